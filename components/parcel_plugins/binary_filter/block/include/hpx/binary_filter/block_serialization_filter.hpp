@@ -0,0 +1,163 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_LZ4) || defined(HPX_HAVE_COMPRESSION_ZSTD)
+#include <hpx/modules/serialization.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::plugins::compression {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Settings shared by all instances of a block compression filter type,
+    // read from the section [hpx.plugins.<filter name>].
+    struct HPX_LIBRARY_EXPORT block_compression_config
+    {
+        explicit block_compression_config(char const* section);
+
+        // the data is split into blocks of at most this many bytes
+        std::size_t block_size_;
+
+        // blocks smaller than this are sent uncompressed (by default 1024
+        // bytes, 64 bytes if a dictionary is configured)
+        std::size_t min_size_;
+
+        // blocks with a higher estimated entropy (in bits per byte) are
+        // considered to be incompressible and are sent uncompressed
+        double max_entropy_;
+
+        // codec specific compression level
+        int level_;
+
+        // send blocks uncompressed while compressing is slower than sending
+        bool bypass_;
+
+        // the contents of the (pre-trained) dictionary, if any
+        std::string dictionary_;
+
+        // hash of the dictionary contents, zero if there is no dictionary
+        std::uint32_t dictionary_id_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Statistics collected for all instances of a block compression filter
+    // type, exposed as performance counters.
+    struct HPX_LIBRARY_EXPORT block_compression_statistics
+    {
+        block_compression_statistics() noexcept;
+
+        // size of the transmitted data relative to its original size, in
+        // 0.01%
+        std::int64_t get_ratio(bool reset);
+
+        std::int64_t get_compressed_blocks(bool reset);
+        std::int64_t get_stored_blocks(bool reset);
+        std::int64_t get_compression_time(bool reset);
+        std::int64_t get_decompression_time(bool reset);
+
+        std::atomic<std::int64_t> original_bytes_;
+        std::atomic<std::int64_t> transmitted_bytes_;
+        std::atomic<std::int64_t> compressed_blocks_;
+        std::atomic<std::int64_t> stored_blocks_;
+        std::atomic<std::int64_t> compression_time_;      // [ns]
+        std::atomic<std::int64_t> decompression_time_;    // [ns]
+
+        // Decide whether a block should be sent uncompressed because the
+        // measured compression throughput is lower than the rate at which
+        // the parcelport sends data. Every 64th of these blocks is compressed
+        // nevertheless to keep the measured throughput up to date.
+        bool bypass_compression();
+
+        // the throughput of the compressor and of the parcelport (bytes per
+        // second), zero if not known yet
+        std::int64_t get_compression_rate() const noexcept;
+        std::int64_t get_send_rate();
+
+        std::atomic<std::int64_t> compressor_bytes_;
+        std::atomic<std::int64_t> compressor_time_;    // [ns]
+        std::atomic<std::int64_t> send_rate_;
+        std::atomic<std::int64_t> send_rate_timestamp_;    // [ns]
+        std::atomic<std::int64_t> slow_blocks_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Common base class for filters compressing the serialized data block by
+    // block. Each block is compressed only if it is large enough, if its
+    // estimated entropy indicates that compressing it will pay off, and if
+    // compressing is not slower than sending the data. Otherwise, or if the
+    // compressed block would not be smaller, it is stored as is.
+    //
+    // The generated stream is a sequence of blocks, each of which consists of
+    // a block_header followed by the (possibly compressed) block data.
+    struct HPX_LIBRARY_EXPORT block_serialization_filter
+      : public serialization::binary_filter
+    {
+        struct block_header
+        {
+            std::uint32_t size;               // original size of the block
+            std::uint32_t compressed_size;    // zero if the block is stored
+            std::uint32_t dictionary_id;      // dictionary used by the sender
+        };
+
+        void load(void* dst, std::size_t dst_count) override;
+        void save(void const* src, std::size_t src_count) override;
+        bool flush(
+            void* dst, std::size_t dst_count, std::size_t& written) override;
+        std::size_t get_max_compressed_length(
+            std::size_t size) const noexcept override;
+
+        void set_max_length(std::size_t size) override;
+        std::size_t init_data(void const* buffer, std::size_t size,
+            std::size_t buffer_size) override;
+
+        // Estimate the (order-0) entropy of the given data in bits per byte
+        // based on a sample of at most 4 KiB.
+        static double estimate_entropy(char const* data, std::size_t size);
+
+    protected:
+        block_serialization_filter(bool compress,
+            block_compression_config const& config,
+            block_compression_statistics& statistics) noexcept;
+
+        // Upper bound of the compressed size of a block of the given size
+        virtual std::size_t max_compressed_size(std::size_t size) const = 0;
+
+        // Compress a block, return the compressed size or zero on failure
+        virtual std::size_t compress_block(char const* src, std::size_t size,
+            char* dst, std::size_t dst_size) = 0;
+
+        // Decompress a block, return false on failure
+        virtual bool decompress_block(char const* src, std::size_t size,
+            char* dst, std::size_t dst_size) = 0;
+
+        block_compression_config const& config_;
+
+    private:
+        bool should_compress(char const* data, std::size_t size);
+        void compress_all();
+
+        block_compression_statistics& statistics_;
+        std::vector<char> buffer_;
+        std::vector<char> compressed_;
+        std::size_t current_;
+        bool compressed_data_valid_;
+    };
+}    // namespace hpx::plugins::compression
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -0,0 +1,55 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/binary_filter/lz4_serialization_filter_registration.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_LZ4)
+#include <hpx/binary_filter/block_serialization_filter.hpp>
+#include <hpx/modules/serialization.hpp>
+
+#include <cstddef>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::plugins::compression {
+
+    struct HPX_LIBRARY_EXPORT lz4_serialization_filter
+      : public block_serialization_filter
+    {
+        explicit lz4_serialization_filter(bool compress = false,
+            serialization::binary_filter* next_filter = nullptr);
+
+        // settings and statistics shared by all instances
+        static block_compression_config const& get_config();
+        static block_compression_statistics& get_statistics() noexcept;
+
+    protected:
+        std::size_t max_compressed_size(std::size_t size) const override;
+        std::size_t compress_block(char const* src, std::size_t size,
+            char* dst, std::size_t dst_size) override;
+        bool decompress_block(char const* src, std::size_t size, char* dst,
+            std::size_t dst_size) override;
+
+    private:
+        // serialization support
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        HPX_FORCEINLINE void serialize(Archive& ar, const unsigned int)
+        {
+        }
+
+        HPX_SERIALIZATION_POLYMORPHIC(lz4_serialization_filter, override);
+    };
+}    // namespace hpx::plugins::compression
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
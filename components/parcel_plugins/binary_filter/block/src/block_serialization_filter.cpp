@@ -0,0 +1,512 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_LZ4) || defined(HPX_HAVE_COMPRESSION_ZSTD)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/modules/util.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <hpx/binary_filter/block_serialization_filter.hpp>
+#include <hpx/plugin_factories/binary_filter_factory.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_COUNTERS)
+#include <hpx/parcelset/parcelhandler.hpp>
+#include <hpx/parcelset_base/parcelport.hpp>
+#include <hpx/runtime_distributed.hpp>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+// All block compression filters live in this module.
+HPX_REGISTER_PLUGIN_MODULE_DYNAMIC()
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::plugins::compression {
+
+    namespace {
+
+        template <typename T>
+        T get_entry(std::string const& section, char const* key, T dflt)
+        {
+            return hpx::util::from_string<T>(
+                hpx::get_config_entry(
+                    section + "." + key, std::to_string(dflt)),
+                dflt);
+        }
+
+        std::string read_dictionary(std::string const& filename)
+        {
+            if (filename.empty())
+                return std::string();
+
+            std::ifstream in(filename, std::ios::in | std::ios::binary);
+            if (!in)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "block_compression_config::block_compression_config",
+                    "could not open compression dictionary: {}", filename);
+            }
+            return std::string(std::istreambuf_iterator<char>(in),
+                std::istreambuf_iterator<char>());
+        }
+
+        // 32 bit FNV-1a hash, never zero for a non-empty dictionary
+        std::uint32_t get_dictionary_id(std::string const& dictionary) noexcept
+        {
+            if (dictionary.empty())
+                return 0;
+
+            std::uint32_t hash = 2166136261u;
+            for (char c : dictionary)
+            {
+                hash ^= static_cast<std::uint8_t>(c);
+                hash *= 16777619u;
+            }
+            return hash != 0 ? hash : 1;
+        }
+
+        // the send rate of the parcelport is sampled at most this often
+        inline constexpr std::int64_t send_rate_interval = 100000000;    // [ns]
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    block_compression_config::block_compression_config(char const* section)
+      : block_size_(get_entry<std::size_t>(section, "block_size", 1048576))
+      , min_size_(0)
+      , max_entropy_(get_entry<double>(section, "max_entropy", 7.0))
+      , level_(get_entry<int>(section, "level", 1))
+      , bypass_(get_entry<int>(section, "bypass", 1) != 0)
+      , dictionary_(read_dictionary(
+            hpx::get_config_entry(std::string(section) + ".dictionary", "")))
+      , dictionary_id_(get_dictionary_id(dictionary_))
+    {
+        // with a dictionary even small blocks compress well, the default
+        // minimal size is much lower in this case
+        min_size_ = get_entry<std::size_t>(
+            section, "min_size", dictionary_.empty() ? 1024 : 64);
+
+        // the size of a block has to be representable in its header
+        block_size_ = (std::clamp)(block_size_, std::size_t(1),
+            std::size_t((std::numeric_limits<std::uint32_t>::max)()));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    block_compression_statistics::block_compression_statistics() noexcept
+      : original_bytes_(0)
+      , transmitted_bytes_(0)
+      , compressed_blocks_(0)
+      , stored_blocks_(0)
+      , compression_time_(0)
+      , decompression_time_(0)
+      , compressor_bytes_(0)
+      , compressor_time_(0)
+      , send_rate_(0)
+      , send_rate_timestamp_(0)
+      , slow_blocks_(0)
+    {
+    }
+
+    std::int64_t block_compression_statistics::get_ratio(bool reset)
+    {
+        std::int64_t const original =
+            util::get_and_reset_value(original_bytes_, reset);
+        std::int64_t const transmitted =
+            util::get_and_reset_value(transmitted_bytes_, reset);
+        if (original == 0)
+            return 0;
+        return transmitted * 10000 / original;
+    }
+
+    std::int64_t block_compression_statistics::get_compressed_blocks(
+        bool reset)
+    {
+        return util::get_and_reset_value(compressed_blocks_, reset);
+    }
+
+    std::int64_t block_compression_statistics::get_stored_blocks(bool reset)
+    {
+        return util::get_and_reset_value(stored_blocks_, reset);
+    }
+
+    std::int64_t block_compression_statistics::get_compression_time(bool reset)
+    {
+        return util::get_and_reset_value(compression_time_, reset);
+    }
+
+    std::int64_t block_compression_statistics::get_decompression_time(
+        bool reset)
+    {
+        return util::get_and_reset_value(decompression_time_, reset);
+    }
+
+    std::int64_t block_compression_statistics::get_compression_rate()
+        const noexcept
+    {
+        std::int64_t const time =
+            compressor_time_.load(std::memory_order_relaxed);
+        if (time == 0)
+            return 0;
+        return static_cast<std::int64_t>(
+            double(compressor_bytes_.load(std::memory_order_relaxed)) * 1e9 /
+            double(time));
+    }
+
+    // The parcelport measures the time from starting to write a message
+    // until its completion, relating it to the number of bytes sent yields
+    // the rate at which a message is put on the wire. The rate is unknown if
+    // the parcelport counters are disabled.
+    std::int64_t block_compression_statistics::get_send_rate()
+    {
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        auto const now = static_cast<std::int64_t>(
+            hpx::chrono::high_resolution_clock::now());
+        std::int64_t last =
+            send_rate_timestamp_.load(std::memory_order_relaxed);
+        if (now - last >= send_rate_interval &&
+            send_rate_timestamp_.compare_exchange_strong(
+                last, now, std::memory_order_relaxed))
+        {
+            runtime_distributed* rt = get_runtime_distributed_ptr();
+            if (rt != nullptr)
+            {
+                std::shared_ptr<parcelset::parcelport> const pp =
+                    rt->get_parcel_handler().get_bootstrap_parcelport();
+                if (pp)
+                {
+                    std::int64_t const bytes = pp->get_data_sent(false);
+                    std::int64_t const time = pp->get_sending_time(false);
+                    if (time != 0)
+                    {
+                        send_rate_.store(
+                            static_cast<std::int64_t>(
+                                double(bytes) * 1e9 / double(time)),
+                            std::memory_order_relaxed);
+                    }
+                }
+            }
+        }
+#endif
+        return send_rate_.load(std::memory_order_relaxed);
+    }
+
+    bool block_compression_statistics::bypass_compression()
+    {
+        std::int64_t const compression_rate = get_compression_rate();
+        if (compression_rate == 0)
+            return false;
+
+        std::int64_t const send_rate = get_send_rate();
+        if (send_rate == 0 || compression_rate >= send_rate)
+            return false;
+
+        return slow_blocks_.fetch_add(1, std::memory_order_relaxed) % 64 != 0;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    block_serialization_filter::block_serialization_filter(bool /* compress */,
+        block_compression_config const& config,
+        block_compression_statistics& statistics) noexcept
+      : config_(config)
+      , statistics_(statistics)
+      , current_(0)
+      , compressed_data_valid_(false)
+    {
+    }
+
+    double block_serialization_filter::estimate_entropy(
+        char const* data, std::size_t size)
+    {
+        constexpr std::size_t sample_size = 4096;
+        constexpr std::size_t slice_size = 64;
+
+        std::array<std::size_t, 256> counts = {};
+        std::size_t num_samples = 0;
+
+        if (size <= sample_size)
+        {
+            for (std::size_t i = 0; i != size; ++i)
+                ++counts[static_cast<std::uint8_t>(data[i])];
+            num_samples = size;
+        }
+        else
+        {
+            // sample contiguous slices spread over the whole block, this
+            // preserves the byte distribution of structured data better than
+            // sampling single bytes
+            constexpr std::size_t num_slices = sample_size / slice_size;
+            std::size_t const stride = size / num_slices;
+            for (std::size_t slice = 0; slice != num_slices; ++slice)
+            {
+                char const* begin = data + slice * stride;
+                for (std::size_t i = 0; i != slice_size; ++i)
+                    ++counts[static_cast<std::uint8_t>(begin[i])];
+            }
+            num_samples = sample_size;
+        }
+
+        if (num_samples == 0)
+            return 0.0;
+
+        double entropy = 0.0;
+        for (std::size_t count : counts)
+        {
+            if (count != 0)
+            {
+                double const p = double(count) / double(num_samples);
+                entropy -= p * std::log2(p);
+            }
+        }
+        return entropy;
+    }
+
+    bool block_serialization_filter::should_compress(
+        char const* data, std::size_t size)
+    {
+        if (size < config_.min_size_)
+            return false;
+
+        // the entropy can't exceed 8 bits per byte, don't bother estimating
+        if (config_.max_entropy_ < 8.0 &&
+            estimate_entropy(data, size) > config_.max_entropy_)
+        {
+            return false;
+        }
+
+        return !config_.bypass_ || !statistics_.bypass_compression();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void block_serialization_filter::set_max_length(std::size_t size)
+    {
+        buffer_.reserve(size);
+    }
+
+    void block_serialization_filter::save(
+        void const* src, std::size_t src_count)
+    {
+        char const* src_begin = static_cast<char const*>(src);
+        buffer_.insert(buffer_.end(), src_begin, src_begin + src_count);
+        compressed_data_valid_ = false;
+    }
+
+    void block_serialization_filter::compress_all()
+    {
+        hpx::chrono::high_resolution_timer timer;
+
+        std::int64_t compressed_blocks = 0;
+        std::int64_t stored_blocks = 0;
+
+        compressed_.clear();
+        compressed_.reserve(buffer_.size() + sizeof(block_header));
+
+        for (std::size_t pos = 0; pos != buffer_.size(); /**/)
+        {
+            std::size_t const size =
+                (std::min)(buffer_.size() - pos, config_.block_size_);
+            char const* block = buffer_.data() + pos;
+
+            block_header header = {
+                static_cast<std::uint32_t>(size), 0, config_.dictionary_id_};
+
+            std::size_t const header_pos = compressed_.size();
+            if (should_compress(block, size))
+            {
+                std::size_t const max_size = max_compressed_size(size);
+                compressed_.resize(
+                    header_pos + sizeof(block_header) + max_size);
+
+                hpx::chrono::high_resolution_timer block_timer;
+
+                std::size_t const compressed_size = compress_block(block, size,
+                    compressed_.data() + header_pos + sizeof(block_header),
+                    max_size);
+
+                statistics_.compressor_bytes_.fetch_add(
+                    static_cast<std::int64_t>(size), std::memory_order_relaxed);
+                statistics_.compressor_time_.fetch_add(
+                    static_cast<std::int64_t>(
+                        block_timer.elapsed_nanoseconds()),
+                    std::memory_order_relaxed);
+
+                // keep the compressed block only if it is actually smaller
+                if (compressed_size != 0 && compressed_size < size)
+                {
+                    header.compressed_size =
+                        static_cast<std::uint32_t>(compressed_size);
+                    compressed_.resize(
+                        header_pos + sizeof(block_header) + compressed_size);
+                }
+            }
+
+            if (header.compressed_size == 0)
+            {
+                compressed_.resize(header_pos + sizeof(block_header));
+                compressed_.insert(compressed_.end(), block, block + size);
+                ++stored_blocks;
+            }
+            else
+            {
+                ++compressed_blocks;
+            }
+
+            std::memcpy(
+                compressed_.data() + header_pos, &header, sizeof(block_header));
+            pos += size;
+        }
+
+        compressed_data_valid_ = true;
+
+        statistics_.original_bytes_.fetch_add(
+            static_cast<std::int64_t>(buffer_.size()),
+            std::memory_order_relaxed);
+        statistics_.transmitted_bytes_.fetch_add(
+            static_cast<std::int64_t>(compressed_.size()),
+            std::memory_order_relaxed);
+        statistics_.compressed_blocks_.fetch_add(
+            compressed_blocks, std::memory_order_relaxed);
+        statistics_.stored_blocks_.fetch_add(
+            stored_blocks, std::memory_order_relaxed);
+        statistics_.compression_time_.fetch_add(
+            static_cast<std::int64_t>(timer.elapsed_nanoseconds()),
+            std::memory_order_relaxed);
+    }
+
+    std::size_t block_serialization_filter::get_max_compressed_length(
+        std::size_t size) const noexcept
+    {
+        // compressed blocks are kept only if they are smaller than the
+        // original data, thus each block adds at most its header
+        std::size_t const num_blocks =
+            (size + config_.block_size_ - 1) / config_.block_size_;
+        return size + num_blocks * sizeof(block_header);
+    }
+
+    bool block_serialization_filter::flush(
+        void* dst, std::size_t dst_count, std::size_t& written)
+    {
+        // the container calls this again after growing the destination,
+        // compress the data only once
+        if (!compressed_data_valid_)
+            compress_all();
+
+        if (compressed_.size() > dst_count)
+        {
+            written = 0;
+            return false;
+        }
+
+        if (!compressed_.empty())
+            std::memcpy(dst, compressed_.data(), compressed_.size());
+
+        written = compressed_.size();
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t block_serialization_filter::init_data(
+        void const* buffer, std::size_t size, std::size_t buffer_size)
+    {
+        hpx::chrono::high_resolution_timer timer;
+
+        char const* src = static_cast<char const*>(buffer);
+
+        buffer_.clear();
+        buffer_.reserve(buffer_size);
+
+        for (std::size_t pos = 0; pos != size; /**/)
+        {
+            block_header header;
+            if (size - pos < sizeof(block_header))
+            {
+                HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                    "block_serialization_filter::init_data",
+                    "archive data bstream is too short");
+            }
+            std::memcpy(&header, src + pos, sizeof(block_header));
+            pos += sizeof(block_header);
+
+            std::size_t const stored_size = header.compressed_size != 0 ?
+                header.compressed_size :
+                header.size;
+            if (size - pos < stored_size ||
+                buffer_size - buffer_.size() < header.size)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                    "block_serialization_filter::init_data",
+                    "archive data bstream is too short");
+            }
+
+            if (header.compressed_size == 0)
+            {
+                buffer_.insert(
+                    buffer_.end(), src + pos, src + pos + stored_size);
+            }
+            else
+            {
+                // the receiver has to use the dictionary of the sender
+                if (header.dictionary_id != config_.dictionary_id_)
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                        "block_serialization_filter::init_data",
+                        "block was compressed using dictionary {:08x}, but "
+                        "dictionary {:08x} is configured (ids are hashes of "
+                        "the dictionary contents, 0 means no dictionary)",
+                        header.dictionary_id, config_.dictionary_id_);
+                }
+
+                std::size_t const offset = buffer_.size();
+                buffer_.resize(offset + header.size);
+                if (!decompress_block(src + pos, stored_size,
+                        buffer_.data() + offset, header.size))
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                        "block_serialization_filter::init_data",
+                        "decompression failure, corrupted block of {} bytes",
+                        stored_size);
+                }
+            }
+            pos += stored_size;
+        }
+
+        current_ = 0;
+
+        statistics_.decompression_time_.fetch_add(
+            static_cast<std::int64_t>(timer.elapsed_nanoseconds()),
+            std::memory_order_relaxed);
+
+        return buffer_.size();
+    }
+
+    void block_serialization_filter::load(void* dst, std::size_t dst_count)
+    {
+        if (current_ + dst_count > buffer_.size())
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "block_serialization_filter::load",
+                "archive data bstream is too short");
+        }
+
+        std::memcpy(dst, &buffer_[current_], dst_count);
+        current_ += dst_count;
+    }
+}    // namespace hpx::plugins::compression
+
+#endif
@@ -0,0 +1,180 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_LZ4)
+#include <hpx/binary_filter/lz4_serialization_filter.hpp>
+#include <hpx/plugin/traits/plugin_config_data.hpp>
+#include <hpx/plugin_factories/binary_filter_factory.hpp>
+#include <hpx/plugin_factories/plugin_registry.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+#include <lz4.h>
+
+namespace hpx::traits {
+
+    // Inject additional configuration data into the factory registry for this
+    // type. This information ends up in the system wide configuration database
+    // under the plugin specific section:
+    //
+    //      [hpx.plugins.lz4_serialization_filter]
+    //      ...
+    //      block_size = 1048576
+    //      max_entropy = 7.0
+    //      level = 1
+    //      bypass = 1
+    //      dictionary =
+    //
+    // The size below which blocks are sent uncompressed (min_size) is not set
+    // here, it defaults to 1024 bytes, or to 64 bytes if a dictionary is
+    // configured.
+    //
+    // For LZ4 the level is used as the acceleration factor, larger values
+    // trade compression ratio for speed.
+    template <>
+    struct plugin_config_data<
+        hpx::plugins::compression::lz4_serialization_filter>
+    {
+        static constexpr char const* call() noexcept
+        {
+            return "block_size = 1048576\n"
+                   "max_entropy = 7.0\n"
+                   "level = 1\n"
+                   "bypass = 1\n"
+                   "dictionary = ";
+        }
+    };
+}    // namespace hpx::traits
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_BINARY_FILTER_FACTORY(
+    hpx::plugins::compression::lz4_serialization_filter,
+    lz4_serialization_filter);
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::plugins::compression {
+
+    namespace {
+
+        // Loading the dictionary requires hashing its contents, this is done
+        // once and the resulting stream state is copied for each block.
+        struct lz4_dictionary
+        {
+            explicit lz4_dictionary(std::string const& dictionary) noexcept
+            {
+                LZ4_initStream(&stream_, sizeof(stream_));
+                if (!dictionary.empty())
+                {
+                    LZ4_loadDict(&stream_, dictionary.data(),
+                        static_cast<int>(dictionary.size()));
+                }
+            }
+
+            LZ4_stream_t stream_;
+        };
+
+        lz4_dictionary const& get_dictionary()
+        {
+            static lz4_dictionary const dictionary(
+                lz4_serialization_filter::get_config().dictionary_);
+            return dictionary;
+        }
+
+        // The compression state is too large to be placed on the stack of an
+        // HPX thread. Compressing a block does not suspend the calling thread,
+        // thus a state per OS thread is sufficient.
+        LZ4_stream_t& get_stream() noexcept
+        {
+            static thread_local LZ4_stream_t stream;
+            return stream;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    lz4_serialization_filter::lz4_serialization_filter(
+        bool compress, serialization::binary_filter* /* next_filter */)
+      : block_serialization_filter(compress, get_config(), get_statistics())
+    {
+    }
+
+    block_compression_config const& lz4_serialization_filter::get_config()
+    {
+        static block_compression_config const config(
+            "hpx.plugins.lz4_serialization_filter");
+        return config;
+    }
+
+    block_compression_statistics&
+    lz4_serialization_filter::get_statistics() noexcept
+    {
+        static block_compression_statistics statistics;
+        return statistics;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t lz4_serialization_filter::max_compressed_size(
+        std::size_t size) const
+    {
+        if (size > LZ4_MAX_INPUT_SIZE)
+            return 0;
+        return static_cast<std::size_t>(
+            LZ4_compressBound(static_cast<int>(size)));
+    }
+
+    std::size_t lz4_serialization_filter::compress_block(
+        char const* src, std::size_t size, char* dst, std::size_t dst_size)
+    {
+        if (size > LZ4_MAX_INPUT_SIZE || dst_size == 0)
+            return 0;
+
+        int const acceleration = (std::max)(config_.level_, 1);
+        LZ4_stream_t& stream = get_stream();
+
+        int result = 0;
+        if (config_.dictionary_.empty())
+        {
+            result = LZ4_compress_fast_extState(&stream, src, dst,
+                static_cast<int>(size), static_cast<int>(dst_size),
+                acceleration);
+        }
+        else
+        {
+            std::memcpy(&stream, &get_dictionary().stream_, sizeof(stream));
+            result = LZ4_compress_fast_continue(&stream, src, dst,
+                static_cast<int>(size), static_cast<int>(dst_size),
+                acceleration);
+        }
+
+        return result > 0 ? static_cast<std::size_t>(result) : 0;
+    }
+
+    bool lz4_serialization_filter::decompress_block(
+        char const* src, std::size_t size, char* dst, std::size_t dst_size)
+    {
+        int result = 0;
+        if (config_.dictionary_.empty())
+        {
+            result = LZ4_decompress_safe(src, dst, static_cast<int>(size),
+                static_cast<int>(dst_size));
+        }
+        else
+        {
+            result = LZ4_decompress_safe_usingDict(src, dst,
+                static_cast<int>(size), static_cast<int>(dst_size),
+                config_.dictionary_.data(),
+                static_cast<int>(config_.dictionary_.size()));
+        }
+
+        return result >= 0 && static_cast<std::size_t>(result) == dst_size;
+    }
+}    // namespace hpx::plugins::compression
+
+#endif
@@ -0,0 +1,161 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_LZ4) || defined(HPX_HAVE_COMPRESSION_ZSTD)
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/runtime_local.hpp>
+
+#include <hpx/binary_filter/block_serialization_filter.hpp>
+#include <hpx/components_base/component_startup_shutdown.hpp>
+#include <hpx/performance_counters/counter_creators.hpp>
+#include <hpx/performance_counters/counters.hpp>
+#include <hpx/performance_counters/manage_counter_type.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_LZ4)
+#include <hpx/binary_filter/lz4_serialization_filter.hpp>
+#endif
+#if defined(HPX_HAVE_COMPRESSION_ZSTD)
+#include <hpx/binary_filter/zstd_serialization_filter.hpp>
+#endif
+
+#include <cstdint>
+#include <string>
+
+namespace hpx::plugins::compression {
+
+    namespace {
+
+        hpx::function<std::int64_t(bool)> counter_function(
+            std::int64_t (block_compression_statistics::*f)(bool),
+            block_compression_statistics& statistics)
+        {
+            return hpx::bind_front(f, &statistics);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void register_counter_types(
+            std::string const& codec, block_compression_statistics& statistics)
+        {
+            using namespace hpx::performance_counters;
+            using hpx::placeholders::_1;
+            using hpx::placeholders::_2;
+
+            generic_counter_type_data const counter_types[] = {
+                // /compression(locality#<locality_id>/total)/count/<codec>/...
+                {hpx::util::format("/compression/count/{}/ratio", codec),
+                    counter_type::raw,
+                    hpx::util::format(
+                        "returns the size of the data transmitted by the {} "
+                        "compression filter relative to its original size",
+                        codec),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(&locality_raw_counter_creator, _1,
+                        counter_function(
+                            &block_compression_statistics::get_ratio,
+                            statistics),
+                        _2),
+                    &locality_counter_discoverer, "0.01%"},
+                {hpx::util::format(
+                     "/compression/count/{}/compressed-blocks", codec),
+                    counter_type::monotonically_increasing,
+                    hpx::util::format(
+                        "returns the number of blocks compressed by the {} "
+                        "compression filter",
+                        codec),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(&locality_raw_counter_creator, _1,
+                        counter_function(
+                            &block_compression_statistics::
+                                get_compressed_blocks,
+                            statistics),
+                        _2),
+                    &locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/compression/count/{}/stored-blocks", codec),
+                    counter_type::monotonically_increasing,
+                    hpx::util::format(
+                        "returns the number of blocks the {} compression "
+                        "filter sent uncompressed as compressing them was not "
+                        "expected to pay off",
+                        codec),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(&locality_raw_counter_creator, _1,
+                        counter_function(
+                            &block_compression_statistics::get_stored_blocks,
+                            statistics),
+                        _2),
+                    &locality_counter_discoverer, ""},
+                {hpx::util::format("/compression/time/{}/compress", codec),
+                    counter_type::monotonically_increasing,
+                    hpx::util::format(
+                        "returns the overall time spent compressing data "
+                        "using the {} compression filter",
+                        codec),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(&locality_raw_counter_creator, _1,
+                        counter_function(
+                            &block_compression_statistics::
+                                get_compression_time,
+                            statistics),
+                        _2),
+                    &locality_counter_discoverer, "ns"},
+                {hpx::util::format("/compression/time/{}/decompress", codec),
+                    counter_type::monotonically_increasing,
+                    hpx::util::format(
+                        "returns the overall time spent decompressing data "
+                        "using the {} compression filter",
+                        codec),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(&locality_raw_counter_creator, _1,
+                        counter_function(
+                            &block_compression_statistics::
+                                get_decompression_time,
+                            statistics),
+                        _2),
+                    &locality_counter_discoverer, "ns"}};
+
+            // Install the counter types, un-installation of the types is
+            // handled automatically.
+            install_counter_types(counter_types,
+                sizeof(counter_types) / sizeof(counter_types[0]));
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void startup()
+    {
+#if defined(HPX_HAVE_COMPRESSION_LZ4)
+        register_counter_types(
+            "lz4", lz4_serialization_filter::get_statistics());
+#endif
+#if defined(HPX_HAVE_COMPRESSION_ZSTD)
+        register_counter_types(
+            "zstd", zstd_serialization_filter::get_statistics());
+#endif
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool get_startup(
+        hpx::startup_function_type& startup_func, bool& pre_startup)
+    {
+        startup_func = startup;    // function to run during startup
+        pre_startup = true;        // run 'startup' as pre-startup function
+        return true;
+    }
+}    // namespace hpx::plugins::compression
+
+///////////////////////////////////////////////////////////////////////////////
+// Register a startup function which will be called as a HPX-thread during
+// runtime startup. We use this function to register our performance counter
+// types.
+//
+// Note that this macro can be used not more than once in one module.
+HPX_REGISTER_STARTUP_MODULE_DYNAMIC(hpx::plugins::compression::get_startup)
+
+#endif
@@ -0,0 +1,186 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_ZSTD)
+#include <hpx/binary_filter/zstd_serialization_filter.hpp>
+#include <hpx/plugin/traits/plugin_config_data.hpp>
+#include <hpx/plugin_factories/binary_filter_factory.hpp>
+#include <hpx/plugin_factories/plugin_registry.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include <zstd.h>
+
+namespace hpx::traits {
+
+    // Inject additional configuration data into the factory registry for this
+    // type. This information ends up in the system wide configuration database
+    // under the plugin specific section:
+    //
+    //      [hpx.plugins.zstd_serialization_filter]
+    //      ...
+    //      block_size = 1048576
+    //      max_entropy = 7.0
+    //      level = 1
+    //      bypass = 1
+    //      dictionary =
+    //
+    // The size below which blocks are sent uncompressed (min_size) is not set
+    // here, it defaults to 1024 bytes, or to 64 bytes if a dictionary is
+    // configured.
+    template <>
+    struct plugin_config_data<
+        hpx::plugins::compression::zstd_serialization_filter>
+    {
+        static constexpr char const* call() noexcept
+        {
+            return "block_size = 1048576\n"
+                   "max_entropy = 7.0\n"
+                   "level = 1\n"
+                   "bypass = 1\n"
+                   "dictionary = ";
+        }
+    };
+}    // namespace hpx::traits
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_BINARY_FILTER_FACTORY(
+    hpx::plugins::compression::zstd_serialization_filter,
+    zstd_serialization_filter);
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::plugins::compression {
+
+    namespace {
+
+        // The digested dictionaries are created once and shared by all
+        // threads.
+        struct zstd_dictionaries
+        {
+            explicit zstd_dictionaries(
+                block_compression_config const& config) noexcept
+              : cdict_(nullptr)
+              , ddict_(nullptr)
+            {
+                if (!config.dictionary_.empty())
+                {
+                    cdict_ = ZSTD_createCDict(config.dictionary_.data(),
+                        config.dictionary_.size(), config.level_);
+                    ddict_ = ZSTD_createDDict(
+                        config.dictionary_.data(), config.dictionary_.size());
+                }
+            }
+
+            ~zstd_dictionaries()
+            {
+                ZSTD_freeCDict(cdict_);
+                ZSTD_freeDDict(ddict_);
+            }
+
+            zstd_dictionaries(zstd_dictionaries const&) = delete;
+            zstd_dictionaries& operator=(zstd_dictionaries const&) = delete;
+
+            ZSTD_CDict* cdict_;
+            ZSTD_DDict* ddict_;
+        };
+
+        zstd_dictionaries const& get_dictionaries()
+        {
+            static zstd_dictionaries const dictionaries(
+                zstd_serialization_filter::get_config());
+            return dictionaries;
+        }
+
+        // Creating a context is expensive. Compressing a block does not
+        // suspend the calling thread, thus a context per OS thread is
+        // sufficient.
+        ZSTD_CCtx* get_compression_context()
+        {
+            using context_ptr =
+                std::unique_ptr<ZSTD_CCtx, std::size_t (*)(ZSTD_CCtx*)>;
+            static thread_local context_ptr context(
+                ZSTD_createCCtx(), &ZSTD_freeCCtx);
+            return context.get();
+        }
+
+        ZSTD_DCtx* get_decompression_context()
+        {
+            using context_ptr =
+                std::unique_ptr<ZSTD_DCtx, std::size_t (*)(ZSTD_DCtx*)>;
+            static thread_local context_ptr context(
+                ZSTD_createDCtx(), &ZSTD_freeDCtx);
+            return context.get();
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    zstd_serialization_filter::zstd_serialization_filter(
+        bool compress, serialization::binary_filter* /* next_filter */)
+      : block_serialization_filter(compress, get_config(), get_statistics())
+    {
+    }
+
+    block_compression_config const& zstd_serialization_filter::get_config()
+    {
+        static block_compression_config const config(
+            "hpx.plugins.zstd_serialization_filter");
+        return config;
+    }
+
+    block_compression_statistics&
+    zstd_serialization_filter::get_statistics() noexcept
+    {
+        static block_compression_statistics statistics;
+        return statistics;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t zstd_serialization_filter::max_compressed_size(
+        std::size_t size) const
+    {
+        return ZSTD_compressBound(size);
+    }
+
+    std::size_t zstd_serialization_filter::compress_block(
+        char const* src, std::size_t size, char* dst, std::size_t dst_size)
+    {
+        ZSTD_CCtx* context = get_compression_context();
+        if (context == nullptr)
+            return 0;
+
+        ZSTD_CDict const* cdict = get_dictionaries().cdict_;
+
+        std::size_t const result = cdict != nullptr ?
+            ZSTD_compress_usingCDict(context, dst, dst_size, src, size, cdict) :
+            ZSTD_compressCCtx(
+                context, dst, dst_size, src, size, config_.level_);
+
+        return ZSTD_isError(result) ? 0 : result;
+    }
+
+    bool zstd_serialization_filter::decompress_block(
+        char const* src, std::size_t size, char* dst, std::size_t dst_size)
+    {
+        ZSTD_DCtx* context = get_decompression_context();
+        if (context == nullptr)
+            return false;
+
+        ZSTD_DDict const* ddict = get_dictionaries().ddict_;
+
+        std::size_t const result = ddict != nullptr ?
+            ZSTD_decompress_usingDDict(
+                context, dst, dst_size, src, size, ddict) :
+            ZSTD_decompressDCtx(context, dst, dst_size, src, size);
+
+        return !ZSTD_isError(result) && result == dst_size;
+    }
+}    // namespace hpx::plugins::compression
+
+#endif
@@ -35,6 +35,8 @@ namespace hpx::plugins::compression {
         void save(void const* src, std::size_t src_count) override;
         bool flush(
             void* dst, std::size_t dst_count, std::size_t& written) override;
+        std::size_t get_max_compressed_length(
+            std::size_t size) const noexcept override;
 
         void set_max_length(std::size_t size) override;
         std::size_t init_data(void const* buffer, std::size_t size,
@@ -69,6 +69,12 @@ namespace hpx::plugins::compression {
     }
 
     ///////////////////////////////////////////////////////////////////////////
+    std::size_t snappy_serialization_filter::get_max_compressed_length(
+        std::size_t size) const noexcept
+    {
+        return snappy::MaxCompressedLength(size);
+    }
+
     bool snappy_serialization_filter::flush(
         void* dst, std::size_t dst_count, std::size_t& written)
     {
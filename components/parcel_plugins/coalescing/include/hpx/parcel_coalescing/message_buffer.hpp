@@ -164,6 +164,12 @@ namespace hpx::plugins::parcel::detail {
             return max_messages_;
         }
 
+        parcelset::write_handler_type& last_handler()
+        {
+            HPX_ASSERT(!handlers_.empty());
+            return handlers_.back();
+        }
+
     private:
         parcelset::locality dest_;
         std::vector<parcelset::parcel> messages_;
@@ -58,6 +58,8 @@ namespace hpx::plugins::parcel {
         std::int64_t get_average_time_between_parcels(bool reset);
         std::vector<std::int64_t> get_time_between_parcels_histogram(
             bool reset);
+        std::int64_t get_current_interval(bool reset);
+        std::int64_t get_current_num_messages(bool reset);
         void get_time_between_parcels_histogram_creator(
             std::int64_t min_boundary, std::int64_t max_boundary,
             std::int64_t num_buckets,
@@ -74,12 +76,33 @@ namespace hpx::plugins::parcel {
 
         void update_num_messages();
         void update_interval();
+        void update_latency_budget();
+
+        // adaptive mode: feed the measured times into the running averages
+        // and recompute the coalescing parameters
+        void update_arrival_time(std::int64_t time_since_last_parcel);
+        void update_send_latency(std::int64_t latency);
+        void adapt_parameters();
+
+        write_handler_type wrap_write_handler(write_handler_type f);
 
     private:
         mutable mutex_type mtx_;
         parcelset::parcelport* pp_;
         std::size_t num_coalesced_parcels_;
         std::size_t interval_;
+
+        // In adaptive mode the configured number of messages and interval are
+        // upper bounds only, the values used are derived from the measured
+        // parcel arrival rate and send latency such that the (average) time a
+        // parcel spends in the buffer and on the wire stays below the latency
+        // budget (in microseconds).
+        bool adaptive_;
+        std::size_t max_num_coalesced_parcels_;
+        std::size_t max_interval_;
+        std::size_t latency_budget_;
+        std::int64_t average_arrival_time_;    // [ns]
+        std::int64_t average_send_latency_;    // [ns]
         detail::message_buffer buffer_;
         util::pool_timer timer_;
         bool stopped_;
@@ -33,6 +33,8 @@ namespace hpx::plugins::parcel {
         get_counter_type num_parcels, get_counter_type num_messages,
         get_counter_type num_parcels_per_message,
         get_counter_type average_time_between_parcels,
+        get_counter_type current_interval,
+        get_counter_type current_num_messages,
         get_counter_values_creator_type time_between_parcels_histogram_creator)
     {
         if (name.empty())
@@ -49,6 +51,7 @@ namespace hpx::plugins::parcel {
         {
             counter_functions data = {num_parcels, num_messages,
                 num_parcels_per_message, average_time_between_parcels,
+                current_interval, current_num_messages,
                 time_between_parcels_histogram_creator, 0, 0, 1};
 
             map_.emplace(name, HPX_MOVE(data));
@@ -61,6 +64,8 @@ namespace hpx::plugins::parcel {
             (*it).second.num_parcels_per_message = num_parcels_per_message;
             (*it).second.average_time_between_parcels =
                 average_time_between_parcels;
+            (*it).second.current_interval = current_interval;
+            (*it).second.current_num_messages = current_num_messages;
             (*it).second.time_between_parcels_histogram_creator =
                 time_between_parcels_histogram_creator;
 
@@ -78,6 +83,8 @@ namespace hpx::plugins::parcel {
             (void) (*it).second.num_messages;
             (void) (*it).second.num_parcels_per_message;
             (void) (*it).second.average_time_between_parcels;
+            (void) (*it).second.current_interval;
+            (void) (*it).second.current_num_messages;
             (void) (*it).second.time_between_parcels_histogram_creator;
         }
     }
@@ -174,6 +181,43 @@ namespace hpx::plugins::parcel {
         return (*it).second.average_time_between_parcels;
     }
 
+    coalescing_counter_registry::get_counter_type
+    coalescing_counter_registry::get_current_interval_counter(
+        std::string const& name) const
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+
+        map_type::const_iterator it = map_.find(name);
+        if (it == map_.end())
+        {
+            l.unlock();
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "coalescing_counter_registry::get_current_interval_counter",
+                "unknown action type");
+            return get_counter_type();
+        }
+        return (*it).second.current_interval;
+    }
+
+    coalescing_counter_registry::get_counter_type
+    coalescing_counter_registry::get_current_num_messages_counter(
+        std::string const& name) const
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+
+        map_type::const_iterator it = map_.find(name);
+        if (it == map_.end())
+        {
+            l.unlock();
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "coalescing_counter_registry::"
+                "get_current_num_messages_counter",
+                "unknown action type");
+            return get_counter_type();
+        }
+        return (*it).second.current_num_messages;
+    }
+
     coalescing_counter_registry::get_counter_values_type
     coalescing_counter_registry::get_time_between_parcels_histogram_counter(
         std::string const& name, std::int64_t min_boundary,
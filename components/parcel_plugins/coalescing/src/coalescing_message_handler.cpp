@@ -23,11 +23,13 @@
 
 #include <boost/accumulators/accumulators.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <mutex>
 #include <string>
+#include <system_error>
 #include <utility>
 #include <vector>
 
@@ -41,6 +43,8 @@ namespace hpx::traits {
     //      ...
     //      num_messages = 50
     //      interval = 100
+    //      adaptive = 0
+    //      latency_budget = 100
     //
     template <>
     struct plugin_config_data<hpx::plugins::parcel::coalescing_message_handler>
@@ -49,7 +53,9 @@ namespace hpx::traits {
         {
             return "num_messages = 50\n"
                    "interval = 100\n"
-                   "allow_background_flush = 1";
+                   "allow_background_flush = 1\n"
+                   "adaptive = 0\n"
+                   "latency_budget = 100";
         }
     };
 }    // namespace hpx::traits
@@ -84,19 +90,129 @@ namespace hpx::plugins::parcel {
                 "1");
             return !value.empty() && value[0] != '0';
         }
+
+        bool get_adaptive()
+        {
+            std::string value = hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.adaptive", "0");
+            return !value.empty() && value[0] != '0';
+        }
+
+        std::size_t get_latency_budget(std::size_t latency_budget)
+        {
+            return hpx::util::from_string<std::size_t>(hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.latency_budget",
+                latency_budget));
+        }
+
+        // weight of a new sample in the running averages, this is 1/8 as used
+        // for estimating round trip times in TCP
+        constexpr std::int64_t average_weight = 8;
+
+        void update_average(std::int64_t& average, std::int64_t value) noexcept
+        {
+            if (average == 0)
+                average = value;
+            else
+                average += (value - average) / average_weight;
+        }
     }    // namespace detail
 
     void coalescing_message_handler::update_num_messages()
     {
         std::lock_guard<mutex_type> l(mtx_);
-        num_coalesced_parcels_ =
-            detail::get_num_messages(num_coalesced_parcels_);
+        max_num_coalesced_parcels_ =
+            detail::get_num_messages(max_num_coalesced_parcels_);
+        num_coalesced_parcels_ = max_num_coalesced_parcels_;
+        if (adaptive_)
+            adapt_parameters();
     }
 
     void coalescing_message_handler::update_interval()
     {
         std::lock_guard<mutex_type> l(mtx_);
-        interval_ = detail::get_interval(interval_);
+        max_interval_ = detail::get_interval(max_interval_);
+        interval_ = max_interval_;
+        if (adaptive_)
+            adapt_parameters();
+    }
+
+    void coalescing_message_handler::update_latency_budget()
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        latency_budget_ = detail::get_latency_budget(latency_budget_);
+        if (adaptive_)
+            adapt_parameters();
+    }
+
+    // this is called with the lock held
+    void coalescing_message_handler::update_arrival_time(
+        std::int64_t time_since_last_parcel)
+    {
+        // Any time between parcels exceeding the latency budget prevents
+        // coalescing, limiting the samples lets the average recover quickly
+        // once parcels arrive in bursts after an idle period.
+        std::int64_t const latency_budget =
+            static_cast<std::int64_t>(latency_budget_) * 1000;
+        detail::update_average(average_arrival_time_,
+            (std::min)(time_since_last_parcel, latency_budget));
+    }
+
+    void coalescing_message_handler::update_send_latency(std::int64_t latency)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        detail::update_average(average_send_latency_, latency);
+        adapt_parameters();
+    }
+
+    // this is called with the lock held
+    void coalescing_message_handler::adapt_parameters()
+    {
+        // the time a parcel may wait in the buffer is what is left of the
+        // latency budget after sending the message
+        std::int64_t const window =
+            static_cast<std::int64_t>(latency_budget_) * 1000 -
+            average_send_latency_;
+
+        if (average_arrival_time_ == 0 || window <= average_arrival_time_ ||
+            max_num_coalesced_parcels_ <= 1)
+        {
+            // no other parcel is expected to arrive in time, send each parcel
+            // right away
+            num_coalesced_parcels_ = 1;
+            interval_ = 0;
+            return;
+        }
+
+        // coalesce as many parcels as are expected to arrive during the
+        // window, but wait no longer than it takes to collect those
+        std::size_t const num_parcels =
+            (std::min)(static_cast<std::size_t>(window / average_arrival_time_),
+                max_num_coalesced_parcels_);
+        std::size_t const interval = static_cast<std::size_t>(
+            static_cast<std::int64_t>(num_parcels) * average_arrival_time_ /
+            1000);
+
+        num_coalesced_parcels_ = num_parcels;
+        interval_ = (std::max)((std::min)(interval, max_interval_),
+            static_cast<std::size_t>(1));
+    }
+
+    // measure the time it takes until the given parcel has been sent
+    coalescing_message_handler::write_handler_type
+    coalescing_message_handler::wrap_write_handler(write_handler_type f)
+    {
+        std::int64_t const sent_at = hpx::chrono::high_resolution_clock::now();
+        return [this, sent_at, f = HPX_MOVE(f)](
+                   std::error_code const& ec, parcelset::parcel const& p) {
+            if (!ec)
+            {
+                update_send_latency(
+                    hpx::chrono::high_resolution_clock::now() - sent_at);
+            }
+            if (f)
+                f(ec, p);
+        };
     }
 
     coalescing_message_handler::coalescing_message_handler(
@@ -105,6 +221,12 @@ namespace hpx::plugins::parcel {
       : pp_(pp)
       , num_coalesced_parcels_(detail::get_num_messages(num))
       , interval_(detail::get_interval(interval))
+      , adaptive_(detail::get_adaptive())
+      , max_num_coalesced_parcels_(num_coalesced_parcels_)
+      , max_interval_(interval_)
+      , latency_budget_(detail::get_latency_budget(100))
+      , average_arrival_time_(0)
+      , average_send_latency_(0)
       , buffer_(num_coalesced_parcels_)
       , timer_(hpx::bind_back(&coalescing_message_handler::timer_flush, this),
             hpx::bind_back(&coalescing_message_handler::flush_terminate, this),
@@ -137,6 +259,10 @@ namespace hpx::plugins::parcel {
             hpx::bind_front(
                 &coalescing_message_handler::get_average_time_between_parcels,
                 this),
+            hpx::bind_front(
+                &coalescing_message_handler::get_current_interval, this),
+            hpx::bind_front(
+                &coalescing_message_handler::get_current_num_messages, this),
             hpx::bind_front(&coalescing_message_handler::
                                 get_time_between_parcels_histogram_creator,
                 this));
@@ -148,6 +274,15 @@ namespace hpx::plugins::parcel {
         set_config_entry_callback(
             "hpx.plugins.coalescing_message_handler.interval",
             hpx::bind(&coalescing_message_handler::update_interval, this));
+        set_config_entry_callback(
+            "hpx.plugins.coalescing_message_handler.latency_budget",
+            hpx::bind(
+                &coalescing_message_handler::update_latency_budget, this));
+
+        // start out sending parcels right away until enough data has been
+        // collected
+        if (adaptive_)
+            adapt_parameters();
     }
 
     void coalescing_message_handler::put_parcel(parcelset::locality const& dest,
@@ -165,6 +300,12 @@ namespace hpx::plugins::parcel {
         if (time_between_parcels_)
             (*time_between_parcels_)(time_since_last_parcel);
 
+        if (adaptive_)
+        {
+            update_arrival_time(time_since_last_parcel);
+            adapt_parameters();
+        }
+
         std::chrono::microseconds interval(interval_);
 
         // just send parcel if the coalescing was stopped or the buffer is
@@ -177,6 +318,8 @@ namespace hpx::plugins::parcel {
             l.unlock();
 
             // this instance should not buffer parcels anymore
+            if (adaptive_)
+                f = wrap_write_handler(HPX_MOVE(f));
             pp_->put_parcel(dest, HPX_MOVE(p), HPX_MOVE(f));
             return;
         }
@@ -189,10 +332,16 @@ namespace hpx::plugins::parcel {
         case detail::message_buffer::first_message:
             [[fallthrough]];
         case detail::message_buffer::normal:
-            // start deadline timer to flush buffer
-            l.unlock();
-            timer_.start(interval);
-            break;
+            // the number of parcels to coalesce might have been reduced after
+            // the buffer was created
+            if (buffer_.size() < num_coalesced_parcels_)
+            {
+                // start deadline timer to flush buffer
+                l.unlock();
+                timer_.start(interval);
+                break;
+            }
+            [[fallthrough]];
 
         case detail::message_buffer::buffer_now_full:
             flush_locked(l,
@@ -276,8 +425,17 @@ namespace hpx::plugins::parcel {
         std::swap(buff, buffer_);
 
         ++num_messages_;
+        bool const adaptive = adaptive_;
         l.unlock();
 
+        // all parcels of the message are sent at the same time, measuring one
+        // of them is sufficient
+        if (adaptive)
+        {
+            buff.last_handler() =
+                wrap_write_handler(HPX_MOVE(buff.last_handler()));
+        }
+
         HPX_ASSERT(nullptr != pp_);
         buff(pp_);    // 'invoke' the buffer
 
@@ -367,6 +525,20 @@ namespace hpx::plugins::parcel {
         return num_messages;
     }
 
+    std::int64_t coalescing_message_handler::get_current_interval(
+        bool /* reset */)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return static_cast<std::int64_t>(interval_) * 1000;    // [ns]
+    }
+
+    std::int64_t coalescing_message_handler::get_current_num_messages(
+        bool /* reset */)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return static_cast<std::int64_t>(num_coalesced_parcels_);
+    }
+
     std::vector<std::int64_t>
     coalescing_message_handler::get_time_between_parcels_histogram(
         bool /* reset */)
@@ -402,6 +402,174 @@ namespace hpx::plugins::parcel {
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    struct current_interval_counter_surrogate
+    {
+        explicit current_interval_counter_surrogate(
+            std::string const& parameters)
+          : parameters_(parameters)
+        {
+        }
+
+        std::int64_t operator()(bool reset)
+        {
+            if (counter_.empty())
+            {
+                counter_ = coalescing_counter_registry::instance()
+                               .get_current_interval_counter(parameters_);
+                if (counter_.empty())
+                    return 0;    // no counter available yet
+            }
+
+            // dispatch to actual counter
+            return counter_(reset);
+        }
+
+        hpx::function<std::int64_t(bool)> counter_;
+        std::string parameters_;
+    };
+
+    hpx::naming::gid_type current_interval_counter_creator(
+        hpx::performance_counters::counter_info const& info,
+        hpx::error_code& ec)
+    {
+        switch (info.type_)
+        {
+        case performance_counters::counter_type::raw:
+        {
+            performance_counters::counter_path_elements paths;
+            performance_counters::get_counter_path_elements(
+                info.fullname_, paths, ec);
+            if (ec)
+                return naming::invalid_gid;
+
+            if (paths.parentinstance_is_basename_)
+            {
+                HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                    "current_interval_counter_creator",
+                    "invalid counter name for current interval (instance "
+                    "name must not be a valid base counter name)");
+                return naming::invalid_gid;
+            }
+
+            if (paths.parameters_.empty())
+            {
+                HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                    "current_interval_counter_creator",
+                    "invalid counter parameter for current interval: must "
+                    "specify an action type");
+                return naming::invalid_gid;
+            }
+
+            // ask registry
+            hpx::function<std::int64_t(bool)> f =
+                coalescing_counter_registry::instance()
+                    .get_current_interval_counter(paths.parameters_);
+
+            if (!f.empty())
+            {
+                return performance_counters::detail::create_raw_counter(
+                    info, HPX_MOVE(f), ec);
+            }
+
+            // the counter is not available yet, create surrogate function
+            return performance_counters::detail::create_raw_counter(info,
+                current_interval_counter_surrogate(paths.parameters_), ec);
+        }
+        break;
+
+        default:
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "current_interval_counter_creator",
+                "invalid counter type requested");
+            return naming::invalid_gid;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct current_num_messages_counter_surrogate
+    {
+        explicit current_num_messages_counter_surrogate(
+            std::string const& parameters)
+          : parameters_(parameters)
+        {
+        }
+
+        std::int64_t operator()(bool reset)
+        {
+            if (counter_.empty())
+            {
+                counter_ = coalescing_counter_registry::instance()
+                               .get_current_num_messages_counter(parameters_);
+                if (counter_.empty())
+                    return 0;    // no counter available yet
+            }
+
+            // dispatch to actual counter
+            return counter_(reset);
+        }
+
+        hpx::function<std::int64_t(bool)> counter_;
+        std::string parameters_;
+    };
+
+    hpx::naming::gid_type current_num_messages_counter_creator(
+        hpx::performance_counters::counter_info const& info,
+        hpx::error_code& ec)
+    {
+        switch (info.type_)
+        {
+        case performance_counters::counter_type::raw:
+        {
+            performance_counters::counter_path_elements paths;
+            performance_counters::get_counter_path_elements(
+                info.fullname_, paths, ec);
+            if (ec)
+                return naming::invalid_gid;
+
+            if (paths.parentinstance_is_basename_)
+            {
+                HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                    "current_num_messages_counter_creator",
+                    "invalid counter name for current batch size (instance "
+                    "name must not be a valid base counter name)");
+                return naming::invalid_gid;
+            }
+
+            if (paths.parameters_.empty())
+            {
+                HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                    "current_num_messages_counter_creator",
+                    "invalid counter parameter for current batch size: must "
+                    "specify an action type");
+                return naming::invalid_gid;
+            }
+
+            // ask registry
+            hpx::function<std::int64_t(bool)> f =
+                coalescing_counter_registry::instance()
+                    .get_current_num_messages_counter(paths.parameters_);
+
+            if (!f.empty())
+            {
+                return performance_counters::detail::create_raw_counter(
+                    info, HPX_MOVE(f), ec);
+            }
+
+            // the counter is not available yet, create surrogate function
+            return performance_counters::detail::create_raw_counter(info,
+                current_num_messages_counter_surrogate(paths.parameters_), ec);
+        }
+        break;
+
+        default:
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "current_num_messages_counter_creator",
+                "invalid counter type requested");
+            return naming::invalid_gid;
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     struct time_between_parcels_histogram_counter_surrogate
     {
@@ -595,7 +763,22 @@ namespace hpx::plugins::parcel {
                 "the action which is given by the counter parameter",
                 HPX_PERFORMANCE_COUNTER_V1,
                 &time_between_parcels_histogram_counter_creator,
-                &counter_discoverer, "ns/0.1%"}};
+                &counter_discoverer, "ns/0.1%"},
+            // /coalescing(...)/time/current-interval@action-name
+            {"/coalescing/time/current-interval", counter_type::raw,
+                "returns the time the message handler associated with the "
+                "action which is given by the counter parameter currently "
+                "waits for parcels to coalesce",
+                HPX_PERFORMANCE_COUNTER_V1, &current_interval_counter_creator,
+                &counter_discoverer, "ns"},
+            // /coalescing(...)/count/current-batch-size@action-name
+            {"/coalescing/count/current-batch-size", counter_type::raw,
+                "returns the number of parcels the message handler associated "
+                "with the action which is given by the counter parameter "
+                "currently coalesces into one message",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &current_num_messages_counter_creator, &counter_discoverer,
+                ""}};
 
         // Install the counter types, un-installation of the types is handled
         // automatically.
@@ -0,0 +1,153 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// In adaptive mode the coalescing message handler derives the number of
+// parcels to coalesce and the flush interval from the measured parcel arrival
+// rate. Parcels arriving less often than the latency budget have to be sent
+// right away, bursts of parcels have to be coalesced, and a partially filled
+// message has to be flushed once the interval has expired.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+
+#include <hpx/include/actions.hpp>
+#include <hpx/include/parcel_coalescing.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t identity(std::size_t i)
+{
+    return i;
+}
+
+HPX_DECLARE_PLAIN_ACTION(identity, identity_action)
+HPX_ACTION_USES_MESSAGE_COALESCING(identity_action)
+HPX_PLAIN_ACTION(identity, identity_action)
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t get_counter(char const* name)
+{
+    std::string const counter_name =
+        std::string("/coalescing{locality#0/total}/") + name +
+        "@identity_action";
+
+    hpx::performance_counters::performance_counter c(counter_name);
+    return c.get_value<std::int64_t>(hpx::launch::sync);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Parcels arriving less often than the latency budget are sent right away. This
+// has to run first, the clamped arrival times then average to the budget.
+void test_low_rate(hpx::id_type const& id, std::size_t num_parcels)
+{
+    std::int64_t const parcels = get_counter("count/parcels");
+    std::int64_t const messages = get_counter("count/messages");
+
+    for (std::size_t i = 0; i != num_parcels; ++i)
+    {
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(50));
+        HPX_TEST_EQ(hpx::async(identity_action(), id, i).get(), i);
+    }
+
+    HPX_TEST_EQ(get_counter("count/current-batch-size"), std::int64_t(1));
+    HPX_TEST_EQ(get_counter("time/current-interval"), std::int64_t(0));
+
+    // every parcel was sent in a message of its own
+    HPX_TEST_EQ(get_counter("count/parcels") - parcels,
+        static_cast<std::int64_t>(num_parcels));
+    HPX_TEST_EQ(get_counter("count/messages") - messages,
+        static_cast<std::int64_t>(num_parcels));
+}
+
+// Bursts of parcels are coalesced.
+void test_high_rate(hpx::id_type const& id, std::size_t num_parcels)
+{
+    std::int64_t const parcels = get_counter("count/parcels");
+    std::int64_t const messages = get_counter("count/messages");
+
+    std::vector<hpx::future<std::size_t>> results;
+    results.reserve(num_parcels);
+    for (std::size_t i = 0; i != num_parcels; ++i)
+    {
+        results.push_back(hpx::async(identity_action(), id, i));
+    }
+
+    // the expected arrival rate makes the handler coalesce parcels and wait
+    // for them for a while
+    HPX_TEST_LT(std::int64_t(1), get_counter("count/current-batch-size"));
+    HPX_TEST_LT(std::int64_t(0), get_counter("time/current-interval"));
+
+    hpx::wait_all(results);
+    for (std::size_t i = 0; i != num_parcels; ++i)
+    {
+        HPX_TEST_EQ(results[i].get(), i);
+    }
+
+    HPX_TEST_EQ(get_counter("count/parcels") - parcels,
+        static_cast<std::int64_t>(num_parcels));
+    HPX_TEST_LT(get_counter("count/messages") - messages,
+        static_cast<std::int64_t>(num_parcels));
+}
+
+// A single parcel sent right after a burst waits for further parcels to
+// arrive, it is flushed once the interval has expired.
+void test_flush(hpx::id_type const& id)
+{
+    std::vector<hpx::future<std::size_t>> results;
+    for (std::size_t i = 0; i != 100; ++i)
+    {
+        results.push_back(hpx::async(identity_action(), id, i));
+    }
+    hpx::wait_all(results);
+
+    HPX_TEST_LT(std::int64_t(1), get_counter("count/current-batch-size"));
+
+    hpx::future<std::size_t> f = hpx::async(identity_action(), id, 42);
+    HPX_TEST(f.wait_for(std::chrono::seconds(5)) == hpx::future_status::ready);
+    HPX_TEST_EQ(f.get(), std::size_t(42));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_low_rate(id, 20);
+        test_high_rate(id, 2000);
+        test_flush(id);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // explicitly enable message handlers (parcel coalescing) in adaptive
+    // mode, the latency budget and the interval are given in microseconds
+    std::vector<std::string> const cfg = {"hpx.parcel.message_handlers=1",
+        "hpx.plugins.coalescing_message_handler.adaptive!=1",
+        "hpx.plugins.coalescing_message_handler.latency_budget!=20000",
+        "hpx.plugins.coalescing_message_handler.num_messages!=100",
+        "hpx.plugins.coalescing_message_handler.interval!=1000"};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,195 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/internal_allocator.hpp>
+#include <hpx/type_support/construct_at.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// An allocator which keeps a small number of released objects per type
+    /// and OS thread for later reuse. Objects which are frequently created
+    /// and destroyed (like the shared states of futures) usually end up
+    /// reusing memory which was released recently on the same OS thread.
+    /// Only allocations of single objects are cached, all other requests are
+    /// forwarded to the underlying allocator.
+    template <typename T, typename Allocator = internal_allocator<T>>
+    struct thread_local_caching_allocator
+    {
+    private:
+        using underlying_allocator_type = typename std::allocator_traits<
+            Allocator>::template rebind_alloc<T>;
+        using underlying_traits =
+            std::allocator_traits<underlying_allocator_type>;
+
+    public:
+        using value_type = T;
+        using pointer = T*;
+        using const_pointer = T const*;
+        using reference = T&;
+        using const_reference = T const&;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = thread_local_caching_allocator<U,
+                typename std::allocator_traits<
+                    Allocator>::template rebind_alloc<U>>;
+        };
+
+        using is_always_equal = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+
+        // the maximal number of objects cached per type and OS thread
+        static constexpr std::size_t max_cached_objects = 128;
+
+        thread_local_caching_allocator() = default;
+
+        template <typename U, typename A>
+        constexpr explicit thread_local_caching_allocator(
+            thread_local_caching_allocator<U, A> const&) noexcept
+        {
+        }
+
+        [[nodiscard]] static pointer allocate(size_type n)
+        {
+            if constexpr (is_cacheable)
+            {
+                if (n == 1)
+                {
+                    cache_data& cache = get_cache();
+                    if (cache.head_ != nullptr)
+                    {
+                        free_object* obj = cache.head_;
+                        cache.head_ = obj->next_;
+                        --cache.count_;
+                        return reinterpret_cast<pointer>(obj);
+                    }
+                }
+            }
+
+            underlying_allocator_type alloc{};
+            return underlying_traits::allocate(alloc, n);
+        }
+
+        static void deallocate(pointer p, size_type n) noexcept
+        {
+            if constexpr (is_cacheable)
+            {
+                if (n == 1)
+                {
+                    cache_data& cache = get_cache();
+                    if (cache.count_ < max_cached_objects)
+                    {
+                        auto* obj = reinterpret_cast<free_object*>(p);
+                        obj->next_ = cache.head_;
+                        cache.head_ = obj;
+                        ++cache.count_;
+                        return;
+                    }
+                }
+            }
+
+            underlying_allocator_type alloc{};
+            underlying_traits::deallocate(alloc, p, n);
+        }
+
+        template <typename U, typename... Args>
+        static void construct(U* p, Args&&... args)
+        {
+            hpx::construct_at(p, HPX_FORWARD(Args, args)...);
+        }
+
+        template <typename U>
+        static void destroy(U* p) noexcept
+        {
+            std::destroy_at(p);
+        }
+
+    private:
+        // released objects are linked through their own storage
+        static constexpr bool is_cacheable = sizeof(T) >= sizeof(void*) &&
+            alignof(T) >= alignof(void*);
+
+        struct free_object
+        {
+            free_object* next_;
+        };
+
+        // this is trivially destructible, thus it stays accessible while
+        // other thread_local objects are destroyed
+        struct cache_data
+        {
+            free_object* head_;
+            std::size_t count_;
+        };
+
+        // releases all cached objects on exit of the OS thread, any object
+        // released afterwards is handed to the underlying allocator
+        struct cache_cleanup
+        {
+            explicit cache_cleanup(cache_data& cache) noexcept
+              : cache_(cache)
+            {
+            }
+
+            cache_cleanup(cache_cleanup const&) = delete;
+            cache_cleanup& operator=(cache_cleanup const&) = delete;
+
+            ~cache_cleanup()
+            {
+                underlying_allocator_type alloc{};
+                while (cache_.head_ != nullptr)
+                {
+                    free_object* obj = cache_.head_;
+                    cache_.head_ = obj->next_;
+                    underlying_traits::deallocate(
+                        alloc, reinterpret_cast<pointer>(obj), 1);
+                }
+                cache_.count_ = max_cached_objects;
+            }
+
+            cache_data& cache_;
+        };
+
+        static cache_data& get_cache() noexcept
+        {
+            static thread_local cache_data cache{nullptr, 0};
+            static thread_local cache_cleanup cleanup(cache);
+            return cache;
+        }
+    };
+
+    template <typename T, typename A, typename U, typename B>
+    [[nodiscard]] constexpr bool operator==(
+        thread_local_caching_allocator<T, A> const&,
+        thread_local_caching_allocator<U, B> const&) noexcept
+    {
+        return true;
+    }
+
+    template <typename T, typename A, typename U, typename B>
+    [[nodiscard]] constexpr bool operator!=(
+        thread_local_caching_allocator<T, A> const&,
+        thread_local_caching_allocator<U, B> const&) noexcept
+    {
+        return false;
+    }
+}    // namespace hpx::util
+
+#include <hpx/config/warnings_suffix.hpp>
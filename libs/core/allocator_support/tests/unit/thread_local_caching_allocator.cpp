@@ -0,0 +1,239 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/allocator_support/thread_local_caching_allocator.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <set>
+#include <thread>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::size_t> allocations(0);
+std::atomic<std::size_t> deallocations(0);
+
+template <typename T>
+struct counting_allocator
+{
+    using value_type = T;
+
+    counting_allocator() = default;
+
+    template <typename U>
+    constexpr counting_allocator(counting_allocator<U> const&) noexcept
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+        ++allocations;
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, std::size_t) noexcept
+    {
+        ++deallocations;
+        ::operator delete(p);
+    }
+};
+
+struct data
+{
+    std::uint64_t values[4];
+};
+
+using allocator_type =
+    hpx::util::thread_local_caching_allocator<data, counting_allocator<data>>;
+
+constexpr std::size_t max_cached = allocator_type::max_cached_objects;
+
+void reset_counters()
+{
+    allocations = 0;
+    deallocations = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// a released object is handed out again by the next allocation on the same
+// OS thread
+void test_reuse()
+{
+    reset_counters();
+
+    std::thread([]() {
+        data* p = allocator_type::allocate(1);
+        HPX_TEST_EQ(allocations.load(), static_cast<std::size_t>(1));
+
+        allocator_type::deallocate(p, 1);
+        HPX_TEST_EQ(deallocations.load(), static_cast<std::size_t>(0));
+
+        data* q = allocator_type::allocate(1);
+        HPX_TEST_EQ(p, q);
+        HPX_TEST_EQ(allocations.load(), static_cast<std::size_t>(1));
+
+        allocator_type::deallocate(q, 1);
+
+        // arrays are never cached
+        data* a = allocator_type::allocate(2);
+        HPX_TEST_EQ(allocations.load(), static_cast<std::size_t>(2));
+        allocator_type::deallocate(a, 2);
+        HPX_TEST_EQ(deallocations.load(), static_cast<std::size_t>(1));
+    }).join();
+
+    // the cached object was released on exit of the OS thread
+    HPX_TEST_EQ(allocations.load(), deallocations.load());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// no more than max_cached_objects objects are kept per OS thread
+void test_cache_cap()
+{
+    reset_counters();
+
+    std::thread([]() {
+        std::size_t const count = 2 * max_cached;
+
+        std::vector<data*> objects;
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            objects.push_back(allocator_type::allocate(1));
+        }
+        HPX_TEST_EQ(allocations.load(), count);
+
+        for (data* p : objects)
+        {
+            allocator_type::deallocate(p, 1);
+        }
+        HPX_TEST_EQ(deallocations.load(), count - max_cached);
+
+        // the cached objects are reused, the next one is allocated anew
+        for (std::size_t i = 0; i != max_cached; ++i)
+        {
+            objects[i] = allocator_type::allocate(1);
+        }
+        HPX_TEST_EQ(allocations.load(), count);
+
+        data* p = allocator_type::allocate(1);
+        HPX_TEST_EQ(allocations.load(), count + 1);
+
+        allocator_type::deallocate(p, 1);
+        for (std::size_t i = 0; i != max_cached; ++i)
+        {
+            allocator_type::deallocate(objects[i], 1);
+        }
+        HPX_TEST_EQ(deallocations.load(), count - max_cached + 1);
+    }).join();
+
+    HPX_TEST_EQ(allocations.load(), deallocations.load());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// objects allocated on one OS thread may be released on another one, they end
+// up in the cache of the releasing thread
+void test_cross_thread()
+{
+    reset_counters();
+
+    std::size_t const count = max_cached / 2;
+
+    std::vector<data*> objects;
+    std::thread([&]() {
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            objects.push_back(allocator_type::allocate(1));
+        }
+    }).join();
+    HPX_TEST_EQ(allocations.load(), count);
+
+    std::thread([&]() {
+        std::set<data*> released(objects.begin(), objects.end());
+        for (data* p : objects)
+        {
+            allocator_type::deallocate(p, 1);
+        }
+        HPX_TEST_EQ(deallocations.load(), static_cast<std::size_t>(0));
+
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            data* p = allocator_type::allocate(1);
+            HPX_TEST(released.find(p) != released.end());
+            objects[i] = p;
+        }
+        HPX_TEST_EQ(allocations.load(), count);
+
+        for (data* p : objects)
+        {
+            allocator_type::deallocate(p, 1);
+        }
+    }).join();
+
+    HPX_TEST_EQ(allocations.load(), deallocations.load());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// many OS threads hand objects to each other concurrently
+void test_concurrent()
+{
+    reset_counters();
+
+    std::size_t const num_threads = 4;
+    std::size_t const count = 1000;
+
+    std::vector<std::vector<data*>> objects(num_threads);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([&objects, t]() {
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                data* p = allocator_type::allocate(1);
+                p->values[0] = t;
+                objects[t].push_back(p);
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    threads.clear();
+
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([&objects, t]() {
+            // release the objects allocated by another thread
+            auto& other = objects[(t + 1) % num_threads];
+            for (data* p : other)
+            {
+                HPX_TEST_EQ(p->values[0], (t + 1) % num_threads);
+                allocator_type::deallocate(p, 1);
+            }
+            other.clear();
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    HPX_TEST_EQ(allocations.load(), num_threads * count);
+    HPX_TEST_EQ(allocations.load(), deallocations.load());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_reuse();
+    test_cache_cap();
+    test_cross_thread();
+    test_concurrent();
+
+    return hpx::util::report_errors();
+}
@@ -11,6 +11,7 @@
 #include <hpx/config.hpp>
 #include <hpx/async_base/scheduling_properties.hpp>
 #include <hpx/async_base/traits/is_launch_policy.hpp>
+#include <hpx/concepts/concepts.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 
@@ -44,11 +45,14 @@ namespace hpx {
                     threads::thread_priority::default_,
                 threads::thread_stacksize stacksize =
                     threads::thread_stacksize::default_,
-                threads::thread_schedule_hint hint = {}) noexcept
+                threads::thread_schedule_hint hint = {},
+                threads::thread_deadline deadline =
+                    threads::thread_deadline::max()) noexcept
               : policy_(p)
               , priority_(priority)
               , stacksize_(stacksize)
               , hint_(hint)
+              , deadline_(deadline)
             {
             }
 
@@ -82,6 +86,11 @@ namespace hpx {
                 return hint_;
             }
 
+            constexpr threads::thread_deadline get_deadline() const noexcept
+            {
+                return deadline_;
+            }
+
             void set_priority(threads::thread_priority priority) noexcept
             {
                 priority_ = priority;
@@ -97,12 +106,21 @@ namespace hpx {
                 hint_ = hint;
             }
 
+            void set_deadline(threads::thread_deadline deadline) noexcept
+            {
+                deadline_ = deadline;
+            }
+
         protected:
             launch_policy policy_;
             threads::thread_priority priority_;
             threads::thread_stacksize stacksize_;
             threads::thread_schedule_hint hint_;
 
+            // The deadline is not serialized as it refers to the steady clock
+            // of the current locality.
+            threads::thread_deadline deadline_;
+
         private:
             friend class serialization::access;
 
@@ -123,8 +141,10 @@ namespace hpx {
                     threads::thread_priority::default_,
                 threads::thread_stacksize stacksize =
                     threads::thread_stacksize::default_,
-                threads::thread_schedule_hint hint = {}) noexcept
-              : policy_holder_base(p, priority, stacksize, hint)
+                threads::thread_schedule_hint hint = {},
+                threads::thread_deadline deadline =
+                    threads::thread_deadline::max()) noexcept
+              : policy_holder_base(p, priority, stacksize, hint, deadline)
             {
             }
 
@@ -159,6 +179,10 @@ namespace hpx {
             {
                 return static_cast<Derived const*>(this)->get_hint();
             }
+            constexpr threads::thread_deadline deadline() const noexcept
+            {
+                return static_cast<Derived const*>(this)->get_deadline();
+            }
         };
 
         template <>
@@ -169,8 +193,10 @@ namespace hpx {
                     threads::thread_priority::default_,
                 threads::thread_stacksize stacksize =
                     threads::thread_stacksize::default_,
-                threads::thread_schedule_hint hint = {}) noexcept
-              : policy_holder_base(p, priority, stacksize, hint)
+                threads::thread_schedule_hint hint = {},
+                threads::thread_deadline deadline =
+                    threads::thread_deadline::max()) noexcept
+              : policy_holder_base(p, priority, stacksize, hint, deadline)
             {
             }
 
@@ -205,8 +231,42 @@ namespace hpx {
             {
                 return this->policy_holder_base::get_hint();
             }
+            constexpr threads::thread_deadline deadline() const noexcept
+            {
+                return this->policy_holder_base::get_deadline();
+            }
         };
 
+        ///////////////////////////////////////////////////////////////////////
+        // Deadlines are supported by all launch policies alike
+
+        // clang-format off
+        template <typename Policy,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_launch_policy_v<Policy>
+            )>
+        // clang-format on
+        Policy tag_invoke(hpx::execution::experimental::with_deadline_t,
+            Policy const& policy, threads::thread_deadline deadline) noexcept
+        {
+            auto policy_with_deadline = policy;
+            policy_with_deadline.set_deadline(deadline);
+            return policy_with_deadline;
+        }
+
+        // clang-format off
+        template <typename Policy,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_launch_policy_v<Policy>
+            )>
+        // clang-format on
+        constexpr threads::thread_deadline tag_invoke(
+            hpx::execution::experimental::get_deadline_t,
+            Policy const& policy) noexcept
+        {
+            return policy.get_deadline();
+        }
+
         ///////////////////////////////////////////////////////////////////////
         struct async_policy : policy_holder<async_policy>
         {
@@ -640,7 +700,8 @@ namespace hpx {
             return policy_holder_base(
                 static_cast<launch_policy>(static_cast<int>(lhs.policy()) &
                     static_cast<int>(rhs.policy())),
-                lhs.get_priority(), lhs.get_stacksize(), lhs.get_hint());
+                lhs.get_priority(), lhs.get_stacksize(), lhs.get_hint(),
+                lhs.get_deadline());
         }
 
         template <typename Left, typename Right>
@@ -651,7 +712,8 @@ namespace hpx {
             return policy_holder_base(
                 static_cast<launch_policy>(static_cast<int>(lhs.policy()) |
                     static_cast<int>(rhs.policy())),
-                lhs.get_priority(), lhs.get_stacksize(), lhs.get_hint());
+                lhs.get_priority(), lhs.get_stacksize(), lhs.get_hint(),
+                lhs.get_deadline());
         }
 
         template <typename Left, typename Right>
@@ -662,7 +724,8 @@ namespace hpx {
             return policy_holder_base(
                 static_cast<launch_policy>(static_cast<int>(lhs.policy()) ^
                     static_cast<int>(rhs.policy())),
-                lhs.get_priority(), lhs.get_stacksize(), lhs.get_hint());
+                lhs.get_priority(), lhs.get_stacksize(), lhs.get_hint(),
+                lhs.get_deadline());
         }
 
         template <typename Derived>
@@ -671,7 +734,8 @@ namespace hpx {
         {
             return policy_holder<Derived>(
                 static_cast<launch_policy>(~static_cast<int>(p.policy())),
-                p.get_priority(), p.get_stacksize(), p.get_hint());
+                p.get_priority(), p.get_stacksize(), p.get_hint(),
+                p.get_deadline());
         }
 
         template <typename Left, typename Right>
@@ -743,7 +807,7 @@ namespace hpx {
         /// Create a launch policy representing asynchronous execution
         constexpr launch(detail::async_policy p) noexcept
           : detail::policy_holder<>{detail::launch_policy::async, p.priority(),
-                p.stacksize(), p.hint()}
+                p.stacksize(), p.hint(), p.deadline()}
         {
         }
 
@@ -751,36 +815,36 @@ namespace hpx {
         /// new thread is executed in a preferred way
         constexpr launch(detail::fork_policy p) noexcept
           : detail::policy_holder<>{detail::launch_policy::fork, p.priority(),
-                p.stacksize(), p.hint()}
+                p.stacksize(), p.hint(), p.deadline()}
         {
         }
 
         /// Create a launch policy representing synchronous execution
         constexpr launch(detail::sync_policy p) noexcept
           : detail::policy_holder<>{detail::launch_policy::sync, p.priority(),
-                p.stacksize(), p.hint()}
+                p.stacksize(), p.hint(), p.deadline()}
         {
         }
 
         /// Create a launch policy representing deferred execution
         constexpr launch(detail::deferred_policy p) noexcept
           : detail::policy_holder<>{detail::launch_policy::deferred,
-                p.priority(), p.stacksize(), p.hint()}
+                p.priority(), p.stacksize(), p.hint(), p.deadline()}
         {
         }
 
         /// Create a launch policy representing fire and forget execution
         constexpr launch(detail::apply_policy p) noexcept
           : detail::policy_holder<>{detail::launch_policy::apply, p.priority(),
-                p.stacksize(), p.hint()}
+                p.stacksize(), p.hint(), p.deadline()}
         {
         }
 
         /// Create a launch policy representing fire and forget execution
         template <typename F>
         constexpr launch(detail::select_policy<F> const& p) noexcept
-          : detail::policy_holder<>{
-                p.policy(), p.priority(), p.stacksize(), p.hint()}
+          : detail::policy_holder<>{p.policy(), p.priority(), p.stacksize(),
+                p.hint(), p.deadline()}
         {
         }
 
@@ -790,7 +854,8 @@ namespace hpx {
         constexpr launch(Launch l, threads::thread_priority priority,
             threads::thread_stacksize stacksize,
             threads::thread_schedule_hint hint) noexcept
-          : detail::policy_holder<>(l.policy(), priority, stacksize, hint)
+          : detail::policy_holder<>(
+                l.policy(), priority, stacksize, hint, l.deadline())
         {
         }
 
@@ -130,6 +130,30 @@ namespace hpx::execution::experimental {
     {
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    inline constexpr struct with_deadline_t final
+      : detail::property_base<with_deadline_t>
+    {
+    } with_deadline{};
+
+    inline constexpr struct get_deadline_t final
+      : hpx::functional::detail::tag_fallback<get_deadline_t>
+    {
+    private:
+        // simply return 'no deadline' if get_deadline is not supported
+        template <typename Target>
+        friend HPX_FORCEINLINE constexpr hpx::threads::thread_deadline
+        tag_fallback_invoke(get_deadline_t, Target&&) noexcept
+        {
+            return hpx::threads::thread_deadline::max();
+        }
+    } get_deadline{};
+
+    template <>
+    struct is_scheduling_property<get_deadline_t> : std::true_type
+    {
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     inline constexpr struct with_annotation_t final
       : detail::property_base<with_annotation_t>
@@ -0,0 +1,771 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/cache/statistics/no_statistics.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::util::cache {
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // Approximates how often keys were accessed recently (a count-min
+        // sketch of 4 bit counters which are halved periodically). Used by
+        // the concurrent_cache to decide whether a new entry is worth keeping
+        // in place of an existing one (TinyLFU admission).
+        class frequency_sketch
+        {
+        private:
+            static constexpr int depth = 4;
+            static constexpr std::size_t max_width = std::size_t(1) << 24;
+
+            static constexpr std::uint64_t seeds[depth] = {
+                0xc3a5c85c97cb3127ULL, 0xb492b66fbe98f273ULL,
+                0x9ae16a3b2f90404fULL, 0xcbf29ce484222325ULL};
+
+        public:
+            explicit frequency_sketch(std::size_t capacity = 0)
+            {
+                resize(capacity);
+            }
+
+            void resize(std::size_t capacity)
+            {
+                // each table entry holds 16 counters
+                std::size_t width = 16;
+                while (width < capacity && width < max_width)
+                {
+                    width <<= 1;
+                }
+
+                table_.assign(width, 0);
+                mask_ = width - 1;
+                sample_size_ = 10 * width;
+                additions_ = 0;
+            }
+
+            // record an access to the key with the given hash value
+            void increment(std::size_t hash) noexcept
+            {
+                bool added = false;
+                for (int i = 0; i != depth; ++i)
+                {
+                    std::uint64_t const h = rehash(hash, i);
+                    added |= increment_at(index_of(h), counter_of(h));
+                }
+
+                if (added && ++additions_ == sample_size_)
+                {
+                    reset();
+                }
+            }
+
+            // return the estimated number of recent accesses to the key with
+            // the given hash value (at most 15)
+            [[nodiscard]] unsigned frequency(std::size_t hash) const noexcept
+            {
+                unsigned frequency = 15;
+                for (int i = 0; i != depth; ++i)
+                {
+                    std::uint64_t const h = rehash(hash, i);
+                    auto const count = static_cast<unsigned>(
+                        (table_[index_of(h)] >> (counter_of(h) << 2)) & 0xf);
+                    frequency = (std::min)(frequency, count);
+                }
+                return frequency;
+            }
+
+        private:
+            [[nodiscard]] static constexpr std::uint64_t rehash(
+                std::size_t hash, int i) noexcept
+            {
+                std::uint64_t const h =
+                    (static_cast<std::uint64_t>(hash) + seeds[i]) *
+                    0x9e3779b97f4a7c15ULL;
+                return h ^ (h >> 29);
+            }
+
+            [[nodiscard]] std::size_t index_of(std::uint64_t h) const noexcept
+            {
+                return static_cast<std::size_t>(h) & mask_;
+            }
+
+            [[nodiscard]] static constexpr unsigned counter_of(
+                std::uint64_t h) noexcept
+            {
+                return static_cast<unsigned>(h >> 60);
+            }
+
+            bool increment_at(std::size_t index, unsigned counter) noexcept
+            {
+                unsigned const offset = counter << 2;
+                std::uint64_t const mask = std::uint64_t(0xf) << offset;
+                if ((table_[index] & mask) != mask)
+                {
+                    table_[index] += std::uint64_t(1) << offset;
+                    return true;
+                }
+                return false;
+            }
+
+            // halve all counters to let older accesses fade out
+            void reset() noexcept
+            {
+                for (std::uint64_t& entry : table_)
+                {
+                    entry = (entry >> 1) & 0x7777777777777777ULL;
+                }
+                additions_ /= 2;
+            }
+
+            std::vector<std::uint64_t> table_;
+            std::size_t mask_ = 0;
+            std::size_t sample_size_ = 0;
+            std::size_t additions_ = 0;
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \class concurrent_cache concurrent_cache.hpp hpx/cache/concurrent_cache.hpp
+    ///
+    /// \brief The \a concurrent_cache implements a local (non-distributed)
+    ///        cache which can be used from many threads at the same time
+    ///        without external locking.
+    ///
+    /// The entries are distributed over a number of independently locked
+    /// shards based on the hash value of their key. Each shard keeps newly
+    /// inserted entries in a small window (1% of its capacity). Entries
+    /// leaving the window are admitted to the main area of the shard only if
+    /// their key was accessed more often recently than the key of the entry
+    /// which would have to be evicted in exchange (W-TinyLFU). The main area
+    /// selects the entries to evict using the CLOCK algorithm, which allows
+    /// for lookups to only mark entries as used instead of reordering them.
+    ///
+    /// \tparam Key           The type of the keys to use to identify the
+    ///                       entries stored in the cache
+    /// \tparam Entry         The type of the items to be held in the cache.
+    /// \tparam Statistics    A (optional) type allowing to collect some basic
+    ///                       statistics about the operation of the cache
+    ///                       instance. The type must conform to the
+    ///                       CacheStatistics concept. The default value is
+    ///                       the type \a statistics#no_statistics which does
+    ///                       not collect any numbers, but provides empty stubs
+    ///                       allowing the code to compile. Statistics are
+    ///                       collected separately for each shard.
+    /// \tparam Hash          The hash function to use for the keys.
+    /// \tparam KeyEqual      The function used to compare keys for equality.
+    template <typename Key, typename Entry,
+        typename Statistics = statistics::no_statistics,
+        typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+    class concurrent_cache
+    {
+    public:
+        using key_type = Key;
+        using entry_type = Entry;
+        using statistics_type = Statistics;
+        using entry_pair = std::pair<key_type, entry_type>;
+        using size_type = std::size_t;
+
+    private:
+        using update_on_exit = typename statistics_type::update_on_exit;
+        using mutex_type = hpx::util::spinlock;
+
+        struct node
+        {
+            template <typename Entry_>
+            node(key_type const& key, Entry_&& entry, size_type cost,
+                std::size_t hash)
+              : data_(key, HPX_FORWARD(Entry_, entry))
+              , cost_(cost)
+              , hash_(hash)
+            {
+            }
+
+            entry_pair data_;
+            size_type cost_;
+            std::size_t hash_;
+            bool referenced_ = false;
+            bool in_window_ = true;
+        };
+
+        using list_type = std::list<node>;
+        using index_type = std::unordered_map<key_type,
+            typename list_type::iterator, Hash, KeyEqual>;
+
+        struct shard_data
+        {
+            mutable mutex_type mtx_;
+            index_type index_;
+
+            list_type window_;    // recently inserted entries, oldest last
+            list_type main_;      // admitted entries, in CLOCK order
+            typename list_type::iterator hand_ = main_.end();
+
+            size_type window_size_ = 0;
+            size_type main_size_ = 0;
+            size_type window_capacity_ = 0;
+            size_type main_capacity_ = 0;
+
+            detail::frequency_sketch sketch_;
+            statistics_type statistics_;
+        };
+
+        using shard_type = util::cache_aligned_data_derived<shard_data>;
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Construct an instance of a concurrent_cache.
+        ///
+        /// \param max_size   [in] The maximal size this cache is allowed to
+        ///                   reach any time. The default is zero (no size
+        ///                   limitation). The size of the cache is the sum of
+        ///                   the costs of its entries (see \a insert).
+        /// \param num_shards [in] The number of independently locked parts the
+        ///                   cache is split into. It is rounded down to a power
+        ///                   of two and limited by \a max_size.
+        ///
+        explicit concurrent_cache(size_type max_size = 0,
+            size_type num_shards = 16, Hash const& hash = Hash(),
+            KeyEqual const& equal = KeyEqual())
+          : hash_(hash)
+        {
+            if (max_size != 0)
+            {
+                num_shards = (std::min)(num_shards, max_size);
+            }
+
+            while (num_shards_ * 2 <= num_shards)
+            {
+                num_shards_ *= 2;
+                ++shard_bits_;
+            }
+
+            shards_ = std::make_unique<shard_type[]>(num_shards_);
+            for (size_type i = 0; i != num_shards_; ++i)
+            {
+                shards_[i].index_ = index_type(0, hash, equal);
+            }
+
+            set_capacity(max_size);
+        }
+
+        concurrent_cache(concurrent_cache const& other) = delete;
+        concurrent_cache(concurrent_cache&& other) = delete;
+        concurrent_cache& operator=(concurrent_cache const& other) = delete;
+        concurrent_cache& operator=(concurrent_cache&& other) = delete;
+
+        ~concurrent_cache() = default;
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Return current size of the cache.
+        ///
+        /// \returns The current size of this cache instance (the sum of the
+        ///          costs of all entries).
+        [[nodiscard]] size_type size() const
+        {
+            size_type size = 0;
+            for (size_type i = 0; i != num_shards_; ++i)
+            {
+                shard_type const& s = shards_[i];
+
+                std::lock_guard<mutex_type> l(s.mtx_);
+                size += s.window_size_ + s.main_size_;
+            }
+            return size;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Access the maximum size the cache is allowed to grow to.
+        ///
+        /// \returns    The maximum size this cache instance is currently
+        ///             allowed to reach. If this number is zero the cache has
+        ///             no limitation with regard to a maximum size.
+        [[nodiscard]] size_type capacity() const noexcept
+        {
+            return max_size_.load(std::memory_order_relaxed);
+        }
+
+        /// \brief Return the number of shards the cache is split into.
+        [[nodiscard]] constexpr size_type num_shards() const noexcept
+        {
+            return num_shards_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Change the maximum size this cache can grow to
+        ///
+        /// \param max_size    [in] The new maximum size this cache will be
+        ///             allowed to grow to.
+        ///
+        void reserve(size_type max_size)
+        {
+            set_capacity(max_size);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Check whether the cache currently holds an entry identified
+        ///        by the given key
+        ///
+        /// \param key    [in] The key for the entry which should be looked up
+        ///               in the cache.
+        ///
+        /// \note         This function does not mark the entry as used. It
+        ///               just checks if the cache contains an entry
+        ///               corresponding to the given key.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        [[nodiscard]] bool holds_key(key_type const& key) const
+        {
+            shard_type const& s = get_shard(hash_(key));
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            return s.index_.find(key) != s.index_.end();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get a specific entry identified by the given key.
+        ///
+        /// \param key    [in] The key for the entry which should be retrieved
+        ///               from the cache.
+        /// \param entry  [out] If the entry indexed by the key is found in the
+        ///               cache this value on successful return will be a copy
+        ///               of the corresponding entry.
+        ///
+        /// \note         The function will mark the entry as recently used if
+        ///               the key was found in the cache.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool get_entry(key_type const& key, entry_type& entry)
+        {
+            std::size_t const hash = hash_(key);
+            shard_type& s = get_shard(hash);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            update_on_exit update(s.statistics_, statistics::method::get_entry);
+
+            s.sketch_.increment(hash);
+
+            auto const it = s.index_.find(key);
+            if (it == s.index_.end())
+            {
+                // Got miss
+                s.statistics_.got_miss();    // update statistics
+                return false;
+            }
+
+            it->second->referenced_ = true;
+
+            // update statistics
+            s.statistics_.got_hit();
+
+            // got hit
+            entry = it->second->data_.second;
+
+            return true;
+        }
+
+        /// \brief Insert a new entry into this cache
+        ///
+        /// \param key    [in] The key for the entry which should be added to
+        ///               the cache.
+        /// \param entry  [in] The entry which should be added to the cache.
+        /// \param cost   [in] The amount this entry adds to the size of the
+        ///               cache.
+        ///
+        /// \note         A newly inserted entry may be evicted right away if
+        ///               it was accessed less often than the other entries.
+        ///
+        /// \returns      This function returns \a false if the cache already
+        ///               holds an entry for the given key, otherwise it
+        ///               returns \a true.
+        template <typename Entry_,
+            typename = std::enable_if_t<
+                std::is_convertible_v<std::decay_t<Entry_>, entry_type>>>
+        bool insert(key_type const& key, Entry_&& entry, size_type cost = 1)
+        {
+            std::size_t const hash = hash_(key);
+            shard_type& s = get_shard(hash);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            update_on_exit update(
+                s.statistics_, statistics::method::insert_entry);
+
+            if (s.index_.find(key) != s.index_.end())
+            {
+                return false;
+            }
+
+            s.sketch_.increment(hash);
+            insert_nonexist(s, key, hash, HPX_FORWARD(Entry_, entry), cost);
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache
+        ///
+        /// \param key    [in] The key for the value which should be updated in
+        ///               the cache.
+        /// \param entry  [in] The entry which should be used as a replacement
+        ///               for the existing value in the cache. If the cache
+        ///               does not hold an entry for the given key, it is
+        ///               inserted.
+        /// \param cost   [in] The amount the entry adds to the size of the
+        ///               cache.
+        ///
+        /// \note         The function will mark the entry as recently used if
+        ///               the key was found in the cache.
+        template <typename Entry_,
+            typename = std::enable_if_t<
+                std::is_convertible_v<std::decay_t<Entry_>, entry_type>>>
+        void update(key_type const& key, Entry_&& entry, size_type cost = 1)
+        {
+            std::size_t const hash = hash_(key);
+            shard_type& s = get_shard(hash);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            update_on_exit update(
+                s.statistics_, statistics::method::update_entry);
+
+            s.sketch_.increment(hash);
+
+            // Is it already in the cache?
+            auto const it = s.index_.find(key);
+            if (it == s.index_.end())
+            {
+                // got miss
+                s.statistics_.got_miss();    // update statistics
+                insert_nonexist(s, key, hash, HPX_FORWARD(Entry_, entry), cost);
+                return;
+            }
+
+            // got hit!
+            node& n = *it->second;
+            n.data_.second = HPX_FORWARD(Entry_, entry);
+            n.referenced_ = true;
+
+            size_type& size = n.in_window_ ? s.window_size_ : s.main_size_;
+            size = size - n.cost_ + cost;
+            n.cost_ = cost;
+
+            // update statistics
+            s.statistics_.got_hit();
+
+            if (capacity() != 0)
+            {
+                evict(s);
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Remove the entry identified by the given key
+        ///
+        /// \returns      This function returns \a true if an entry has been
+        ///               removed, otherwise it returns \a false.
+        bool erase(key_type const& key)
+        {
+            shard_type& s = get_shard(hash_(key));
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            update_on_exit update(
+                s.statistics_, statistics::method::erase_entry);
+
+            auto const it = s.index_.find(key);
+            if (it == s.index_.end())
+            {
+                return false;
+            }
+
+            remove(s, it->second);
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Remove stored entries from the cache for which the supplied
+        ///        function object returns true.
+        ///
+        /// \param ep     [in] This parameter has to be a (unary) function
+        ///               object. It is invoked for each of the entries
+        ///               (\a entry_pair) currently held in the cache. An
+        ///               entry is removed from the cache whenever the value
+        ///               returned from this invocation is \a true. The
+        ///               function object is invoked while the shard holding
+        ///               the entry is locked.
+        ///
+        /// \returns      This function returns the number of the removed
+        ///               entries.
+        template <typename Func,
+            typename = std::enable_if_t<
+                std::is_invocable_r_v<bool, Func const&, entry_pair const&>>>
+        size_type erase(Func const& ep)
+        {
+            size_type erased = 0;
+            for (size_type i = 0; i != num_shards_; ++i)
+            {
+                shard_type& s = shards_[i];
+
+                std::lock_guard<mutex_type> l(s.mtx_);
+                update_on_exit update(
+                    s.statistics_, statistics::method::erase_entry);
+
+                erased += erase_if(s, s.window_, ep);
+                erased += erase_if(s, s.main_, ep);
+            }
+            return erased;
+        }
+
+        /// \brief Clear the cache
+        ///
+        /// Unconditionally removes all stored entries from the cache.
+        ///
+        /// \returns      This function returns the overall size of the removed
+        ///               entries.
+        size_type clear()
+        {
+            size_type erased = 0;
+            for (size_type i = 0; i != num_shards_; ++i)
+            {
+                shard_type& s = shards_[i];
+
+                std::lock_guard<mutex_type> l(s.mtx_);
+                erased += s.window_size_ + s.main_size_;
+
+                s.index_.clear();
+                s.window_.clear();
+                s.main_.clear();
+                s.hand_ = s.main_.end();
+                s.window_size_ = 0;
+                s.main_size_ = 0;
+            }
+            return erased;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Allow to access the statistics instance of a shard
+        ///
+        /// \param shard  [in] The index of the shard, less than the value
+        ///               returned by \a num_shards.
+        ///
+        /// \note         The statistics instances are updated while the
+        ///               corresponding shard is locked, reading them while the
+        ///               cache is in use is racy.
+        ///
+        /// \returns      This function returns a reference to the statistics
+        ///               instance embedded inside the given shard
+        [[nodiscard]] statistics_type const& get_statistics(
+            size_type shard) const noexcept
+        {
+            return shards_[shard].statistics_;
+        }
+
+        [[nodiscard]] statistics_type& get_statistics(size_type shard) noexcept
+        {
+            return shards_[shard].statistics_;
+        }
+
+    private:
+        [[nodiscard]] shard_type& get_shard(std::size_t hash) const noexcept
+        {
+            if (shard_bits_ == 0)
+            {
+                return shards_[0];
+            }
+
+            // use the upper bits of the (remixed) hash value, the lower ones
+            // select the bucket in the shard's index
+            std::uint64_t const h =
+                static_cast<std::uint64_t>(hash) * 0x9e3779b97f4a7c15ULL;
+            return shards_[static_cast<size_type>(h >> (64 - shard_bits_))];
+        }
+
+        void set_capacity(size_type max_size)
+        {
+            max_size_.store(max_size, std::memory_order_relaxed);
+
+            for (size_type i = 0; i != num_shards_; ++i)
+            {
+                shard_type& s = shards_[i];
+
+                size_type capacity = max_size / num_shards_;
+                if (i < max_size % num_shards_)
+                {
+                    ++capacity;
+                }
+
+                std::lock_guard<mutex_type> l(s.mtx_);
+
+                s.window_capacity_ = (std::max)(capacity / 100, size_type(1));
+                s.main_capacity_ =
+                    capacity - (std::min)(capacity, s.window_capacity_);
+                s.sketch_.resize(capacity);
+
+                if (max_size != 0)
+                {
+                    evict(s);
+                }
+            }
+        }
+
+        template <typename Entry_>
+        void insert_nonexist(shard_type& s, key_type const& key,
+            std::size_t hash, Entry_&& entry, size_type cost)
+        {
+            // insert ...
+            s.window_.emplace_front(
+                key, HPX_FORWARD(Entry_, entry), cost, hash);
+            s.index_.emplace(key, s.window_.begin());
+            s.window_size_ += cost;
+
+            // update statistics
+            s.statistics_.got_insertion();
+
+            // Do we need to evict a cache entry?
+            if (capacity() != 0)
+            {
+                evict(s);
+            }
+        }
+
+        // Move the entries not fitting into the window to the main area. An
+        // entry is admitted only if it was accessed more often than the
+        // entries which have to be evicted to make room for it.
+        void evict(shard_type& s)
+        {
+            while (s.window_size_ > s.window_capacity_)
+            {
+                auto const candidate = std::prev(s.window_.end());
+
+                // the candidate is visited last by the CLOCK hand
+                s.main_.splice(s.hand_, s.window_, candidate);
+                candidate->in_window_ = false;
+                s.window_size_ -= candidate->cost_;
+                s.main_size_ += candidate->cost_;
+
+                unsigned const frequency =
+                    s.sketch_.frequency(candidate->hash_);
+                while (s.main_size_ > s.main_capacity_)
+                {
+                    auto const victim = next_victim(s, candidate);
+                    if (victim == candidate ||
+                        frequency <= s.sketch_.frequency(victim->hash_))
+                    {
+                        s.statistics_.got_eviction();
+                        remove(s, candidate);
+                        break;
+                    }
+
+                    s.statistics_.got_eviction();
+                    remove(s, victim);
+                }
+            }
+
+            // the main area may still be too large after the capacity was
+            // reduced
+            while (s.main_size_ > s.main_capacity_)
+            {
+                s.statistics_.got_eviction();
+                remove(s, next_victim(s, s.main_.end()));
+            }
+        }
+
+        // Advance the CLOCK hand to the next entry which was not used since
+        // the hand passed it last time, skipping the given candidate.
+        typename list_type::iterator next_victim(
+            shard_type& s, typename list_type::iterator candidate)
+        {
+            for (;;)
+            {
+                if (s.hand_ == s.main_.end())
+                {
+                    s.hand_ = s.main_.begin();
+                }
+
+                auto const it = s.hand_++;
+                if (it == candidate)
+                {
+                    if (s.main_.size() == 1)
+                    {
+                        return it;
+                    }
+                    continue;
+                }
+
+                if (!it->referenced_)
+                {
+                    return it;
+                }
+                it->referenced_ = false;
+            }
+        }
+
+        void remove(shard_type& s, typename list_type::iterator it)
+        {
+            s.index_.erase(it->data_.first);
+            if (it->in_window_)
+            {
+                s.window_size_ -= it->cost_;
+                s.window_.erase(it);
+            }
+            else
+            {
+                if (s.hand_ == it)
+                {
+                    ++s.hand_;
+                }
+                s.main_size_ -= it->cost_;
+                s.main_.erase(it);
+            }
+        }
+
+        template <typename Func>
+        size_type erase_if(shard_type& s, list_type& l, Func const& ep)
+        {
+            size_type erased = 0;
+            for (auto it = l.begin(); it != l.end(); /**/)
+            {
+                auto const current = it++;
+                if (ep(std::as_const(current->data_)))
+                {
+                    remove(s, current);
+                    ++erased;
+
+                    // update statistics
+                    s.statistics_.got_eviction();
+                }
+            }
+            return erased;
+        }
+
+    private:
+        Hash hash_;
+
+        size_type num_shards_ = 1;
+        int shard_bits_ = 0;
+        std::unique_ptr<shard_type[]> shards_;
+
+        std::atomic<size_type> max_size_{0};
+    };
+}    // namespace hpx::util::cache
@@ -0,0 +1,223 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares the throughput and hit ratio of the concurrent_cache with the ones
+// of the lru_cache and the local_cache (both protected by a spinlock) when
+// accessed from all worker threads at the same time. Keys are drawn from a
+// Zipf distribution, a miss inserts the key into the cache.
+
+#include <hpx/cache/concurrent_cache.hpp>
+#include <hpx/cache/entries/lru_entry.hpp>
+#include <hpx/cache/local_cache.hpp>
+#include <hpx/cache/lru_cache.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+#include <hpx/local/chrono.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/runtime.hpp>
+
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Cache>
+class locked_cache
+{
+public:
+    explicit locked_cache(std::size_t capacity)
+      : cache_(capacity)
+    {
+    }
+
+    bool get_entry(std::uint64_t key, std::uint64_t& value)
+    {
+        std::lock_guard<hpx::util::spinlock> l(mtx_);
+        return get_entry(cache_, key, value);
+    }
+
+    void insert(std::uint64_t key, std::uint64_t value)
+    {
+        std::lock_guard<hpx::util::spinlock> l(mtx_);
+        cache_.insert(key, value);
+    }
+
+private:
+    template <typename Entry, typename Statistics>
+    static bool get_entry(
+        hpx::util::cache::lru_cache<std::uint64_t, Entry, Statistics>& cache,
+        std::uint64_t key, std::uint64_t& value)
+    {
+        std::uint64_t realkey = 0;
+        return cache.get_entry(key, realkey, value);
+    }
+
+    template <typename C>
+    static bool get_entry(C& cache, std::uint64_t key, std::uint64_t& value)
+    {
+        return cache.get_entry(key, value);
+    }
+
+    hpx::util::spinlock mtx_;
+    Cache cache_;
+};
+
+using lru_cache_type =
+    locked_cache<hpx::util::cache::lru_cache<std::uint64_t, std::uint64_t>>;
+using local_cache_type = locked_cache<hpx::util::cache::local_cache<
+    std::uint64_t, hpx::util::cache::entries::lru_entry<std::uint64_t>>>;
+using concurrent_cache_type =
+    hpx::util::cache::concurrent_cache<std::uint64_t, std::uint64_t>;
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::vector<std::uint64_t>> generate_keys(std::size_t num_threads,
+    std::size_t num_accesses, std::size_t num_keys, double skew)
+{
+    std::vector<double> weights(num_keys);
+    for (std::size_t i = 0; i != num_keys; ++i)
+    {
+        weights[i] = 1.0 / std::pow(static_cast<double>(i + 1), skew);
+    }
+
+    std::discrete_distribution<std::uint64_t> dist(
+        weights.begin(), weights.end());
+
+    std::vector<std::vector<std::uint64_t>> keys(num_threads);
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        std::mt19937_64 gen(t);
+
+        keys[t].reserve(num_accesses);
+        for (std::size_t i = 0; i != num_accesses; ++i)
+        {
+            // scatter the popular keys over the key space
+            keys[t].push_back(dist(gen) * 0x9e3779b97f4a7c15ULL);
+        }
+    }
+    return keys;
+}
+
+template <typename Cache>
+void measure(char const* name, Cache& cache,
+    std::vector<std::vector<std::uint64_t>> const& keys)
+{
+    std::atomic<std::size_t> hits(0);
+
+    std::vector<hpx::future<void>> threads;
+    threads.reserve(keys.size());
+
+    std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+    for (auto const& thread_keys : keys)
+    {
+        threads.push_back(hpx::async([&cache, &hits, &thread_keys]() {
+            std::size_t local_hits = 0;
+            for (std::uint64_t const key : thread_keys)
+            {
+                std::uint64_t value = 0;
+                if (cache.get_entry(key, value))
+                {
+                    ++local_hits;
+                }
+                else
+                {
+                    cache.insert(key, key);
+                }
+            }
+            hits += local_hits;
+        }));
+    }
+    hpx::wait_all(threads);
+
+    double const elapsed =
+        static_cast<double>(hpx::chrono::high_resolution_clock::now() - start) /
+        1e9;
+
+    std::size_t accesses = 0;
+    for (auto const& thread_keys : keys)
+    {
+        accesses += thread_keys.size();
+    }
+
+    std::cout << std::left << std::setw(20) << name << std::right
+              << std::setw(14) << std::fixed << std::setprecision(3)
+              << static_cast<double>(accesses) / elapsed / 1e6
+              << std::setw(14) << std::setprecision(2)
+              << 100.0 * static_cast<double>(hits.load()) /
+            static_cast<double>(accesses)
+              << "\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    auto const capacity = vm["capacity"].as<std::size_t>();
+    auto const num_keys = vm["keys"].as<std::size_t>();
+    auto const num_accesses = vm["accesses"].as<std::size_t>();
+    auto const num_shards = vm["shards"].as<std::size_t>();
+    auto const skew = vm["skew"].as<double>();
+    std::size_t const num_threads = hpx::get_os_thread_count();
+
+    std::cout << "threads: " << num_threads << ", capacity: " << capacity
+              << ", keys: " << num_keys << ", skew: " << skew
+              << ", accesses per thread: " << num_accesses << "\n";
+
+    auto const keys =
+        generate_keys(num_threads, num_accesses, num_keys, skew);
+
+    std::cout << std::left << std::setw(20) << "cache" << std::right
+              << std::setw(14) << "Mops/s" << std::setw(14) << "hit ratio[%]"
+              << "\n";
+
+    {
+        lru_cache_type cache(capacity);
+        measure("lru_cache", cache, keys);
+    }
+    {
+        local_cache_type cache(capacity);
+        measure("local_cache", cache, keys);
+    }
+    {
+        concurrent_cache_type cache(capacity, num_shards);
+        measure("concurrent_cache", cache, keys);
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("capacity", value<std::size_t>()->default_value(1000),
+            "maximal number of entries held by the caches")
+        ("keys", value<std::size_t>()->default_value(100000),
+            "number of distinct keys accessed")
+        ("accesses", value<std::size_t>()->default_value(100000),
+            "number of cache accesses per worker thread")
+        ("shards", value<std::size_t>()->default_value(16),
+            "number of shards of the concurrent_cache")
+        ("skew", value<double>()->default_value(0.99),
+            "skew of the Zipf distribution the keys are drawn from")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
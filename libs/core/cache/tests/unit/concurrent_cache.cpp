@@ -0,0 +1,216 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/cache/concurrent_cache.hpp>
+#include <hpx/cache/statistics/local_statistics.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct data
+{
+    constexpr data(char const* const k, char const* const v) noexcept
+      : key(k)
+      , value(v)
+    {
+    }
+
+    char const* const key;
+    char const* const value;
+};
+
+data cache_entries[] = {data("white", "255,255,255"),
+    data("yellow", "255,255,0"), data("green", "0,255,0"),
+    data("blue", "0,0,255"), data("magenta", "255,0,255"),
+    data("black", "0,0,0"), data(nullptr, nullptr)};
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent_insert()
+{
+    using namespace hpx::util::cache;
+
+    using cache_type = concurrent_cache<std::string, std::string,
+        statistics::local_statistics>;
+
+    cache_type c(3);
+
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.capacity());
+
+    // insert all items into the cache
+    for (data* d = &cache_entries[0]; d->key != nullptr; ++d)
+    {
+        HPX_TEST(c.insert(d->key, d->value));
+        HPX_TEST_LTE(c.size(), static_cast<cache_type::size_type>(3));
+    }
+
+    // the cache never holds more items than its capacity
+    std::size_t insertions = 0;
+    std::size_t evictions = 0;
+    for (std::size_t i = 0; i != c.num_shards(); ++i)
+    {
+        insertions += c.get_statistics(i).insertions();
+        evictions += c.get_statistics(i).evictions();
+    }
+
+    HPX_TEST_EQ(static_cast<std::size_t>(6), insertions);
+    HPX_TEST_EQ(insertions - evictions, c.size());
+
+    HPX_TEST_EQ(c.clear(), insertions - evictions);
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(0), c.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent_update()
+{
+    using namespace hpx::util::cache;
+
+    using cache_type = concurrent_cache<std::string, std::string>;
+
+    cache_type c(4, 1);
+
+    for (data* d = &cache_entries[0]; d->key != nullptr; ++d)
+    {
+        c.update(d->key, d->value);
+        HPX_TEST_LTE(c.size(), static_cast<cache_type::size_type>(4));
+    }
+
+    c.update("yellow", "255,0,0");
+    HPX_TEST(c.holds_key("yellow"));
+
+    std::string yellow;
+    HPX_TEST(c.get_entry("yellow", yellow));
+    HPX_TEST_EQ(yellow, "255,0,0");
+
+    HPX_TEST(c.erase(std::string("yellow")));
+    HPX_TEST(!c.holds_key("yellow"));
+    HPX_TEST(!c.erase(std::string("yellow")));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent_cost()
+{
+    using namespace hpx::util::cache;
+
+    using cache_type = concurrent_cache<int, int>;
+
+    cache_type c(100, 1);
+
+    HPX_TEST(c.insert(1, 1, 60));
+    HPX_TEST(c.insert(2, 2, 60));
+    HPX_TEST_LTE(c.size(), static_cast<cache_type::size_type>(100));
+
+    HPX_TEST(c.insert(3, 3, 10));
+    HPX_TEST_LTE(c.size(), static_cast<cache_type::size_type>(100));
+
+    c.reserve(10);
+    HPX_TEST_LTE(c.size(), static_cast<cache_type::size_type>(10));
+
+    HPX_TEST_EQ(
+        c.erase([](cache_type::entry_pair const&) { return true; }), c.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent_frequency()
+{
+    using namespace hpx::util::cache;
+
+    using cache_type = concurrent_cache<int, int>;
+
+    cache_type c(1000, 1);
+
+    auto access = [&](int key) {
+        int value = 0;
+        if (!c.get_entry(key, value))
+        {
+            c.insert(key, key);
+        }
+    };
+
+    // entries accessed frequently survive a scan of many other entries
+    for (int i = 0; i != 5; ++i)
+    {
+        for (int key = 0; key != 500; ++key)
+        {
+            access(key);
+        }
+    }
+
+    for (int key = 1000; key != 100000; ++key)
+    {
+        access(key);
+        access((key * 7) % 500);
+    }
+
+    std::size_t hot = 0;
+    for (int key = 0; key != 500; ++key)
+    {
+        if (c.holds_key(key))
+        {
+            ++hot;
+        }
+    }
+
+    HPX_TEST_LTE(static_cast<std::size_t>(450), hot);
+    HPX_TEST_LTE(c.size(), static_cast<cache_type::size_type>(1000));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent_threads()
+{
+    using namespace hpx::util::cache;
+
+    using cache_type = concurrent_cache<int, int>;
+
+    cache_type c(1000);
+
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t != 4; ++t)
+    {
+        threads.emplace_back([&c, t]() {
+            std::mt19937 gen(t);
+            std::uniform_int_distribution<int> dist(0, 5000);
+
+            for (int i = 0; i != 100000; ++i)
+            {
+                int const key = dist(gen);
+
+                int value = 0;
+                if (c.get_entry(key, value))
+                {
+                    HPX_TEST_EQ(key, value);
+                }
+                else
+                {
+                    c.insert(key, key);
+                }
+            }
+        });
+    }
+
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    HPX_TEST_LTE(c.size(), static_cast<cache_type::size_type>(1000));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_concurrent_insert();
+    test_concurrent_update();
+    test_concurrent_cost();
+    test_concurrent_frequency();
+    test_concurrent_threads();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,226 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::lockfree {
+
+    /**
+     * The work_stealing_deque class implements the dynamically sized,
+     * lock-free work-stealing deque as described by Chase and Lev (Dynamic
+     * Circular Work-Stealing Deque, SPAA 2005), using the memory orderings
+     * given by Le et.al. (Correct and Efficient Work-Stealing for Weak
+     * Memory Models, PPoPP 2013).
+     *
+     * Only a single thread (the owner) may call push() and pop(), which
+     * operate on the bottom end of the deque in LIFO order. Any number of
+     * other threads may concurrently call steal(), which removes items from
+     * the top end of the deque (FIFO order).
+     *
+     * Arrays that have been outgrown are kept alive until the deque is
+     * destroyed as concurrent thieves may still be reading from them.
+     *
+     *  \b Requirements:
+     *  - T must be trivially copyable
+     */
+    template <typename T>
+    class work_stealing_deque
+    {
+        static_assert(std::is_trivially_copyable_v<T>,
+            "work_stealing_deque requires a trivially copyable value type");
+
+        class array
+        {
+        public:
+            explicit array(std::int64_t capacity)
+              : mask_(capacity - 1)
+              , buffer_(new std::atomic<T>[static_cast<std::size_t>(capacity)])
+            {
+                HPX_ASSERT(capacity != 0 && (capacity & (capacity - 1)) == 0);
+            }
+
+            [[nodiscard]] std::int64_t capacity() const noexcept
+            {
+                return mask_ + 1;
+            }
+
+            [[nodiscard]] T get(std::int64_t i) const noexcept
+            {
+                return buffer_[i & mask_].load(std::memory_order_relaxed);
+            }
+
+            void put(std::int64_t i, T val) noexcept
+            {
+                buffer_[i & mask_].store(val, std::memory_order_relaxed);
+            }
+
+            [[nodiscard]] std::unique_ptr<array> grow(
+                std::int64_t bottom, std::int64_t top) const
+            {
+                auto result = std::make_unique<array>(2 * capacity());
+                for (std::int64_t i = top; i != bottom; ++i)
+                {
+                    result->put(i, get(i));
+                }
+                return result;
+            }
+
+        private:
+            std::int64_t mask_;
+            std::unique_ptr<std::atomic<T>[]> buffer_;
+        };
+
+        static constexpr std::int64_t round_up_capacity(
+            std::size_t capacity) noexcept
+        {
+            std::int64_t result = 16;
+            while (result < static_cast<std::int64_t>(capacity))
+            {
+                result *= 2;
+            }
+            return result;
+        }
+
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+
+        explicit work_stealing_deque(std::size_t initial_capacity = 0)
+        {
+            auto a = std::make_unique<array>(
+                round_up_capacity(initial_capacity));
+            array_.data_.store(a.get(), std::memory_order_relaxed);
+            arrays_.push_back(HPX_MOVE(a));
+        }
+
+        work_stealing_deque(work_stealing_deque const&) = delete;
+        work_stealing_deque(work_stealing_deque&&) = delete;
+        work_stealing_deque& operator=(work_stealing_deque const&) = delete;
+        work_stealing_deque& operator=(work_stealing_deque&&) = delete;
+
+        ~work_stealing_deque() = default;
+
+        /// Add an item to the bottom of the deque, may be called by the
+        /// owning thread only.
+        void push(T val)
+        {
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t const t = top_.data_.load(std::memory_order_acquire);
+
+            array* a = array_.data_.load(std::memory_order_relaxed);
+            if (b - t > a->capacity() - 1)
+            {
+                // the deque is full, switch over to a larger array
+                arrays_.push_back(a->grow(b, t));
+                a = arrays_.back().get();
+                array_.data_.store(a, std::memory_order_release);
+            }
+
+            a->put(b, val);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom_.data_.store(b + 1, std::memory_order_relaxed);
+        }
+
+        /// Remove the item from the bottom of the deque (the item which was
+        /// pushed last), may be called by the owning thread only.
+        bool pop(T& val) noexcept
+        {
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_relaxed) - 1;
+            array* a = array_.data_.load(std::memory_order_relaxed);
+            bottom_.data_.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            std::int64_t t = top_.data_.load(std::memory_order_relaxed);
+            if (t > b)
+            {
+                // the deque is empty
+                bottom_.data_.store(b + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            T item = a->get(b);
+            if (t == b)
+            {
+                // this is the last item, compete with thieves for it
+                bool const success = top_.data_.compare_exchange_strong(t,
+                    t + 1, std::memory_order_seq_cst,
+                    std::memory_order_relaxed);
+                bottom_.data_.store(b + 1, std::memory_order_relaxed);
+                if (!success)
+                {
+                    return false;
+                }
+            }
+
+            val = item;
+            return true;
+        }
+
+        /// Remove the item from the top of the deque (the oldest item), may
+        /// be called by any thread. Returns false if the deque is empty or if
+        /// another thread has removed the top item concurrently.
+        bool steal(T& val) noexcept
+        {
+            std::int64_t t = top_.data_.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_acquire);
+
+            if (t >= b)
+            {
+                return false;
+            }
+
+            array const* a = array_.data_.load(std::memory_order_acquire);
+            T item = a->get(t);
+            if (!top_.data_.compare_exchange_strong(t, t + 1,
+                    std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            val = item;
+            return true;
+        }
+
+        /// Return the (approximate) number of items in the deque
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            std::int64_t const b =
+                bottom_.data_.load(std::memory_order_relaxed);
+            std::int64_t const t = top_.data_.load(std::memory_order_relaxed);
+            return b > t ? static_cast<std::size_t>(b - t) : 0;
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+    private:
+        // top_ is modified by thieves, bottom_ is modified by the owner only
+        util::cache_line_data<std::atomic<std::int64_t>> top_{0};
+        util::cache_line_data<std::atomic<std::int64_t>> bottom_{0};
+        util::cache_line_data<std::atomic<array*>> array_{nullptr};
+
+        // all arrays ever used by this deque, accessed by the owner only
+        std::vector<std::unique_ptr<array>> arrays_;
+    };
+}    // namespace hpx::lockfree
@@ -0,0 +1,136 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/modules/concurrency.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+void simple_deque_test()
+{
+    hpx::lockfree::work_stealing_deque<long> q;
+    HPX_TEST(q.empty());
+
+    q.push(1);
+    q.push(2);
+    q.push(3);
+    HPX_TEST_EQ(q.size(), std::size_t(3));
+
+    long out = 0;
+
+    // the owner pops the most recently pushed item
+    HPX_TEST(q.pop(out));
+    HPX_TEST_EQ(out, 3);
+
+    // thieves steal the oldest item
+    HPX_TEST(q.steal(out));
+    HPX_TEST_EQ(out, 1);
+
+    HPX_TEST(q.pop(out));
+    HPX_TEST_EQ(out, 2);
+
+    HPX_TEST(!q.pop(out));
+    HPX_TEST(!q.steal(out));
+    HPX_TEST(q.empty());
+}
+
+void grow_deque_test()
+{
+    constexpr long count = 1000;
+
+    hpx::lockfree::work_stealing_deque<long> q(4);
+    for (long i = 0; i != count; ++i)
+    {
+        q.push(i);
+    }
+    HPX_TEST_EQ(q.size(), std::size_t(count));
+
+    long out = 0;
+    for (long i = 0; i != count / 2; ++i)
+    {
+        HPX_TEST(q.steal(out));
+        HPX_TEST_EQ(out, i);
+    }
+    for (long i = count - 1; i != count / 2 - 1; --i)
+    {
+        HPX_TEST(q.pop(out));
+        HPX_TEST_EQ(out, i);
+    }
+    HPX_TEST(q.empty());
+}
+
+void concurrent_deque_test(std::size_t num_thieves)
+{
+    constexpr std::uint64_t count = 200000;
+
+    hpx::lockfree::work_stealing_deque<std::uint64_t> q;
+    std::vector<std::atomic<int>> seen(count);
+    std::atomic<bool> done(false);
+
+    auto consume = [&](std::uint64_t item) {
+        HPX_TEST(item < count);
+        HPX_TEST_EQ(++seen[item], 1);
+    };
+
+    std::vector<std::thread> thieves;
+    thieves.reserve(num_thieves);
+    for (std::size_t i = 0; i != num_thieves; ++i)
+    {
+        thieves.emplace_back([&]() {
+            std::uint64_t item = 0;
+            while (!done.load() || !q.empty())
+            {
+                if (q.steal(item))
+                {
+                    consume(item);
+                }
+            }
+        });
+    }
+
+    // the owner interleaves pushing and popping items
+    std::uint64_t item = 0;
+    for (std::uint64_t i = 0; i != count; ++i)
+    {
+        q.push(i);
+        if (i % 3 == 0 && q.pop(item))
+        {
+            consume(item);
+        }
+    }
+    while (q.pop(item))
+    {
+        consume(item);
+    }
+
+    done = true;
+    for (auto& t : thieves)
+    {
+        t.join();
+    }
+
+    for (auto const& s : seen)
+    {
+        HPX_TEST_EQ(s.load(), 1);
+    }
+}
+
+int main()
+{
+    simple_deque_test();
+    grow_deque_test();
+
+    std::size_t const num_thieves =
+        (std::max)(std::thread::hardware_concurrency(), 2u) - 1;
+    concurrent_deque_test(num_thieves);
+
+    return hpx::util::report_errors();
+}
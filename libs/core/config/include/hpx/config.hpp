@@ -393,6 +393,26 @@
 #  define HPX_THREAD_QUEUE_INIT_THREADS_COUNT 10
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// Number of consecutive failed attempts to steal work from nearer workers
+// before a worker steals from workers sharing its L2 cache, its L3 cache, its
+// NUMA domain, its socket, or from any other worker, respectively.
+#if !defined(HPX_THREAD_QUEUE_STEAL_THRESHOLD_L2)
+#  define HPX_THREAD_QUEUE_STEAL_THRESHOLD_L2 0
+#endif
+#if !defined(HPX_THREAD_QUEUE_STEAL_THRESHOLD_L3)
+#  define HPX_THREAD_QUEUE_STEAL_THRESHOLD_L3 0
+#endif
+#if !defined(HPX_THREAD_QUEUE_STEAL_THRESHOLD_NUMA)
+#  define HPX_THREAD_QUEUE_STEAL_THRESHOLD_NUMA 8
+#endif
+#if !defined(HPX_THREAD_QUEUE_STEAL_THRESHOLD_SOCKET)
+#  define HPX_THREAD_QUEUE_STEAL_THRESHOLD_SOCKET 16
+#endif
+#if !defined(HPX_THREAD_QUEUE_STEAL_THRESHOLD_MACHINE)
+#  define HPX_THREAD_QUEUE_STEAL_THRESHOLD_MACHINE 32
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // Maximum sleep time for idle backoff in milliseconds (used only if
 // HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF is defined).
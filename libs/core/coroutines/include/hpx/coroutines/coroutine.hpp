@@ -166,6 +166,13 @@ namespace hpx::threads::coroutines {
         }
 #endif
 
+        // Return the number of bytes of stack used by the most recent
+        // execution of this coroutine (zero if not measured)
+        std::size_t get_stack_usage() const noexcept
+        {
+            return impl_.get_stack_usage();
+        }
+
         constexpr impl_type* impl() noexcept
         {
             return &impl_;
@@ -247,6 +247,12 @@ namespace hpx::threads::coroutines {
                 return (std::numeric_limits<std::ptrdiff_t>::max)();
             }
 #endif
+            // Stack usage is not measured for this context implementation
+            static constexpr std::size_t get_stack_usage() noexcept
+            {
+                return 0;
+            }
+
             void reset_stack()
             {
                 if (ctx_)
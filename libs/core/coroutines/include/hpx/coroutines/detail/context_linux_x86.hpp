@@ -368,6 +368,12 @@ namespace hpx::threads::coroutines::detail::lx {
         void reset_stack()
         {
             HPX_ASSERT(m_stack);
+            if (posix::track_stack_usage)
+            {
+                m_stack_usage = posix::measure_stack_usage(
+                    m_stack, static_cast<std::size_t>(m_stack_size));
+            }
+
             if (posix::reset_stack(
                     m_stack, static_cast<std::size_t>(m_stack_size)))
             {
@@ -384,6 +390,8 @@ namespace hpx::threads::coroutines::detail::lx {
             increment_stack_recycle_count();
 #endif
 
+            m_stack_usage = 0;
+
             // On rebind, we initialize our stack to ensure a virgin stack
             m_sp = (static_cast<void**>(m_stack) +
                        static_cast<std::size_t>(m_stack_size) / sizeof(void*)) -
@@ -405,6 +413,13 @@ namespace hpx::threads::coroutines::detail::lx {
                 context_size;
         }
 
+        // Return the stack usage measured when the coroutine last terminated
+        // (zero if unknown)
+        constexpr std::size_t get_stack_usage() const noexcept
+        {
+            return m_stack_usage;
+        }
+
         using counter_type = std::atomic<std::int64_t>;
 
 #if defined(HPX_HAVE_COROUTINE_COUNTERS)
@@ -519,6 +534,7 @@ namespace hpx::threads::coroutines::detail::lx {
 
         std::ptrdiff_t m_stack_size;
         void* m_stack;
+        std::size_t m_stack_usage = 0;
 
 #if defined(HPX_HAVE_STACKOVERFLOW_DETECTION) &&                               \
     !defined(HPX_HAVE_ADDRESS_SANITIZER)
@@ -346,10 +346,23 @@ namespace hpx::threads::coroutines {
                 return (std::numeric_limits<std::ptrdiff_t>::max)();
             }
 #endif
+            // Return the stack usage measured when the coroutine last
+            // terminated (zero if unknown)
+            constexpr std::size_t get_stack_usage() const noexcept
+            {
+                return m_stack_usage;
+            }
+
             void reset_stack()
             {
                 if (m_stack)
                 {
+                    if (posix::track_stack_usage)
+                    {
+                        m_stack_usage = posix::measure_stack_usage(
+                            m_stack, static_cast<std::size_t>(m_stack_size));
+                    }
+
                     if (posix::reset_stack(
                             m_stack, static_cast<std::size_t>(m_stack_size)))
                     {
@@ -364,6 +377,8 @@ namespace hpx::threads::coroutines {
             {
                 if (m_stack)
                 {
+                    m_stack_usage = 0;
+
                     // just reset the context stack pointer to its initial value at
                     // the stack start
 #if defined(HPX_HAVE_COROUTINE_COUNTERS)
@@ -420,6 +435,7 @@ namespace hpx::threads::coroutines {
             // declare m_stack_size first so we can use it to initialize m_stack
             std::ptrdiff_t m_stack_size;
             void* m_stack;
+            std::size_t m_stack_usage = 0;
             void (*funp_)(void*);
 
 #if defined(HPX_HAVE_STACKOVERFLOW_DETECTION)
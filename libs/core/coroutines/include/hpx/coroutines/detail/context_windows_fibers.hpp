@@ -278,6 +278,12 @@ namespace hpx::threads::coroutines {
 
             static constexpr void reset_stack() noexcept {}
 
+            // Stack usage is not measured for this context implementation
+            static constexpr std::size_t get_stack_usage() noexcept
+            {
+                return 0;
+            }
+
 #if defined(HPX_HAVE_COROUTINE_COUNTERS)
             void rebind_stack() noexcept
             {
@@ -32,6 +32,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/coroutines/stack_pool.hpp>
 
 // include unistd.h conditionally to check for POSIX version. Not all OSs have the
 // unistd header...
@@ -78,10 +79,18 @@ namespace hpx::threads::coroutines::detail::posix {
 
     HPX_CORE_EXPORT extern bool use_guard_pages;
 
+    // this variable is used to control whether stacks are allocated from the
+    // stack pool (see hpx/coroutines/stack_pool.hpp)
+    HPX_CORE_EXPORT extern bool use_stack_pool;
+
+    // this variable is used to control whether the stack usage of coroutines
+    // is measured whenever a coroutine terminates
+    HPX_CORE_EXPORT extern bool track_stack_usage;
+
 #if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
     _POSIX_MAPPED_FILES > 0
 
-    inline void* alloc_stack(std::size_t size)
+    inline void* alloc_stack_unpooled(std::size_t size)
     {
         void* real_stack =
             ::mmap(nullptr, size + EXEC_PAGESIZE, PROT_READ | PROT_WRITE,
@@ -135,6 +144,47 @@ namespace hpx::threads::coroutines::detail::posix {
         *watermark = reinterpret_cast<void*>(0xDEADBEEFDEADBEEFull);
     }
 
+    // Return the offset of the lowest page of the given memory range that is
+    // backed by physical memory (or 'size' if no page is)
+    inline std::size_t get_lowest_resident_offset(
+        [[maybe_unused]] void* stack, std::size_t size) noexcept
+    {
+#if defined(__linux__)
+        constexpr std::size_t chunk = 64;
+        unsigned char residency[chunk];
+
+        std::size_t const num_pages = size / EXEC_PAGESIZE;
+        for (std::size_t page = 0; page < num_pages; page += chunk)
+        {
+            std::size_t const n =
+                num_pages - page < chunk ? num_pages - page : chunk;
+            if (::mincore(static_cast<char*>(stack) + page * EXEC_PAGESIZE,
+                    n * EXEC_PAGESIZE, residency) != 0)
+            {
+                return 0;    // assume everything is resident
+            }
+
+            for (std::size_t i = 0; i != n; ++i)
+            {
+                if (residency[i] & 1)
+                {
+                    return (page + i) * EXEC_PAGESIZE;
+                }
+            }
+        }
+        return size;
+#else
+        return 0;
+#endif
+    }
+
+    // Return the number of bytes of the given stack that were touched since
+    // the stack was allocated or last reset. This has page granularity.
+    inline std::size_t measure_stack_usage(void* stack, std::size_t size)
+    {
+        return size - get_lowest_resident_offset(stack, size);
+    }
+
     inline bool reset_stack(void* stack, std::size_t size)
     {
         void** watermark = static_cast<void**>(stack) +
@@ -153,7 +203,7 @@ namespace hpx::threads::coroutines::detail::posix {
         return false;
     }
 
-    inline void free_stack(void* stack, std::size_t size)
+    inline void free_stack_unpooled(void* stack, std::size_t size)
     {
 #if defined(HPX_HAVE_THREAD_GUARD_PAGE)
         if (use_guard_pages)
@@ -171,6 +221,25 @@ namespace hpx::threads::coroutines::detail::posix {
 #endif
     }
 
+    inline void* alloc_stack(std::size_t size)
+    {
+        if (use_stack_pool)
+        {
+            return coroutines::detail::allocate_pooled_stack(size);
+        }
+        return alloc_stack_unpooled(size);
+    }
+
+    inline void free_stack(void* stack, std::size_t size)
+    {
+        if (use_stack_pool)
+        {
+            coroutines::detail::deallocate_pooled_stack(stack, size);
+            return;
+        }
+        free_stack_unpooled(stack, size);
+    }
+
 #else    // non-mmap()
 
     //this should be a fine default.
@@ -199,6 +268,11 @@ namespace hpx::threads::coroutines::detail::posix {
 
     inline void watermark_stack(void* stack, std::size_t size) {}    // no-op
 
+    inline std::size_t measure_stack_usage(void*, std::size_t)
+    {
+        return 0;
+    }
+
     inline bool reset_stack(void* stack, std::size_t size)
     {
         return false;
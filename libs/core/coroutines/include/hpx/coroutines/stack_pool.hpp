@@ -0,0 +1,60 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx::threads::coroutines {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The stack pool hands out pre-guarded coroutine stacks from per-thread
+    // free lists which are backed by per-NUMA-domain depots. New stacks are
+    // carved out of larger slabs, each of which is created with a single
+    // mmap() call. Idle stacks that have been used beyond their first page
+    // are trimmed (their dirty pages are released using madvise()) whenever a
+    // worker thread has been idle for a while, slabs whose stacks are all idle
+    // in the trimmed depot are unmapped.
+    //
+    // The pool is used only on platforms that allocate stacks using mmap(),
+    // it is enabled by the configuration setting hpx.stacks.use_stack_pool.
+    // Elsewhere, pooled stacks fall back to the plain allocator.
+    namespace detail {
+
+        // Allocate/release a stack of the given size (excluding the guard
+        // page) from/to the pool of the calling thread.
+        HPX_CORE_EXPORT void* allocate_pooled_stack(std::size_t size);
+        HPX_CORE_EXPORT void deallocate_pooled_stack(
+            void* stack, std::size_t size) noexcept;
+    }    // namespace detail
+
+    // Release the dirty pages of the idle stacks held by the calling thread
+    // and by the depot of the NUMA domain the calling thread is running on,
+    // and unmap the slabs whose stacks are all idle in the trimmed depot. If
+    // 'all' is true, the calling thread hands all of its cached stacks over to
+    // its depot first and the depots of all NUMA domains are trimmed.
+    HPX_CORE_EXPORT void trim_stack_pool(bool all = false) noexcept;
+
+    // Return the number of stack allocations served from the pool
+    HPX_CORE_EXPORT std::int64_t get_stack_pool_hit_count(bool reset) noexcept;
+
+    // Return the number of stack allocations that required a new slab
+    HPX_CORE_EXPORT std::int64_t get_stack_pool_miss_count(bool reset) noexcept;
+
+    // Return the number of slabs currently owned by the pool
+    HPX_CORE_EXPORT std::int64_t get_stack_pool_slab_count(bool reset) noexcept;
+
+    // Return the number of idle stacks currently held by the pool
+    HPX_CORE_EXPORT std::int64_t get_stack_pool_idle_count(bool reset) noexcept;
+
+    // Return an upper bound of the number of bytes of idle stacks that are
+    // currently backed by physical memory
+    HPX_CORE_EXPORT std::int64_t get_stack_pool_resident_bytes(
+        bool reset) noexcept;
+}    // namespace hpx::threads::coroutines
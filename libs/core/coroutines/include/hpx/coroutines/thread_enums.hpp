@@ -10,6 +10,7 @@
 
 #include <hpx/coroutines/detail/combined_tagged_state.hpp>
 
+#include <chrono>
 #include <cstdint>
 #include <iosfwd>
 
@@ -385,4 +386,14 @@ namespace hpx::threads {
         /// The mode of the desired sharing hint
         std::int8_t sharing_mode_bits : 2;
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief The absolute point in time by which a task should have been
+    /// executed.
+    ///
+    /// Schedulers supporting deadlines (see the deadline scheduling policy)
+    /// run pending tasks in earliest-deadline-first order, all other
+    /// schedulers ignore the deadline. Tasks without a deadline use
+    /// \a thread_deadline::max().
+    using thread_deadline = std::chrono::steady_clock::time_point;
 }    // namespace hpx::threads
@@ -18,6 +18,14 @@ namespace hpx::threads::coroutines::detail::posix {
     // this global (urghhh) variable is used to control whether guard pages
     // will be used or not
     bool use_guard_pages = true;
+
+    // this variable is used to control whether stacks will be allocated from
+    // the stack pool or using a separate mmap() call for each stack
+    bool use_stack_pool = true;
+
+    // this variable is used to control whether the stack usage of terminated
+    // coroutines will be measured
+    bool track_stack_usage = false;
 }    // namespace hpx::threads::coroutines::detail::posix
 
 #endif
@@ -0,0 +1,744 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/stack_pool.hpp>
+
+#if defined(HPX_HAVE_UNISTD_H)
+#include <unistd.h>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) && defined(_POSIX_MAPPED_FILES) &&     \
+    _POSIX_MAPPED_FILES > 0 &&                                                 \
+    (defined(__linux) || defined(linux) || defined(__linux__) ||               \
+        defined(__FreeBSD__) || defined(__APPLE__))
+
+#include <hpx/assert.hpp>
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <map>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+namespace hpx::threads::coroutines::detail {
+
+    namespace {
+
+        // maximum number of distinct stack sizes managed by the pool
+        inline constexpr std::size_t max_size_classes = 8;
+
+        // maximum number of NUMA domains distinguished by the pool, threads
+        // running on higher domains share depots
+        inline constexpr std::size_t max_numa_domains = 8;
+
+        // number of idle stacks a thread keeps before handing half of them
+        // over to the depot of its NUMA domain
+        inline constexpr std::size_t max_local_stacks = 32;
+        inline constexpr std::size_t local_batch_size = max_local_stacks / 2;
+
+        // approximate size of the memory mapped with a single mmap() call
+        inline constexpr std::size_t slab_size = 4 * 1024 * 1024;
+        inline constexpr std::size_t max_stacks_per_slab = 32;
+
+        // the sentinel written by posix::watermark_stack
+        inline void* const stack_watermark =
+            reinterpret_cast<void*>(0xDEADBEEFDEADBEEFull);
+
+        ///////////////////////////////////////////////////////////////////////
+        // Idle stacks are linked through a node stored at the very top of the
+        // stack memory, this page is touched by every coroutine anyways.
+        struct free_node
+        {
+            free_node* next;
+            bool dirty;
+        };
+
+        free_node* get_node(void* stack, std::size_t size) noexcept
+        {
+            return reinterpret_cast<free_node*>(
+                       static_cast<char*>(stack) + size) -
+                1;
+        }
+
+        void* get_stack(free_node* node, std::size_t size) noexcept
+        {
+            return reinterpret_cast<char*>(node + 1) - size;
+        }
+
+        bool is_stack_dirty(void* stack, std::size_t size) noexcept
+        {
+            void** watermark = static_cast<void**>(stack) +
+                ((size - EXEC_PAGESIZE) / sizeof(void*));
+            return *watermark != stack_watermark;
+        }
+
+        // Release the pages of the given stack which were touched since it
+        // was last watermarked, except for its first page. Pages released
+        // using MADV_FREE are still reported as resident by mincore() until
+        // they are actually reclaimed, MADV_DONTNEED is used instead whenever
+        // the stack usage is measured.
+        void release_stack_pages(void* stack, std::size_t size) noexcept
+        {
+            std::size_t const used = size - EXEC_PAGESIZE;
+
+            // skip the pages below the high-water mark that were never
+            // touched
+            std::size_t const begin =
+                posix::get_lowest_resident_offset(stack, used);
+
+            if (begin < used)
+            {
+#if defined(MADV_FREE)
+                ::madvise(static_cast<char*>(stack) + begin, used - begin,
+                    posix::track_stack_usage ? MADV_DONTNEED : MADV_FREE);
+#else
+                ::madvise(static_cast<char*>(stack) + begin, used - begin,
+                    MADV_DONTNEED);
+#endif
+            }
+
+            posix::watermark_stack(stack, size);
+        }
+
+        std::size_t get_numa_domain() noexcept
+        {
+#if defined(__linux__) && defined(SYS_getcpu)
+            unsigned cpu = 0;
+            unsigned node = 0;
+            if (::syscall(SYS_getcpu, &cpu, &node, nullptr) == 0)
+            {
+                return node % max_numa_domains;
+            }
+#endif
+            return 0;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        struct stack_list
+        {
+            free_node* head = nullptr;
+            std::size_t count = 0;
+            std::size_t dirty = 0;
+
+            void push(free_node* node) noexcept
+            {
+                node->next = head;
+                head = node;
+                ++count;
+                if (node->dirty)
+                {
+                    ++dirty;
+                }
+            }
+
+            free_node* pop() noexcept
+            {
+                free_node* node = head;
+                if (node != nullptr)
+                {
+                    head = node->next;
+                    --count;
+                    if (node->dirty)
+                    {
+                        --dirty;
+                    }
+                }
+                return node;
+            }
+
+            // move up to n nodes from the front of this list to the front of
+            // the given list
+            void splice_to(stack_list& to, std::size_t n) noexcept
+            {
+                while (n-- != 0 && head != nullptr)
+                {
+                    to.push(pop());
+                }
+            }
+        };
+
+        struct depot
+        {
+            hpx::util::detail::spinlock mtx;
+            stack_list stacks;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        class stack_pool
+        {
+        public:
+            stack_pool() = default;
+
+            stack_pool(stack_pool const&) = delete;
+            stack_pool(stack_pool&&) = delete;
+            stack_pool& operator=(stack_pool const&) = delete;
+            stack_pool& operator=(stack_pool&&) = delete;
+
+            // The pool is never destroyed, see get_stack_pool().
+            ~stack_pool() = delete;
+
+            // Return the size class for the given stack size, registering
+            // a new class if needed. Returns max_size_classes if all classes
+            // are in use.
+            std::size_t get_size_class(std::size_t size) noexcept
+            {
+                for (std::size_t i = 0; i != max_size_classes; ++i)
+                {
+                    std::size_t current =
+                        sizes_[i].load(std::memory_order_acquire);
+                    if (current == size)
+                    {
+                        return i;
+                    }
+
+                    if (current == 0 &&
+                        sizes_[i].compare_exchange_strong(
+                            current, size, std::memory_order_acq_rel))
+                    {
+                        return i;
+                    }
+
+                    if (current == size)
+                    {
+                        return i;
+                    }
+                }
+                return max_size_classes;
+            }
+
+            std::size_t get_slot_size(std::size_t size) const noexcept
+            {
+#if defined(HPX_HAVE_THREAD_GUARD_PAGE)
+                if (posix::use_guard_pages)
+                {
+                    return size + EXEC_PAGESIZE;
+                }
+#endif
+                return size;
+            }
+
+            // Map a new slab and push all of its stacks onto the given list.
+            void allocate_slab(std::size_t size, stack_list& stacks)
+            {
+                std::size_t const slot_size = get_slot_size(size);
+                std::size_t const num_stacks = (std::clamp)(
+                    slab_size / slot_size, std::size_t(1), max_stacks_per_slab);
+                std::size_t const bytes = num_stacks * slot_size;
+
+                void* slab = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+#if defined(__APPLE__)
+                    MAP_PRIVATE | MAP_ANON | MAP_NORESERVE,
+#elif defined(__FreeBSD__)
+                    MAP_PRIVATE | MAP_ANON,
+#else
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+#endif
+                    -1, 0);
+
+                if (slab == MAP_FAILED)
+                {
+                    char const* error_message =
+                        "mmap() failed to allocate thread stack slab";
+                    if (ENOMEM == errno && posix::use_guard_pages)
+                    {
+                        error_message =
+                            "mmap() failed to allocate thread stack slab due "
+                            "to insufficient resources, increase "
+                            "/proc/sys/vm/max_map_count or add "
+                            "-Ihpx.stacks.use_guard_pages=0 to the command "
+                            "line";
+                    }
+                    throw std::runtime_error(error_message);
+                }
+
+                try
+                {
+                    std::lock_guard<hpx::util::detail::spinlock> l(slabs_mtx_);
+                    slabs_.emplace(static_cast<char*>(slab),
+                        slab_info{bytes, num_stacks, 0});
+                }
+                catch (...)
+                {
+                    ::munmap(slab, bytes);
+                    throw;
+                }
+
+                slab_count_.fetch_add(1, std::memory_order_relaxed);
+
+                char* slot = static_cast<char*>(slab);
+                for (std::size_t i = 0; i != num_stacks; ++i, slot += slot_size)
+                {
+                    void* stack = slot;
+#if defined(HPX_HAVE_THREAD_GUARD_PAGE)
+                    if (posix::use_guard_pages)
+                    {
+                        // Each stack has its own guard page below it. They
+                        // are protected here, while the slab is set up, and
+                        // stay in place while the stacks are reused.
+                        ::mprotect(slot, EXEC_PAGESIZE, PROT_NONE);
+                        stack = slot + EXEC_PAGESIZE;
+                    }
+#endif
+                    free_node* node = get_node(stack, size);
+                    node->dirty = false;
+                    stacks.push(node);
+                }
+
+                // stacks in a fresh slab are accounted for as having one
+                // resident page each
+                idle_count_.fetch_add(static_cast<std::int64_t>(num_stacks),
+                    std::memory_order_relaxed);
+                resident_bytes_.fetch_add(
+                    static_cast<std::int64_t>(num_stacks * EXEC_PAGESIZE),
+                    std::memory_order_relaxed);
+            }
+
+            depot& get_depot(std::size_t domain, std::size_t size_class)
+            {
+                return depots_[domain][size_class];
+            }
+
+            std::size_t get_class_size(std::size_t size_class) const noexcept
+            {
+                return sizes_[size_class].load(std::memory_order_relaxed);
+            }
+
+            // Release the dirty pages of all stacks on the given list.
+            void trim(stack_list& stacks, std::size_t size) noexcept
+            {
+                if (stacks.dirty == 0)
+                {
+                    return;
+                }
+
+                std::size_t trimmed = 0;
+                for (free_node* node = stacks.head; node != nullptr;
+                     node = node->next)
+                {
+                    if (!node->dirty)
+                    {
+                        continue;
+                    }
+
+                    release_stack_pages(get_stack(node, size), size);
+                    node->dirty = false;
+                    ++trimmed;
+                }
+
+                stacks.dirty = 0;
+                resident_bytes_.fetch_sub(
+                    static_cast<std::int64_t>(
+                        trimmed * (size - EXEC_PAGESIZE)),
+                    std::memory_order_relaxed);
+            }
+
+            void trim_depot(std::size_t domain, std::size_t size_class) noexcept
+            {
+                std::size_t const size = get_class_size(size_class);
+                if (size == 0)
+                {
+                    return;
+                }
+
+                // trimming is opportunistic, don't compete with threads
+                // which are allocating stacks
+                depot& d = get_depot(domain, size_class);
+                std::unique_lock<hpx::util::detail::spinlock> l(
+                    d.mtx, std::try_to_lock);
+                if (l.owns_lock())
+                {
+                    trim(d.stacks, size);
+                    release_idle_slabs(d.stacks);
+                }
+            }
+
+            // Unmap all slabs whose stacks are all held by the given (already
+            // trimmed) list. Slabs with stacks in use or cached elsewhere are
+            // left alone.
+            void release_idle_slabs(stack_list& stacks) noexcept
+            {
+                HPX_ASSERT(stacks.dirty == 0);
+                if (stacks.head == nullptr)
+                {
+                    return;
+                }
+
+                std::lock_guard<hpx::util::detail::spinlock> l(slabs_mtx_);
+
+                auto find_slab = [this](free_node* node) {
+                    auto it = slabs_.upper_bound(reinterpret_cast<char*>(node));
+                    HPX_ASSERT(it != slabs_.begin());
+                    return --it;
+                };
+
+                for (free_node* node = stacks.head; node != nullptr;
+                     node = node->next)
+                {
+                    ++find_slab(node)->second.idle;
+                }
+
+                // unlink the stacks of idle slabs before unmapping them, the
+                // list nodes live in the stack memory
+                free_node** next = &stacks.head;
+                while (*next != nullptr)
+                {
+                    slab_info const& info = find_slab(*next)->second;
+                    if (info.idle == info.num_stacks)
+                    {
+                        *next = (*next)->next;
+                        --stacks.count;
+                    }
+                    else
+                    {
+                        next = &(*next)->next;
+                    }
+                }
+
+                for (auto it = slabs_.begin(); it != slabs_.end(); /**/)
+                {
+                    if (it->second.idle != it->second.num_stacks)
+                    {
+                        it->second.idle = 0;
+                        ++it;
+                        continue;
+                    }
+
+                    ::munmap(it->first, it->second.bytes);
+
+                    // trimmed stacks are accounted for as having one
+                    // resident page each
+                    slab_count_.fetch_sub(1, std::memory_order_relaxed);
+                    idle_count_.fetch_sub(
+                        static_cast<std::int64_t>(it->second.num_stacks),
+                        std::memory_order_relaxed);
+                    resident_bytes_.fetch_sub(
+                        static_cast<std::int64_t>(
+                            it->second.num_stacks * EXEC_PAGESIZE),
+                        std::memory_order_relaxed);
+
+                    it = slabs_.erase(it);
+                }
+            }
+
+            void on_hit() noexcept
+            {
+                hit_count_.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            void on_miss() noexcept
+            {
+                miss_count_.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            void on_allocate(free_node* node, std::size_t size) noexcept
+            {
+                idle_count_.fetch_sub(1, std::memory_order_relaxed);
+                resident_bytes_.fetch_sub(
+                    static_cast<std::int64_t>(
+                        node->dirty ? size : EXEC_PAGESIZE),
+                    std::memory_order_relaxed);
+            }
+
+            void on_deallocate(free_node* node, std::size_t size) noexcept
+            {
+                idle_count_.fetch_add(1, std::memory_order_relaxed);
+                resident_bytes_.fetch_add(
+                    static_cast<std::int64_t>(
+                        node->dirty ? size : EXEC_PAGESIZE),
+                    std::memory_order_relaxed);
+            }
+
+            std::atomic<std::int64_t> hit_count_ = 0;
+            std::atomic<std::int64_t> miss_count_ = 0;
+            std::atomic<std::int64_t> slab_count_ = 0;
+            std::atomic<std::int64_t> idle_count_ = 0;
+            std::atomic<std::int64_t> resident_bytes_ = 0;
+
+        private:
+            struct slab_info
+            {
+                std::size_t bytes;
+                std::size_t num_stacks;
+                std::size_t idle;    // used while releasing idle slabs only
+            };
+
+            std::array<std::atomic<std::size_t>, max_size_classes> sizes_ = {};
+            std::array<std::array<depot, max_size_classes>, max_numa_domains>
+                depots_;
+
+            // all slabs currently owned by the pool, keyed by their address
+            hpx::util::detail::spinlock slabs_mtx_;
+            std::map<char*, slab_info> slabs_;
+        };
+
+        // The pool is intentionally leaked. The stack caches of threads which
+        // exit after the static objects have been destroyed (e.g. threads
+        // detached by the application) still hand their stacks back to the
+        // depots of the pool.
+        stack_pool& get_stack_pool()
+        {
+            static stack_pool& pool = *new stack_pool;
+            return pool;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The stacks cached by a single (worker-) thread. Stacks released by
+        // a thread are reused by the same thread first, which keeps their
+        // already touched pages close to the NUMA domain they were first
+        // touched on.
+        struct local_stack_cache
+        {
+            local_stack_cache()
+              : pool(get_stack_pool())
+              , domain(get_numa_domain())
+            {
+            }
+
+            local_stack_cache(local_stack_cache const&) = delete;
+            local_stack_cache(local_stack_cache&&) = delete;
+            local_stack_cache& operator=(local_stack_cache const&) = delete;
+            local_stack_cache& operator=(local_stack_cache&&) = delete;
+
+            ~local_stack_cache()
+            {
+                // hand all cached stacks back to the depots
+                for (std::size_t i = 0; i != max_size_classes; ++i)
+                {
+                    if (stacks[i].head != nullptr)
+                    {
+                        depot& d = pool.get_depot(domain, i);
+                        std::lock_guard<hpx::util::detail::spinlock> l(d.mtx);
+                        stacks[i].splice_to(d.stacks, stacks[i].count);
+                    }
+                }
+            }
+
+            stack_pool& pool;
+            std::size_t domain;
+            std::array<stack_list, max_size_classes> stacks;
+        };
+
+        local_stack_cache& get_local_stack_cache()
+        {
+            static thread_local local_stack_cache cache;
+            return cache;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void* allocate_pooled_stack(std::size_t size)
+    {
+        local_stack_cache& cache = get_local_stack_cache();
+        std::size_t const size_class = cache.pool.get_size_class(size);
+        if (size_class == max_size_classes)
+        {
+            return posix::alloc_stack_unpooled(size);
+        }
+
+        stack_list& stacks = cache.stacks[size_class];
+        if (stacks.head != nullptr)
+        {
+            cache.pool.on_hit();
+        }
+        else
+        {
+            {
+                depot& d = cache.pool.get_depot(cache.domain, size_class);
+                std::lock_guard<hpx::util::detail::spinlock> l(d.mtx);
+                d.stacks.splice_to(stacks, local_batch_size);
+            }
+
+            if (stacks.head != nullptr)
+            {
+                cache.pool.on_hit();
+            }
+            else
+            {
+                cache.pool.on_miss();
+                cache.pool.allocate_slab(size, stacks);
+                HPX_ASSERT(stacks.head != nullptr);
+            }
+        }
+
+        free_node* node = stacks.pop();
+        cache.pool.on_allocate(node, size);
+
+        void* stack = get_stack(node, size);
+        if (posix::track_stack_usage && node->dirty)
+        {
+            // the usage measured for this stack must not include the pages
+            // touched by its previous user
+            release_stack_pages(stack, size);
+        }
+        return stack;
+    }
+
+    void deallocate_pooled_stack(void* stack, std::size_t size) noexcept
+    {
+        local_stack_cache& cache = get_local_stack_cache();
+        std::size_t const size_class = cache.pool.get_size_class(size);
+        if (size_class == max_size_classes)
+        {
+            posix::free_stack_unpooled(stack, size);
+            return;
+        }
+
+        free_node* node = get_node(stack, size);
+        node->dirty = is_stack_dirty(stack, size);
+        cache.pool.on_deallocate(node, size);
+
+        stack_list& stacks = cache.stacks[size_class];
+        stacks.push(node);
+
+        if (stacks.count > max_local_stacks)
+        {
+            depot& d = cache.pool.get_depot(cache.domain, size_class);
+            std::lock_guard<hpx::util::detail::spinlock> l(d.mtx);
+            stacks.splice_to(d.stacks, local_batch_size);
+        }
+    }
+}    // namespace hpx::threads::coroutines::detail
+
+namespace hpx::threads::coroutines {
+
+    void trim_stack_pool(bool all) noexcept
+    {
+        using namespace detail;
+
+        local_stack_cache& cache = get_local_stack_cache();
+        for (std::size_t i = 0; i != max_size_classes; ++i)
+        {
+            std::size_t const size = cache.pool.get_class_size(i);
+            if (size == 0)
+            {
+                break;
+            }
+
+            cache.pool.trim(cache.stacks[i], size);
+
+            if (all)
+            {
+                // hand the stacks cached by this thread over to its depot,
+                // this allows to release slabs which are entirely idle
+                if (cache.stacks[i].head != nullptr)
+                {
+                    depot& d = cache.pool.get_depot(cache.domain, i);
+                    std::lock_guard<hpx::util::detail::spinlock> l(d.mtx);
+                    cache.stacks[i].splice_to(d.stacks, cache.stacks[i].count);
+                }
+
+                for (std::size_t domain = 0; domain != max_numa_domains;
+                     ++domain)
+                {
+                    cache.pool.trim_depot(domain, i);
+                }
+            }
+            else
+            {
+                cache.pool.trim_depot(cache.domain, i);
+            }
+        }
+    }
+
+    std::int64_t get_stack_pool_hit_count(bool reset) noexcept
+    {
+        return util::get_and_reset_value(
+            detail::get_stack_pool().hit_count_, reset);
+    }
+
+    std::int64_t get_stack_pool_miss_count(bool reset) noexcept
+    {
+        return util::get_and_reset_value(
+            detail::get_stack_pool().miss_count_, reset);
+    }
+
+    std::int64_t get_stack_pool_slab_count(bool) noexcept
+    {
+        return detail::get_stack_pool().slab_count_.load(
+            std::memory_order_relaxed);
+    }
+
+    std::int64_t get_stack_pool_idle_count(bool) noexcept
+    {
+        return detail::get_stack_pool().idle_count_.load(
+            std::memory_order_relaxed);
+    }
+
+    std::int64_t get_stack_pool_resident_bytes(bool) noexcept
+    {
+        return detail::get_stack_pool().resident_bytes_.load(
+            std::memory_order_relaxed);
+    }
+}    // namespace hpx::threads::coroutines
+
+#else
+
+#include <new>
+
+namespace hpx::threads::coroutines::detail {
+
+    // Stacks can't be pooled without mmap(), fall back to the plain
+    // allocator (hpx.stacks.use_stack_pool is disabled by default in this
+    // case).
+    inline constexpr std::size_t stack_alignment =
+        sizeof(void*) > 16 ? sizeof(void*) : 16;
+
+    void* allocate_pooled_stack(std::size_t size)
+    {
+        return ::operator new(size, std::align_val_t(stack_alignment));
+    }
+
+    void deallocate_pooled_stack(void* stack, std::size_t) noexcept
+    {
+        ::operator delete(stack, std::align_val_t(stack_alignment));
+    }
+}    // namespace hpx::threads::coroutines::detail
+
+namespace hpx::threads::coroutines {
+
+    void trim_stack_pool(bool) noexcept {}
+
+    std::int64_t get_stack_pool_hit_count(bool) noexcept
+    {
+        return 0;
+    }
+
+    std::int64_t get_stack_pool_miss_count(bool) noexcept
+    {
+        return 0;
+    }
+
+    std::int64_t get_stack_pool_slab_count(bool) noexcept
+    {
+        return 0;
+    }
+
+    std::int64_t get_stack_pool_idle_count(bool) noexcept
+    {
+        return 0;
+    }
+
+    std::int64_t get_stack_pool_resident_bytes(bool) noexcept
+    {
+        return 0;
+    }
+}    // namespace hpx::threads::coroutines
+
+#endif
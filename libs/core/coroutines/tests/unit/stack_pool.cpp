@@ -0,0 +1,181 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_THREAD_STACK_MMAP) &&                                     \
+    (defined(__linux) || defined(linux) || defined(__linux__))
+
+#include <hpx/coroutines/detail/posix_utility.hpp>
+#include <hpx/coroutines/stack_pool.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <set>
+#include <vector>
+
+namespace posix = hpx::threads::coroutines::detail::posix;
+namespace coroutines = hpx::threads::coroutines;
+
+constexpr std::size_t stack_size = 16 * EXEC_PAGESIZE;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_reuse()
+{
+    coroutines::get_stack_pool_hit_count(true);
+    coroutines::get_stack_pool_miss_count(true);
+
+    void* stack = posix::alloc_stack(stack_size);
+    HPX_TEST(stack != nullptr);
+    HPX_TEST_EQ(coroutines::get_stack_pool_miss_count(false), 1);
+    posix::watermark_stack(stack, stack_size);
+    posix::free_stack(stack, stack_size);
+
+    // the most recently released stack is handed out first
+    void* reused = posix::alloc_stack(stack_size);
+    HPX_TEST_EQ(stack, reused);
+    HPX_TEST_EQ(coroutines::get_stack_pool_hit_count(false), 1);
+    HPX_TEST_EQ(coroutines::get_stack_pool_miss_count(false), 1);
+    posix::free_stack(reused, stack_size);
+}
+
+void test_many_stacks()
+{
+    std::int64_t const slabs = coroutines::get_stack_pool_slab_count(false);
+
+    std::vector<void*> stacks;
+    std::set<void*> unique;
+    for (int i = 0; i != 100; ++i)
+    {
+        void* stack = posix::alloc_stack(stack_size);
+        posix::watermark_stack(stack, stack_size);
+
+        // the whole stack must be writable, this also overwrites the
+        // watermark
+        std::memset(stack, 0xcd, stack_size);
+
+        stacks.push_back(stack);
+        unique.insert(stack);
+    }
+    HPX_TEST_EQ(unique.size(), stacks.size());
+
+    // stacks are mapped in batches
+    HPX_TEST_LT(coroutines::get_stack_pool_slab_count(false) - slabs,
+        static_cast<std::int64_t>(stacks.size()));
+
+    for (void* stack : stacks)
+    {
+        posix::free_stack(stack, stack_size);
+    }
+    HPX_TEST_LTE(static_cast<std::int64_t>(stacks.size()),
+        coroutines::get_stack_pool_idle_count(false));
+
+    // all released stacks were used beyond their first page
+    std::int64_t const resident =
+        coroutines::get_stack_pool_resident_bytes(false);
+    coroutines::trim_stack_pool(true);
+    HPX_TEST_LT(coroutines::get_stack_pool_resident_bytes(false), resident);
+
+    // trimmed stacks are usable again
+    void* stack = posix::alloc_stack(stack_size);
+    std::memset(stack, 0xcd, stack_size);
+    posix::free_stack(stack, stack_size);
+}
+
+void test_release_slabs()
+{
+    std::vector<void*> stacks;
+    for (int i = 0; i != 100; ++i)
+    {
+        void* stack = posix::alloc_stack(stack_size);
+        std::memset(stack, 0xcd, stack_size);
+        stacks.push_back(stack);
+    }
+
+    std::int64_t const slabs = coroutines::get_stack_pool_slab_count(false);
+    HPX_TEST_LT(static_cast<std::int64_t>(0), slabs);
+
+    for (void* stack : stacks)
+    {
+        posix::free_stack(stack, stack_size);
+    }
+
+    // all stacks are idle and held by this thread's depot, so all slabs are
+    // released
+    coroutines::trim_stack_pool(true);
+    HPX_TEST_EQ(coroutines::get_stack_pool_slab_count(false),
+        static_cast<std::int64_t>(0));
+    HPX_TEST_EQ(coroutines::get_stack_pool_idle_count(false),
+        static_cast<std::int64_t>(0));
+    HPX_TEST_EQ(coroutines::get_stack_pool_resident_bytes(false),
+        static_cast<std::int64_t>(0));
+
+    // a slab in use is kept
+    void* stack = posix::alloc_stack(stack_size);
+    std::memset(stack, 0xcd, stack_size);
+    coroutines::trim_stack_pool(true);
+    HPX_TEST_EQ(coroutines::get_stack_pool_slab_count(false),
+        static_cast<std::int64_t>(1));
+    posix::free_stack(stack, stack_size);
+}
+
+void test_measure_reused()
+{
+    posix::track_stack_usage = true;
+
+    // measure the usage of a stack that was trimmed or handed out again
+    // without being trimmed
+    for (bool trim : {true, false})
+    {
+        void* stack = posix::alloc_stack(stack_size);
+        posix::watermark_stack(stack, stack_size);
+        std::memset(stack, 0xcd, stack_size);
+        HPX_TEST_EQ(posix::measure_stack_usage(stack, stack_size), stack_size);
+        posix::free_stack(stack, stack_size);
+
+        if (trim)
+        {
+            coroutines::trim_stack_pool();
+        }
+
+        void* reused = posix::alloc_stack(stack_size);
+        HPX_TEST_EQ(stack, reused);
+
+        // only the first page is still resident
+        HPX_TEST_EQ(posix::measure_stack_usage(reused, stack_size),
+            static_cast<std::size_t>(EXEC_PAGESIZE));
+
+        // touch the topmost four pages
+        std::memset(static_cast<char*>(reused) + stack_size - 4 * EXEC_PAGESIZE,
+            0xcd, 4 * EXEC_PAGESIZE);
+        HPX_TEST_EQ(posix::measure_stack_usage(reused, stack_size),
+            static_cast<std::size_t>(4 * EXEC_PAGESIZE));
+
+        posix::free_stack(reused, stack_size);
+    }
+
+    posix::track_stack_usage = false;
+}
+
+int main()
+{
+    test_reuse();
+    test_many_stacks();
+    test_release_slabs();
+    test_measure_reused();
+
+    return hpx::util::report_errors();
+}
+
+#else
+
+int main()
+{
+    return 0;
+}
+
+#endif
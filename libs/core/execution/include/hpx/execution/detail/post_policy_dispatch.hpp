@@ -23,6 +23,24 @@
 
 namespace hpx::detail {
 
+    ////////////////////////////////////////////////////////////////////////////
+    // Create the data describing a new HPX thread which runs the given function
+    // as mandated by the given asynchronous launch policy. This is used by
+    // post_policy_dispatch<launch::async_policy>, and for creating many of
+    // those threads in one go using threads::register_work_bulk.
+    template <typename Policy, typename F, typename... Ts>
+    threads::thread_init_data make_post_thread_init_data(Policy const& policy,
+        hpx::threads::thread_description const& desc, F&& f, Ts&&... ts)
+    {
+        threads::thread_init_data data(
+            threads::make_thread_function_nullary(hpx::util::deferred_call(
+                HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...)),
+            desc, policy.priority(), policy.hint(), policy.stacksize(),
+            threads::thread_schedule_state::pending);
+        data.deadline = policy.deadline();
+        return data;
+    }
+
     ////////////////////////////////////////////////////////////////////////////
     // forward declaration
     template <typename Policy>
@@ -36,11 +54,8 @@ namespace hpx::detail {
             hpx::threads::thread_description const& desc,
             threads::thread_pool_base* pool, F&& f, Ts&&... ts)
         {
-            threads::thread_init_data data(
-                threads::make_thread_function_nullary(hpx::util::deferred_call(
-                    HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...)),
-                desc, policy.priority(), policy.hint(), policy.stacksize(),
-                threads::thread_schedule_state::pending);
+            threads::thread_init_data data = make_post_thread_init_data(
+                policy, desc, HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
 
             threads::register_work(data, pool);
         }
@@ -70,6 +85,7 @@ namespace hpx::detail {
                     static_cast<std::int16_t>(get_worker_thread_num())),
                 policy.stacksize(),
                 threads::thread_schedule_state::pending_do_not_schedule, true);
+            data.deadline = policy.deadline();
 
             threads::thread_id_ref_type tid =
                 threads::register_thread(data, pool);
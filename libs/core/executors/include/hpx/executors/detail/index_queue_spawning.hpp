@@ -25,6 +25,8 @@
 #include <hpx/iterator_support/range.hpp>
 #include <hpx/modules/memory.hpp>
 #include <hpx/resource_partitioner/detail/partitioner.hpp>
+#include <hpx/threading_base/register_thread.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
 #include <hpx/topology/cpu_mask.hpp>
 #include <hpx/type_support/pack.hpp>
@@ -298,10 +300,12 @@ namespace hpx::parallel::execution::detail {
         }
 
         // Spawn a task which will process a number of chunks. If the queue
-        // contains no chunks no task will be spawned.
+        // contains no chunks no task will be spawned. Asynchronous tasks are
+        // appended to bulk_tasks instead, if given, to be created in one go.
         template <typename Task>
         void do_work_task(hpx::threads::thread_description const& desc,
             threads::thread_pool_base* pool, bool dont_bind_to_core,
+            std::vector<threads::thread_init_data>* bulk_tasks,
             Task&& task_f) const
         {
             std::uint32_t const worker_thread = task_f.worker_thread;
@@ -340,9 +344,14 @@ namespace hpx::parallel::execution::detail {
                 hint.mode = hpx::threads::thread_schedule_hint_mode::thread;
                 hint.hint = worker_thread + first_thread;
 
-                hpx::detail::post_policy_dispatch<Launch>::call(
-                    hpx::execution::experimental::with_hint(post_policy, hint),
-                    desc, pool, HPX_FORWARD(Task, task_f));
+                post_policy =
+                    hpx::execution::experimental::with_hint(post_policy, hint);
+            }
+
+            if (bulk_tasks != nullptr && post_policy == hpx::launch::async)
+            {
+                bulk_tasks->push_back(hpx::detail::make_post_thread_init_data(
+                    post_policy, desc, HPX_FORWARD(Task, task_f)));
             }
             else
             {
@@ -436,6 +445,11 @@ namespace hpx::parallel::execution::detail {
             bool allow_stealing =
                 !hpx::threads::do_not_share_function(hint.sharing_mode());
 
+            // the tasks for all worker threads are handed to the scheduler
+            // in one go
+            std::vector<threads::thread_init_data> bulk_tasks;
+            bulk_tasks.reserve(num_threads);
+
             for (std::uint32_t pu = 0;
                  worker_thread != num_threads && pu != num_pus; ++pu)
             {
@@ -467,7 +481,7 @@ namespace hpx::parallel::execution::detail {
                 }
 
                 // Schedule task for this worker thread
-                do_work_task(desc, pool, false,
+                do_work_task(desc, pool, false, &bulk_tasks,
                     task_function<index_queue_bulk_state>{
                         hpx::intrusive_ptr<index_queue_bulk_state>(this), size,
                         chunk_size, worker_thread, reverse_placement,
@@ -484,12 +498,18 @@ namespace hpx::parallel::execution::detail {
             if (main_thread_ok)
             {
                 // Handle the queue for the local thread.
-                do_work_task(desc, pool, true,
+                do_work_task(desc, pool, true, &bulk_tasks,
                     task_function<index_queue_bulk_state>{
                         hpx::intrusive_ptr<index_queue_bulk_state>(this), size,
                         chunk_size, local_worker_thread, reverse_placement,
                         allow_stealing});
             }
+
+            if (!bulk_tasks.empty())
+            {
+                threads::register_work_bulk(
+                    bulk_tasks.data(), bulk_tasks.size(), pool);
+            }
         }
 
         std::uint32_t first_thread;
@@ -21,6 +21,7 @@
 #include <hpx/modules/topology.hpp>
 #include <hpx/threading_base/annotated_function.hpp>
 #include <hpx/threading_base/register_thread.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/timing/steady_clock.hpp>
 
 #include <cstddef>
@@ -28,6 +29,7 @@
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace hpx::execution::experimental {
 
@@ -207,6 +209,30 @@ namespace hpx::execution::experimental {
             execute(HPX_FORWARD(F, f), policy_);
         }
 
+        // Create the data describing a new HPX thread which runs the given
+        // function using the given (asynchronous) policy. Threads created
+        // this way are scheduled in one go using execute_bulk.
+        template <typename F>
+        threads::thread_init_data make_thread_init_data(
+            F&& f, Policy const& policy) const
+        {
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+            hpx::threads::thread_description desc(f, annotation_);
+#else
+            hpx::threads::thread_description desc(f);
+#endif
+            return hpx::detail::make_post_thread_init_data(
+                policy, desc, HPX_FORWARD(F, f));
+        }
+
+        void execute_bulk(std::vector<threads::thread_init_data>& data) const
+        {
+            auto pool =
+                pool_ ? pool_ : threads::detail::get_self_or_default_pool();
+
+            threads::register_work_bulk(data.data(), data.size(), pool);
+        }
+
         template <typename Scheduler, typename Receiver>
         struct operation_state
         {
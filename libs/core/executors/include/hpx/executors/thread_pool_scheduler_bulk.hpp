@@ -32,6 +32,7 @@
 #include <hpx/iterator_support/traits/is_range.hpp>
 #include <hpx/resource_partitioner/detail/partitioner.hpp>
 #include <hpx/threading_base/annotated_function.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/topology/cpu_mask.hpp>
 #include <hpx/type_support/pack.hpp>
 
@@ -380,9 +381,12 @@ namespace hpx::execution::experimental::detail {
         }
 
         // Spawn a task which will process a number of chunks. If the queue
-        // contains no chunks no task will be spawned.
+        // contains no chunks no task will be spawned. Asynchronous tasks are
+        // appended to bulk_tasks instead, to be scheduled in one go.
         template <typename Task>
-        void do_work_task(Task&& task_f) const
+        void do_work_task(
+            std::vector<hpx::threads::thread_init_data>& bulk_tasks,
+            Task&& task_f) const
         {
             std::uint32_t const worker_thread = task_f.worker_thread;
             auto& queue = op_state->queues[worker_thread].data_;
@@ -394,6 +398,7 @@ namespace hpx::execution::experimental::detail {
                 return;
             }
 
+            auto policy = op_state->scheduler.policy();
             auto hint =
                 hpx::execution::experimental::get_hint(op_state->scheduler);
             if (hint.mode == hpx::threads::thread_schedule_hint_mode::none &&
@@ -403,14 +408,17 @@ namespace hpx::execution::experimental::detail {
                 hint.mode = hpx::threads::thread_schedule_hint_mode::thread;
                 hint.hint = worker_thread + op_state->first_thread;
 
-                auto policy = hpx::execution::experimental::with_hint(
-                    op_state->scheduler.policy(), hint);
+                policy = hpx::execution::experimental::with_hint(policy, hint);
+            }
 
-                op_state->scheduler.execute(HPX_FORWARD(Task, task_f), policy);
+            if (policy == hpx::launch::async)
+            {
+                bulk_tasks.push_back(op_state->scheduler.make_thread_init_data(
+                    HPX_FORWARD(Task, task_f), policy));
             }
             else
             {
-                op_state->scheduler.execute(HPX_FORWARD(Task, task_f));
+                op_state->scheduler.execute(HPX_FORWARD(Task, task_f), policy);
             }
         }
 
@@ -524,6 +532,11 @@ namespace hpx::execution::experimental::detail {
             bool allow_stealing =
                 !hpx::threads::do_not_share_function(hint.sharing_mode());
 
+            // the tasks for all other worker threads are handed to the
+            // scheduler in one go
+            std::vector<hpx::threads::thread_init_data> bulk_tasks;
+            bulk_tasks.reserve(op_state->num_worker_threads);
+
             for (std::uint32_t pu = 0;
                  worker_thread != op_state->num_worker_threads && pu != num_pus;
                  ++pu)
@@ -556,7 +569,7 @@ namespace hpx::execution::experimental::detail {
                 }
 
                 // Schedule task for this worker thread
-                do_work_task(
+                do_work_task(bulk_tasks,
                     task_function<OperationState>{op_state, size, chunk_size,
                         worker_thread, reverse_placement, allow_stealing});
 
@@ -567,6 +580,11 @@ namespace hpx::execution::experimental::detail {
             // the PU-mask
             HPX_ASSERT(worker_thread == op_state->num_worker_threads);
 
+            if (!bulk_tasks.empty())
+            {
+                op_state->scheduler.execute_bulk(bulk_tasks);
+            }
+
             // Handle the queue for the local thread.
             if (main_thread_ok)
             {
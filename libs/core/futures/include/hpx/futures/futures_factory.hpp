@@ -111,6 +111,7 @@ namespace hpx::lcos::local {
                         policy.stacksize(),
                         threads::thread_schedule_state::pending_do_not_schedule,
                         true);
+                    data.deadline = policy.deadline();
 
                     return threads::register_thread(data, pool, ec);
                 }
@@ -121,6 +122,7 @@ namespace hpx::lcos::local {
                     threads::thread_description(f_, annotation),
                     policy.priority(), policy.hint(), policy.stacksize(),
                     threads::thread_schedule_state::pending);
+                data.deadline = policy.deadline();
 
                 return threads::register_work(data, pool, ec);
             }
@@ -315,12 +315,16 @@ namespace hpx::lcos::detail {
                     "the future to attach has no valid shared state");
             }
 
+            // Capture whether the continuation has to run asynchronously
+            // instead of the whole launch policy. This keeps the callback
+            // small enough to be stored without an additional allocation.
+            bool const is_async = hpx::detail::has_async_policy(policy);
+
             ptr->execute_deferred();
             ptr->set_on_completed(
-                [this_ = HPX_MOVE(this_), state = HPX_MOVE(state),
-                    policy = HPX_FORWARD(Policy, policy),
+                [this_ = HPX_MOVE(this_), state = HPX_MOVE(state), is_async,
                     spawner = HPX_FORWARD(Spawner, spawner)]() mutable -> void {
-                    if (hpx::detail::has_async_policy(policy))
+                    if (is_async)
                     {
                         this_->template async<Unwrap>(
                             HPX_MOVE(state), HPX_FORWARD(Spawner, spawner));
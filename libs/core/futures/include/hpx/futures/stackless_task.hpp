@@ -0,0 +1,294 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file stackless_task.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/config/coroutines_support.hpp>
+
+#if defined(HPX_HAVE_CXX20_COROUTINES)
+
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/traits/detail/future_await_traits.hpp>
+#include <hpx/futures/traits/is_future.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::experimental {
+
+    template <typename T = void>
+    class stackless_task;
+}    // namespace hpx::experimental
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::lcos::detail {
+
+    // Allocate and free the frames of stackless tasks. Frames are cached per
+    // OS thread, thus allocating the frame of a new task usually reuses the
+    // frame of a task which has recently finished on the same worker thread.
+    HPX_CORE_EXPORT void* allocate_coroutine_frame(std::size_t size);
+    HPX_CORE_EXPORT void deallocate_coroutine_frame(
+        void* p, std::size_t size) noexcept;
+
+    // Schedule the given coroutine to be resumed by a stackless HPX thread.
+    // The coroutine is resumed directly if no HPX thread can be created.
+    HPX_CORE_EXPORT void schedule_coroutine(coroutine_handle<> rh,
+        threads::thread_schedule_hint hint = threads::thread_schedule_hint());
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Awaiting a future from inside a stackless task schedules the task to be
+    // resumed on a worker thread once the future has become ready, instead
+    // of resuming it on the thread which happens to make the future ready.
+    template <typename Future>
+    struct stackless_awaiter
+    {
+        Future& f_;
+
+        [[nodiscard]] bool await_ready() const noexcept
+        {
+            return f_.is_ready();
+        }
+
+        void await_suspend(coroutine_handle<> rh)
+        {
+            // prefer resuming on the current worker thread, the frame is
+            // likely to still be in its caches
+            threads::thread_schedule_hint hint;
+            std::size_t const num_thread =
+                threads::detail::get_local_thread_num_tss();
+            if (num_thread != std::size_t(-1))
+            {
+                hint = threads::thread_schedule_hint(
+                    static_cast<std::int16_t>(num_thread));
+            }
+
+            // the frame must not be accessed after the callback is attached,
+            // the coroutine might be running already
+            traits::detail::get_shared_state(f_)->set_on_completed(
+                [rh, hint]() { schedule_coroutine(rh, hint); });
+        }
+
+        decltype(auto) await_resume()
+        {
+            return lcos::detail::await_resume(f_);
+        }
+    };
+
+    template <typename T>
+    struct is_stackless_task : std::false_type
+    {
+    };
+
+    template <typename T>
+    struct is_stackless_task<hpx::experimental::stackless_task<T>>
+      : std::true_type
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename Derived>
+    struct stackless_task_promise_base : coroutine_promise_base<T, Derived>
+    {
+        using base_type = coroutine_promise_base<T, Derived>;
+
+        stackless_task_promise_base() = default;
+
+        hpx::experimental::stackless_task<T> get_return_object()
+        {
+            return hpx::experimental::stackless_task<T>(
+                base_type::get_return_object());
+        }
+
+        // The body of the task is not run by the caller, the task is handed
+        // to the scheduler instead.
+        struct initial_awaiter : coro::suspend_always
+        {
+            void await_suspend(coroutine_handle<> rh) const
+            {
+                schedule_coroutine(rh);
+            }
+        };
+
+        constexpr initial_awaiter initial_suspend() const noexcept
+        {
+            return initial_awaiter{};
+        }
+
+        void unhandled_exception() noexcept
+        {
+            this->base_type::set_exception(std::current_exception());
+        }
+
+        // futures (and other stackless tasks) are awaited such that the task
+        // is resumed by the scheduler, all other awaitables are left alone
+        template <typename Future,
+            typename = std::enable_if_t<
+                hpx::traits::is_future_v<std::decay_t<Future>>>>
+        stackless_awaiter<std::decay_t<Future>> await_transform(
+            Future&& f) noexcept
+        {
+            return stackless_awaiter<std::decay_t<Future>>{f};
+        }
+
+        template <typename U>
+        stackless_awaiter<hpx::future<U>> await_transform(
+            hpx::experimental::stackless_task<U>& task) noexcept
+        {
+            return stackless_awaiter<hpx::future<U>>{task.future_};
+        }
+
+        template <typename U>
+        stackless_awaiter<hpx::future<U>> await_transform(
+            hpx::experimental::stackless_task<U>&& task) noexcept
+        {
+            return stackless_awaiter<hpx::future<U>>{task.future_};
+        }
+
+        template <typename Awaitable,
+            typename = std::enable_if_t<
+                !hpx::traits::is_future_v<std::decay_t<Awaitable>> &&
+                !is_stackless_task<std::decay_t<Awaitable>>::value>>
+        Awaitable&& await_transform(Awaitable&& awaitable) noexcept
+        {
+            return HPX_FORWARD(Awaitable, awaitable);
+        }
+
+        [[nodiscard]] HPX_FORCEINLINE static void* operator new(
+            std::size_t size)
+        {
+            return allocate_coroutine_frame(size);
+        }
+
+        HPX_FORCEINLINE static void operator delete(
+            void* p, std::size_t size) noexcept
+        {
+            deallocate_coroutine_frame(p, size);
+        }
+    };
+
+    template <typename T>
+    struct stackless_task_promise
+      : stackless_task_promise_base<T, stackless_task_promise<T>>
+    {
+        template <typename U>
+        void return_value(U&& value)
+        {
+            this->set_value(HPX_FORWARD(U, value));
+        }
+    };
+
+    template <>
+    struct stackless_task_promise<void>
+      : stackless_task_promise_base<void, stackless_task_promise<void>>
+    {
+        void return_void()
+        {
+            this->set_value();
+        }
+    };
+}    // namespace hpx::lcos::detail
+
+namespace hpx::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A stackless_task is the result of a C++20 coroutine which is run by
+    /// the HPX schedulers without allocating a stack. Calling the coroutine
+    /// hands it to the scheduler of the calling thread (or of the default
+    /// thread pool), its body is run by a stackless HPX thread. Whenever the
+    /// coroutine awaits a future (or another stackless_task) which is not
+    /// ready yet, it is suspended by returning to the scheduler and is
+    /// resumed as a new stackless HPX thread once the future becomes ready.
+    /// Coroutine frames are allocated from a per worker thread cache.
+    ///
+    /// As no stack is associated with the coroutine, functions which would
+    /// suspend the current HPX thread (e.g. future::get() on a future which
+    /// is not ready, or locking an hpx::mutex) must not be called from
+    /// inside of a stackless_task, use co_await instead.
+    ///
+    /// \tparam T   The type of the value returned by the coroutine.
+    template <typename T>
+    class stackless_task
+    {
+    public:
+        using promise_type = lcos::detail::stackless_task_promise<T>;
+
+        stackless_task() = default;
+
+        stackless_task(stackless_task&&) noexcept = default;
+        stackless_task& operator=(stackless_task&&) noexcept = default;
+
+        stackless_task(stackless_task const&) = delete;
+        stackless_task& operator=(stackless_task const&) = delete;
+
+        /// Return whether this refers to a coroutine
+        [[nodiscard]] bool valid() const noexcept
+        {
+            return future_.valid();
+        }
+
+        /// Return whether the coroutine has finished
+        [[nodiscard]] bool is_ready() const noexcept
+        {
+            return future_.is_ready();
+        }
+
+        /// Wait for the coroutine to finish
+        void wait() const
+        {
+            future_.wait();
+        }
+
+        /// Wait for the coroutine to finish and return its result
+        decltype(auto) get()
+        {
+            return future_.get();
+        }
+
+        /// Return a future referring to the result of the coroutine
+        [[nodiscard]] hpx::future<T> get_future() noexcept
+        {
+            return HPX_MOVE(future_);
+        }
+
+        // allow to co_await a stackless_task from any other coroutine
+        [[nodiscard]] bool await_ready() const noexcept
+        {
+            return future_.await_ready();
+        }
+
+        template <typename Promise>
+        void await_suspend(lcos::detail::coroutine_handle<Promise> rh)
+        {
+            future_.await_suspend(rh);
+        }
+
+        decltype(auto) await_resume()
+        {
+            return future_.await_resume();
+        }
+
+    private:
+        template <typename, typename>
+        friend struct lcos::detail::stackless_task_promise_base;
+
+        explicit stackless_task(hpx::future<T>&& f) noexcept
+          : future_(HPX_MOVE(f))
+        {
+        }
+
+        hpx::future<T> future_;
+    };
+}    // namespace hpx::experimental
+
+#endif    // HPX_HAVE_CXX20_COROUTINES
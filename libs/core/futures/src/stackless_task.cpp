@@ -0,0 +1,152 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/config/coroutines_support.hpp>
+
+#if defined(HPX_HAVE_CXX20_COROUTINES)
+
+#include <hpx/futures/stackless_task.hpp>
+#include <hpx/modules/allocator_support.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/register_thread.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+
+namespace hpx::lcos::detail {
+
+    namespace {
+
+        // Frames are binned into size classes of 64 bytes, larger frames
+        // are not cached.
+        inline constexpr std::size_t frame_granularity = 64;
+        inline constexpr std::size_t num_frame_size_classes = 32;
+
+        // the maximal number of frames cached per size class and OS thread
+        inline constexpr std::size_t max_cached_frames = 256;
+
+        using frame_allocator_type = hpx::util::internal_allocator<char>;
+        using frame_traits = std::allocator_traits<frame_allocator_type>;
+
+        struct frame_cache
+        {
+            struct free_frame
+            {
+                free_frame* next_;
+            };
+
+            struct size_class
+            {
+                free_frame* head_ = nullptr;
+                std::size_t count_ = 0;
+            };
+
+            frame_cache() = default;
+
+            frame_cache(frame_cache const&) = delete;
+            frame_cache& operator=(frame_cache const&) = delete;
+
+            ~frame_cache()
+            {
+                frame_allocator_type alloc{};
+                for (std::size_t i = 0; i != num_frame_size_classes; ++i)
+                {
+                    free_frame* frame = size_classes_[i].head_;
+                    while (frame != nullptr)
+                    {
+                        free_frame* next = frame->next_;
+                        frame_traits::deallocate(alloc,
+                            reinterpret_cast<char*>(frame),
+                            (i + 1) * frame_granularity);
+                        frame = next;
+                    }
+                }
+            }
+
+            std::array<size_class, num_frame_size_classes> size_classes_;
+        };
+
+        frame_cache& get_frame_cache() noexcept
+        {
+            static thread_local frame_cache cache;
+            return cache;
+        }
+
+        constexpr std::size_t get_size_class(std::size_t size) noexcept
+        {
+            return size == 0 ? 0 : (size - 1) / frame_granularity;
+        }
+    }    // namespace
+
+    void* allocate_coroutine_frame(std::size_t size)
+    {
+        std::size_t const cls = get_size_class(size);
+        frame_allocator_type alloc{};
+        if (cls >= num_frame_size_classes)
+        {
+            return frame_traits::allocate(alloc, size);
+        }
+
+        auto& sc = get_frame_cache().size_classes_[cls];
+        if (sc.head_ != nullptr)
+        {
+            auto* frame = sc.head_;
+            sc.head_ = frame->next_;
+            --sc.count_;
+            return frame;
+        }
+        return frame_traits::allocate(alloc, (cls + 1) * frame_granularity);
+    }
+
+    void deallocate_coroutine_frame(void* p, std::size_t size) noexcept
+    {
+        std::size_t const cls = get_size_class(size);
+        frame_allocator_type alloc{};
+        if (cls >= num_frame_size_classes)
+        {
+            frame_traits::deallocate(alloc, static_cast<char*>(p), size);
+            return;
+        }
+
+        // frames released on a different OS thread than the one they were
+        // allocated on are cached by the releasing OS thread
+        auto& sc = get_frame_cache().size_classes_[cls];
+        if (sc.count_ == max_cached_frames)
+        {
+            frame_traits::deallocate(
+                alloc, static_cast<char*>(p), (cls + 1) * frame_granularity);
+            return;
+        }
+
+        auto* frame = static_cast<frame_cache::free_frame*>(p);
+        frame->next_ = sc.head_;
+        sc.head_ = frame;
+        ++sc.count_;
+    }
+
+    void schedule_coroutine(
+        coroutine_handle<> rh, threads::thread_schedule_hint hint)
+    {
+        threads::thread_init_data data(
+            threads::make_thread_function_nullary([rh]() { rh.resume(); }),
+            "stackless_task", threads::thread_priority::normal, hint,
+            threads::thread_stacksize::nostack,
+            threads::thread_schedule_state::pending);
+
+        error_code ec(throwmode::lightweight);
+        threads::register_work(data, ec);
+        if (ec)
+        {
+            // run the coroutine on the calling thread instead
+            rh.resume();
+        }
+    }
+}    // namespace hpx::lcos::detail
+
+#endif    // HPX_HAVE_CXX20_COROUTINES
@@ -0,0 +1,166 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_HAVE_CXX20_COROUTINES)
+#error "This test requires compiler support for C++20 coroutines"
+#endif
+
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using hpx::experimental::stackless_task;
+
+///////////////////////////////////////////////////////////////////////////////
+bool runs_stackless()
+{
+    auto const* thrd = hpx::threads::get_self_id_data();
+    return thrd != nullptr && thrd->is_stackless();
+}
+
+int just_wait(int result)
+{
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(100));
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+stackless_task<int> test_ready()
+{
+    HPX_TEST(runs_stackless());
+    co_return co_await hpx::make_ready_future(42);
+}
+
+stackless_task<int> test_async()
+{
+    int result = co_await hpx::async(just_wait, 42);
+
+    // the task is resumed by a new stackless HPX thread
+    HPX_TEST(runs_stackless());
+    co_return result;
+}
+
+stackless_task<int> test_shared()
+{
+    hpx::shared_future<int> f = hpx::async(just_wait, 42);
+    co_return co_await f;
+}
+
+stackless_task<> test_void(std::atomic<int>& count)
+{
+    co_await hpx::async(just_wait, 0);
+    ++count;
+}
+
+stackless_task<int> test_exception()
+{
+    co_await hpx::async(just_wait, 0);
+    throw std::runtime_error("test_exception");
+}
+
+void simple_stackless_tests()
+{
+    HPX_TEST_EQ(test_ready().get(), 42);
+    HPX_TEST_EQ(test_async().get(), 42);
+    HPX_TEST_EQ(test_shared().get(), 42);
+
+    std::atomic<int> count(0);
+    test_void(count).wait();
+    HPX_TEST_EQ(count.load(), 1);
+
+    bool caught_exception = false;
+    try
+    {
+        test_exception().get();
+        HPX_TEST(false);
+    }
+    catch (std::runtime_error const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+stackless_task<int> fib(int n)
+{
+    if (n < 2)
+    {
+        co_return n;
+    }
+    co_return co_await fib(n - 1) + co_await fib(n - 2);
+}
+
+hpx::future<int> awaiting_future(int n)
+{
+    co_return co_await fib(n);
+}
+
+void recursive_stackless_tests()
+{
+    HPX_TEST_EQ(fib(15).get(), 610);
+    HPX_TEST_EQ(awaiting_future(10).get(), 55);
+    HPX_TEST_EQ(fib(10).get_future().get(), 55);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+stackless_task<std::size_t> pipeline_stage(std::size_t i)
+{
+    co_return co_await hpx::make_ready_future(i) + 1;
+}
+
+void many_stackless_tests()
+{
+    std::size_t const num_tasks = 10000;
+
+    std::vector<stackless_task<std::size_t>> tasks;
+    tasks.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(pipeline_stage(i));
+    }
+
+    std::size_t sum = 0;
+    for (auto& task : tasks)
+    {
+        sum += task.get();
+    }
+    HPX_TEST_EQ(sum, num_tasks * (num_tasks + 1) / 2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    simple_stackless_tests();
+    recursive_stackless_tests();
+    many_stackless_tests();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // We force this test to use several threads by default.
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    hpx::local::init(hpx_main, argc, argv, init_args);
+    return hpx::util::report_errors();
+}
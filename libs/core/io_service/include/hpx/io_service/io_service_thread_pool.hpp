@@ -49,7 +49,7 @@ namespace hpx::threads::detail {
             thread_schedule_state new_state, thread_restart_state new_state_ex,
             thread_priority priority, error_code& ec) override;
 
-        thread_id_ref_type set_state(
+        timer_id_type set_state(
             hpx::chrono::steady_time_point const& abs_time,
             thread_id_type const& id, thread_schedule_state newstate,
             thread_restart_state newstate_ex, thread_priority priority,
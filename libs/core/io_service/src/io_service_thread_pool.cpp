@@ -62,13 +62,13 @@ namespace hpx::threads::detail {
             threads::thread_restart_state::unknown);
     }
 
-    threads::thread_id_ref_type io_service_thread_pool::set_state(
+    threads::timer_id_type io_service_thread_pool::set_state(
         hpx::chrono::steady_time_point const& /* abs_time */,
-        thread_id_type const& id, thread_schedule_state /* newstate */,
+        thread_id_type const& /* id */, thread_schedule_state /* newstate */,
         thread_restart_state /* newstate_ex */, thread_priority /* priority */,
         error_code& /* ec */)
     {
-        return id;
+        return threads::timer_id_type();
     }
 
     void io_service_thread_pool::report_error(
@@ -157,6 +157,12 @@ namespace hpx::resource::detail {
         case resource::scheduling_policy::shared_priority:
             sched = "shared_priority";
             break;
+        case resource::scheduling_policy::local_workstealing:
+            sched = "local_workstealing";
+            break;
+        case resource::scheduling_policy::local_deadline:
+            sched = "local_deadline";
+            break;
         }
 
         os << "\"" << sched << "\" is running on PUs : \n";
@@ -499,6 +505,15 @@ namespace hpx::resource::detail {
         {
             default_scheduler = scheduling_policy::shared_priority;
         }
+        else if (0 ==
+            std::string("local-workstealing").find(default_scheduler_str))
+        {
+            default_scheduler = scheduling_policy::local_workstealing;
+        }
+        else if (0 == std::string("local-deadline").find(default_scheduler_str))
+        {
+            default_scheduler = scheduling_policy::local_deadline;
+        }
         else
         {
             throw hpx::detail::command_line_error(
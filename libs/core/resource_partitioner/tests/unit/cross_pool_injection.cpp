@@ -277,6 +277,8 @@ int main(int argc, char* argv[])
 #endif
         hpx::resource::scheduling_policy::static_,
         hpx::resource::scheduling_policy::static_priority,
+        hpx::resource::scheduling_policy::local_workstealing,
+        hpx::resource::scheduling_policy::local_deadline,
         // The shared_priority scheduler sometimes hangs in this test.
         //hpx::resource::scheduling_policy::shared_priority,
     };
@@ -71,6 +71,8 @@ int main(int argc, char* argv[])
         hpx::resource::scheduling_policy::static_,
         hpx::resource::scheduling_policy::static_priority,
         hpx::resource::scheduling_policy::shared_priority,
+        hpx::resource::scheduling_policy::local_workstealing,
+        hpx::resource::scheduling_policy::local_deadline,
     };
 
     for (auto const scheduler : schedulers)
@@ -113,6 +113,10 @@ namespace hpx::util {
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
         bool use_stack_guard_pages() const;
+        bool use_stack_pool() const;
+        bool track_stack_usage() const;
+        bool adapt_stack_size() const;
+        bool shrink_stack_size() const;
 #endif
 
         // return trace_depth for stack-backtraces
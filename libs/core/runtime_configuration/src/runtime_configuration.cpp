@@ -214,6 +214,14 @@ namespace hpx { namespace util {
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
     defined(__FreeBSD__)
             "use_guard_pages = ${HPX_USE_GUARD_PAGES:1}",
+#if defined(HPX_HAVE_THREAD_STACK_MMAP)
+            "use_stack_pool = ${HPX_USE_STACK_POOL:1}",
+#else
+            "use_stack_pool = ${HPX_USE_STACK_POOL:0}",
+#endif
+            "track_usage = ${HPX_TRACK_STACK_USAGE:0}",
+            "adapt_size = ${HPX_ADAPT_STACK_SIZE:0}",
+            "shrink_size = ${HPX_SHRINK_STACK_SIZE:0}",
 #endif
 
             "[hpx.threadpools]",
@@ -257,6 +265,21 @@ namespace hpx { namespace util {
             "init_threads_count = "
             "${HPX_THREAD_QUEUE_INIT_THREADS_COUNT:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_THREAD_QUEUE_INIT_THREADS_COUNT)) "}",
+            "steal_threshold_l2 = "
+            "${HPX_THREAD_QUEUE_STEAL_THRESHOLD_L2:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_THREAD_QUEUE_STEAL_THRESHOLD_L2)) "}",
+            "steal_threshold_l3 = "
+            "${HPX_THREAD_QUEUE_STEAL_THRESHOLD_L3:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_THREAD_QUEUE_STEAL_THRESHOLD_L3)) "}",
+            "steal_threshold_numa = "
+            "${HPX_THREAD_QUEUE_STEAL_THRESHOLD_NUMA:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_THREAD_QUEUE_STEAL_THRESHOLD_NUMA)) "}",
+            "steal_threshold_socket = "
+            "${HPX_THREAD_QUEUE_STEAL_THRESHOLD_SOCKET:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_THREAD_QUEUE_STEAL_THRESHOLD_SOCKET)) "}",
+            "steal_threshold_machine = "
+            "${HPX_THREAD_QUEUE_STEAL_THRESHOLD_MACHINE:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_THREAD_QUEUE_STEAL_THRESHOLD_MACHINE)) "}",
 
             "[hpx.commandline]",
             // enable aliasing
@@ -304,6 +327,9 @@ namespace hpx { namespace util {
             "${HPX_AGAS_MAX_PENDING_REFCNT_REQUESTS:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(
                     HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS)) "}",
+            "refcnt_flush_interval = ${HPX_AGAS_REFCNT_FLUSH_INTERVAL:1000}",
+            "refcnt_credit_batch = ${HPX_AGAS_REFCNT_CREDIT_BATCH:8}",
+            "refcnt_credit_lifetime = ${HPX_AGAS_REFCNT_CREDIT_LIFETIME:10000}",
             "service_mode = hosted",
             "local_cache_size = ${HPX_AGAS_LOCAL_CACHE_SIZE:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_AGAS_LOCAL_CACHE_SIZE)) "}",
@@ -1100,6 +1126,49 @@ namespace hpx { namespace util {
         }
         return true;    // default is true
     }
+
+    bool runtime_configuration::use_stack_pool() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<int>(*sec, "use_stack_pool", 1) !=
+                0;
+        }
+        return true;    // default is true
+    }
+
+    bool runtime_configuration::track_stack_usage() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            // adapting stack sizes requires measuring the stack usage
+            return hpx::util::get_entry_as<int>(*sec, "track_usage", 0) != 0 ||
+                hpx::util::get_entry_as<int>(*sec, "adapt_size", 0) != 0;
+        }
+        return false;    // default is false
+    }
+
+    bool runtime_configuration::adapt_stack_size() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<int>(*sec, "adapt_size", 0) != 0;
+        }
+        return false;    // default is false
+    }
+
+    bool runtime_configuration::shrink_stack_size() const
+    {
+        if (util::section const* sec = get_section("hpx.stacks");
+            nullptr != sec)
+        {
+            return hpx::util::get_entry_as<int>(*sec, "shrink_size", 0) != 0;
+        }
+        return false;    // default is false
+    }
 #endif
 
     std::ptrdiff_t runtime_configuration::init_small_stack_size() const
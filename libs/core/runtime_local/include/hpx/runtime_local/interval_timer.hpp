@@ -88,8 +88,8 @@ namespace hpx::util::detail {
         std::int64_t microsecs_ = 0;
         /// id of currently scheduled thread
         threads::thread_id_ref_type id_;
-        /// id of the timer thread for the currently scheduled thread
-        threads::thread_id_ref_type timerid_;
+        /// timer waking up the currently scheduled thread
+        threads::timer_id_type timerid_;
         /// description of this interval timer
         std::string description_;
 
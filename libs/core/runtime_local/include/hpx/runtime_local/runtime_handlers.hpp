@@ -10,12 +10,9 @@
 #pragma once
 
 #include <hpx/config.hpp>
-#include <hpx/config/asio.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
 
-#include <asio/io_context.hpp>
-
 #include <cstddef>
 #include <string>
 
@@ -34,5 +31,4 @@ namespace hpx { namespace detail {
     HPX_CORE_EXPORT threads::thread_pool_base* get_default_pool();
     HPX_CORE_EXPORT threads::mask_type get_pu_mask(
         threads::topology& topo, std::size_t thread_num);
-    HPX_CORE_EXPORT asio::io_context& get_default_timer_service();
 }}    // namespace hpx::detail
@@ -146,12 +146,7 @@ namespace hpx::util::detail {
 
             if (timerid_)
             {
-                error_code ec(
-                    throwmode::lightweight);    // avoid throwing on error
-                threads::set_thread_state(timerid_.noref(),
-                    threads::thread_schedule_state::pending,
-                    threads::thread_restart_state::abort,
-                    threads::thread_priority::boost, true, ec);
+                threads::cancel_timer(timerid_);
                 timerid_.reset();
             }
             if (id_)
@@ -308,11 +303,12 @@ namespace hpx::util::detail {
         }
 
         // schedule this thread to be run after the given amount of seconds
-        threads::thread_id_ref_type timerid = threads::set_thread_state(
-            id.noref(), std::chrono::microseconds(microsecs_),
-            threads::thread_schedule_state::pending,
-            threads::thread_restart_state::signaled,
-            threads::thread_priority::boost, true, ec);
+        threads::timer_id_type const timerid =
+            threads::set_thread_state(id.noref(),
+                std::chrono::microseconds(microsecs_),
+                threads::thread_schedule_state::pending,
+                threads::thread_restart_state::signaled,
+                threads::thread_priority::boost, true, ec);
 
         if (ec)
         {
@@ -9,8 +9,11 @@
 #include <hpx/config.hpp>
 
 #include <hpx/schedulers/background_scheduler.hpp>
+#include <hpx/schedulers/local_deadline_scheduler.hpp>
 #include <hpx/schedulers/local_priority_queue_scheduler.hpp>
 #include <hpx/schedulers/local_queue_scheduler.hpp>
+#include <hpx/schedulers/local_workstealing_scheduler.hpp>
 #include <hpx/schedulers/shared_priority_queue_scheduler.hpp>
 #include <hpx/schedulers/static_priority_queue_scheduler.hpp>
 #include <hpx/schedulers/static_queue_scheduler.hpp>
+#include <hpx/schedulers/stealing_hierarchy.hpp>
@@ -0,0 +1,288 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+#include <hpx/schedulers/local_queue_scheduler.hpp>
+#include <hpx/schedulers/lockfree_queue_backends.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::threads::policies {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Earliest deadline first
+    struct earliest_deadline_first;
+
+    template <typename T>
+    struct earliest_deadline_first_backend
+    {
+        using value_type = T;
+        using reference = T&;
+        using const_reference = T const&;
+        using rvalue_reference = T&&;
+        using size_type = std::uint64_t;
+
+        explicit earliest_deadline_first_backend(size_type initial_size = 0,
+            size_type /* num_thread */ = size_type(-1))
+        {
+            heap_.reserve(std::size_t(initial_size));
+        }
+
+        // Items with the same deadline are returned in the order they were
+        // pushed, items without a deadline are returned last.
+        bool push(const_reference val, bool /*other_end*/ = false)    //-V659
+        {
+            thread_deadline const deadline = deadline_of(val);
+
+            std::lock_guard<mutex_type> l(mtx_);
+            heap_.push_back(entry{deadline, sequence_++, val});
+            std::push_heap(heap_.begin(), heap_.end(), later{});
+            update_earliest_deadline();
+            return true;
+        }
+
+        bool push(rvalue_reference val, bool other_end = false)    //-V659
+        {
+            return push(static_cast<const_reference>(val), other_end);
+        }
+
+        bool pop(reference val, bool /* steal */ = true)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            if (heap_.empty())
+            {
+                return false;
+            }
+
+            std::pop_heap(heap_.begin(), heap_.end(), later{});
+            val = heap_.back().value;
+            heap_.pop_back();
+            update_earliest_deadline();
+            return true;
+        }
+
+        bool empty() noexcept
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            return heap_.empty();
+        }
+
+        // Return the deadline of the most urgent item in the queue, this is
+        // thread_deadline::max() if the queue is empty
+        thread_deadline earliest_deadline() const noexcept
+        {
+            return thread_deadline(thread_deadline::duration(
+                earliest_deadline_.load(std::memory_order_relaxed)));
+        }
+
+    private:
+        using mutex_type = hpx::util::spinlock;
+        using rep = thread_deadline::rep;
+
+        static constexpr rep no_deadline =
+            thread_deadline::max().time_since_epoch().count();
+
+        struct entry
+        {
+            thread_deadline deadline;
+            std::uint64_t sequence;
+            T value;
+        };
+
+        struct later
+        {
+            bool operator()(entry const& lhs, entry const& rhs) const noexcept
+            {
+                return lhs.deadline > rhs.deadline ||
+                    (lhs.deadline == rhs.deadline &&
+                        lhs.sequence > rhs.sequence);
+            }
+        };
+
+        static thread_deadline deadline_of(
+            threads::detail::thread_data_reference_counting* thrd) noexcept
+        {
+            return static_cast<thread_data*>(thrd)->get_deadline();
+        }
+
+        // used for staged tasks and if the queue maintains wait times
+        template <typename U>
+        static thread_deadline deadline_of(U* description) noexcept
+        {
+            if constexpr (std::is_same_v<std::decay_t<decltype(
+                                             description->data)>,
+                              thread_init_data>)
+            {
+                return description->data.deadline;
+            }
+            else
+            {
+                return get_thread_id_data(description->data)->get_deadline();
+            }
+        }
+
+        void update_earliest_deadline() noexcept
+        {
+            earliest_deadline_.store(heap_.empty() ?
+                    no_deadline :
+                    heap_.front().deadline.time_since_epoch().count(),
+                std::memory_order_relaxed);
+        }
+
+        mutex_type mtx_;
+        std::vector<entry> heap_;
+        std::uint64_t sequence_ = 0;
+        std::atomic<rep> earliest_deadline_{no_deadline};
+    };
+
+    struct earliest_deadline_first
+    {
+        template <typename T>
+        struct apply
+        {
+            using type = earliest_deadline_first_backend<T>;
+        };
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The local_deadline_scheduler maintains one queue of work items
+    /// (threads) per OS thread which is ordered by the absolute deadline of
+    /// the work items, earliest deadline first (EDF). Work items without a
+    /// deadline are executed only if no work item with a deadline is ready.
+    /// An idle OS thread steals the most urgent work item, i.e. the one with
+    /// the least slack, from all currently eligible victims (see
+    /// \a stealing_hierarchy). Staged tasks (which have not been converted
+    /// to threads yet) are kept in deadline order as well, so urgent tasks
+    /// are converted first.
+    template <typename Mutex = std::mutex,
+        typename PendingQueuing = earliest_deadline_first,
+        typename StagedQueuing = earliest_deadline_first,
+        typename TerminatedQueuing =
+            default_local_queue_scheduler_terminated_queue>
+    class local_deadline_scheduler final
+      : public local_queue_scheduler<Mutex, PendingQueuing, StagedQueuing,
+            TerminatedQueuing>
+    {
+    public:
+        using base_type = local_queue_scheduler<Mutex, PendingQueuing,
+            StagedQueuing, TerminatedQueuing>;
+        using thread_queue_type = typename base_type::thread_queue_type;
+
+        explicit local_deadline_scheduler(
+            typename base_type::init_parameter_type const& init,
+            bool deferred_initialization = true)
+          : base_type(init, deferred_initialization)
+        {
+        }
+
+        static std::string_view get_scheduler_name()
+        {
+            return "local_deadline_scheduler";
+        }
+
+        // Return the next thread to be executed, return false if none is
+        // available
+        bool get_next_thread(std::size_t num_thread, bool running,
+            threads::thread_id_ref_type& thrd, bool enable_stealing)
+        {
+            HPX_ASSERT(num_thread < this->queues_.size());
+
+            thread_queue_type* this_queue = this->queues_[num_thread];
+            {
+                bool result = this_queue->get_next_thread(thrd);
+
+                this_queue->increment_num_pending_accesses();
+                if (result)
+                {
+                    this->victim_threads_[num_thread].data_.reset();
+                    return true;
+                }
+                this_queue->increment_num_pending_misses();
+
+                // Give up, we should have work to convert.
+                if (this_queue->get_staged_queue_length(
+                        std::memory_order_relaxed) != 0)
+                {
+                    return false;
+                }
+            }
+
+            if (!running || !enable_stealing)
+            {
+                return false;
+            }
+
+            bool const numa_stealing =
+                this->has_scheduler_mode(scheduler_mode::enable_stealing_numa);
+
+            auto& victims = this->victim_threads_[num_thread].data_;
+
+            // find the eligible victim holding the most urgent work item
+            std::size_t victim = std::size_t(-1);
+            thread_deadline earliest = thread_deadline::max();
+            victims.visit(
+                [&](std::size_t idx) {
+                    thread_deadline const deadline =
+                        this->queues_[idx]->get_earliest_deadline();
+                    if (deadline < earliest)
+                    {
+                        earliest = deadline;
+                        victim = idx;
+                    }
+                    return false;
+                },
+                numa_stealing);
+
+            if (victim != std::size_t(-1) &&
+                steal_from(victim, this_queue, running, thrd))
+            {
+                victims.reset();
+                return true;
+            }
+
+            // steal work items without a deadline, nearest workers first
+            return victims.steal(
+                [&](std::size_t idx) {
+                    return steal_from(idx, this_queue, running, thrd);
+                },
+                numa_stealing);
+        }
+
+    private:
+        bool steal_from(std::size_t victim, thread_queue_type* this_queue,
+            bool running, threads::thread_id_ref_type& thrd)
+        {
+            thread_queue_type* q = this->queues_[victim];
+            if (q->get_next_thread(thrd, running, true))
+            {
+                q->increment_num_stolen_from_pending();
+                this_queue->increment_num_stolen_to_pending();
+                return true;
+            }
+            return false;
+        }
+    };
+}    // namespace hpx::threads::policies
+
+#include <hpx/config/warnings_suffix.hpp>
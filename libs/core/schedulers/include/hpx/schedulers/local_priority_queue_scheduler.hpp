@@ -16,6 +16,7 @@
 #include <hpx/modules/logging.hpp>
 #include <hpx/schedulers/deadlock_detection.hpp>
 #include <hpx/schedulers/lockfree_queue_backends.hpp>
+#include <hpx/schedulers/stealing_hierarchy.hpp>
 #include <hpx/schedulers/thread_queue.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
@@ -23,8 +24,8 @@
 #include <hpx/threading_base/thread_queue_init_parameters.hpp>
 #include <hpx/topology/topology.hpp>
 
+#include <algorithm>
 #include <atomic>
-#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
@@ -116,6 +117,7 @@ namespace hpx::threads::policies {
           : scheduler_base(
                 init.num_queues_, init.description_, init.thread_queue_init_)
           , curr_queue_(0)
+          , num_bulk_created_(0)
           , affinity_data_(init.affinity_data_)
           , num_queues_(init.num_queues_)
           , num_high_priority_queues_(init.num_high_priority_queues_)
@@ -576,6 +578,9 @@ namespace hpx::threads::policies {
                 std::size_t num = num_thread % num_high_priority_queues_;
                 high_priority_queues_[num].data_->create_thread(data, id, ec);
 
+                // the high priority queues are owned by the first OS threads
+                data.schedulehint.hint = static_cast<std::int16_t>(num);
+
                 LTM_(debug)
                     .format("local_priority_queue_scheduler::create_thread, "
                             "high priority queue: pool({}), scheduler({}), "
@@ -653,50 +658,185 @@ namespace hpx::threads::policies {
             }
         }
 
+        // Create a batch of new threads. Runs of staged normal priority
+        // threads are grouped by their target queue, each group is pushed to
+        // its queue in one go. Threads with a thread hint go to the hinted
+        // queue, the threads without a hint are split into contiguous chunks
+        // which are distributed round-robin across the queues. All other
+        // threads are created one by one. The hint of every thread is
+        // replaced with the queue it was added to.
+        void create_thread_bulk(thread_init_data* data, std::size_t count,
+            error_code& ec) override
+        {
+            auto const is_batchable = [](thread_init_data const& d) {
+                return !d.run_now &&
+                    (d.priority == thread_priority::normal ||
+                        d.priority == thread_priority::default_);
+            };
+            auto const is_hinted = [](thread_init_data const& d) {
+                return d.schedulehint.mode == thread_schedule_hint_mode::thread;
+            };
+
+            std::size_t i = 0;
+            while (i != count)
+            {
+                if (!is_batchable(data[i]))
+                {
+                    create_thread(data[i], nullptr, ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    ++i;
+                    continue;
+                }
+
+                std::size_t run_end = i + 1;
+                std::size_t num_unhinted = is_hinted(data[i]) ? 0 : 1;
+                while (run_end != count && is_batchable(data[run_end]))
+                {
+                    if (!is_hinted(data[run_end]))
+                    {
+                        ++num_unhinted;
+                    }
+                    ++run_end;
+                }
+
+                std::size_t const num_chunks =
+                    (std::min)(num_unhinted, num_queues_);
+                std::size_t const first_queue = num_chunks != 0 ?
+                    curr_queue_.fetch_add(num_chunks) % num_queues_ :
+                    0;
+
+                // assign the target queue to each of the threads
+                std::size_t unhinted = 0;
+                for (std::size_t j = i; j != run_end; ++j)
+                {
+                    thread_init_data& d = data[j];
+
+                    std::size_t num_thread = 0;
+                    if (is_hinted(d))
+                    {
+                        num_thread =
+                            static_cast<std::size_t>(d.schedulehint.hint) %
+                            num_queues_;
+                    }
+                    else
+                    {
+                        std::size_t const chunk =
+                            unhinted++ * num_chunks / num_unhinted;
+                        num_thread = (first_queue + chunk) % num_queues_;
+                    }
+
+                    d.schedulehint.mode = thread_schedule_hint_mode::thread;
+                    d.schedulehint.hint = static_cast<std::int16_t>(
+                        select_active_pu(num_thread));
+                    d.priority = thread_priority::normal;
+                }
+
+                // group the threads by their queue, keeping their order
+                std::stable_sort(data + i, data + run_end,
+                    [](thread_init_data const& lhs,
+                        thread_init_data const& rhs) {
+                        return lhs.schedulehint.hint < rhs.schedulehint.hint;
+                    });
+
+                std::size_t begin = i;
+                while (begin != run_end)
+                {
+                    std::int16_t const hint = data[begin].schedulehint.hint;
+
+                    std::size_t end = begin + 1;
+                    while (
+                        end != run_end && data[end].schedulehint.hint == hint)
+                    {
+                        ++end;
+                    }
+
+                    std::size_t const num_thread =
+                        static_cast<std::size_t>(hint);
+                    queues_[num_thread].data_->create_thread_bulk(
+                        data + begin, end - begin, ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+
+                    num_bulk_created_.fetch_add(
+                        static_cast<std::int64_t>(end - begin),
+                        std::memory_order_relaxed);
+
+                    LTM_(debug).format(
+                        "local_priority_queue_scheduler::create_thread_bulk, "
+                        "normal priority queue: pool({}), scheduler({}), "
+                        "worker_thread({}), count({})",
+                        *this->get_parent_pool(), *this, num_thread,
+                        end - begin);
+
+                    begin = end;
+                }
+
+                i = run_end;
+            }
+        }
+
+        std::int64_t get_num_bulk_created_threads(bool reset) override
+        {
+            if (reset)
+            {
+                return num_bulk_created_.exchange(0, std::memory_order_relaxed);
+            }
+            return num_bulk_created_.load(std::memory_order_relaxed);
+        }
+
         bool attempt_stealing_pending(std::size_t num_thread,
             threads::thread_id_ref_type& thrd,
             [[maybe_unused]] thread_queue_type* this_high_priority_queue,
             [[maybe_unused]] thread_queue_type* this_queue)
         {
-            thread_queue_type* q = nullptr;
+            bool const numa_stealing = has_scheduler_mode(
+                policies::scheduler_mode::enable_stealing_numa);
+
             if (num_thread < num_high_priority_queues_)
             {
-                for (std::size_t idx : victim_threads_[num_thread].data_)
-                {
-                    HPX_ASSERT(idx != num_thread);
+                return victim_threads_[num_thread].data_.steal(
+                    [&](std::size_t idx) {
+                        HPX_ASSERT(idx != num_thread);
 
-                    if (idx < num_high_priority_queues_)
-                    {
-                        q = high_priority_queues_[idx].data_;
-                        if (q->get_next_thread(thrd, true, true))
+                        thread_queue_type* q = nullptr;
+                        if (idx < num_high_priority_queues_)
                         {
+                            q = high_priority_queues_[idx].data_;
+                            if (q->get_next_thread(thrd, true, true))
+                            {
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
-                            q->increment_num_stolen_from_pending();
-                            this_high_priority_queue
-                                ->increment_num_stolen_to_pending();
+                                q->increment_num_stolen_from_pending();
+                                this_high_priority_queue
+                                    ->increment_num_stolen_to_pending();
 #endif
-                            return true;
+                                return true;
+                            }
                         }
-                    }
 
-                    q = queues_[idx].data_;
-                    if (q->get_next_thread(thrd, true, true))
-                    {
+                        q = queues_[idx].data_;
+                        if (q->get_next_thread(thrd, true, true))
+                        {
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
-                        q->increment_num_stolen_from_pending();
-                        this_queue->increment_num_stolen_to_pending();
+                            q->increment_num_stolen_from_pending();
+                            this_queue->increment_num_stolen_to_pending();
 #endif
-                        return true;
-                    }
-                }
+                            return true;
+                        }
+                        return false;
+                    },
+                    numa_stealing);
             }
-            else
-            {
-                for (std::size_t idx : victim_threads_[num_thread].data_)
-                {
+
+            return victim_threads_[num_thread].data_.steal(
+                [&](std::size_t idx) {
                     HPX_ASSERT(idx != num_thread);
 
-                    q = queues_[idx].data_;
+                    thread_queue_type* q = queues_[idx].data_;
                     if (q->get_next_thread(thrd, true, true))
                     {
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
@@ -705,9 +845,9 @@ namespace hpx::threads::policies {
 #endif
                         return true;
                     }
-                }
-            }
-            return false;
+                    return false;
+                },
+                numa_stealing);
         }
 
         // Return the next thread to be executed, return false if none is
@@ -727,11 +867,17 @@ namespace hpx::threads::policies {
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
                 this_high_priority_queue->increment_num_pending_accesses();
                 if (result)
+                {
+                    victim_threads_[num_thread].data_.reset();
                     return true;
+                }
                 this_high_priority_queue->increment_num_pending_misses();
 #else
                 if (result)
+                {
+                    victim_threads_[num_thread].data_.reset();
                     return true;
+                }
 #endif
             }
 
@@ -744,11 +890,17 @@ namespace hpx::threads::policies {
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
                 q->increment_num_pending_accesses();
                 if (result)
+                {
+                    victim_threads_[num_thread].data_.reset();
                     return true;
+                }
                 q->increment_num_pending_misses();
 #else
                 if (result)
+                {
+                    victim_threads_[num_thread].data_.reset();
                     return true;
+                }
 #endif
 
                 // Give up, we should have work to convert.
@@ -1294,67 +1446,74 @@ namespace hpx::threads::policies {
             thread_queue_type* this_high_priority_queue,
             thread_queue_type* this_queue)
         {
+            bool const numa_stealing = has_scheduler_mode(
+                policies::scheduler_mode::enable_stealing_numa);
+
             bool result = true;
-            thread_queue_type* q = nullptr;
             if (num_thread < num_high_priority_queues_)
             {
-                for (std::size_t idx : victim_threads_[num_thread].data_)
-                {
-                    HPX_ASSERT(idx != num_thread);
-
-                    if (idx < num_high_priority_queues_)
-                    {
-                        q = high_priority_queues_[idx].data_;
-                        result = this_high_priority_queue->wait_or_add_new(
-                                     true, added, q) &&
-                            result;
+                victim_threads_[num_thread].data_.visit(
+                    [&](std::size_t idx) {
+                        HPX_ASSERT(idx != num_thread);
 
-                        if (0 != added)
+                        thread_queue_type* q = nullptr;
+                        if (idx < num_high_priority_queues_)
                         {
+                            q = high_priority_queues_[idx].data_;
+                            result = this_high_priority_queue->wait_or_add_new(
+                                         true, added, q) &&
+                                result;
+
+                            if (0 != added)
+                            {
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
-                            q->increment_num_stolen_from_staged(added);
-                            this_high_priority_queue
-                                ->increment_num_stolen_to_staged(added);
+                                q->increment_num_stolen_from_staged(added);
+                                this_high_priority_queue
+                                    ->increment_num_stolen_to_staged(added);
 #endif
-                            return result;
+                                return true;
+                            }
                         }
-                    }
 
-                    q = queues_[idx].data_;
-                    result =
-                        this_queue->wait_or_add_new(true, added, q) && result;
+                        q = queues_[idx].data_;
+                        result = this_queue->wait_or_add_new(true, added, q) &&
+                            result;
 
-                    if (0 != added)
-                    {
+                        if (0 != added)
+                        {
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
-                        q->increment_num_stolen_from_staged(added);
-                        this_queue->increment_num_stolen_to_staged(added);
+                            q->increment_num_stolen_from_staged(added);
+                            this_queue->increment_num_stolen_to_staged(added);
 #endif
-                        return result;
-                    }
-                }
+                            return true;
+                        }
+                        return false;
+                    },
+                    numa_stealing);
             }
             else
             {
-                for (std::size_t idx : victim_threads_[num_thread].data_)
-                {
-                    HPX_ASSERT(idx != num_thread);
+                victim_threads_[num_thread].data_.visit(
+                    [&](std::size_t idx) {
+                        HPX_ASSERT(idx != num_thread);
 
-                    q = queues_[idx].data_;
-                    result =
-                        this_queue->wait_or_add_new(true, added, q) && result;
+                        thread_queue_type* q = queues_[idx].data_;
+                        result = this_queue->wait_or_add_new(true, added, q) &&
+                            result;
 
-                    if (0 != added)
-                    {
+                        if (0 != added)
+                        {
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
-                        q->increment_num_stolen_from_staged(added);
-                        this_queue->increment_num_stolen_to_staged(added);
+                            q->increment_num_stolen_from_staged(added);
+                            this_queue->increment_num_stolen_to_staged(added);
 #endif
-                        return result;
-                    }
-                }
+                            return true;
+                        }
+                        return false;
+                    },
+                    numa_stealing);
             }
-            return false;
+            return 0 != added && result;
         }
 
 #ifdef HPX_HAVE_THREAD_MINIMAL_DEADLOCK_DETECTION
@@ -1499,107 +1658,10 @@ namespace hpx::threads::policies {
             bound_queues_[num_thread].data_->on_start_thread(num_thread);
             queues_[num_thread].data_->on_start_thread(num_thread);
 
-            std::size_t const num_threads = num_queues_;
-            auto const& topo = create_topology();
-
-            // get NUMA domain masks of all queues...
-            std::vector<mask_type> numa_masks(num_threads);
-            std::vector<mask_type> core_masks(num_threads);
-            std::vector<std::ptrdiff_t> numa_domains(num_threads);
-            for (std::size_t i = 0; i != num_threads; ++i)
-            {
-                std::size_t const num_pu = affinity_data_.get_pu_num(i);
-                numa_masks[i] = topo.get_numa_node_affinity_mask(num_pu);
-                numa_domains[i] = static_cast<std::ptrdiff_t>(
-                    topo.get_numa_node_number(num_pu));
-                core_masks[i] = topo.get_core_affinity_mask(num_pu);
-            }
-
-            // iterate over the number of threads again to determine where to
-            // steal from
-            std::ptrdiff_t const radius =
-                std::lround(static_cast<double>(num_threads) / 2.0);
-            victim_threads_[num_thread].data_.reserve(num_threads);
-
-            std::size_t const num_pu = affinity_data_.get_pu_num(num_thread);
-            mask_cref_type pu_mask = topo.get_thread_affinity_mask(num_pu);
-            mask_cref_type numa_mask = numa_masks[num_thread];
-            mask_cref_type core_mask = core_masks[num_thread];
-
-            // we allow the thread on the boundary of the NUMA domain to steal
-            auto first_mask = mask_type();
-            resize(first_mask, mask_size(pu_mask));
-
-            std::size_t const first = find_first(numa_mask);
-            if (first != static_cast<std::size_t>(-1))
-                set(first_mask, first);
-            else
-                first_mask = pu_mask;
-
-            auto iterate = [&](auto&& f) {
-                // check our neighbors in a radial fashion (left and right
-                // alternating, increasing distance each iteration)
-                std::ptrdiff_t i = 1;
-                for (/**/; i < radius; ++i)
-                {
-                    std::ptrdiff_t left =
-                        (static_cast<std::ptrdiff_t>(num_thread) - i) %
-                        static_cast<std::ptrdiff_t>(num_threads);
-                    if (left < 0)
-                        left = num_threads + left;
-
-                    if (f(static_cast<std::size_t>(left)))
-                    {
-                        victim_threads_[num_thread].data_.push_back(
-                            static_cast<std::size_t>(left));
-                    }
-
-                    std::size_t const right = (num_thread + i) % num_threads;
-                    if (f(right))
-                    {
-                        victim_threads_[num_thread].data_.push_back(right);
-                    }
-                }
-                if ((num_threads % 2) == 0)
-                {
-                    std::size_t const right = (num_thread + i) % num_threads;
-                    if (f(right))
-                    {
-                        victim_threads_[num_thread].data_.push_back(right);
-                    }
-                }
-            };
-
-            // check for threads which share the same core...
-            iterate([&](std::size_t other_num_thread) {
-                return any(core_mask & core_masks[other_num_thread]);
-            });
-
-            // check for threads which share the same NUMA domain...
-            iterate([&](std::size_t other_num_thread) {
-                return !any(core_mask & core_masks[other_num_thread]) &&
-                    any(numa_mask & numa_masks[other_num_thread]);
-            });
-
-            // check for the rest and if we are NUMA aware
-            if (has_scheduler_mode(
-                    policies::scheduler_mode::enable_stealing_numa) &&
-                any(first_mask & pu_mask))
-            {
-                iterate([&](std::size_t other_num_thread) {
-                    // allow stealing from neighboring NUMA domain only
-                    std::ptrdiff_t const numa_distance =
-                        numa_domains[num_thread] -
-                        numa_domains[other_num_thread];
-                    if (numa_distance > 1 || numa_distance < -1)
-                        return false;
-                    // steal of even cores from neighboring NUMA domains
-                    if (numa_distance == 1 || numa_distance == -1)
-                        return other_num_thread % 2 == 0;
-                    // cores from our domain are handled above
-                    return false;
-                });
-            }
+            // determine where to steal from
+            victim_threads_[num_thread].data_.init(num_thread, num_queues_,
+                parent_pool_->get_thread_offset(), affinity_data_,
+                thread_queue_init_);
         }
 
         void on_stop_thread(std::size_t num_thread) override
@@ -1638,6 +1700,7 @@ namespace hpx::threads::policies {
 
     protected:
         std::atomic<std::size_t> curr_queue_;
+        std::atomic<std::int64_t> num_bulk_created_;
 
         detail::affinity_data const& affinity_data_;
 
@@ -1650,8 +1713,7 @@ namespace hpx::threads::policies {
         std::vector<util::cache_line_data<thread_queue_type*>> queues_;
         std::vector<util::cache_line_data<thread_queue_type*>>
             high_priority_queues_;
-        std::vector<util::cache_line_data<std::vector<std::size_t>>>
-            victim_threads_;
+        std::vector<util::cache_line_data<stealing_hierarchy>> victim_threads_;
     };    // namespace hpx::threads::policies
 }    // namespace hpx::threads::policies
 
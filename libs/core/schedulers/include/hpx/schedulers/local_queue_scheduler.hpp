@@ -10,11 +10,13 @@
 #include <hpx/config.hpp>
 #include <hpx/affinity/affinity_data.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/logging.hpp>
 #include <hpx/schedulers/deadlock_detection.hpp>
 #include <hpx/schedulers/lockfree_queue_backends.hpp>
+#include <hpx/schedulers/stealing_hierarchy.hpp>
 #include <hpx/schedulers/thread_queue.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
@@ -101,22 +103,8 @@ namespace hpx::threads::policies {
           , queues_(init.num_queues_)
           , curr_queue_(0)
           , affinity_data_(init.affinity_data_)
-        // we know that the MIC has one NUMA domain only)
-#if !defined(HPX_NATIVE_MIC)
-          , steals_in_numa_domain_()
-          , steals_outside_numa_domain_()
-#endif
-          , numa_domain_masks_(
-                init.num_queues_, create_topology().get_machine_affinity_mask())
-          , outside_numa_domain_masks_(
-                init.num_queues_, create_topology().get_machine_affinity_mask())
+          , victim_threads_(init.num_queues_)
         {
-#if !defined(HPX_NATIVE_MIC)    // we know that the MIC has one NUMA domain only
-            resize(steals_in_numa_domain_,
-                static_cast<std::size_t>(threads::hardware_concurrency()));
-            resize(steals_outside_numa_domain_,
-                static_cast<std::size_t>(threads::hardware_concurrency()));
-#endif
             if (!deferred_initialization)
             {
                 HPX_ASSERT(init.num_queues_ != 0);
@@ -311,6 +299,9 @@ namespace hpx::threads::policies {
 
             num_thread = select_active_pu(num_thread);
 
+            data.schedulehint.mode = thread_schedule_hint_mode::thread;
+            data.schedulehint.hint = static_cast<std::int16_t>(num_thread);
+
             HPX_ASSERT(num_thread < queue_size);
             queues_[num_thread]->create_thread(data, id, ec);
 
@@ -340,7 +331,10 @@ namespace hpx::threads::policies {
 
                 q->increment_num_pending_accesses();
                 if (result)
+                {
+                    victim_threads_[num_thread].data_.reset();
                     return true;
+                }
                 q->increment_num_pending_misses();
 
                 bool have_staged =
@@ -356,101 +350,25 @@ namespace hpx::threads::policies {
                 return false;
             }
 
-            bool numa_stealing = has_scheduler_mode(
+            // steal work items, nearest workers first
+            bool const numa_stealing = has_scheduler_mode(
                 policies::scheduler_mode::enable_stealing_numa);
-            if (!numa_stealing)
-            {
-                // steal work items: first try to steal from other cores in
-                // the same NUMA node
-                std::size_t pu_number = affinity_data_.get_pu_num(num_thread);
-
-                // we know that the MIC has one NUMA domain only
-#if !defined(HPX_NATIVE_MIC)
-                if (test(steals_in_numa_domain_, pu_number))    //-V600 //-V111
-#endif
-                {
-                    mask_cref_type this_numa_domain =
-                        numa_domain_masks_[num_thread];
-
-                    // steal thread from other queue
-                    for (std::size_t i = 1; i != queues_size; ++i)
-                    {
-                        // FIXME: Do a better job here.
-                        std::size_t const idx = (i + num_thread) % queues_size;
-
-                        HPX_ASSERT(idx != num_thread);
-
-                        std::size_t pu_num = affinity_data_.get_pu_num(idx);
-                        if (!test(this_numa_domain,
-                                pu_num))    //-V560 //-V600 //-V111
-                            continue;
-
-                        thread_queue_type* q = queues_[idx];
-                        if (q->get_next_thread(thrd, running))
-                        {
-                            q->increment_num_stolen_from_pending();
-                            queues_[num_thread]
-                                ->increment_num_stolen_to_pending();
-                            return true;
-                        }
-                    }
-                }
-
-                // we know that the MIC has one NUMA domain only)
-#if !defined(HPX_NATIVE_MIC)
-                // if nothing found, ask everybody else
-                if (test(steals_outside_numa_domain_,
-                        pu_number))    //-V600 //-V111
-                {
-                    mask_cref_type numa_domain =
-                        outside_numa_domain_masks_[num_thread];
-
-                    // steal thread from other queue
-                    for (std::size_t i = 1; i != queues_size; ++i)
-                    {
-                        // FIXME: Do a better job here.
-                        std::size_t const idx = (i + num_thread) % queues_size;
-
-                        HPX_ASSERT(idx != num_thread);
-
-                        std::size_t pu_num = affinity_data_.get_pu_num(idx);
-                        if (!test(numa_domain,
-                                pu_num))    //-V560 //-V600 //-V111
-                            continue;
-
-                        thread_queue_type* q = queues_[idx];
-                        if (q->get_next_thread(thrd, running))
-                        {
-                            q->increment_num_stolen_from_pending();
-                            queues_[num_thread]
-                                ->increment_num_stolen_to_pending();
-                            return true;
-                        }
-                    }
-                }
-#endif
-            }
-
-            else    // not NUMA-sensitive - numa stealing ok
-            {
-                for (std::size_t i = 1; i != queues_size; ++i)
-                {
-                    // FIXME: Do a better job here.
-                    std::size_t const idx = (i + num_thread) % queues_size;
 
+            thread_queue_type* this_queue = queues_[num_thread];
+            return victim_threads_[num_thread].data_.steal(
+                [&](std::size_t idx) {
                     HPX_ASSERT(idx != num_thread);
 
                     thread_queue_type* q = queues_[idx];
                     if (q->get_next_thread(thrd, running))
                     {
                         q->increment_num_stolen_from_pending();
-                        queues_[num_thread]->increment_num_stolen_to_pending();
+                        this_queue->increment_num_stolen_to_pending();
                         return true;
                     }
-                }
-            }
-
-            return false;
+                    return false;
+                },
+                numa_stealing);
         }
 
         // Schedule the passed thread
@@ -711,7 +629,6 @@ namespace hpx::threads::policies {
             std::int64_t& idle_loop_count, bool /* enable_stealing */,
             std::size_t& added, thread_id_ref_type* = nullptr)
         {
-            std::size_t queues_size = queues_.size();
             HPX_ASSERT(num_thread < queues_.size());
 
             added = 0;
@@ -729,104 +646,31 @@ namespace hpx::threads::policies {
                 return true;
             }
 
-            bool numa_stealing_ = has_scheduler_mode(
+            // steal staged work items, nearest workers first
+            bool const numa_stealing = has_scheduler_mode(
                 policies::scheduler_mode::enable_stealing_numa);
-            // limited or no stealing across domains
-            if (!numa_stealing_)
-            {
-                // steal work items: first try to steal from other cores in the
-                // same NUMA node
-                std::size_t pu_number = affinity_data_.get_pu_num(num_thread);
-
-                // we know that the MIC has one NUMA domain only
-#if !defined(HPX_NATIVE_MIC)
-                if (test(steals_in_numa_domain_, pu_number))    //-V600 //-V111
-#endif
-                {
-                    mask_cref_type numa_domain_mask =
-                        numa_domain_masks_[num_thread];
-                    for (std::size_t i = 1; i != queues_size; ++i)
-                    {
-                        // FIXME: Do a better job here.
-                        std::size_t const idx = (i + num_thread) % queues_size;
-
-                        HPX_ASSERT(idx != num_thread);
-
-                        if (!test(numa_domain_mask,
-                                affinity_data_.get_pu_num(idx)))    //-V600
-                        {
-                            continue;
-                        }
-                        result = queues_[num_thread]->wait_or_add_new(
-                                     running, added, queues_[idx]) &&
-                            result;
-                        if (0 != added)
-                        {
-                            queues_[idx]->increment_num_stolen_from_staged(
-                                added);
-                            queues_[num_thread]->increment_num_stolen_to_staged(
-                                added);
-                            return result;
-                        }
-                    }
-                }
-
-                // we know that the MIC has one NUMA domain only)
-#if !defined(HPX_NATIVE_MIC)
-                // if nothing found, ask everybody else
-                if (test(steals_outside_numa_domain_,
-                        pu_number))    //-V600 //-V111
-                {
-                    mask_cref_type numa_domain_mask =
-                        outside_numa_domain_masks_[num_thread];
-                    for (std::size_t i = 1; i != queues_size; ++i)
-                    {
-                        // FIXME: Do a better job here.
-                        std::size_t const idx = (i + num_thread) % queues_size;
-
-                        HPX_ASSERT(idx != num_thread);
-
-                        if (!test(numa_domain_mask,
-                                affinity_data_.get_pu_num(idx)))    //-V600
-                        {
-                            continue;
-                        }
-
-                        result = queues_[num_thread]->wait_or_add_new(
-                                     running, added, queues_[idx]) &&
-                            result;
-                        if (0 != added)
-                        {
-                            queues_[idx]->increment_num_stolen_from_staged(
-                                added);
-                            queues_[num_thread]->increment_num_stolen_to_staged(
-                                added);
-                            return result;
-                        }
-                    }
-                }
-#endif
-            }
-            else    // not NUMA-sensitive : numa stealing ok
-            {
-                for (std::size_t i = 1; i != queues_size; ++i)
-                {
-                    // FIXME: Do a better job here.
-                    std::size_t const idx = (i + num_thread) % queues_size;
 
+            thread_queue_type* this_queue = queues_[num_thread];
+            bool const stolen = victim_threads_[num_thread].data_.visit(
+                [&](std::size_t idx) {
                     HPX_ASSERT(idx != num_thread);
 
-                    result = queues_[num_thread]->wait_or_add_new(
+                    result = this_queue->wait_or_add_new(
                                  running, added, queues_[idx]) &&
                         result;
                     if (0 != added)
                     {
                         queues_[idx]->increment_num_stolen_from_staged(added);
-                        queues_[num_thread]->increment_num_stolen_to_staged(
-                            added);
-                        return result;
+                        this_queue->increment_num_stolen_to_staged(added);
+                        return true;
                     }
-                }
+                    return false;
+                },
+                numa_stealing);
+
+            if (stolen)
+            {
+                return result;
             }
 
 #ifdef HPX_HAVE_THREAD_MINIMAL_DEADLOCK_DETECTION
@@ -883,42 +727,10 @@ namespace hpx::threads::policies {
 
             queues_[num_thread]->on_start_thread(num_thread);
 
-            auto const& topo = create_topology();
-
-            // pre-calculate certain constants for the given thread number
-            std::size_t num_pu = affinity_data_.get_pu_num(num_thread);
-            mask_cref_type machine_mask = topo.get_machine_affinity_mask();
-            mask_cref_type core_mask = topo.get_thread_affinity_mask(num_pu);
-            mask_cref_type node_mask = topo.get_numa_node_affinity_mask(num_pu);
-
-            if (any(core_mask) && any(node_mask))
-            {
-#if !defined(HPX_NATIVE_MIC)    // we know that the MIC has one NUMA domain only
-                set(steals_in_numa_domain_, num_pu);
-#endif
-                numa_domain_masks_[num_thread] = node_mask;
-            }
-
-            // we allow the thread on the boundary of the NUMA domain to steal
-            mask_type first_mask = mask_type();
-            resize(first_mask, mask_size(core_mask));
-
-            std::size_t first = find_first(node_mask);
-            if (first != std::size_t(-1))
-                set(first_mask, first);
-            else
-                first_mask = core_mask;
-
-            bool numa_stealing = has_scheduler_mode(
-                policies::scheduler_mode::enable_stealing_numa);
-            if (numa_stealing && any(first_mask & core_mask))
-            {
-#if !defined(HPX_NATIVE_MIC)    // we know that the MIC has one NUMA domain only
-                set(steals_outside_numa_domain_, num_pu);
-#endif
-                outside_numa_domain_masks_[num_thread] =
-                    not_(node_mask) & machine_mask;
-            }
+            // determine where to steal from
+            victim_threads_[num_thread].data_.init(num_thread, queues_.size(),
+                parent_pool_->get_thread_offset(), affinity_data_,
+                thread_queue_init_);
         }
 
         void on_stop_thread(std::size_t num_thread) override
@@ -938,12 +750,7 @@ namespace hpx::threads::policies {
 
         detail::affinity_data const& affinity_data_;
 
-#if !defined(HPX_NATIVE_MIC)    // we know that the MIC has one NUMA domain only
-        mask_type steals_in_numa_domain_;
-        mask_type steals_outside_numa_domain_;
-#endif
-        std::vector<mask_type> numa_domain_masks_;
-        std::vector<mask_type> outside_numa_domain_masks_;
+        std::vector<util::cache_line_data<stealing_hierarchy>> victim_threads_;
     };
 }    // namespace hpx::threads::policies
 
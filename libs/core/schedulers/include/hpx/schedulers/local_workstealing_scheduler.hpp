@@ -0,0 +1,146 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/schedulers/local_queue_scheduler.hpp>
+#include <hpx/schedulers/lockfree_queue_backends.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+#include <utility>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::threads::policies {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The local_workstealing_scheduler maintains one Chase-Lev work-stealing
+    /// deque of work items (threads) per OS thread. Each OS thread pushes and
+    /// pops work items at the bottom of its own deque (LIFO), while idle OS
+    /// threads steal from the top of the deque of a randomly selected victim
+    /// (FIFO). Victims are selected from the nearest OS threads in the
+    /// machine topology first (see \a stealing_hierarchy). A successful
+    /// thief takes up to half of the work items of its victim at once.
+    template <typename Mutex = std::mutex,
+        typename PendingQueuing = work_stealing_lifo,
+        typename StagedQueuing = lockfree_fifo,
+        typename TerminatedQueuing =
+            default_local_queue_scheduler_terminated_queue>
+    class local_workstealing_scheduler final
+      : public local_queue_scheduler<Mutex, PendingQueuing, StagedQueuing,
+            TerminatedQueuing>
+    {
+    public:
+        using base_type = local_queue_scheduler<Mutex, PendingQueuing,
+            StagedQueuing, TerminatedQueuing>;
+        using thread_queue_type = typename base_type::thread_queue_type;
+
+        // maximal number of work items taken from a victim at once
+        static constexpr std::int64_t max_steal_batch_size = 32;
+
+        explicit local_workstealing_scheduler(
+            typename base_type::init_parameter_type const& init,
+            bool deferred_initialization = true)
+          : base_type(init, deferred_initialization)
+        {
+        }
+
+        static std::string_view get_scheduler_name()
+        {
+            return "local_workstealing_scheduler";
+        }
+
+        // Return the next thread to be executed, return false if none is
+        // available
+        bool get_next_thread(std::size_t num_thread, bool running,
+            threads::thread_id_ref_type& thrd, bool enable_stealing)
+        {
+            HPX_ASSERT(num_thread < this->queues_.size());
+
+            {
+                thread_queue_type* q = this->queues_[num_thread];
+                bool result = q->get_next_thread(thrd);
+
+                q->increment_num_pending_accesses();
+                if (result)
+                {
+                    this->victim_threads_[num_thread].data_.reset();
+                    return true;
+                }
+                q->increment_num_pending_misses();
+
+                // Give up, we should have work to convert.
+                if (q->get_staged_queue_length(std::memory_order_relaxed) != 0)
+                    return false;
+            }
+
+            if (!running || !enable_stealing)
+            {
+                return false;
+            }
+
+            // steal from the nearest workers first, stealing across NUMA
+            // domains is allowed only if enabled
+            bool const numa_stealing =
+                this->has_scheduler_mode(scheduler_mode::enable_stealing_numa);
+
+            return this->victim_threads_[num_thread].data_.steal(
+                [&](std::size_t victim) {
+                    return steal_from(victim, num_thread, running, thrd);
+                },
+                numa_stealing);
+        }
+
+    private:
+        // Try to steal work items from the given victim. Returns the first
+        // stolen work item in thrd, all others are moved to the queue of the
+        // calling OS thread.
+        bool steal_from(std::size_t victim, std::size_t num_thread,
+            bool running, threads::thread_id_ref_type& thrd)
+        {
+            thread_queue_type* from = this->queues_[victim];
+
+            std::int64_t const length =
+                from->get_pending_queue_length(std::memory_order_relaxed);
+            if (length == 0 || !from->get_next_thread(thrd, running, true))
+            {
+                return false;
+            }
+
+            thread_queue_type* to = this->queues_[num_thread];
+
+            std::int64_t const batch_size =
+                (std::min)(length / 2, max_steal_batch_size);
+            std::int64_t stolen = 1;
+
+            threads::thread_id_ref_type next;
+            while (stolen < batch_size &&
+                from->get_next_thread(next, running, true))
+            {
+                to->schedule_thread(HPX_MOVE(next));
+                ++stolen;
+            }
+
+            from->increment_num_stolen_from_pending(
+                static_cast<std::size_t>(stolen));
+            to->increment_num_stolen_to_pending(
+                static_cast<std::size_t>(stolen));
+
+            return true;
+        }
+    };
+}    // namespace hpx::threads::policies
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -21,9 +21,12 @@
 
 // Does not rely on CXX11_STD_ATOMIC_128BIT
 #include <hpx/concurrency/concurrentqueue.hpp>
+#include <hpx/concurrency/work_stealing_deque.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <thread>
 #include <type_traits>
 #include <utility>
 
@@ -154,6 +157,118 @@ namespace hpx::threads::policies {
         };
     };
 
+    ////////////////////////////////////////////////////////////////////////////
+    // LIFO for the owning thread + FIFO stealing at the opposite end, based on
+    // a Chase-Lev work-stealing deque. Items pushed by any other thread (or
+    // pushed to the other end) are collected in a multi-producer inbox which
+    // is drained by the owning thread and which can be stolen from as well.
+    struct work_stealing_lifo;
+
+    template <typename T>
+    struct work_stealing_lifo_backend
+    {
+        using container_type = hpx::lockfree::work_stealing_deque<T>;
+        using inbox_type = hpx::concurrency::ConcurrentQueue<T>;
+
+        using value_type = T;
+        using reference = T&;
+        using const_reference = T const&;
+        using rvalue_reference = T&&;
+        using size_type = std::uint64_t;
+
+        // the owning thread looks at the inbox at least every
+        // inbox_check_interval pop operations
+        static constexpr std::size_t inbox_check_interval = 61;
+
+        // maximal number of items moved from the inbox at once
+        static constexpr std::size_t inbox_batch_size = 16;
+
+        explicit work_stealing_lifo_backend(size_type initial_size = 0,
+            size_type /* num_thread */ = size_type(-1))
+          : queue_(std::size_t(initial_size))
+          , inbox_(std::size_t(initial_size))
+        {
+        }
+
+        // Has to be invoked by the owning thread, all items pushed before
+        // are treated as being pushed by other threads.
+        void on_start_thread() noexcept
+        {
+            owner_.store(std::this_thread::get_id(), std::memory_order_relaxed);
+        }
+
+        bool push(const_reference val, bool other_end = false)    //-V659
+        {
+            if (!other_end && is_owner())
+            {
+                queue_.push(val);
+                return true;
+            }
+            return inbox_.enqueue(val);
+        }
+
+        bool push(rvalue_reference val, bool other_end = false)    //-V659
+        {
+            return push(static_cast<const_reference>(val), other_end);
+        }
+
+        bool pop(reference val, bool steal = true)
+        {
+            if (steal || !is_owner())
+            {
+                return queue_.steal(val) || inbox_.try_dequeue(val);
+            }
+
+            if (++pop_count_ % inbox_check_interval != 0 && queue_.pop(val))
+            {
+                return true;
+            }
+
+            // move the oldest items from the inbox to the deque such that
+            // they are executed in the order they were pushed
+            T items[inbox_batch_size];
+            std::size_t count =
+                inbox_.try_dequeue_bulk(items, inbox_batch_size);
+            if (count == 0)
+            {
+                return queue_.pop(val);
+            }
+
+            while (count > 1)
+            {
+                queue_.push(items[--count]);
+            }
+            val = items[0];
+            return true;
+        }
+
+        bool empty() noexcept
+        {
+            return queue_.empty() && inbox_.size_approx() == 0;
+        }
+
+    private:
+        bool is_owner() const noexcept
+        {
+            return owner_.load(std::memory_order_relaxed) ==
+                std::this_thread::get_id();
+        }
+
+        container_type queue_;
+        inbox_type inbox_;
+        std::atomic<std::thread::id> owner_{std::thread::id()};
+        std::size_t pop_count_ = 0;    // accessed by the owning thread only
+    };
+
+    struct work_stealing_lifo
+    {
+        template <typename T>
+        struct apply
+        {
+            using type = work_stealing_lifo_backend<T>;
+        };
+    };
+
     // LIFO
 #if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
     struct lockfree_lifo;
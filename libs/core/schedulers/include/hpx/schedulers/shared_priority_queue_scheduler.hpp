@@ -12,6 +12,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/debugging/print.hpp>
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/functional/function.hpp>
@@ -19,6 +20,7 @@
 #include <hpx/schedulers/lockfree_queue_backends.hpp>
 #include <hpx/schedulers/queue_holder_numa.hpp>
 #include <hpx/schedulers/queue_holder_thread.hpp>
+#include <hpx/schedulers/stealing_hierarchy.hpp>
 #include <hpx/schedulers/thread_queue_mc.hpp>
 #include <hpx/threading_base/print.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
@@ -165,6 +167,7 @@ namespace hpx::threads::policies {
           , schedcpu_(hpx::threads::hardware_concurrency())
 #endif
 #endif
+          , victim_threads_(init.num_worker_threads_)
           , cores_per_queue_(init.cores_per_queue_)
           , num_workers_(init.num_worker_threads_)
           , num_domains_(1)
@@ -448,10 +451,70 @@ namespace hpx::threads::policies {
                 ->create_thread(data, thrd, local_num, ec);
         }
 
+        // Invoke the given operation for the queues of the potential victims
+        // of the given worker thread, nearest workers first. Only stealing
+        // from the thread queues with update_backoff set updates the stealing
+        // back-off of the worker, this must happen at most once per attempt
+        // to find work.
+        template <typename T, typename F>
+        bool steal_from_victims(std::size_t this_thread, std::size_t domain,
+            bool steal_numa, thread_holder_type* origin, T& var,
+            char const* prefix, F const& operation, bool update_backoff = true)
+        {
+            auto steal_from = [&](std::size_t victim) {
+                std::size_t const dom = d_lookup_[victim];
+                if (!steal_numa && dom != domain)
+                {
+                    return false;
+                }
+
+                std::size_t const q_index = q_lookup_[victim];
+                if (!operation(dom, q_index, origin, var, true, true))
+                {
+                    return false;
+                }
+
+                spq_deb.debug(debug::str<>(prefix), "stolen", "D",
+                    debug::dec<2>(dom), "Q", debug::dec<3>(q_index));
+                return true;
+            };
+
+            stealing_hierarchy& victims = victim_threads_[this_thread].data_;
+            if constexpr (std::is_same_v<T, threads::thread_id_ref_type>)
+            {
+                if (update_backoff)
+                {
+                    return victims.steal(steal_from, steal_numa);
+                }
+
+                if (victims.visit(steal_from, steal_numa))
+                {
+                    victims.reset();
+                    return true;
+                }
+                return false;
+            }
+            else
+            {
+                return victims.visit(steal_from, steal_numa);
+            }
+        }
+
+        // Forget about previously failed stealing attempts of the given
+        // worker thread once it has found a thread in its own queues.
+        template <typename T>
+        void on_local_work(std::size_t this_thread) noexcept
+        {
+            if constexpr (std::is_same_v<T, threads::thread_id_ref_type>)
+            {
+                victim_threads_[this_thread].data_.reset();
+            }
+        }
+
         template <typename T>
-        bool steal_by_function(std::size_t domain, std::size_t q_index,
-            bool steal_numa, bool steal_core, thread_holder_type* origin,
-            T& var, char const* prefix,
+        bool steal_by_function(std::size_t this_thread, std::size_t domain,
+            std::size_t q_index, bool steal_numa, bool steal_core,
+            thread_holder_type* origin, T& var, char const* prefix,
             hpx::function<bool(
                 std::size_t, std::size_t, thread_holder_type*, T&, bool, bool)>
                 operation_HP,
@@ -471,6 +534,7 @@ namespace hpx::threads::policies {
                     operation(domain, q_index, origin, var, false, false);
                 if (result)
                 {
+                    on_local_work<T>(this_thread);
                     spq_deb.debug(debug::str<>(prefix), "local no stealing",
                         "D", debug::dec<2>(domain), "Q",
                         debug::dec<3>(q_index));
@@ -480,42 +544,38 @@ namespace hpx::threads::policies {
             // High priority tasks first
             else if (steal_hp_first_)
             {
-                for (std::size_t d = 0; d < num_domains_; ++d)
+                result =
+                    operation_HP(domain, q_index, origin, var, false, true);
+                if (result)
                 {
-                    std::size_t dom = fast_mod(domain + d, num_domains_);
-                    q_index = fast_mod(q_index, q_counts_[dom]);
-                    result =
-                        operation_HP(dom, q_index, origin, var, (d > 0), true);
-                    if (result)
-                    {
-                        spq_deb.debug(debug::str<>(prefix),
-                            "steal_high_priority_first BP/HP",
-                            (d == 0 ? "taken" : "stolen"), "D",
-                            debug::dec<2>(domain), "Q", debug::dec<3>(q_index));
-                        return result;
-                    }
-                    // if no numa stealing, skip other domains
-                    if (!steal_numa)
-                        break;
+                    on_local_work<T>(this_thread);
+                    spq_deb.debug(debug::str<>(prefix),
+                        "steal_high_priority_first BP/HP", "taken", "D",
+                        debug::dec<2>(domain), "Q", debug::dec<3>(q_index));
+                    return result;
                 }
-                for (std::size_t d = 0; d < num_domains_; ++d)
+
+                // steal high priority tasks from the nearest workers first,
+                // the back-off is updated by the second pass only
+                if (steal_from_victims(this_thread, domain, steal_numa, origin,
+                        var, "steal_high_priority_first BP/HP", operation_HP,
+                        false))
                 {
-                    std::size_t dom = fast_mod(domain + d, num_domains_);
-                    q_index = fast_mod(q_index, q_counts_[dom]);
-                    result =
-                        operation(dom, q_index, origin, var, (d > 0), true);
-                    if (result)
-                    {
-                        spq_deb.debug(debug::str<>(prefix),
-                            "steal_high_priority_first NP/LP",
-                            (d == 0 ? "taken" : "stolen"), "D",
-                            debug::dec<2>(domain), "Q", debug::dec<3>(q_index));
-                        return result;
-                    }
-                    // if no numa stealing, skip other domains
-                    if (!steal_numa)
-                        break;
+                    return true;
+                }
+
+                result = operation(domain, q_index, origin, var, false, true);
+                if (result)
+                {
+                    on_local_work<T>(this_thread);
+                    spq_deb.debug(debug::str<>(prefix),
+                        "steal_high_priority_first NP/LP", "taken", "D",
+                        debug::dec<2>(domain), "Q", debug::dec<3>(q_index));
+                    return result;
                 }
+
+                return steal_from_victims(this_thread, domain, steal_numa,
+                    origin, var, "steal_high_priority_first NP/LP", operation);
             }
             else /*steal_after_local*/
             {
@@ -526,65 +586,25 @@ namespace hpx::threads::policies {
                     operation(domain, q_index, origin, var, false, false);
                 if (result)
                 {
+                    on_local_work<T>(this_thread);
                     spq_deb.debug(debug::str<>(prefix),
                         "steal_after_local local taken", "D",
                         debug::dec<2>(domain), "Q", debug::dec<3>(q_index));
                     return result;
                 }
 
-                if (q_counts_[domain] > 1)
-                {
-                    // steal from other cores on this numa domain?
-                    // use q+1 to avoid testing the same local queue again
-                    q_index = fast_mod((q_index + 1), q_counts_[domain]);
-                    result =
-                        operation_HP(domain, q_index, origin, var, true, true);
-                    result = result ||
-                        operation(domain, q_index, origin, var, true, true);
-                    if (result)
-                    {
-                        spq_deb.debug(debug::str<>(prefix),
-                            "steal_after_local this numa", "stolen", "D",
-                            debug::dec<2>(domain), "Q", debug::dec<3>(q_index));
-                        return result;
-                    }
-                }
-
-                if (steal_numa)
-                {
-                    // try other numa domains BP/HP
-                    for (std::size_t d = 1; d < num_domains_; ++d)
-                    {
-                        std::size_t dom = fast_mod(domain + d, num_domains_);
-                        q_index = fast_mod(q_index, q_counts_[dom]);
-                        result =
-                            operation_HP(dom, q_index, origin, var, true, true);
-                        if (result)
-                        {
-                            spq_deb.debug(debug::str<>(prefix),
-                                "steal_after_local other numa BP/HP", "stolen",
-                                "D", debug::dec<2>(domain), "Q",
-                                debug::dec<3>(q_index));
-                            return result;
-                        }
-                    }
-                    // try other numa domains NP/LP
-                    for (std::size_t d = 1; d < num_domains_; ++d)
-                    {
-                        std::size_t dom = fast_mod(domain + d, num_domains_);
-                        q_index = fast_mod(q_index, q_counts_[dom]);
-                        result =
-                            operation(dom, q_index, origin, var, true, true);
-                        if (result)
-                        {
-                            spq_deb.debug(debug::str<>(prefix),
-                                "steal_after_local other numa NP/LP", "stolen",
-                                "D", debug::dec<2>(domain), "Q",
-                                debug::dec<3>(q_index));
-                            return result;
-                        }
-                    }
-                }
+                // steal from the nearest workers first, high priority tasks
+                // before normal priority tasks of the same victim
+                auto steal_from_victim =
+                    [&](std::size_t dom, std::size_t q, thread_holder_type* o,
+                        T& v, bool stealing, bool allow_stealing) {
+                        return operation_HP(
+                                   dom, q, o, v, stealing, allow_stealing) ||
+                            operation(dom, q, o, v, stealing, allow_stealing);
+                    };
+
+                return steal_from_victims(this_thread, domain, steal_numa,
+                    origin, var, "steal_after_local", steal_from_victim);
             }
             return false;
         }
@@ -626,10 +646,10 @@ namespace hpx::threads::policies {
             // first try a high priority task, allow stealing if stealing of HP
             // tasks in on, this will be fine but send a null function for
             // normal tasks
-            bool result = steal_by_function<threads::thread_id_ref_type>(domain,
-                q_index, numa_stealing_, core_stealing_, nullptr, thrd,
-                "SBF-get_next_thread", get_next_thread_function_HP,
-                get_next_thread_function);
+            bool result = steal_by_function<threads::thread_id_ref_type>(
+                this_thread, domain, q_index, numa_stealing_, core_stealing_,
+                nullptr, thrd, "SBF-get_next_thread",
+                get_next_thread_function_HP, get_next_thread_function);
 
             if (result)
                 return result;
@@ -684,9 +704,10 @@ namespace hpx::threads::policies {
                 q_index, "numa_stealing ", numa_stealing_, "core_stealing ",
                 core_stealing_);
 
-            bool added_tasks = steal_by_function<std::size_t>(domain, q_index,
-                numa_stealing_, core_stealing_, receiver, added,
-                "wait_or_add_new", add_new_function_HP, add_new_function);
+            bool added_tasks = steal_by_function<std::size_t>(this_thread,
+                domain, q_index, numa_stealing_, core_stealing_, receiver,
+                added, "wait_or_add_new", add_new_function_HP,
+                add_new_function);
 
             return !added_tasks;
         }
@@ -859,8 +880,6 @@ namespace hpx::threads::policies {
             spq_deb.debug(debug::str<>("get_queue_length"), "thread_num ",
                 debug::dec<>(thread_num));
 
-            HPX_ASSERT(thread_num != std::size_t(-1));
-
             std::int64_t count = 0;
             if (thread_num != std::size_t(-1))
             {
@@ -872,7 +891,16 @@ namespace hpx::threads::policies {
             }
             else
             {
-                throw std::runtime_error("unhandled get_queue_length with -1");
+                for (std::size_t d = 0; d < num_domains_; ++d)
+                {
+                    for (std::size_t q = 0; q != numa_holder_[d].size(); ++q)
+                    {
+                        if (auto* tq = numa_holder_[d].thread_queue(q))
+                        {
+                            count += tq->get_queue_length();
+                        }
+                    }
+                }
             }
             return count;
         }
@@ -1180,6 +1208,11 @@ namespace hpx::threads::policies {
                 index++;
             }
 
+            // determine where to steal from
+            victim_threads_[local_thread].data_.init(local_thread,
+                num_workers_, parent_pool_->get_thread_offset(), affinity_data_,
+                queue_parameters_);
+
             // increment the thread counter and allow the next thread to init
             thread_init_counter_++;
 
@@ -1363,6 +1396,9 @@ namespace hpx::threads::policies {
 #endif
 #endif
 
+        // potential victims of each worker thread, ordered by distance
+        std::vector<util::cache_line_data<stealing_hierarchy>> victim_threads_;
+
         // number of cores per queue for HP, NP, LP queues
         core_ratios cores_per_queue_;
 
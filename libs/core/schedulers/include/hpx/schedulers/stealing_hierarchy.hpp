@@ -0,0 +1,168 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/affinity/affinity_data.hpp>
+#include <hpx/threading_base/thread_queue_init_parameters.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::threads::policies {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The levels of the machine topology distinguished when selecting the
+    /// workers to steal work from, ordered by increasing distance.
+    enum class steal_level : std::uint8_t
+    {
+        core = 0,       ///< workers running on the same core (SMT siblings)
+        l2_cache,       ///< workers sharing the L2 cache
+        l3_cache,       ///< workers sharing the L3 cache
+        numa_domain,    ///< workers running in the same NUMA domain
+        socket,         ///< workers running on the same socket (package)
+        machine         ///< all other workers
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The stealing_hierarchy holds the potential victims of a single worker
+    /// thread grouped by their distance in the machine topology. Work is
+    /// stolen from the nearest workers first. A level is considered only
+    /// after the given number of consecutive stealing attempts have failed
+    /// (see hpx.thread_queue.steal_threshold_* for the configuration of the
+    /// thresholds). This keeps the working set of stolen work in the caches
+    /// shared with the thief after short-lived load imbalances.
+    ///
+    /// Each worker thread must use its own instance, the instances are not
+    /// thread safe.
+    class HPX_CORE_EXPORT stealing_hierarchy
+    {
+    public:
+        stealing_hierarchy() = default;
+
+        /// Sort all other workers of a pool by their distance to the given
+        /// worker. The workers are identified by their pool-local number, the
+        /// global number of the first worker of the pool is thread_offset.
+        void init(std::size_t num_thread, std::size_t num_threads,
+            std::size_t thread_offset,
+            detail::affinity_data const& affinity_data,
+            thread_queue_init_parameters const& parameters);
+
+        /// Invoke the given function for the potential victims, nearest
+        /// levels first, until it returns true. The victims of each level
+        /// are visited starting at a randomly selected one. Levels outside of
+        /// the NUMA domain of the worker are considered only if numa_stealing
+        /// is true. Returns whether the function has returned true.
+        template <typename F>
+        bool steal(F&& f, bool numa_stealing = true)
+        {
+            std::uint64_t const start = next_random();
+            for (level const& l : levels_)
+            {
+                if (failed_attempts_ < l.threshold ||
+                    (!numa_stealing && is_remote(l.kind)))
+                {
+                    break;
+                }
+
+                std::size_t const num_victims = l.victims.size();
+                std::size_t const first =
+                    static_cast<std::size_t>(start % num_victims);
+                for (std::size_t i = 0; i != num_victims; ++i)
+                {
+                    std::size_t const victim =
+                        l.victims[(first + i) % num_victims];
+                    if (f(victim))
+                    {
+                        failed_attempts_ = 0;
+                        return true;
+                    }
+                }
+            }
+
+            if (failed_attempts_ < max_threshold_)
+            {
+                ++failed_attempts_;
+            }
+            return false;
+        }
+
+        /// Invoke the given function for the potential victims which are
+        /// currently eligible, nearest levels first, until it returns true.
+        /// This does not influence the number of failed stealing attempts.
+        template <typename F>
+        bool visit(F&& f, bool numa_stealing = true) const
+        {
+            for (level const& l : levels_)
+            {
+                if (failed_attempts_ < l.threshold ||
+                    (!numa_stealing && is_remote(l.kind)))
+                {
+                    break;
+                }
+
+                for (std::size_t victim : l.victims)
+                {
+                    if (f(victim))
+                    {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+        /// Forget about previously failed stealing attempts, this should be
+        /// called whenever the worker has found local work.
+        void reset() noexcept
+        {
+            failed_attempts_ = 0;
+        }
+
+        /// Return the number of potential victims on all levels
+        [[nodiscard]] std::size_t size() const noexcept;
+
+        /// Return the potential victims on the given level
+        [[nodiscard]] std::vector<std::size_t> const& get_victims(
+            steal_level level) const noexcept;
+
+    private:
+        static constexpr bool is_remote(steal_level level) noexcept
+        {
+            return level == steal_level::socket ||
+                level == steal_level::machine;
+        }
+
+        // xorshift64*
+        std::uint64_t next_random() noexcept
+        {
+            random_state_ ^= random_state_ >> 12;
+            random_state_ ^= random_state_ << 25;
+            random_state_ ^= random_state_ >> 27;
+            return random_state_ * 0x2545F4914F6CDD1Dull;
+        }
+
+        struct level
+        {
+            steal_level kind;
+            std::int64_t threshold;
+            std::vector<std::size_t> victims;
+        };
+
+        // non-empty levels only, ordered by increasing distance
+        std::vector<level> levels_;
+
+        std::int64_t failed_attempts_ = 0;
+        std::int64_t max_threshold_ = 0;
+        std::uint64_t random_state_ = 0x9E3779B97F4A7C15ull;
+    };
+}    // namespace hpx::threads::policies
+
+#include <hpx/config/warnings_suffix.hpp>
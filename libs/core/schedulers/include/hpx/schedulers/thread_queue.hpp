@@ -23,6 +23,7 @@
 #include <hpx/threading_base/thread_data_stackful.hpp>
 #include <hpx/threading_base/thread_data_stackless.hpp>
 #include <hpx/threading_base/thread_queue_init_parameters.hpp>
+#include <hpx/type_support/detected.hpp>
 #include <hpx/util/get_and_reset_value.hpp>
 
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
@@ -71,6 +72,12 @@ namespace hpx::threads::policies {
     //     bool pop(reference val, bool steal = true);
     //
     //     bool empty();
+    //
+    //     // optional, invoked by the OS thread owning the queue on startup
+    //     void on_start_thread();
+    //
+    //     // optional, deadline of the most urgent item in the queue
+    //     thread_deadline earliest_deadline() const;
     // };
     //
     // struct queue_policy
@@ -81,6 +88,17 @@ namespace hpx::threads::policies {
     //         typedef ... type;
     //     };
     // };
+    namespace detail {
+
+        template <typename Queue>
+        using queue_on_start_thread_t =
+            decltype(std::declval<Queue&>().on_start_thread());
+
+        template <typename Queue>
+        using queue_earliest_deadline_t =
+            decltype(std::declval<Queue const&>().earliest_deadline());
+    }    // namespace detail
+
     template <typename Mutex, typename PendingQueuing, typename StagedQueuing,
         typename TerminatedQueuing>
     class thread_queue
@@ -568,6 +586,22 @@ namespace hpx::threads::policies {
             return new_tasks_count_.data_.load(order);
         }
 
+        // This returns the deadline of the most urgent pending work item if
+        // the queue back-end keeps track of deadlines
+        thread_deadline get_earliest_deadline() const noexcept
+        {
+            if constexpr (hpx::util::is_detected_v<
+                              detail::queue_earliest_deadline_t,
+                              work_items_type>)
+            {
+                return work_items_.earliest_deadline();
+            }
+            else
+            {
+                return thread_deadline::max();
+            }
+        }
+
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
         std::uint64_t get_average_task_wait_time() const noexcept
         {
@@ -774,6 +808,55 @@ namespace hpx::threads::policies {
                 ec = make_success_code();
         }
 
+        // Register a batch of new tasks for later thread creation. All tasks
+        // must be staged (not run_now) and must have 'pending' as their
+        // initial state. The thread objects are acquired in batches by
+        // add_new while holding the queue lock only once.
+        void create_thread_bulk(
+            thread_init_data* data, std::size_t count, error_code& ec)
+        {
+            if (count == 0)
+            {
+                if (&ec != &throws)
+                    ec = make_success_code();
+                return;
+            }
+
+            // the tasks are not visible to add_new before they are pushed,
+            // thus the count can be updated once for the whole batch
+            new_tasks_count_.data_ += static_cast<std::int64_t>(count);
+
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+            std::uint64_t const now = hpx::chrono::high_resolution_clock::now();
+#endif
+            threads::thread_stacksize const self_stacksize =
+                get_self_stacksize_enum();
+
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                thread_init_data& d = data[i];
+
+                HPX_ASSERT(!d.run_now);
+                HPX_ASSERT(d.initial_state == thread_schedule_state::pending);
+
+                if (d.stacksize == threads::thread_stacksize::current)
+                {
+                    d.stacksize = self_stacksize;
+                }
+
+                task_description* td = task_description_alloc_.allocate(1);
+#ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
+                new (td) task_description{HPX_MOVE(d), now};
+#else
+                new (td) task_description{HPX_MOVE(d)};    //-V106
+#endif
+                new_tasks_.push(td);
+            }
+
+            if (&ec != &throws)
+                ec = make_success_code();
+        }
+
         void move_work_items_from(thread_queue* src, std::int64_t count)
         {
             thread_description_ptr trd;
@@ -1140,6 +1223,12 @@ namespace hpx::threads::policies {
         ///////////////////////////////////////////////////////////////////////
         void on_start_thread(std::size_t /* num_thread */)
         {
+            if constexpr (hpx::util::is_detected_v<
+                              detail::queue_on_start_thread_t, work_items_type>)
+            {
+                work_items_.on_start_thread();
+            }
+
             thread_heap_small_.reserve(parameters_.init_threads_count_);
             thread_heap_medium_.reserve(parameters_.init_threads_count_);
             thread_heap_large_.reserve(parameters_.init_threads_count_);
@@ -0,0 +1,121 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/affinity/affinity_data.hpp>
+#include <hpx/schedulers/stealing_hierarchy.hpp>
+#include <hpx/threading_base/thread_queue_init_parameters.hpp>
+#include <hpx/topology/cpu_mask.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hpx::threads::policies {
+
+    namespace {
+
+        inline constexpr std::size_t num_steal_levels =
+            static_cast<std::size_t>(steal_level::machine) + 1;
+    }
+
+    void stealing_hierarchy::init(std::size_t num_thread,
+        std::size_t num_threads, std::size_t thread_offset,
+        detail::affinity_data const& affinity_data,
+        thread_queue_init_parameters const& parameters)
+    {
+        auto const& topo = create_topology();
+
+        std::size_t const num_pu =
+            affinity_data.get_pu_num(thread_offset + num_thread);
+
+        // the processing units sharing the resource of each level with the
+        // given worker
+        std::array<mask_type, num_steal_levels - 1> masks = {
+            {topo.get_core_affinity_mask(num_pu),
+                topo.get_cache_affinity_mask(num_pu, 2),
+                topo.get_cache_affinity_mask(num_pu, 3),
+                topo.get_numa_node_affinity_mask(num_pu),
+                topo.get_socket_affinity_mask(num_pu)}};
+
+        // without any information about NUMA domains the whole machine is
+        // treated as a single domain
+        auto& numa_mask =
+            masks[static_cast<std::size_t>(steal_level::numa_domain)];
+        if (!any(numa_mask))
+        {
+            numa_mask = topo.get_machine_affinity_mask();
+        }
+
+        std::array<std::vector<std::size_t>, num_steal_levels> victims;
+        for (std::size_t i = 0; i != num_threads; ++i)
+        {
+            if (i == num_thread)
+            {
+                continue;
+            }
+
+            std::size_t const pu = affinity_data.get_pu_num(thread_offset + i);
+
+            std::size_t l = 0;
+            while (l != masks.size() && !test(masks[l], pu))    //-V600
+            {
+                ++l;
+            }
+            victims[l].push_back(i);
+        }
+
+        // the thresholds never decrease with the distance
+        std::array<std::int64_t, num_steal_levels> const thresholds = {
+            {0, parameters.steal_threshold_l2_, parameters.steal_threshold_l3_,
+                parameters.steal_threshold_numa_,
+                parameters.steal_threshold_socket_,
+                parameters.steal_threshold_machine_}};
+
+        levels_.clear();
+        max_threshold_ = 0;
+        for (std::size_t l = 0; l != num_steal_levels; ++l)
+        {
+            max_threshold_ = (std::max)(max_threshold_, thresholds[l]);
+            if (!victims[l].empty())
+            {
+                levels_.push_back(level{static_cast<steal_level>(l),
+                    max_threshold_, HPX_MOVE(victims[l])});
+            }
+        }
+
+        failed_attempts_ = 0;
+        random_state_ = 0x9E3779B97F4A7C15ull * (num_thread + 1);
+    }
+
+    std::size_t stealing_hierarchy::size() const noexcept
+    {
+        std::size_t result = 0;
+        for (level const& l : levels_)
+        {
+            result += l.victims.size();
+        }
+        return result;
+    }
+
+    std::vector<std::size_t> const& stealing_hierarchy::get_victims(
+        steal_level kind) const noexcept
+    {
+        for (level const& l : levels_)
+        {
+            if (l.kind == kind)
+            {
+                return l.victims;
+            }
+        }
+
+        static std::vector<std::size_t> const no_victims;
+        return no_victims;
+    }
+}    // namespace hpx::threads::policies
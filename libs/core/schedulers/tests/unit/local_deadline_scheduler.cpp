@@ -0,0 +1,95 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The local_deadline_scheduler runs the work items of a worker thread in the
+// order of their deadlines, work items without a deadline are run last.
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/runtime.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+using hpx::threads::thread_deadline;
+
+void test_deadline_property()
+{
+    using hpx::execution::experimental::get_deadline;
+    using hpx::execution::experimental::with_deadline;
+
+    thread_deadline const deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(1);
+
+    hpx::execution::parallel_executor exec;
+    HPX_TEST(get_deadline(exec) == thread_deadline::max());
+    HPX_TEST(get_deadline(with_deadline(exec, deadline)) == deadline);
+
+    hpx::launch policy = with_deadline(hpx::launch::async, deadline);
+    HPX_TEST(get_deadline(policy) == deadline);
+    HPX_TEST(get_deadline(hpx::launch(policy)) == deadline);
+
+    auto par = with_deadline(hpx::execution::par, deadline);
+    HPX_TEST(get_deadline(par) == deadline);
+}
+
+void test_deadline_order()
+{
+    using hpx::execution::experimental::with_deadline;
+
+    // all work items are queued on the single worker thread before the
+    // first of them is run
+    HPX_TEST_EQ(hpx::get_num_worker_threads(), std::size_t(1));
+
+    auto const now = std::chrono::steady_clock::now();
+    int const offsets[] = {5, 2, 7, 1, 3, 6};
+
+    std::vector<int> order;
+    std::vector<hpx::future<void>> futures;
+
+    hpx::execution::parallel_executor exec;
+    futures.push_back(hpx::async(exec, [&]() { order.push_back(-1); }));
+    for (int offset : offsets)
+    {
+        auto deadline_exec =
+            with_deadline(exec, now + std::chrono::seconds(offset));
+        futures.push_back(hpx::async(
+            deadline_exec, [&, offset]() { order.push_back(offset); }));
+    }
+    futures.push_back(hpx::async(exec, [&]() { order.push_back(-2); }));
+
+    hpx::wait_all(futures);
+
+    std::vector<int> const expected = {1, 2, 3, 5, 6, 7, -1, -2};
+    HPX_TEST(order == expected);
+}
+
+int hpx_main()
+{
+    test_deadline_property();
+    test_deadline_order();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+    init_args.cfg = {"hpx.os_threads=1"};
+    init_args.rp_callback = [](auto& rp,
+                                hpx::program_options::variables_map const&) {
+        rp.create_thread_pool("default",
+            hpx::resource::scheduling_policy::local_deadline);
+    };
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
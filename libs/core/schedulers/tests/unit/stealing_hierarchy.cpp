@@ -0,0 +1,133 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/affinity/affinity_data.hpp>
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/threading_base/thread_queue_init_parameters.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using hpx::threads::policies::steal_level;
+using hpx::threads::policies::stealing_hierarchy;
+using hpx::threads::policies::thread_queue_init_parameters;
+
+constexpr steal_level all_levels[] = {steal_level::core,
+    steal_level::l2_cache, steal_level::l3_cache, steal_level::numa_domain,
+    steal_level::socket, steal_level::machine};
+
+thread_queue_init_parameters make_parameters(std::int64_t l2,
+    std::int64_t l3, std::int64_t numa, std::int64_t socket,
+    std::int64_t machine)
+{
+    return thread_queue_init_parameters(
+        HPX_THREAD_QUEUE_MAX_THREAD_COUNT,
+        HPX_THREAD_QUEUE_MIN_TASKS_TO_STEAL_PENDING,
+        HPX_THREAD_QUEUE_MIN_TASKS_TO_STEAL_STAGED,
+        HPX_THREAD_QUEUE_MIN_ADD_NEW_COUNT, HPX_THREAD_QUEUE_MAX_ADD_NEW_COUNT,
+        HPX_THREAD_QUEUE_MIN_DELETE_COUNT, HPX_THREAD_QUEUE_MAX_DELETE_COUNT,
+        HPX_THREAD_QUEUE_MAX_TERMINATED_THREADS,
+        HPX_THREAD_QUEUE_INIT_THREADS_COUNT, HPX_IDLE_BACKOFF_TIME_MAX,
+        HPX_SMALL_STACK_SIZE, HPX_MEDIUM_STACK_SIZE, HPX_LARGE_STACK_SIZE,
+        HPX_HUGE_STACK_SIZE, l2, l3, numa, socket, machine);
+}
+
+// every other worker is a potential victim on exactly one level, workers
+// sharing a core with the thief are placed on the nearest level
+void test_victims(std::size_t num_threads,
+    hpx::threads::policies::detail::affinity_data const& affinity_data)
+{
+    auto const& topo = hpx::threads::create_topology();
+    auto const parameters = make_parameters(0, 0, 8, 16, 32);
+
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        stealing_hierarchy victims;
+        victims.init(t, num_threads, 0, affinity_data, parameters);
+
+        HPX_TEST_EQ(victims.size(), num_threads - 1);
+
+        std::vector<std::size_t> all;
+        for (steal_level l : all_levels)
+        {
+            auto const& v = victims.get_victims(l);
+            all.insert(all.end(), v.begin(), v.end());
+        }
+        std::sort(all.begin(), all.end());
+
+        HPX_TEST_EQ(all.size(), num_threads - 1);
+        HPX_TEST(std::adjacent_find(all.begin(), all.end()) == all.end());
+        HPX_TEST(std::find(all.begin(), all.end(), t) == all.end());
+
+        auto const& core_mask =
+            topo.get_core_affinity_mask(affinity_data.get_pu_num(t));
+        for (std::size_t v : victims.get_victims(steal_level::core))
+        {
+            HPX_TEST(hpx::threads::test(
+                core_mask, affinity_data.get_pu_num(v)));
+        }
+    }
+}
+
+// distant levels are considered only after enough failed attempts
+void test_thresholds(std::size_t num_threads,
+    hpx::threads::policies::detail::affinity_data const& affinity_data)
+{
+    constexpr std::int64_t threshold = 4;
+    auto const parameters = make_parameters(threshold, threshold, threshold,
+        threshold, threshold);
+
+    stealing_hierarchy victims;
+    victims.init(0, num_threads, 0, affinity_data, parameters);
+
+    std::size_t const num_near =
+        victims.get_victims(steal_level::core).size();
+
+    for (std::int64_t i = 0; i != threshold; ++i)
+    {
+        std::size_t visited = 0;
+        HPX_TEST(!victims.steal([&](std::size_t) {
+            ++visited;
+            return false;
+        }));
+        HPX_TEST_EQ(visited, num_near);
+    }
+
+    // all victims are eligible now, a successful steal resets the back-off
+    std::size_t visited = 0;
+    HPX_TEST(victims.steal([&](std::size_t) {
+        return ++visited == num_threads - 1;
+    }));
+    HPX_TEST_EQ(visited, num_threads - 1);
+
+    visited = 0;
+    HPX_TEST(!victims.visit([&](std::size_t) {
+        ++visited;
+        return false;
+    }));
+    HPX_TEST_EQ(visited, num_near);
+}
+
+int main()
+{
+    std::size_t const num_threads =
+        hpx::threads::create_topology().get_number_of_pus();
+
+    hpx::threads::policies::detail::affinity_data affinity_data;
+    affinity_data.init(num_threads, num_threads);
+
+    test_victims(num_threads, affinity_data);
+    if (num_threads > 1)
+    {
+        test_thresholds(num_threads, affinity_data);
+    }
+
+    return hpx::util::report_errors();
+}
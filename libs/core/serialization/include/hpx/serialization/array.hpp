@@ -14,8 +14,12 @@
 #include <hpx/assert.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/serialize.hpp>
-#include <hpx/serialization/traits/is_bitwise_serializable.hpp>
-#include <hpx/serialization/traits/is_not_bitwise_serializable.hpp>
+#include <hpx/serialization/traits/is_bitwise_copyable.hpp>
+
+#if defined(HPX_SERIALIZATION_HAVE_LAYOUT_HASH)
+#include <hpx/modules/errors.hpp>
+#include <hpx/serialization/detail/layout_hash.hpp>
+#endif
 
 #if defined(HPX_SERIALIZATION_HAVE_BOOST_TYPES)
 #include <hpx/serialization/boost_array.hpp>    // for backwards compatibility
@@ -23,6 +27,7 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <type_traits>
 
 namespace hpx::serialization {
@@ -73,18 +78,25 @@ namespace hpx::serialization {
 
             static constexpr bool use_optimized =
                 std::is_default_constructible_v<element_type> &&
-                (hpx::traits::is_bitwise_serializable_v<element_type> ||
-                    !hpx::traits::is_not_bitwise_serializable_v<element_type>);
+                hpx::traits::is_bitwise_copyable_v<element_type>;
 
             if constexpr (use_optimized)
             {
                 // try using chunking
                 if constexpr (std::is_same_v<Archive, input_archive>)
                 {
+#if defined(HPX_SERIALIZATION_HAVE_LAYOUT_HASH)
+                    check_layout_hash(ar);
+#endif
                     ar.load_binary_chunk(m_t, m_element_count * sizeof(T));
                 }
                 else
                 {
+#if defined(HPX_SERIALIZATION_HAVE_LAYOUT_HASH)
+                    std::uint64_t const hash =
+                        detail::layout_hash_v<element_type>;
+                    ar << hash;
+#endif
                     ar.save_binary_chunk(m_t, m_element_count * sizeof(T));
                 }
             }
@@ -101,6 +113,23 @@ namespace hpx::serialization {
         }
 
     private:
+#if defined(HPX_SERIALIZATION_HAVE_LAYOUT_HASH)
+        // verify that the elements have been written by a peer using the
+        // same memory layout for them
+        static void check_layout_hash(input_archive& ar)
+        {
+            std::uint64_t hash = 0;
+            ar >> hash;
+            if (hash != detail::layout_hash_v<std::remove_const_t<T>>)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                    "hpx::serialization::array::serialize",
+                    "the memory layout of the received elements does not "
+                    "match the layout of the local element type");
+            }
+        }
+#endif
+
         value_type* m_t;
         std::size_t m_element_count;
     };
@@ -27,6 +27,15 @@ namespace hpx::serialization {
         virtual bool flush(
             void* dst, std::size_t dst_count, std::size_t& written) = 0;
 
+        // Upper bound of the number of bytes generated by flush() for the
+        // given number of saved bytes. This is used to size the destination
+        // buffer up front.
+        [[nodiscard]] virtual std::size_t get_max_compressed_length(
+            std::size_t size) const noexcept
+        {
+            return size;
+        }
+
         // decompression API
         virtual std::size_t init_data(
             void const* buffer, std::size_t size, std::size_t buffer_size) = 0;
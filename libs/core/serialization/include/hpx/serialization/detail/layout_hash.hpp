@@ -0,0 +1,170 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/serialization/traits/is_bitwise_copyable.hpp>
+#include <hpx/type_support/pack.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::serialization::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The layout hash of a type is computed at compile time from its
+    // structure (the kinds, sizes, and alignments of the type and of all of
+    // its members). It is embedded into the archive for ranges which are
+    // copied in bulk, if enabled, which allows to detect layout mismatches
+    // between the sending and the receiving side without having to transmit
+    // any per-member meta data.
+    enum class layout_kind : std::uint64_t
+    {
+        boolean = 1,
+        signed_integral = 2,
+        unsigned_integral = 3,
+        floating_point = 4,
+        enumeration = 5,
+        pointer = 6,
+        array = 7,
+        tuple = 8,
+        aggregate = 9,
+        other = 10
+    };
+
+    // 64 bit FNV-1a
+    inline constexpr std::uint64_t layout_hash_seed = 0xcbf29ce484222325ULL;
+
+    constexpr std::uint64_t layout_hash_combine(
+        std::uint64_t seed, std::uint64_t value) noexcept
+    {
+        for (int i = 0; i != 8; ++i)
+        {
+            seed ^= (value >> (8 * i)) & 0xff;
+            seed *= 0x100000001b3ULL;
+        }
+        return seed;
+    }
+
+    constexpr std::uint64_t layout_hash_combine(
+        std::uint64_t seed, layout_kind kind) noexcept
+    {
+        return layout_hash_combine(seed, static_cast<std::uint64_t>(kind));
+    }
+
+    template <typename T>
+    struct is_std_array : std::false_type
+    {
+    };
+
+    template <typename T, std::size_t N>
+    struct is_std_array<std::array<T, N>> : std::true_type
+    {
+    };
+
+    template <typename T>
+    struct tuple_members
+    {
+        using type = void;
+    };
+
+    template <typename... Ts>
+    struct tuple_members<std::tuple<Ts...>>
+    {
+        using type = hpx::util::pack<Ts...>;
+    };
+
+    template <typename T1, typename T2>
+    struct tuple_members<std::pair<T1, T2>>
+    {
+        using type = hpx::util::pack<T1, T2>;
+    };
+
+    template <typename T>
+    constexpr std::uint64_t layout_hash() noexcept;
+
+    template <typename... Ts>
+    constexpr std::uint64_t layout_hash_members(
+        std::uint64_t seed, hpx::util::pack<Ts...>) noexcept
+    {
+        ((seed = layout_hash_combine(
+              seed, layout_hash<std::remove_cv_t<Ts>>())),
+            ...);
+        return seed;
+    }
+
+    template <typename T>
+    constexpr std::uint64_t layout_hash() noexcept
+    {
+        std::uint64_t seed = layout_hash_combine(layout_hash_seed, sizeof(T));
+        seed = layout_hash_combine(seed, alignof(T));
+
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            return layout_hash_combine(seed, layout_kind::boolean);
+        }
+        else if constexpr (std::is_floating_point_v<T>)
+        {
+            return layout_hash_combine(seed, layout_kind::floating_point);
+        }
+        else if constexpr (std::is_integral_v<T>)
+        {
+            return layout_hash_combine(seed,
+                std::is_signed_v<T> ? layout_kind::signed_integral :
+                                      layout_kind::unsigned_integral);
+        }
+        else if constexpr (std::is_enum_v<T>)
+        {
+            return layout_hash_combine(
+                layout_hash_combine(seed, layout_kind::enumeration),
+                layout_hash<std::underlying_type_t<T>>());
+        }
+        else if constexpr (std::is_pointer_v<T>)
+        {
+            return layout_hash_combine(seed, layout_kind::pointer);
+        }
+        else if constexpr (std::is_array_v<T>)
+        {
+            seed = layout_hash_combine(seed, layout_kind::array);
+            seed = layout_hash_combine(seed, std::extent_v<T>);
+            return layout_hash_combine(
+                seed, layout_hash<std::remove_cv_t<std::remove_extent_t<T>>>());
+        }
+        else if constexpr (is_std_array<T>::value)
+        {
+            seed = layout_hash_combine(seed, layout_kind::array);
+            seed = layout_hash_combine(seed, std::tuple_size_v<T>);
+            return layout_hash_combine(seed,
+                layout_hash<std::remove_cv_t<typename T::value_type>>());
+        }
+        else if constexpr (!std::is_void_v<typename tuple_members<T>::type>)
+        {
+            return layout_hash_members(
+                layout_hash_combine(seed, layout_kind::tuple),
+                typename tuple_members<T>::type());
+        }
+        else if constexpr (hpx::traits::detail::is_bitwise_copyable_struct<
+                               T>::value)
+        {
+            return layout_hash_members(
+                layout_hash_combine(seed, layout_kind::aggregate),
+                hpx::traits::detail::struct_member_types_t<T>());
+        }
+        else
+        {
+            // types explicitly marked as being bitwise serializable are opaque
+            return layout_hash_combine(seed, layout_kind::other);
+        }
+    }
+
+    template <typename T>
+    inline constexpr std::uint64_t layout_hash_v = layout_hash<T>();
+}    // namespace hpx::serialization::detail
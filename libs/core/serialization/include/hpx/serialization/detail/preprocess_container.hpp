@@ -16,7 +16,10 @@
 namespace hpx::serialization::detail {
 
     // This 'container' is used to gather the required archive size for a given
-    // type before it is serialized.
+    // type before it is serialized. If the archive is created with a (unused)
+    // chunk vector, the data sent as zero-copy chunks is excluded from the
+    // gathered size and the chunks are counted instead (see
+    // output_archive::get_num_chunks).
     class preprocess_container
     {
     public:
@@ -11,6 +11,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/traits/is_bitwise_copyable.hpp>
 #include <hpx/serialization/traits/is_bitwise_serializable.hpp>
 #include <hpx/serialization/traits/is_not_bitwise_serializable.hpp>
 
@@ -25,8 +26,8 @@ namespace hpx::traits {
     template <typename Key, typename Value>
     struct is_bitwise_serializable<std::pair<Key, Value>>
       : std::integral_constant<bool,
-            is_bitwise_serializable_v<std::remove_const_t<Key>> &&
-                is_bitwise_serializable_v<std::remove_const_t<Value>>>
+            is_bitwise_copyable_v<std::remove_const_t<Key>> &&
+                is_bitwise_copyable_v<std::remove_const_t<Value>>>
     {
     };
 
@@ -16,8 +16,7 @@
 #include <hpx/serialization/detail/polymorphic_nonintrusive_factory.hpp>
 #include <hpx/serialization/detail/raw_ptr.hpp>
 #include <hpx/serialization/output_container.hpp>
-#include <hpx/serialization/traits/is_bitwise_serializable.hpp>
-#include <hpx/serialization/traits/is_not_bitwise_serializable.hpp>
+#include <hpx/serialization/traits/is_bitwise_copyable.hpp>
 
 #include <cstddef>
 #include <cstdint>
@@ -211,8 +210,7 @@ namespace hpx::serialization {
 #endif
             if constexpr (!std::is_integral_v<T> && !std::is_enum_v<T>)
             {
-                if constexpr (hpx::traits::is_bitwise_serializable_v<T> ||
-                    !hpx::traits::is_not_bitwise_serializable_v<T>)
+                if constexpr (hpx::traits::is_bitwise_copyable_v<T>)
                 {
                     // bitwise serialization
                     static_assert(!std::is_abstract_v<T>,
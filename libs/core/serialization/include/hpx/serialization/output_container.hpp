@@ -311,8 +311,14 @@ namespace hpx::serialization {
         {
             std::size_t written = 0;
 
-            if (access_traits::size(this->cont_) < this->current_)
-                access_traits::resize(this->cont_, this->current_);
+            // make room for the largest possible output of the filter to
+            // avoid having to grow the container while flushing
+            std::size_t const required = start_compressing_at_ +
+                filter_->get_max_compressed_length(
+                    this->current_ - start_compressing_at_);
+            std::size_t const size = access_traits::size(this->cont_);
+            if (size < required)
+                access_traits::resize(this->cont_, required - size);
 
             this->current_ = start_compressing_at_;
 
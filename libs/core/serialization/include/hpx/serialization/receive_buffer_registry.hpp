@@ -0,0 +1,49 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx::serialization {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A receiving locality can pre-post a destination buffer for the data of
+    // an incoming serialize_buffer. The sender associates the buffer with the
+    // same tag (see serialize_buffer::set_receive_tag). While deserializing,
+    // the data is then written directly into the registered memory and the
+    // received serialize_buffer refers to it (without managing its lifetime),
+    // which avoids allocating a temporary buffer and copying the data out of
+    // it on the receiving side.
+    //
+    // A registration is consumed by the first serialize_buffer carrying its
+    // tag whose data fits into the registered memory. The memory has to stay
+    // valid until the received serialize_buffer has been destroyed. If no
+    // buffer was registered (or if the data was delivered locally, without
+    // being serialized), the received serialize_buffer owns its own memory
+    // as usual, the receiver can detect this by comparing its data() with
+    // the registered memory.
+    //
+    // Returns false if the tag is zero (which is reserved) or if a buffer is
+    // already registered for the given tag.
+    HPX_CORE_EXPORT bool register_receive_buffer(
+        std::uint64_t tag, void* data, std::size_t size);
+
+    // Remove a registration which was not consumed yet. Returns false if no
+    // buffer is registered for the given tag (anymore).
+    HPX_CORE_EXPORT bool unregister_receive_buffer(std::uint64_t tag);
+
+    namespace detail {
+
+        // Retrieve and remove the buffer registered for the given tag if
+        // it can hold the given number of bytes, returns nullptr otherwise.
+        HPX_CORE_EXPORT void* take_receive_buffer(
+            std::uint64_t tag, std::size_t size);
+    }    // namespace detail
+}    // namespace hpx::serialization
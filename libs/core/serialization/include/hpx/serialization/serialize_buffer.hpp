@@ -12,6 +12,7 @@
 #include <hpx/modules/errors.hpp>
 
 #include <hpx/serialization/array.hpp>
+#include <hpx/serialization/receive_buffer_registry.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/serialize.hpp>
 
@@ -20,7 +21,9 @@
 #endif
 
 #include <algorithm>
+#include <climits>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 
 namespace hpx::serialization {
@@ -293,15 +296,41 @@ namespace hpx::serialization {
             }
         }
 
+        // Associate the data with a destination buffer registered on the
+        // receiving locality (see register_receive_buffer), zero means none.
+        void set_receive_tag(std::uint64_t tag) noexcept
+        {
+            receive_tag_ = tag;
+        }
+
+        [[nodiscard]] constexpr std::uint64_t get_receive_tag() const noexcept
+        {
+            return receive_tag_;
+        }
+
     private:
         // serialization support
         friend class hpx::serialization::access;
 
+        // The most significant bit of the serialized size flags that a receive
+        // tag follows the allocator, untagged buffers keep their format.
+        static constexpr std::size_t receive_tag_flag = std::size_t(1)
+            << (sizeof(std::size_t) * CHAR_BIT - 1);
+
         ///////////////////////////////////////////////////////////////////////
         template <typename Archive>
         void save(Archive& ar, unsigned int const) const
         {
-            ar << size_ << alloc_;    // -V128
+            if (receive_tag_ == 0)
+            {
+                ar << size_ << alloc_;    // -V128
+            }
+            else
+            {
+                HPX_ASSERT((size_ & receive_tag_flag) == 0);
+                ar << (size_ | receive_tag_flag) << alloc_
+                   << receive_tag_;    // -V128
+            }
 
             if (size_ != 0)
             {
@@ -315,10 +344,35 @@ namespace hpx::serialization {
         {
             ar >> size_ >> alloc_;    // -V128
 
-            data_.reset(alloc_.allocate(size_),
-                [alloc = this->alloc_, size = this->size_](T* p) {
-                    serialize_buffer::deleter<allocator_type>(p, alloc, size);
-                });
+            receive_tag_ = 0;
+            if ((size_ & receive_tag_flag) != 0)
+            {
+                size_ &= ~receive_tag_flag;
+                ar >> receive_tag_;
+            }
+
+            // deserialize the data directly into the destination buffer
+            // registered by the receiver, if any
+            void* dest = nullptr;
+            if (receive_tag_ != 0 && size_ != 0)
+            {
+                dest = detail::take_receive_buffer(
+                    receive_tag_, size_ * sizeof(T));
+            }
+
+            if (dest != nullptr)
+            {
+                data_.reset(
+                    static_cast<T*>(dest), &serialize_buffer::no_deleter);
+            }
+            else
+            {
+                data_.reset(alloc_.allocate(size_),
+                    [alloc = this->alloc_, size = this->size_](T* p) {
+                        serialize_buffer::deleter<allocator_type>(
+                            p, alloc, size);
+                    });
+            }
 
             if (size_ != 0)
             {
@@ -339,5 +393,6 @@ namespace hpx::serialization {
         buffer_type data_;
         std::size_t size_;
         Allocator alloc_;
+        std::uint64_t receive_tag_ = 0;
     };
 }    // namespace hpx::serialization
@@ -10,6 +10,7 @@
 #pragma once
 
 #include <hpx/serialization/serialization_fwd.hpp>
+#include <hpx/serialization/traits/is_bitwise_copyable.hpp>
 #include <hpx/serialization/traits/is_bitwise_serializable.hpp>
 #include <hpx/serialization/traits/is_not_bitwise_serializable.hpp>
 #include <hpx/type_support/pack.hpp>
@@ -23,7 +24,7 @@ namespace hpx::traits {
     template <typename... Ts>
     struct is_bitwise_serializable<std::tuple<Ts...>>
       : ::hpx::util::all_of<
-            hpx::traits::is_bitwise_serializable<std::remove_const_t<Ts>>...>
+            hpx::traits::is_bitwise_copyable<std::remove_const_t<Ts>>...>
     {
     };
 
@@ -0,0 +1,246 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/serialization/config/defines.hpp>
+#include <hpx/serialization/access.hpp>
+#include <hpx/serialization/traits/brace_initializable_traits.hpp>
+#include <hpx/serialization/traits/is_bitwise_serializable.hpp>
+#include <hpx/serialization/traits/is_not_bitwise_serializable.hpp>
+#include <hpx/type_support/pack.hpp>
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::traits {
+
+    template <typename T>
+    struct is_bitwise_copyable;
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // Retrieve the types of the members of a simple (brace-initializable)
+        // struct. These functions are used in unevaluated contexts only.
+        template <typename T>
+        auto struct_member_types(T& t, size<1>)
+        {
+            auto& [p1] = t;
+            return hpx::util::pack<decltype(p1)>();
+        }
+
+        template <typename T>
+        auto struct_member_types(T& t, size<2>)
+        {
+            auto& [p1, p2] = t;
+            return hpx::util::pack<decltype(p1), decltype(p2)>();
+        }
+
+        template <typename T>
+        auto struct_member_types(T& t, size<3>)
+        {
+            auto& [p1, p2, p3] = t;
+            return hpx::util::pack<decltype(p1), decltype(p2), decltype(p3)>();
+        }
+
+        template <typename T>
+        auto struct_member_types(T& t, size<4>)
+        {
+            auto& [p1, p2, p3, p4] = t;
+            return hpx::util::pack<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4)>();
+        }
+
+        template <typename T>
+        auto struct_member_types(T& t, size<5>)
+        {
+            auto& [p1, p2, p3, p4, p5] = t;
+            return hpx::util::pack<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5)>();
+        }
+
+        template <typename T>
+        auto struct_member_types(T& t, size<6>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6] = t;
+            return hpx::util::pack<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6)>();
+        }
+
+        template <typename T>
+        auto struct_member_types(T& t, size<7>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7] = t;
+            return hpx::util::pack<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7)>();
+        }
+
+        template <typename T>
+        auto struct_member_types(T& t, size<8>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8] = t;
+            return hpx::util::pack<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7),
+                decltype(p8)>();
+        }
+
+        template <typename T>
+        auto struct_member_types(T& t, size<9>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9] = t;
+            return hpx::util::pack<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7),
+                decltype(p8), decltype(p9)>();
+        }
+
+        template <typename T>
+        auto struct_member_types(T& t, size<10>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10] = t;
+            return hpx::util::pack<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7),
+                decltype(p8), decltype(p9), decltype(p10)>();
+        }
+
+        template <typename T>
+        auto struct_member_types(T& t, size<11>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11] = t;
+            return hpx::util::pack<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7),
+                decltype(p8), decltype(p9), decltype(p10), decltype(p11)>();
+        }
+
+        template <typename T>
+        auto struct_member_types(T& t, size<12>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12] = t;
+            return hpx::util::pack<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7),
+                decltype(p8), decltype(p9), decltype(p10), decltype(p11),
+                decltype(p12)>();
+        }
+
+        template <typename T>
+        auto struct_member_types(T& t, size<13>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13] = t;
+            return hpx::util::pack<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7),
+                decltype(p8), decltype(p9), decltype(p10), decltype(p11),
+                decltype(p12), decltype(p13)>();
+        }
+
+        template <typename T>
+        auto struct_member_types(T& t, size<14>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13,
+                p14] = t;
+            return hpx::util::pack<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7),
+                decltype(p8), decltype(p9), decltype(p10), decltype(p11),
+                decltype(p12), decltype(p13), decltype(p14)>();
+        }
+
+        template <typename T>
+        auto struct_member_types(T& t, size<15>)
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14,
+                p15] = t;
+            return hpx::util::pack<decltype(p1), decltype(p2), decltype(p3),
+                decltype(p4), decltype(p5), decltype(p6), decltype(p7),
+                decltype(p8), decltype(p9), decltype(p10), decltype(p11),
+                decltype(p12), decltype(p13), decltype(p14), decltype(p15)>();
+        }
+
+        template <typename T>
+        using struct_member_types_t = decltype(struct_member_types(
+            std::declval<T&>(), hpx::traits::detail::arity<T>()));
+
+        ///////////////////////////////////////////////////////////////////////
+        // A struct can be copied as a whole if all of its members can be
+        // copied as a whole and if it has no padding, which avoids sending
+        // uninitialized memory.
+        template <typename T, typename Members>
+        struct is_bitwise_copyable_members;
+
+        template <typename T, typename... Ms>
+        struct is_bitwise_copyable_members<T, hpx::util::pack<Ms...>>
+          : std::conjunction<std::negation<std::is_reference<Ms>>...,
+                std::negation<std::is_const<Ms>>...,
+                std::bool_constant<(sizeof(Ms) + ... + 0) == sizeof(T)>,
+                is_bitwise_copyable<Ms>...>
+        {
+        };
+
+        // Only simple structs without any explicit serialization support are
+        // considered. The checks are evaluated lazily as decomposing the
+        // struct is valid only if all of the preceding checks hold.
+        template <typename T>
+        struct is_simple_struct
+          : std::conjunction<std::is_class<T>, std::is_aggregate<T>,
+                std::is_trivially_copyable<T>,
+                std::negation<hpx::serialization::access::has_serialize<T>>,
+                std::negation<hpx::serialization::has_serialize_adl<T>>,
+#if defined(HPX_SERIALIZATION_HAVE_ALL_TYPES_ARE_BITWISE_SERIALIZABLE)
+                // a struct explicitly marked as not bitwise serializable
+                // (HPX_IS_NOT_BITWISE_SERIALIZABLE) is serialized member by
+                // member
+                std::negation<is_not_bitwise_serializable<T>>,
+#endif
+                hpx::serialization::has_struct_serialization<T>>
+        {
+        };
+
+        template <typename T, typename Enable = void>
+        struct is_bitwise_copyable_struct : std::false_type
+        {
+        };
+
+        template <typename T>
+        struct is_bitwise_copyable_struct<T,
+            std::enable_if_t<is_simple_struct<T>::value>>
+          : is_bitwise_copyable_members<T, struct_member_types_t<T>>
+        {
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Values of a type satisfying this trait are serialized by copying their
+    // memory as a whole. This is true for all types which are bitwise
+    // serializable and for simple structs (see brace_initializable.hpp) which
+    // are not explicitly serializable themselves, which are trivially
+    // copyable, and all members of which are bitwise copyable as well. Ranges
+    // of such values are copied in bulk by the container serializers.
+    template <typename T>
+    struct is_bitwise_copyable
+      : std::disjunction<is_bitwise_serializable<T>,
+            std::negation<is_not_bitwise_serializable<T>>, std::is_enum<T>,
+            detail::is_bitwise_copyable_struct<T>>
+    {
+    };
+
+    template <typename T>
+    inline constexpr bool is_bitwise_copyable_v = is_bitwise_copyable<T>::value;
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, std::size_t N>
+    struct is_bitwise_serializable<std::array<T, N>>
+      : is_bitwise_copyable<std::remove_const_t<T>>
+    {
+    };
+
+    template <typename T, std::size_t N>
+    struct is_not_bitwise_serializable<std::array<T, N>>
+      : std::integral_constant<bool,
+            !is_bitwise_serializable_v<std::array<T, N>>>
+    {
+    };
+}    // namespace hpx::traits
@@ -7,11 +7,15 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/serialization/array.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
-#include <hpx/serialization/traits/is_bitwise_serializable.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/traits/is_bitwise_copyable.hpp>
 
 #include <cstddef>
 #include <cstdint>
+#include <type_traits>
 #include <valarray>
 
 namespace hpx::serialization {
@@ -26,6 +30,23 @@ namespace hpx::serialization {
         if (sz == 0)
             return;
 
+        if constexpr (hpx::traits::is_bitwise_copyable_v<T>)
+        {
+#if !defined(HPX_SERIALIZATION_HAVE_ALL_TYPES_ARE_BITWISE_SERIALIZABLE)
+            if (!(ar.disable_array_optimization() || ar.endianess_differs()))
+            {
+                // bitwise load ...
+                ar >> hpx::serialization::make_array(&arr[0], arr.size());
+                return;
+            }
+#else
+            HPX_ASSERT(
+                !(ar.disable_array_optimization() || ar.endianess_differs()));
+            ar >> hpx::serialization::make_array(&arr[0], arr.size());
+            return;
+#endif
+        }
+
         for (std::size_t i = 0; i < sz; ++i)
             ar >> arr[i];
     }
@@ -39,6 +60,23 @@ namespace hpx::serialization {
         if (sz == 0)
             return;
 
+        if constexpr (hpx::traits::is_bitwise_copyable_v<T>)
+        {
+#if !defined(HPX_SERIALIZATION_HAVE_ALL_TYPES_ARE_BITWISE_SERIALIZABLE)
+            if (!(ar.disable_array_optimization() || ar.endianess_differs()))
+            {
+                // bitwise (zero-copy) save ...
+                ar << hpx::serialization::make_array(&arr[0], arr.size());
+                return;
+            }
+#else
+            HPX_ASSERT(
+                !(ar.disable_array_optimization() || ar.endianess_differs()));
+            ar << hpx::serialization::make_array(&arr[0], arr.size());
+            return;
+#endif
+        }
+
         for (auto const& v : arr)
             ar << v;
     }
@@ -14,8 +14,7 @@
 #include <hpx/serialization/detail/serialize_collection.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/serialize.hpp>
-#include <hpx/serialization/traits/is_bitwise_serializable.hpp>
-#include <hpx/serialization/traits/is_not_bitwise_serializable.hpp>
+#include <hpx/serialization/traits/is_bitwise_copyable.hpp>
 
 #include <cstddef>
 #include <cstdint>
@@ -63,8 +62,7 @@ namespace hpx::serialization {
 
         static constexpr bool use_optimized =
             std::is_default_constructible_v<element_type> &&
-            (hpx::traits::is_bitwise_serializable_v<element_type> ||
-                !hpx::traits::is_not_bitwise_serializable_v<element_type>);
+            hpx::traits::is_bitwise_copyable_v<element_type>;
 
         if constexpr (use_optimized)
         {
@@ -128,8 +126,7 @@ namespace hpx::serialization {
 
         static constexpr bool use_optimized =
             std::is_default_constructible_v<element_type> &&
-            (hpx::traits::is_bitwise_serializable_v<element_type> ||
-                !hpx::traits::is_not_bitwise_serializable_v<element_type>);
+            hpx::traits::is_bitwise_copyable_v<element_type>;
 
         if constexpr (use_optimized)
         {
@@ -0,0 +1,82 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/serialization/receive_buffer_registry.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+#include <hpx/type_support/static.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+namespace hpx::serialization {
+
+    namespace {
+
+        struct receive_buffer
+        {
+            void* data;
+            std::size_t size;
+        };
+
+        // The registry is accessed by HPX threads while (de-)serializing, the
+        // critical sections are short and never suspend.
+        struct receive_buffer_registry
+        {
+            using mutex_type = hpx::util::detail::spinlock;
+
+            mutex_type mtx;
+            std::unordered_map<std::uint64_t, receive_buffer> buffers;
+        };
+
+        receive_buffer_registry& get_receive_buffer_registry()
+        {
+            util::static_<receive_buffer_registry> registry;
+            return registry.get();
+        }
+    }    // namespace
+
+    bool register_receive_buffer(
+        std::uint64_t tag, void* data, std::size_t size)
+    {
+        if (tag == 0)
+            return false;
+
+        receive_buffer_registry& registry = get_receive_buffer_registry();
+
+        std::lock_guard l(registry.mtx);
+        return registry.buffers.emplace(tag, receive_buffer{data, size})
+            .second;
+    }
+
+    bool unregister_receive_buffer(std::uint64_t tag)
+    {
+        receive_buffer_registry& registry = get_receive_buffer_registry();
+
+        std::lock_guard l(registry.mtx);
+        return registry.buffers.erase(tag) != 0;
+    }
+
+    namespace detail {
+
+        void* take_receive_buffer(std::uint64_t tag, std::size_t size)
+        {
+            receive_buffer_registry& registry = get_receive_buffer_registry();
+
+            std::lock_guard l(registry.mtx);
+
+            auto const it = registry.buffers.find(tag);
+            if (it == registry.buffers.end() || it->second.size < size)
+                return nullptr;
+
+            void* data = it->second.data;
+            registry.buffers.erase(it);
+            return data;
+        }
+    }    // namespace detail
+}    // namespace hpx::serialization
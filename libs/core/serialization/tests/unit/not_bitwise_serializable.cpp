@@ -96,6 +96,20 @@ struct B
 
 HPX_IS_NOT_BITWISE_SERIALIZABLE(B)
 
+// a simple struct without serialization support explicitly marked as not
+// bitwise serializable is serialized member by member
+struct C
+{
+    int a;
+    int b;
+};
+
+HPX_IS_NOT_BITWISE_SERIALIZABLE(C)
+
+static_assert(hpx::traits::is_bitwise_copyable_v<A_nonser>);
+static_assert(!hpx::traits::is_bitwise_copyable_v<B>);
+static_assert(!hpx::traits::is_bitwise_copyable_v<C>);
+
 int main(int, char*[])
 {
     {
@@ -171,5 +185,24 @@ int main(int, char*[])
         HPX_TEST_EQ(ib.a, 42);
         HPX_TEST_EQ(ib.b, 42.0);
     }
+
+    {
+        std::vector<char> buffer;
+        hpx::serialization::output_archive oarchive(buffer);
+
+        std::vector<C> oc = {{1, 2}, {3, 4}};
+        oarchive << oc;
+
+        hpx::serialization::input_archive iarchive(buffer);
+        std::vector<C> ic;
+
+        iarchive >> ic;
+
+        HPX_TEST_EQ(ic.size(), std::size_t(2));
+        HPX_TEST_EQ(ic[0].a, 1);
+        HPX_TEST_EQ(ic[0].b, 2);
+        HPX_TEST_EQ(ic[1].a, 3);
+        HPX_TEST_EQ(ic[1].b, 4);
+    }
     return hpx::util::report_errors();
 }
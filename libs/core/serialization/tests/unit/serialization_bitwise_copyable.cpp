@@ -0,0 +1,250 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#include <hpx/serialization/array.hpp>
+#include <hpx/serialization/brace_initializable.hpp>
+#include <hpx/serialization/detail/layout_hash.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/map.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/traits/is_bitwise_copyable.hpp>
+#include <hpx/serialization/valarray.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <tuple>
+#include <valarray>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct point
+{
+    double x;
+    double y;
+    double z;
+};
+
+bool operator==(point const& lhs, point const& rhs)
+{
+    return std::tie(lhs.x, lhs.y, lhs.z) == std::tie(rhs.x, rhs.y, rhs.z);
+}
+
+struct cell
+{
+    point center;
+    std::array<std::int32_t, 4> vertices;
+};
+
+bool operator==(cell const& lhs, cell const& rhs)
+{
+    return lhs.center == rhs.center && lhs.vertices == rhs.vertices;
+}
+
+// has padding
+struct padded
+{
+    char c;
+    double d;
+};
+
+// not trivially copyable
+struct named
+{
+    std::string name;
+    double value;
+};
+
+// explicitly serializable
+struct custom
+{
+    double value;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & value;
+        // clang-format on
+    }
+};
+
+static_assert(hpx::traits::is_bitwise_copyable_v<point>);
+static_assert(hpx::traits::is_bitwise_copyable_v<cell>);
+static_assert(hpx::traits::is_bitwise_copyable_v<std::array<double, 3>>);
+static_assert(hpx::traits::is_bitwise_copyable_v<std::array<point, 2>>);
+static_assert(hpx::traits::is_bitwise_copyable_v<std::pair<int const, point>>);
+static_assert(!hpx::traits::is_bitwise_copyable_v<padded>);
+static_assert(!hpx::traits::is_bitwise_copyable_v<named>);
+static_assert(!hpx::traits::is_bitwise_copyable_v<custom>);
+static_assert(!hpx::traits::is_bitwise_copyable_v<std::array<named, 2>>);
+
+struct point2d
+{
+    double x;
+    double y;
+};
+
+struct point3i
+{
+    double x;
+    double y;
+    std::int64_t z;
+};
+
+static_assert(hpx::serialization::detail::layout_hash_v<point> ==
+    hpx::serialization::detail::layout_hash_v<point>);
+static_assert(hpx::serialization::detail::layout_hash_v<point> !=
+    hpx::serialization::detail::layout_hash_v<point2d>);
+static_assert(hpx::serialization::detail::layout_hash_v<point> !=
+    hpx::serialization::detail::layout_hash_v<point3i>);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Container>
+void test_roundtrip(Container const& os, std::uint32_t flags)
+{
+    std::vector<char> buffer;
+    std::vector<hpx::serialization::serialization_chunk> chunks;
+    hpx::serialization::output_archive oarchive(buffer, flags, &chunks);
+    oarchive << os;
+    std::size_t const size = oarchive.bytes_written();
+
+    Container is;
+    hpx::serialization::input_archive iarchive(buffer, size, &chunks);
+    iarchive >> is;
+
+    HPX_TEST(os.size() == is.size());
+    HPX_TEST(std::equal(std::begin(os), std::end(os), std::begin(is)));
+}
+
+template <typename Container>
+void test_roundtrip(Container const& os)
+{
+    using hpx::serialization::archive_flags;
+
+    test_roundtrip(os, 0);
+    test_roundtrip(
+        os, static_cast<std::uint32_t>(archive_flags::disable_data_chunking));
+    test_roundtrip(os,
+        static_cast<std::uint32_t>(archive_flags::disable_array_optimization));
+}
+
+std::vector<point> make_points(std::size_t count)
+{
+    std::vector<point> points;
+    points.reserve(count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        double const d = static_cast<double>(i);
+        points.push_back(point{d, 2 * d, 3 * d});
+    }
+    return points;
+}
+
+void test_vector()
+{
+    // large enough to be sent as a zero-copy chunk
+    std::size_t const count =
+        HPX_ZERO_COPY_SERIALIZATION_THRESHOLD / sizeof(point) + 1;
+
+    test_roundtrip(make_points(5));
+    test_roundtrip(make_points(count));
+
+    std::vector<std::array<double, 3>> arrays;
+    for (point const& p : make_points(count))
+    {
+        arrays.push_back({{p.x, p.y, p.z}});
+    }
+    test_roundtrip(arrays);
+
+    std::vector<cell> cells;
+    for (point const& p : make_points(count))
+    {
+        std::int32_t const i = static_cast<std::int32_t>(p.x);
+        cells.push_back(cell{p, {{i, i + 1, i + 2, i + 3}}});
+    }
+    test_roundtrip(cells);
+}
+
+void test_valarray()
+{
+    std::vector<point> const points = make_points(100);
+    std::valarray<point> os(points.data(), points.size());
+
+    for (std::uint32_t flags :
+        {std::uint32_t(0),
+            std::uint32_t(
+                hpx::serialization::archive_flags::disable_array_optimization)})
+    {
+        std::vector<char> buffer;
+        hpx::serialization::output_archive oarchive(buffer, flags);
+        oarchive << os;
+
+        std::valarray<point> is;
+        hpx::serialization::input_archive iarchive(buffer);
+        iarchive >> is;
+
+        HPX_TEST_EQ(os.size(), is.size());
+        for (std::size_t i = 0; i != os.size(); ++i)
+        {
+            HPX_TEST(os[i] == is[i]);
+        }
+    }
+}
+
+void test_map()
+{
+    std::map<int, point> os;
+    for (point const& p : make_points(100))
+    {
+        os.emplace(static_cast<int>(p.x), p);
+    }
+    test_roundtrip(os);
+}
+
+void test_struct()
+{
+    point const os{1.0, 2.0, 3.0};
+
+    std::size_t header_size = 0;
+    {
+        std::vector<char> buffer;
+        hpx::serialization::output_archive oarchive(buffer);
+        header_size = oarchive.bytes_written();
+    }
+
+    std::vector<char> buffer;
+    hpx::serialization::output_archive oarchive(buffer);
+    oarchive << os;
+
+    // the struct is copied as a whole, without any per-member overhead
+    HPX_TEST_EQ(oarchive.bytes_written() - header_size, sizeof(point));
+
+    point is{};
+    hpx::serialization::input_archive iarchive(buffer);
+    iarchive >> is;
+    HPX_TEST(os == is);
+}
+
+int main()
+{
+    test_vector();
+    test_valarray();
+    test_map();
+    test_struct();
+
+    return hpx::util::report_errors();
+}
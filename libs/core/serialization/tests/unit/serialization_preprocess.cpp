@@ -0,0 +1,127 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#include <hpx/serialization/detail/preprocess_container.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct payload
+{
+    std::string name;
+    std::vector<double> small;
+    std::vector<double> large;
+    std::vector<std::int32_t> more;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & name & small & large & more;
+        // clang-format on
+    }
+};
+
+payload make_payload(std::size_t large_size)
+{
+    payload p;
+    p.name = "payload";
+    p.small.resize(8);
+    std::iota(p.small.begin(), p.small.end(), 0.0);
+    p.large.resize(large_size);
+    std::iota(p.large.begin(), p.large.end(), 1.0);
+    p.more.resize(large_size);
+    std::iota(p.more.begin(), p.more.end(), 2);
+    return p;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Measuring the archive with chunking enabled gives the exact size of the
+// non-zero-copy data and the exact number of chunks, which allows to
+// allocate the output buffer only once.
+void test_measure(payload const& outp, std::uint32_t flags)
+{
+    std::size_t const threshold = 1024;
+
+    hpx::serialization::detail::preprocess_container measure;
+    std::vector<hpx::serialization::serialization_chunk> unused_chunks;
+    std::size_t num_chunks = 0;
+    {
+        hpx::serialization::output_archive archive(
+            measure, flags, &unused_chunks, nullptr, threshold);
+        archive << outp;
+        archive.flush();
+        num_chunks = archive.get_num_chunks();
+    }
+
+    // the chunks are only counted while measuring
+    HPX_TEST(unused_chunks.empty());
+
+    std::vector<char> buffer;
+    buffer.reserve(measure.size());
+    char const* data = buffer.data();
+
+    std::vector<hpx::serialization::serialization_chunk> chunks;
+    std::size_t size = 0;
+    {
+        hpx::serialization::output_archive archive(
+            buffer, flags, &chunks, nullptr, threshold);
+        archive << outp;
+        archive.flush();
+        size = archive.bytes_written();
+    }
+
+    HPX_TEST_EQ(buffer.size(), measure.size());
+    HPX_TEST_EQ(chunks.size(), num_chunks);
+
+    // the buffer was not reallocated while serializing
+    HPX_TEST(buffer.data() == data);
+
+    payload inp;
+    {
+        hpx::serialization::input_archive archive(buffer, size, &chunks);
+        archive >> inp;
+    }
+
+    HPX_TEST_EQ(outp.name, inp.name);
+    HPX_TEST(outp.small == inp.small);
+    HPX_TEST(outp.large == inp.large);
+    HPX_TEST(outp.more == inp.more);
+}
+
+void test_measure(std::size_t large_size)
+{
+    using hpx::serialization::archive_flags;
+
+    payload const p = make_payload(large_size);
+
+    test_measure(p, 0);
+    test_measure(
+        p, static_cast<std::uint32_t>(archive_flags::disable_data_chunking));
+    test_measure(p,
+        static_cast<std::uint32_t>(archive_flags::disable_array_optimization));
+}
+
+int main()
+{
+    test_measure(10);
+    test_measure(100000);
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,171 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#include <hpx/serialization/array.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/receive_buffer_registry.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+using buffer_type = hpx::serialization::serialize_buffer<double>;
+
+///////////////////////////////////////////////////////////////////////////////
+buffer_type roundtrip(buffer_type const& outp, std::uint32_t flags)
+{
+    std::vector<char> buffer;
+    std::vector<hpx::serialization::serialization_chunk> chunks;
+    std::size_t size = 0;
+    {
+        hpx::serialization::output_archive archive(buffer, flags, &chunks);
+        archive << outp;
+        size = archive.bytes_written();
+    }
+
+    buffer_type inp;
+    {
+        hpx::serialization::input_archive archive(buffer, size, &chunks);
+        archive >> inp;
+    }
+    return inp;
+}
+
+buffer_type make_buffer(std::size_t size, std::uint64_t tag)
+{
+    buffer_type buffer(size);
+    std::iota(buffer.begin(), buffer.end(), 1.0);
+    buffer.set_receive_tag(tag);
+    return buffer;
+}
+
+void test_receive_buffer(std::size_t size, std::uint32_t flags)
+{
+    std::uint64_t const tag = 42;
+    buffer_type const outp = make_buffer(size, tag);
+
+    // the data is deserialized directly into the registered memory
+    {
+        std::vector<double> dest(size);
+        HPX_TEST(hpx::serialization::register_receive_buffer(
+            tag, dest.data(), dest.size() * sizeof(double)));
+
+        buffer_type const inp = roundtrip(outp, flags);
+        HPX_TEST(inp.data() == dest.data());
+        HPX_TEST_EQ(inp.size(), size);
+        HPX_TEST(std::equal(outp.data(), outp.data() + size, dest.begin()));
+
+        // the registration was consumed
+        HPX_TEST(!hpx::serialization::unregister_receive_buffer(tag));
+    }
+
+    // without a registration the received buffer owns its memory
+    {
+        buffer_type const inp = roundtrip(outp, flags);
+        HPX_TEST_EQ(inp.size(), size);
+        HPX_TEST(std::equal(outp.data(), outp.data() + size, inp.data()));
+    }
+
+    // registered memory which is too small is not used
+    {
+        std::vector<double> dest(size - 1);
+        HPX_TEST(hpx::serialization::register_receive_buffer(
+            tag, dest.data(), dest.size() * sizeof(double)));
+
+        buffer_type const inp = roundtrip(outp, flags);
+        HPX_TEST(inp.data() != dest.data());
+        HPX_TEST(std::equal(outp.data(), outp.data() + size, inp.data()));
+
+        HPX_TEST(hpx::serialization::unregister_receive_buffer(tag));
+    }
+
+    // buffers without a tag never use registered memory
+    {
+        std::vector<double> dest(size);
+        HPX_TEST(hpx::serialization::register_receive_buffer(
+            tag, dest.data(), dest.size() * sizeof(double)));
+
+        buffer_type const inp = roundtrip(make_buffer(size, 0), flags);
+        HPX_TEST(inp.data() != dest.data());
+
+        HPX_TEST(hpx::serialization::unregister_receive_buffer(tag));
+    }
+}
+
+// Buffers without a tag are serialized in the format used before receive tags
+// were introduced: the size, the allocator, and the data.
+void test_untagged_format(std::size_t size, std::uint32_t flags)
+{
+    buffer_type const outp = make_buffer(size, 0);
+
+    std::vector<char> buffer;
+    std::vector<hpx::serialization::serialization_chunk> chunks;
+    std::size_t archive_size = 0;
+    {
+        hpx::serialization::output_archive archive(buffer, flags, &chunks);
+        archive << outp;
+        archive_size = archive.bytes_written();
+    }
+
+    std::size_t inp_size = 0;
+    std::allocator<double> alloc;
+    std::vector<double> data(size);
+    {
+        hpx::serialization::input_archive archive(
+            buffer, archive_size, &chunks);
+        archive >> inp_size >> alloc;
+        HPX_TEST_EQ(inp_size, size);
+
+        archive >> hpx::serialization::make_array(data.data(), size);
+    }
+    HPX_TEST(std::equal(outp.data(), outp.data() + size, data.begin()));
+}
+
+void test_registration()
+{
+    double dest[4];
+
+    // tag zero is reserved
+    HPX_TEST(!hpx::serialization::register_receive_buffer(
+        0, dest, sizeof(dest)));
+
+    HPX_TEST(
+        hpx::serialization::register_receive_buffer(1, dest, sizeof(dest)));
+    HPX_TEST(
+        !hpx::serialization::register_receive_buffer(1, dest, sizeof(dest)));
+    HPX_TEST(hpx::serialization::unregister_receive_buffer(1));
+    HPX_TEST(!hpx::serialization::unregister_receive_buffer(1));
+}
+
+int main()
+{
+    using hpx::serialization::archive_flags;
+
+    test_registration();
+
+    for (std::size_t size : {std::size_t(10), std::size_t(100000)})
+    {
+        test_receive_buffer(size, 0);
+        test_receive_buffer(size,
+            static_cast<std::uint32_t>(archive_flags::disable_data_chunking));
+
+        test_untagged_format(size, 0);
+        test_untagged_format(size,
+            static_cast<std::uint32_t>(archive_flags::disable_data_chunking));
+    }
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,105 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace hpx::detail {
+
+    // Reader-writer spinlock for short critical sections which are mostly
+    // entered by readers (std::shared_mutex-compatible). Readers only
+    // announce themselves, a writer excludes new readers and waits for the
+    // active ones to leave. Waiting threads yield to the scheduler.
+    class rw_spinlock
+    {
+    private:
+        static constexpr std::uint32_t writer = 1;
+        static constexpr std::uint32_t reader = 2;
+
+    public:
+        constexpr rw_spinlock() noexcept = default;
+
+        rw_spinlock(rw_spinlock const&) = delete;
+        rw_spinlock& operator=(rw_spinlock const&) = delete;
+        rw_spinlock(rw_spinlock&&) = delete;
+        rw_spinlock& operator=(rw_spinlock&&) = delete;
+
+        ~rw_spinlock() = default;
+
+        bool try_lock_shared() noexcept
+        {
+            if (state_.fetch_add(reader, std::memory_order_acquire) & writer)
+            {
+                state_.fetch_sub(reader, std::memory_order_relaxed);
+                return false;
+            }
+            return true;
+        }
+
+        void lock_shared() noexcept
+        {
+            while (!try_lock_shared())
+            {
+                util::yield_while(
+                    [this]() noexcept {
+                        return state_.load(std::memory_order_relaxed) & writer;
+                    },
+                    "hpx::detail::rw_spinlock::lock_shared");
+            }
+        }
+
+        void unlock_shared() noexcept
+        {
+            state_.fetch_sub(reader, std::memory_order_release);
+        }
+
+        void lock() noexcept
+        {
+            for (;;)
+            {
+                std::uint32_t state = state_.load(std::memory_order_relaxed);
+                if (!(state & writer) &&
+                    state_.compare_exchange_weak(state, state | writer,
+                        std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    break;
+                }
+                util::yield_while(
+                    [this]() noexcept {
+                        return state_.load(std::memory_order_relaxed) & writer;
+                    },
+                    "hpx::detail::rw_spinlock::lock");
+            }
+
+            // wait for the active readers to leave
+            util::yield_while(
+                [this]() noexcept {
+                    return state_.load(std::memory_order_acquire) != writer;
+                },
+                "hpx::detail::rw_spinlock::lock");
+        }
+
+        bool try_lock() noexcept
+        {
+            std::uint32_t state = 0;
+            return state_.compare_exchange_strong(
+                state, writer, std::memory_order_acquire);
+        }
+
+        void unlock() noexcept
+        {
+            state_.fetch_sub(writer, std::memory_order_release);
+        }
+
+    private:
+        std::atomic<std::uint32_t> state_{0};
+    };
+}    // namespace hpx::detail
@@ -78,11 +78,14 @@ namespace hpx::threads::detail {
         thread_id_ref_type create_work(
             thread_init_data& data, error_code& ec) override;
 
+        void create_work_bulk(thread_init_data* data, std::size_t count,
+            error_code& ec) override;
+
         thread_state set_state(thread_id_type const& id,
             thread_schedule_state new_state, thread_restart_state new_state_ex,
             thread_priority priority, error_code& ec) override;
 
-        thread_id_ref_type set_state(
+        timer_id_type set_state(
             hpx::chrono::steady_time_point const& abs_time,
             thread_id_type const& id, thread_schedule_state newstate,
             thread_restart_state newstate_ex, thread_priority priority,
@@ -261,6 +261,9 @@ namespace hpx::threads::detail {
                     }
                 }
                 threads_.clear();
+
+                // release the threads still referenced by pending timers
+                sched_->Scheduler::cancel_all_timers();
             }
         }
     }
@@ -403,6 +406,9 @@ namespace hpx::threads::detail {
             hpx::state expected = hpx::state::running;
             sched_->Scheduler::get_state(i).compare_exchange_strong(
                 expected, hpx::state::pre_sleep);
+
+            // wake up the thread if it is idling
+            sched_->Scheduler::do_some_work(i);
         }
 
         for (std::size_t i = 0; i != threads_.size(); ++i)
@@ -644,6 +650,27 @@ namespace hpx::threads::detail {
         return id;
     }
 
+    template <typename Scheduler>
+    void scheduled_thread_pool<Scheduler>::create_work_bulk(
+        thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        // verify state
+        if (thread_count_ == 0 &&
+            !sched_->Scheduler::is_state(hpx::state::running))
+        {
+            // thread-manager is not currently running
+            HPX_THROWS_IF(ec, hpx::error::invalid_status,
+                "thread_pool<Scheduler>::create_work_bulk",
+                "invalid state: thread pool is not running");
+            return;
+        }
+
+        detail::create_work_bulk(sched_.get(), data, count, ec);    //-V601
+
+        // update statistics
+        tasks_scheduled_ += static_cast<std::int64_t>(count);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Scheduler>
     thread_state scheduled_thread_pool<Scheduler>::set_state(
@@ -659,7 +686,7 @@ namespace hpx::threads::detail {
     }
 
     template <typename Scheduler>
-    thread_id_ref_type scheduled_thread_pool<Scheduler>::set_state(
+    timer_id_type scheduled_thread_pool<Scheduler>::set_state(
         hpx::chrono::steady_time_point const& abs_time,
         thread_id_type const& id, thread_schedule_state newstate,
         thread_restart_state newstate_ex, thread_priority priority,
@@ -1973,6 +2000,9 @@ namespace hpx::threads::detail {
         hpx::state expected = hpx::state::running;
         state.compare_exchange_strong(expected, hpx::state::pre_sleep);
 
+        // wake up the thread if it is idling
+        sched_->Scheduler::do_some_work(virt_core);
+
         l.unlock();
 
         HPX_ASSERT(expected == hpx::state::running ||
@@ -8,6 +8,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/coroutines/stack_pool.hpp>
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/hardware/timestamp.hpp>
 #include <hpx/modules/itt_notify.hpp>
@@ -189,6 +190,11 @@ namespace hpx::threads::detail {
             bool running = this_state.load(std::memory_order_relaxed) <
                 hpx::state::pre_sleep;
 
+            // apply the timed state changes which have expired, an idle OS
+            // thread takes care of the expired timers of all OS threads
+            scheduler.SchedulingPolicy::process_timers(
+                num_thread, idle_loop_count != 0);
+
             // extract the stealing mode once per loop iteration
             bool enable_stealing = scheduler.has_scheduler_mode(
                 policies::scheduler_mode::enable_stealing);
@@ -618,6 +624,9 @@ namespace hpx::threads::detail {
                 else
                 {
                     scheduler.SchedulingPolicy::cleanup_terminated(true);
+
+                    // release the dirty pages of idle thread stacks
+                    coroutines::trim_stack_pool();
                 }
             }
         }
@@ -0,0 +1,54 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#if !defined(__linux__)
+#include <condition_variable>
+#include <mutex>
+#endif
+
+namespace hpx::util::detail {
+
+    /// The thread_parker allows a single OS thread to block until another OS
+    /// thread unparks it. Unparking a thread that is not parked leaves a
+    /// permit behind which makes the next call to park() return immediately.
+    /// On Linux this is implemented on top of a futex, otherwise a mutex and
+    /// a condition variable are used.
+    class thread_parker
+    {
+    public:
+        thread_parker() = default;
+
+        HPX_NON_COPYABLE(thread_parker);
+
+        ~thread_parker() = default;
+
+        /// Block the calling thread until unpark() is called or the given
+        /// time has passed. Returns true if the thread was unparked. May
+        /// return false spuriously, may be called by a single thread only.
+        HPX_CORE_EXPORT bool park(std::chrono::nanoseconds timeout) noexcept;
+
+        /// Wake up the thread blocked in park(), may be called by any thread.
+        HPX_CORE_EXPORT void unpark() noexcept;
+
+    private:
+        static constexpr std::int32_t empty = 0;
+        static constexpr std::int32_t notified = 1;
+        static constexpr std::int32_t parked = -1;
+
+        std::atomic<std::int32_t> state_ = empty;
+#if !defined(__linux__)
+        std::mutex mtx_;
+        std::condition_variable cond_;
+#endif
+    };
+}    // namespace hpx::util::detail
@@ -0,0 +1,100 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/thread_support/thread_parker.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#else
+#include <condition_variable>
+#include <mutex>
+#endif
+
+namespace hpx::util::detail {
+
+#if defined(__linux__)
+    namespace {
+
+        void futex_wait(std::atomic<std::int32_t>& addr, std::int32_t expected,
+            std::chrono::nanoseconds timeout) noexcept
+        {
+            auto const secs =
+                std::chrono::duration_cast<std::chrono::seconds>(timeout);
+
+            timespec ts{};
+            ts.tv_sec = static_cast<time_t>(secs.count());
+            ts.tv_nsec = static_cast<long>((timeout - secs).count());
+
+            // the result is deliberately ignored, the caller re-checks the
+            // state in any case
+            ::syscall(SYS_futex, reinterpret_cast<std::int32_t*>(&addr),
+                FUTEX_WAIT_PRIVATE, expected, &ts, nullptr, 0);
+        }
+
+        void futex_wake(std::atomic<std::int32_t>& addr) noexcept
+        {
+            ::syscall(SYS_futex, reinterpret_cast<std::int32_t*>(&addr),
+                FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+        }
+    }    // namespace
+
+    bool thread_parker::park(std::chrono::nanoseconds timeout) noexcept
+    {
+        // consume a pending permit or announce that this thread is parked
+        if (state_.fetch_sub(1, std::memory_order_acquire) == notified)
+        {
+            return true;
+        }
+
+        futex_wait(state_, parked, timeout);
+
+        return state_.exchange(empty, std::memory_order_acquire) == notified;
+    }
+
+    void thread_parker::unpark() noexcept
+    {
+        if (state_.exchange(notified, std::memory_order_release) == parked)
+        {
+            futex_wake(state_);
+        }
+    }
+#else
+    bool thread_parker::park(std::chrono::nanoseconds timeout) noexcept
+    {
+        std::unique_lock<std::mutex> l(mtx_);
+        if (state_.load(std::memory_order_relaxed) != notified)
+        {
+            state_.store(parked, std::memory_order_relaxed);
+            cond_.wait_for(l, timeout, [this]() {
+                return state_.load(std::memory_order_relaxed) == notified;
+            });
+        }
+        return state_.exchange(empty, std::memory_order_relaxed) == notified;
+    }
+
+    void thread_parker::unpark() noexcept
+    {
+        std::int32_t previous = empty;
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+            previous = state_.exchange(notified, std::memory_order_relaxed);
+        }
+
+        if (previous == parked)
+        {
+            cond_.notify_one();
+        }
+    }
+#endif
+}    // namespace hpx::util::detail
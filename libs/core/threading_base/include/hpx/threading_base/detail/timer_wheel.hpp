@@ -0,0 +1,186 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+#include <hpx/memory/intrusive_ptr.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::threads::detail {
+
+    class timer_wheel;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A timed state change of an HPX thread. Entries are reference counted,
+    /// they are referenced by the timer_wheel they are linked into and by the
+    /// timer_id_type handed out to the code which has created the timer.
+    struct timer_entry
+    {
+        enum class timer_state : std::uint8_t
+        {
+            pending = 0,
+            fired = 1,
+            canceled = 2
+        };
+
+        timer_entry(thread_id_ref_type thrd, thread_schedule_state newstate,
+            thread_restart_state newstate_ex, thread_priority priority,
+            bool retry_on_active) noexcept
+          : thrd_(HPX_MOVE(thrd))
+          , newstate_(newstate)
+          , newstate_ex_(newstate_ex)
+          , priority_(priority)
+          , retry_on_active_(retry_on_active)
+        {
+        }
+
+        // Mark the entry as fired, returns false if it was canceled before
+        bool fire() noexcept
+        {
+            timer_state expected = timer_state::pending;
+            return state_.compare_exchange_strong(
+                expected, timer_state::fired, std::memory_order_acq_rel);
+        }
+
+        bool is_pending() const noexcept
+        {
+            return state_.load(std::memory_order_acquire) ==
+                timer_state::pending;
+        }
+
+        // the requested state change
+        thread_id_ref_type thrd_;
+        thread_schedule_state newstate_;
+        thread_restart_state newstate_ex_;
+        thread_priority priority_;
+        bool retry_on_active_;
+
+    private:
+        friend class timer_wheel;
+
+        friend HPX_CORE_EXPORT void intrusive_ptr_add_ref(
+            timer_entry* p) noexcept;
+        friend HPX_CORE_EXPORT void intrusive_ptr_release(
+            timer_entry* p) noexcept;
+
+        // managed by the timer_wheel, protected by its lock
+        timer_entry* prev_ = nullptr;
+        timer_entry* next_ = nullptr;
+        std::size_t slot_ = std::size_t(-1);    // slot linked into, if any
+        std::uint64_t expiry_ = 0;              // in ticks of the wheel
+
+        timer_wheel* wheel_ = nullptr;
+        std::atomic<timer_state> state_{timer_state::pending};
+        std::atomic<std::uint32_t> count_{0};
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A hierarchical hashed timing wheel (see G. Varghese and T. Lauck,
+    /// "Hashed and Hierarchical Timing Wheels"). Time is divided into ticks of
+    /// the given resolution. Timers expiring within the next 64 ticks are
+    /// kept in the slots of the first level, timers further in the future
+    /// are kept in the coarser slots of the higher levels and are cascaded
+    /// down as time advances. Adding and canceling timers is O(1), all timers
+    /// of a slot expire as one batch. Timers never expire early, but may be
+    /// reported late by up to one tick.
+    ///
+    /// All member functions are thread safe.
+    class HPX_CORE_EXPORT timer_wheel
+    {
+    public:
+        using clock_type = std::chrono::steady_clock;
+
+        static constexpr std::size_t slot_bits = 6;
+        static constexpr std::size_t num_slots = std::size_t(1) << slot_bits;
+        static constexpr std::size_t num_levels = 6;
+
+        explicit timer_wheel(std::chrono::nanoseconds resolution =
+                                 std::chrono::microseconds(100));
+        ~timer_wheel();
+
+        timer_wheel(timer_wheel const&) = delete;
+        timer_wheel(timer_wheel&&) = delete;
+        timer_wheel& operator=(timer_wheel const&) = delete;
+        timer_wheel& operator=(timer_wheel&&) = delete;
+
+        /// Insert the given entry which is to expire at the given time.
+        /// Returns whether the entry has become the earliest timer of the
+        /// wheel.
+        bool add(timer_entry* entry, clock_type::time_point expiry);
+
+        /// Cancel the given entry, returns false if it has already fired or
+        /// was canceled before.
+        static bool cancel(timer_entry* entry) noexcept;
+
+        /// Remove all entries which have expired at the given point in time
+        /// and append them to the given vector.
+        std::size_t expire(clock_type::time_point now,
+            std::vector<hpx::intrusive_ptr<timer_entry>>& expired);
+
+        /// Cancel and remove all entries.
+        void clear(std::vector<hpx::intrusive_ptr<timer_entry>>& removed);
+
+        /// Return the earliest point in time the wheel needs to be checked
+        /// for expired timers again, this is clock_type::time_point::max()
+        /// if the wheel is empty.
+        clock_type::time_point next_expiry() const noexcept
+        {
+            return clock_type::time_point(clock_type::duration(
+                next_expiry_.load(std::memory_order_acquire)));
+        }
+
+        /// Return whether the wheel holds any timers
+        bool empty() const noexcept
+        {
+            return size_.load(std::memory_order_relaxed) == 0;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return size_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        using mutex_type = hpx::util::spinlock;
+
+        std::uint64_t to_ticks(clock_type::time_point t) const noexcept;
+        clock_type::time_point from_ticks(std::uint64_t ticks) const noexcept;
+
+        void link(timer_entry* entry) noexcept;
+        void unlink(timer_entry* entry) noexcept;
+
+        // the next tick at which a slot has to be processed
+        std::uint64_t next_event() const noexcept;
+        void update_next_expiry() noexcept;
+
+        mutable mutex_type mtx_;
+
+        clock_type::time_point const epoch_;
+        clock_type::duration const resolution_;
+
+        // all ticks before current_ have been processed
+        std::uint64_t current_ = 0;
+
+        std::array<std::array<timer_entry*, num_slots>, num_levels> slots_{};
+        std::array<std::uint64_t, num_levels> occupied_{};
+
+        std::atomic<std::size_t> size_{0};
+        std::atomic<clock_type::rep> next_expiry_;
+    };
+}    // namespace hpx::threads::detail
+
+#include <hpx/config/warnings_suffix.hpp>
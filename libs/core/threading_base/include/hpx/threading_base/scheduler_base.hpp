@@ -12,6 +12,8 @@
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/format.hpp>
+#include <hpx/thread_support/thread_parker.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
 #include <hpx/threading_base/thread_data.hpp>
@@ -24,6 +26,7 @@
 #endif
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstddef>
 #include <cstdint>
@@ -99,10 +102,45 @@ namespace hpx::threads::policies {
 
         void idle_callback(std::size_t num_thread);
 
+        /// Schedule a change of the state of the given thread at the given
+        /// point in time. The timer is kept by the timing wheel of the
+        /// calling OS thread if that belongs to this scheduler, otherwise by
+        /// the one selected by the given hint.
+        timer_id_type add_timer(std::chrono::steady_clock::time_point abs_time,
+            thread_id_ref_type thrd, thread_schedule_state newstate,
+            thread_restart_state newstate_ex, thread_priority priority,
+            thread_schedule_hint schedulehint, bool retry_on_active);
+
+        /// Apply the state changes of all timers of the given OS thread
+        /// which have expired. If steal is true, the expired timers of all
+        /// other OS threads are processed as well. Returns whether any timer
+        /// has expired.
+        bool process_timers(std::size_t num_thread, bool steal = false)
+        {
+            HPX_ASSERT(num_thread < timers_.size());
+            if (!steal && timers_[num_thread].data_.wheel_.empty())
+            {
+                return false;
+            }
+            return process_timers_slow(num_thread, steal);
+        }
+
+        /// Return the earliest point in time any of the timers of this
+        /// scheduler needs attention.
+        std::chrono::steady_clock::time_point next_timer_expiry() const noexcept;
+
+        /// Cancel all pending timers, releasing the threads referenced by
+        /// them.
+        void cancel_all_timers();
+
         /// This function gets called by the thread-manager whenever new work
         /// has been added, allowing the scheduler to reactivate one or more of
-        /// possibly idling OS threads
-        void do_some_work(std::size_t);
+        /// possibly idling OS threads. If idle OS threads are parked, the
+        /// parked OS thread closest to the given one is woken up. Schedulers
+        /// which don't steal work wake up the given OS thread only (or all
+        /// parked OS threads if none is given), as no other OS thread would
+        /// run the new work.
+        void do_some_work(std::size_t num_thread);
 
         virtual void suspend(std::size_t num_thread);
         virtual void resume(std::size_t num_thread);
@@ -226,6 +264,21 @@ namespace hpx::threads::policies {
         virtual void create_thread(
             thread_init_data& data, thread_id_ref_type* id, error_code& ec) = 0;
 
+        // Create a batch of new threads. None of the threads is run
+        // immediately and no thread ids are returned, all threads must have
+        // 'pending' as their initial state. Schedulers may override this to
+        // push the new threads to their queues in batches.
+        virtual void create_thread_bulk(
+            thread_init_data* data, std::size_t count, error_code& ec);
+
+        // Return the number of threads which were pushed to a queue as part
+        // of a batch by create_thread_bulk, zero if the scheduler doesn't
+        // push threads in batches.
+        virtual std::int64_t get_num_bulk_created_threads(bool /* reset */)
+        {
+            return 0;
+        }
+
         virtual void schedule_thread(threads::thread_id_ref_type thrd,
             threads::thread_schedule_hint schedulehint,
             bool allow_fallback = false,
@@ -324,8 +377,36 @@ namespace hpx::threads::policies {
             double max_idle_backoff_time_;
         };
         std::vector<util::cache_line_data<idle_backoff_data>> wait_counts_;
+
+        // support for parking idle OS threads
+        bool park(std::size_t num_thread, std::chrono::nanoseconds timeout);
+        void unpark(std::size_t num_thread) noexcept;
+        void unpark_one(std::size_t num_thread) noexcept;
+        void unpark_all() noexcept;
+
+        struct parking_data
+        {
+            util::detail::thread_parker parker_;
+        };
+        std::vector<util::cache_line_data<parking_data>> parking_data_;
+
+        // one bit per parked OS thread, 64 OS threads per word
+        std::vector<util::cache_line_data<std::atomic<std::uint64_t>>> parked_;
 #endif
 
+        // wake up the given OS thread to let it process its timers
+        void wake_for_timers(std::size_t num_thread) noexcept;
+
+        bool process_timers_slow(std::size_t num_thread, bool steal);
+
+        // per OS thread timing wheels holding the timed thread state changes
+        struct timer_data
+        {
+            threads::detail::timer_wheel wheel_;
+            std::vector<timer_id_type> expired_;
+        };
+        std::vector<util::cache_line_data<timer_data>> timers_;
+
         // support for suspension of pus
         std::vector<pu_mutex_type> suspend_mtxs_;
         std::vector<std::condition_variable> suspend_conds_;
@@ -80,6 +80,12 @@ namespace hpx::threads::policies {
         /// 'normal' work scheduling is performed.
         do_background_work_only = 0x1000,
 
+        /// Idle OS threads block on a per-thread futex (parking) instead of
+        /// waiting on a shared condition variable while backing off. Newly
+        /// created work wakes up exactly one parked OS thread, preferably one
+        /// close to the OS thread that created the work.
+        enable_idle_parking = 0x2000,
+
         // clang-format off
         /// This option represents the default mode.
         default_ =
@@ -90,7 +96,8 @@ namespace hpx::threads::policies {
             enable_stealing_numa |
             assign_work_round_robin |
             steal_after_local |
-            enable_idle_backoff,
+            enable_idle_backoff |
+            enable_idle_parking,
 
         /// This enables all available options.
         all_flags =
@@ -106,7 +113,8 @@ namespace hpx::threads::policies {
             steal_high_priority_first |
             steal_after_local |
             enable_idle_backoff |
-            do_background_work_only
+            do_background_work_only |
+            enable_idle_parking
         // clang-format on
     };
 
@@ -20,7 +20,7 @@ namespace hpx::threads::detail {
 
     /// Set a timer to set the state of the given \a thread to the given
     /// new value after it expired (at the given time)
-    HPX_CORE_EXPORT thread_id_ref_type set_thread_state_timed(
+    HPX_CORE_EXPORT timer_id_type set_thread_state_timed(
         policies::scheduler_base* scheduler,
         hpx::chrono::steady_time_point const& abs_time,
         thread_id_type const& thrd, thread_schedule_state newstate,
@@ -28,7 +28,7 @@ namespace hpx::threads::detail {
         thread_schedule_hint schedulehint, std::atomic<bool>* started,
         bool retry_on_active, error_code& ec);
 
-    inline thread_id_ref_type set_thread_state_timed(
+    inline timer_id_type set_thread_state_timed(
         policies::scheduler_base* scheduler,
         hpx::chrono::steady_time_point const& abs_time,
         thread_id_type const& id, std::atomic<bool>* started,
@@ -42,7 +42,7 @@ namespace hpx::threads::detail {
 
     // Set a timer to set the state of the given \a thread to the given
     // new value after it expired (after the given duration)
-    inline thread_id_ref_type set_thread_state_timed(
+    inline timer_id_type set_thread_state_timed(
         policies::scheduler_base* scheduler,
         hpx::chrono::steady_duration const& rel_time,
         thread_id_type const& thrd, thread_schedule_state newstate,
@@ -55,7 +55,7 @@ namespace hpx::threads::detail {
             retry_on_active, ec);
     }
 
-    inline thread_id_ref_type set_thread_state_timed(
+    inline timer_id_type set_thread_state_timed(
         policies::scheduler_base* scheduler,
         hpx::chrono::steady_duration const& rel_time,
         thread_id_type const& thrd, std::atomic<bool>* started,
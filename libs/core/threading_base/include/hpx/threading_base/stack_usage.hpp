@@ -0,0 +1,75 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx::threads {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The stack usage recorded for all terminated threads sharing the same
+    /// description (see \a get_stack_usage_statistics).
+    struct stack_usage_statistics
+    {
+        std::uint64_t count = 0;          ///< number of measurements
+        std::size_t max_usage = 0;        ///< maximal stack usage (bytes)
+        std::size_t average_usage = 0;    ///< average stack usage (bytes)
+    };
+
+    /// Return the stack usage recorded for the threads with the given
+    /// description. Stack usage is recorded only if the configuration
+    /// setting hpx.stacks.track_usage is enabled.
+    HPX_CORE_EXPORT stack_usage_statistics get_stack_usage_statistics(
+        thread_description const& desc) noexcept;
+
+    /// Return the maximal stack usage of all recorded threads
+    HPX_CORE_EXPORT std::int64_t get_stack_usage_max(bool reset) noexcept;
+
+    /// Return the average stack usage of all recorded threads
+    HPX_CORE_EXPORT std::int64_t get_stack_usage_average(bool reset) noexcept;
+
+    /// Return the number of threads that were created with a different stack
+    /// size than requested based on their recorded stack usage
+    HPX_CORE_EXPORT std::int64_t get_stack_size_adaptation_count(
+        bool reset) noexcept;
+
+    namespace detail {
+
+        // enable/disable picking larger stack sizes for threads whose stack
+        // usage is known to come close to the requested stack size
+        HPX_CORE_EXPORT void set_stack_size_adaptation_enabled(
+            bool enabled) noexcept;
+        HPX_CORE_EXPORT bool get_stack_size_adaptation_enabled() noexcept;
+
+        // enable/disable additionally picking smaller stack sizes for threads
+        // whose stack usage is known to be sufficiently low
+        HPX_CORE_EXPORT void set_stack_size_shrinking_enabled(
+            bool enabled) noexcept;
+        HPX_CORE_EXPORT bool get_stack_size_shrinking_enabled() noexcept;
+
+        // record the stack usage of a terminated thread
+        HPX_CORE_EXPORT void record_stack_usage(
+            thread_description const& desc, std::size_t usage) noexcept;
+
+        // return the stack size to use for threads with the given
+        // description instead of the given one
+        HPX_CORE_EXPORT thread_stacksize adapt_stack_size(
+            policies::scheduler_base const& scheduler,
+            thread_description const& desc,
+            thread_stacksize stacksize) noexcept;
+
+        // replace the stack size of a new thread based on the stack usage
+        // recorded for threads with the same description, if enabled
+        HPX_CORE_EXPORT void adapt_stack_size(thread_init_data& data) noexcept;
+    }    // namespace detail
+}    // namespace hpx::threads
@@ -438,6 +438,15 @@ namespace hpx { namespace threads {
             priority_ = priority;
         }
 
+        constexpr thread_deadline get_deadline() const noexcept
+        {
+            return deadline_;
+        }
+        void set_deadline(thread_deadline deadline) noexcept
+        {
+            deadline_ = deadline;
+        }
+
         // handle thread interruption
         bool interruption_requested() const noexcept
         {
@@ -614,6 +623,7 @@ namespace hpx { namespace threads {
 #endif
         ///////////////////////////////////////////////////////////////////////
         thread_priority priority_;
+        thread_deadline deadline_;
 
         bool requested_interrupt_;
         bool enabled_interrupt_;
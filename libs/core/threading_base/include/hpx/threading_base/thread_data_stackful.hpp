@@ -134,6 +134,8 @@ namespace hpx::threads {
 
         void rebind(thread_init_data& init_data) override
         {
+            record_stack_usage();
+
             this->thread_data::rebind_base(init_data);
 
             coroutine_.rebind(HPX_MOVE(init_data.func), thread_id_type(this));
@@ -164,6 +166,9 @@ namespace hpx::threads {
         }
 
     private:
+        // record the stack usage measured when this thread last terminated
+        void record_stack_usage() const noexcept;
+
         coroutine_type coroutine_;
         execution_agent agent_;
     };
@@ -81,8 +81,8 @@ namespace hpx::threads {
     ///                   be modified for.
     /// \param abs_time   [in] Absolute point in time for the new thread to be
     ///                   run
-    /// \param started    [in,out] A helper variable allowing to track the
-    ///                   state of the timer helper thread
+    /// \param started    [in,out] A helper variable which is set to true
+    ///                   once the timer has been started (may be nullptr)
     /// \param state      [in] The new state to be set for the thread
     ///                   referenced by the \a id parameter.
     /// \param stateex    [in] The new extended state to be set for the
@@ -92,15 +92,17 @@ namespace hpx::threads {
     ///                   if this is pre-initialized to \a hpx#throws
     ///                   the function will throw on error instead.
     ///
-    /// \returns
+    /// \returns          This function returns the handle of the new timer
+    ///                   which can be used to cancel it (see
+    ///                   \a cancel_timer). The handle is empty if the timer
+    ///                   could not be set.
     ///
     /// \note             As long as \a ec is not pre-initialized to
     ///                   \a hpx#throws this function doesn't
     ///                   throw but returns the result code using the
     ///                   parameter \a ec. Otherwise it throws an instance
     ///                   of hpx#exception.
-    HPX_CORE_EXPORT thread_id_ref_type set_thread_state(
-        thread_id_type const& id,
+    HPX_CORE_EXPORT timer_id_type set_thread_state(thread_id_type const& id,
         hpx::chrono::steady_time_point const& abs_time,
         std::atomic<bool>* started,
         thread_schedule_state state = thread_schedule_state::pending,
@@ -108,15 +110,15 @@ namespace hpx::threads {
         thread_priority priority = thread_priority::normal,
         bool retry_on_active = true, error_code& ec = throws);
 
-    inline thread_id_ref_type set_thread_state(thread_id_type const& id,
+    inline timer_id_type set_thread_state(thread_id_type const& id,
         hpx::chrono::steady_time_point const& abs_time,
         thread_schedule_state state = thread_schedule_state::pending,
         thread_restart_state stateex = thread_restart_state::timeout,
         thread_priority priority = thread_priority::normal,
-        bool retry_on_active = true, error_code& /*ec*/ = throws)
+        bool retry_on_active = true, error_code& ec = throws)
     {
         return set_thread_state(id, abs_time, nullptr, state, stateex, priority,
-            retry_on_active, throws);
+            retry_on_active, ec);
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -139,14 +141,17 @@ namespace hpx::threads {
     ///                   if this is pre-initialized to \a hpx#throws
     ///                   the function will throw on error instead.
     ///
-    /// \returns
+    /// \returns          This function returns the handle of the new timer
+    ///                   which can be used to cancel it (see
+    ///                   \a cancel_timer). The handle is empty if the timer
+    ///                   could not be set.
     ///
     /// \note             As long as \a ec is not pre-initialized to
     ///                   \a hpx#throws this function doesn't
     ///                   throw but returns the result code using the
     ///                   parameter \a ec. Otherwise it throws an instance
     ///                   of hpx#exception.
-    inline thread_id_ref_type set_thread_state(thread_id_type const& id,
+    inline timer_id_type set_thread_state(thread_id_type const& id,
         hpx::chrono::steady_duration const& rel_time,
         thread_schedule_state state = thread_schedule_state::pending,
         thread_restart_state stateex = thread_restart_state::timeout,
@@ -157,6 +162,17 @@ namespace hpx::threads {
             priority, retry_on_active, ec);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief  Cancel a timer created by one of the timed \a set_thread_state
+    ///         functions.
+    ///
+    /// \param timer      [in] The handle of the timer to cancel.
+    ///
+    /// \returns          This function returns true if the timer was canceled
+    ///                   before it expired, false if it has expired already
+    ///                   or was canceled before.
+    HPX_CORE_EXPORT bool cancel_timer(timer_id_type const& timer) noexcept;
+
     ///////////////////////////////////////////////////////////////////////////
     /// The function get_thread_backtrace is part of the thread related API
     /// allows to query the currently stored thread back trace (which is
@@ -45,6 +45,7 @@ namespace hpx { namespace threads {
           , initial_state(thread_schedule_state::pending)
           , run_now(false)
           , scheduler_base(nullptr)
+          , deadline(thread_deadline::max())
         {
             if (initial_state == thread_schedule_state::staged)
             {
@@ -63,6 +64,7 @@ namespace hpx { namespace threads {
             initial_state = rhs.initial_state;
             run_now = rhs.run_now;
             scheduler_base = rhs.scheduler_base;
+            deadline = rhs.deadline;
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
             description = HPX_MOVE(rhs.description);
 #endif
@@ -101,6 +103,7 @@ namespace hpx { namespace threads {
           , initial_state(rhs.initial_state)
           , run_now(rhs.run_now)
           , scheduler_base(rhs.scheduler_base)
+          , deadline(rhs.deadline)
         {
         }
 
@@ -134,6 +137,7 @@ namespace hpx { namespace threads {
           , initial_state(initial_state_)
           , run_now(run_now_)
           , scheduler_base(scheduler_base_)
+          , deadline(thread_deadline::max())
         {
             HPX_UNUSED(desc);
 
@@ -168,5 +172,8 @@ namespace hpx { namespace threads {
         bool run_now;
 
         policies::scheduler_base* scheduler_base;
+
+        // absolute deadline of the new thread, thread_deadline::max() if none
+        thread_deadline deadline;
     };
 }}    // namespace hpx::threads
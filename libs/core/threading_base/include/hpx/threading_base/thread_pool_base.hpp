@@ -190,11 +190,16 @@ namespace hpx::threads {
         virtual thread_id_ref_type create_work(
             thread_init_data& data, error_code& ec) = 0;
 
+        // Create a batch of new work items, all of which must have 'pending'
+        // as their initial state.
+        virtual void create_work_bulk(
+            thread_init_data* data, std::size_t count, error_code& ec);
+
         virtual thread_state set_state(thread_id_type const& id,
             thread_schedule_state new_state, thread_restart_state new_state_ex,
             thread_priority priority, error_code& ec) = 0;
 
-        virtual thread_id_ref_type set_state(
+        virtual timer_id_type set_state(
             hpx::chrono::steady_time_point const& abs_time,
             thread_id_type const& id, thread_schedule_state newstate,
             thread_restart_state newstate_ex, thread_priority priority,
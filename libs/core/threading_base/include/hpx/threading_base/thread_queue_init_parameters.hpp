@@ -40,7 +40,17 @@ namespace hpx::threads::policies {
             std::ptrdiff_t small_stacksize = HPX_SMALL_STACK_SIZE,
             std::ptrdiff_t medium_stacksize = HPX_MEDIUM_STACK_SIZE,
             std::ptrdiff_t large_stacksize = HPX_LARGE_STACK_SIZE,
-            std::ptrdiff_t huge_stacksize = HPX_HUGE_STACK_SIZE) noexcept
+            std::ptrdiff_t huge_stacksize = HPX_HUGE_STACK_SIZE,
+            std::int64_t steal_threshold_l2 = std::int64_t(
+                HPX_THREAD_QUEUE_STEAL_THRESHOLD_L2),
+            std::int64_t steal_threshold_l3 = std::int64_t(
+                HPX_THREAD_QUEUE_STEAL_THRESHOLD_L3),
+            std::int64_t steal_threshold_numa = std::int64_t(
+                HPX_THREAD_QUEUE_STEAL_THRESHOLD_NUMA),
+            std::int64_t steal_threshold_socket = std::int64_t(
+                HPX_THREAD_QUEUE_STEAL_THRESHOLD_SOCKET),
+            std::int64_t steal_threshold_machine = std::int64_t(
+                HPX_THREAD_QUEUE_STEAL_THRESHOLD_MACHINE)) noexcept
           : max_thread_count_(max_thread_count)
           , min_tasks_to_steal_pending_(min_tasks_to_steal_pending)
           , min_tasks_to_steal_staged_(min_tasks_to_steal_staged)
@@ -56,6 +66,11 @@ namespace hpx::threads::policies {
           , large_stacksize_(large_stacksize)
           , huge_stacksize_(huge_stacksize)
           , nostack_stacksize_((std::numeric_limits<std::ptrdiff_t>::max)())
+          , steal_threshold_l2_(steal_threshold_l2)
+          , steal_threshold_l3_(steal_threshold_l3)
+          , steal_threshold_numa_(steal_threshold_numa)
+          , steal_threshold_socket_(steal_threshold_socket)
+          , steal_threshold_machine_(steal_threshold_machine)
         {
         }
 
@@ -74,5 +89,10 @@ namespace hpx::threads::policies {
         std::ptrdiff_t const large_stacksize_;
         std::ptrdiff_t const huge_stacksize_;
         std::ptrdiff_t const nostack_stacksize_;
+        std::int64_t steal_threshold_l2_;
+        std::int64_t steal_threshold_l3_;
+        std::int64_t steal_threshold_numa_;
+        std::int64_t steal_threshold_socket_;
+        std::int64_t steal_threshold_machine_;
     };
 }    // namespace hpx::threads::policies
@@ -14,6 +14,7 @@
 #include <hpx/coroutines/thread_id_type.hpp>
 #include <hpx/functional/function.hpp>
 #include <hpx/functional/move_only_function.hpp>
+#include <hpx/memory/intrusive_ptr.hpp>
 #include <hpx/modules/errors.hpp>
 
 #include <cstddef>
@@ -44,6 +45,13 @@ namespace hpx::threads {
     }
     class HPX_CORE_EXPORT thread_pool_base;
 
+    namespace detail {
+
+        struct timer_entry;
+        HPX_CORE_EXPORT void intrusive_ptr_add_ref(timer_entry* p) noexcept;
+        HPX_CORE_EXPORT void intrusive_ptr_release(timer_entry* p) noexcept;
+    }    // namespace detail
+
     /// \cond NOINTERNAL
     using thread_id_ref_type = thread_id_ref;
     using thread_id_type = thread_id;
@@ -60,6 +68,9 @@ namespace hpx::threads {
     using thread_self = coroutines::detail::coroutine_self;
     using thread_self_impl_type = coroutines::detail::coroutine_impl;
 
+    // refers to a pending timed state change of an HPX thread
+    using timer_id_type = hpx::intrusive_ptr<detail::timer_entry>;
+
 #if defined(HPX_HAVE_APEX)
     HPX_CORE_EXPORT std::shared_ptr<hpx::util::external_timer::task_wrapper>
     get_self_timer_data(void);
@@ -10,6 +10,7 @@
 #include <hpx/modules/logging.hpp>
 #include <hpx/threading_base/create_thread.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/stack_usage.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 
@@ -70,6 +71,8 @@ namespace hpx::threads::detail {
         if (nullptr == data.scheduler_base)
             data.scheduler_base = scheduler;
 
+        detail::adapt_stack_size(data);
+
         // Pass critical priority from parent to child (but only if there is
         // none is explicitly specified).
         if (self)
@@ -99,8 +102,11 @@ namespace hpx::threads::detail {
 #endif
             ;
 
-        // NOTE: Don't care if the hint is a NUMA hint, just want to wake up a
-        // thread.
-        scheduler->do_some_work(data.schedulehint.hint);
+        // The scheduler may have replaced the hint with the queue the thread
+        // was added to, wake up its owner (NUMA hints don't name a thread).
+        scheduler->do_some_work(
+            data.schedulehint.mode == thread_schedule_hint_mode::thread ?
+                static_cast<std::size_t>(data.schedulehint.hint) :
+                static_cast<std::size_t>(-1));
     }
 }    // namespace hpx::threads::detail
@@ -10,101 +10,194 @@
 #include <hpx/modules/logging.hpp>
 #include <hpx/threading_base/create_work.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/stack_usage.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
 
 namespace hpx::threads::detail {
 
-    thread_id_ref_type create_work(policies::scheduler_base* scheduler,
-        threads::thread_init_data& data, error_code& ec)
-    {
-        // verify parameters
-        switch (data.initial_state)
-        {
-        // NOLINTNEXTLINE(bugprone-branch-clone)
-        case thread_schedule_state::pending:
-            [[fallthrough]];
-        case thread_schedule_state::pending_do_not_schedule:
-            [[fallthrough]];
-        case thread_schedule_state::pending_boost:
-            [[fallthrough]];
-        case thread_schedule_state::suspended:
-            break;
-
-        default:
+    namespace {
+
+        // verify the parameters of a new work item and fill in the values
+        // which are derived from the scheduler and from the calling thread
+        bool prepare_work(policies::scheduler_base* scheduler,
+            threads::thread_init_data& data, thread_self* self,
+            char const* func, error_code& ec)
         {
-            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
-                "thread::detail::create_work", "invalid initial state: {}",
-                data.initial_state);
-            return invalid_thread_id;
-        }
-        }
+            // verify parameters
+            switch (data.initial_state)
+            {
+            // NOLINTNEXTLINE(bugprone-branch-clone)
+            case thread_schedule_state::pending:
+                [[fallthrough]];
+            case thread_schedule_state::pending_do_not_schedule:
+                [[fallthrough]];
+            case thread_schedule_state::pending_boost:
+                [[fallthrough]];
+            case thread_schedule_state::suspended:
+                break;
+
+            default:
+            {
+                HPX_THROWS_IF(ec, hpx::error::bad_parameter, func,
+                    "invalid initial state: {}", data.initial_state);
+                return false;
+            }
+            }
 
 #ifdef HPX_HAVE_THREAD_DESCRIPTION
-        if (!data.description)
-        {
-            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
-                "thread::detail::create_work", "description is nullptr");
-            return invalid_thread_id;
-        }
+            if (!data.description)
+            {
+                HPX_THROWS_IF(ec, hpx::error::bad_parameter, func,
+                    "description is nullptr");
+                return false;
+            }
 #endif
 
-        LTM_(info)
-            .format("create_work: pool({}), scheduler({}), initial_state({}), "
-                    "thread_priority({})",
-                *scheduler->get_parent_pool(), *scheduler,
-                get_thread_state_name(data.initial_state),
-                get_thread_priority_name(data.priority))
+            LTM_(info)
+                .format("{}: pool({}), scheduler({}), initial_state({}), "
+                        "thread_priority({})",
+                    func, *scheduler->get_parent_pool(), *scheduler,
+                    get_thread_state_name(data.initial_state),
+                    get_thread_priority_name(data.priority))
 #ifdef HPX_HAVE_THREAD_DESCRIPTION
-            .format(", description({})", data.description)
+                .format(", description({})", data.description)
 #endif
-            ;
-
-        thread_self* self = get_self_ptr();
+                ;
 
 #ifdef HPX_HAVE_THREAD_PARENT_REFERENCE
-        if (nullptr == data.parent_id)
-        {
-            if (self)
+            if (nullptr == data.parent_id)
             {
-                data.parent_id = get_thread_id_data(self->get_thread_id());
-                data.parent_phase = self->get_thread_phase();
+                if (self)
+                {
+                    data.parent_id = get_thread_id_data(self->get_thread_id());
+                    data.parent_phase = self->get_thread_phase();
+                }
             }
-        }
-        if (0 == data.parent_locality_id)
-            data.parent_locality_id = detail::get_locality_id(hpx::throws);
+            if (0 == data.parent_locality_id)
+                data.parent_locality_id = detail::get_locality_id(hpx::throws);
 #endif
 
-        if (nullptr == data.scheduler_base)
-            data.scheduler_base = scheduler;
+            if (nullptr == data.scheduler_base)
+                data.scheduler_base = scheduler;
 
-        // Pass critical priority from parent to child.
-        if (self)
-        {
-            if (data.priority == thread_priority::default_ &&
-                thread_priority::high_recursive ==
-                    get_thread_id_data(self->get_thread_id())->get_priority())
+            detail::adapt_stack_size(data);
+
+            // Pass critical priority from parent to child.
+            if (self)
             {
-                data.priority = thread_priority::high_recursive;
+                if (data.priority == thread_priority::default_ &&
+                    thread_priority::high_recursive ==
+                        get_thread_id_data(self->get_thread_id())
+                            ->get_priority())
+                {
+                    data.priority = thread_priority::high_recursive;
+                }
             }
-        }
 
-        // create the new thread
-        if (data.priority == thread_priority::default_)
-            data.priority = thread_priority::normal;
+            // create the new thread
+            if (data.priority == thread_priority::default_)
+                data.priority = thread_priority::normal;
 
-        data.run_now = (thread_priority::high == data.priority ||
-            thread_priority::high_recursive == data.priority ||
-            thread_priority::bound == data.priority ||
-            thread_priority::boost == data.priority);
+            data.run_now = (thread_priority::high == data.priority ||
+                thread_priority::high_recursive == data.priority ||
+                thread_priority::bound == data.priority ||
+                thread_priority::boost == data.priority);
+
+            return true;
+        }
+    }    // namespace
+
+    thread_id_ref_type create_work(policies::scheduler_base* scheduler,
+        threads::thread_init_data& data, error_code& ec)
+    {
+        if (!prepare_work(scheduler, data, get_self_ptr(),
+                "thread::detail::create_work", ec))
+        {
+            return invalid_thread_id;
+        }
 
         thread_id_ref_type id = invalid_thread_id;
         scheduler->create_thread(data, data.run_now ? &id : nullptr, ec);
 
-        // NOTE: Don't care if the hint is a NUMA hint, just want to wake up a
-        // thread.
-        scheduler->do_some_work(data.schedulehint.hint);
+        // The scheduler may have replaced the hint with the queue the thread
+        // was added to, wake up its owner (NUMA hints don't name a thread).
+        scheduler->do_some_work(
+            data.schedulehint.mode == thread_schedule_hint_mode::thread ?
+                static_cast<std::size_t>(data.schedulehint.hint) :
+                static_cast<std::size_t>(-1));
 
         return id;
     }
+
+    void create_work_bulk(policies::scheduler_base* scheduler,
+        threads::thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        thread_self* self = get_self_ptr();
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            // no thread ids are returned, thus all threads must be scheduled
+            if (data[i].initial_state != thread_schedule_state::pending)
+            {
+                HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                    "thread::detail::create_work_bulk",
+                    "work created in bulk must have 'pending' as its initial "
+                    "state");
+                return;
+            }
+
+            if (!prepare_work(scheduler, data[i], self,
+                    "thread::detail::create_work_bulk", ec))
+            {
+                return;
+            }
+        }
+
+        scheduler->create_thread_bulk(data, count, ec);
+        if (ec)
+        {
+            return;
+        }
+
+        // The scheduler may have replaced the hints with the queues the
+        // threads were added to, wake up the owners of those queues once.
+        std::size_t const num_threads =
+            scheduler->get_parent_pool()->get_os_thread_count();
+        std::vector<bool> woken(num_threads, false);
+
+        std::size_t num_unhinted = 0;
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            if (data[i].schedulehint.mode != thread_schedule_hint_mode::thread)
+            {
+                ++num_unhinted;
+                continue;
+            }
+
+            auto const num_thread =
+                static_cast<std::size_t>(data[i].schedulehint.hint);
+            if (num_thread < num_threads)
+            {
+                if (woken[num_thread])
+                {
+                    continue;
+                }
+                woken[num_thread] = true;
+            }
+            scheduler->do_some_work(num_thread);
+        }
+
+        // the remaining work doesn't name a thread, wake up as many OS
+        // threads as there is such work, at most all of them
+        for (std::size_t i = 0; i != (std::min)(num_unhinted, num_threads);
+             ++i)
+        {
+            scheduler->do_some_work(static_cast<std::size_t>(-1));
+        }
+    }
 }    // namespace hpx::threads::detail
@@ -10,12 +10,18 @@
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
+#include <hpx/threading_base/set_thread_state.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
 #if defined(HPX_HAVE_SCHEDULER_LOCAL_STORAGE)
 #include <hpx/coroutines/detail/tss.hpp>
 #endif
 
+#if defined(HPX_MSVC)
+#include <intrin.h>
+#endif
+
 #include <algorithm>
 #include <atomic>
 #include <chrono>
@@ -40,7 +46,8 @@ namespace hpx::threads::policies {
         char const* description,
         thread_queue_init_parameters const& thread_queue_init,
         scheduler_mode mode)
-      : suspend_mtxs_(num_threads)
+      : timers_(num_threads)
+      , suspend_mtxs_(num_threads)
       , suspend_conds_(num_threads)
       , pu_mtxs_(num_threads)
       , states_(num_threads)
@@ -64,6 +71,16 @@ namespace hpx::threads::policies {
             data.data_.wait_count_ = 0;
             data.data_.max_idle_backoff_time_ = max_time;
         }
+
+        parking_data_ =
+            std::vector<util::cache_line_data<parking_data>>(num_threads);
+        parked_ =
+            std::vector<util::cache_line_data<std::atomic<std::uint64_t>>>(
+                (num_threads + 63) / 64);
+        for (auto& word : parked_)
+        {
+            word.data_.store(0, std::memory_order_relaxed);
+        }
 #endif
 
         for (std::size_t i = 0; i != num_threads; ++i)
@@ -73,8 +90,10 @@ namespace hpx::threads::policies {
     void scheduler_base::idle_callback([[maybe_unused]] std::size_t num_thread)
     {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-        if (mode_.data_.load(std::memory_order_relaxed) &
-            policies::scheduler_mode::enable_idle_backoff)
+        scheduler_mode const mode = mode_.data_.load(std::memory_order_relaxed);
+        if (mode &
+            (policies::scheduler_mode::enable_idle_backoff |
+                policies::scheduler_mode::enable_idle_parking))
         {
             // Put this thread to sleep for some time, additionally it gets
             // woken up on new work.
@@ -87,14 +106,37 @@ namespace hpx::threads::policies {
             double exponent =
                 (std::min)(double(data.wait_count_), double(max_exponent - 1));
 
-            std::chrono::milliseconds period(std::lround((std::min)(
-                data.max_idle_backoff_time_, std::pow(2.0, exponent))));
+            std::chrono::nanoseconds period(
+                std::chrono::milliseconds(std::lround((std::min)(
+                    data.max_idle_backoff_time_, std::pow(2.0, exponent)))));
 
             ++data.wait_count_;
 
-            std::unique_lock<pu_mutex_type> l(mtx_);
-            if (cond_.wait_for(l, period) ==    //-V1089
-                std::cv_status::no_timeout)
+            bool woken_up = false;
+            if (mode & policies::scheduler_mode::enable_idle_parking)
+            {
+                woken_up = park(num_thread, period);
+            }
+            else
+            {
+                // don't sleep past the expiry of the next timer
+                auto const next = next_timer_expiry();
+                if (next != std::chrono::steady_clock::time_point::max())
+                {
+                    period = (std::min)(period,
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            next - std::chrono::steady_clock::now()));
+                }
+
+                if (period.count() > 0)
+                {
+                    std::unique_lock<pu_mutex_type> l(mtx_);
+                    woken_up = cond_.wait_for(l, period) ==    //-V1089
+                        std::cv_status::no_timeout;
+                }
+            }
+
+            if (woken_up)
             {
                 // reset counter if thread was woken up
                 data.wait_count_ = 0;
@@ -106,17 +148,331 @@ namespace hpx::threads::policies {
     /// This function gets called by the thread-manager whenever new work
     /// has been added, allowing the scheduler to reactivate one or more of
     /// possibly idling OS threads
-    void scheduler_base::do_some_work(std::size_t)
+    void scheduler_base::do_some_work([[maybe_unused]] std::size_t num_thread)
     {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
-        if (mode_.data_.load(std::memory_order_relaxed) &
-            policies::scheduler_mode::enable_idle_backoff)
+        scheduler_mode const mode = mode_.data_.load(std::memory_order_relaxed);
+        if (mode & policies::scheduler_mode::enable_idle_parking)
+        {
+            if (mode & policies::scheduler_mode::enable_stealing)
+            {
+                // any OS thread can pick up the new work
+                unpark_one(num_thread);
+            }
+            else if (num_thread < parking_data_.size())
+            {
+                // only the owner of the queue the work was added to will
+                // look at it
+                unpark(num_thread);
+            }
+            else
+            {
+                // the queue the work was added to is not known
+                unpark_all();
+            }
+        }
+        else if (mode & policies::scheduler_mode::enable_idle_backoff)
         {
             cond_.notify_all();
         }
 #endif
     }
 
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+    namespace {
+
+        // index of the lowest bit set in the given (non-zero) value
+        inline std::size_t lowest_bit(std::uint64_t bits) noexcept
+        {
+            HPX_ASSERT(bits != 0);
+#if defined(HPX_GCC_VERSION) || defined(HPX_CLANG_VERSION)
+            return static_cast<std::size_t>(__builtin_ctzll(bits));
+#elif defined(HPX_MSVC) && defined(_M_X64)
+            unsigned long index = 0;
+            _BitScanForward64(&index, bits);
+            return static_cast<std::size_t>(index);
+#else
+            std::size_t index = 0;
+            while ((bits & 1) == 0)
+            {
+                bits >>= 1;
+                ++index;
+            }
+            return index;
+#endif
+        }
+
+        // rotate the given bits to the right, i.e. bit n becomes bit 0
+        constexpr std::uint64_t rotate_right(
+            std::uint64_t bits, std::size_t n) noexcept
+        {
+            return n == 0 ? bits : (bits >> n) | (bits << (64 - n));
+        }
+    }    // namespace
+
+    // Block the given OS thread until new work arrives or the timeout
+    // expires. Returns whether the thread should reset its back-off.
+    bool scheduler_base::park(
+        std::size_t num_thread, std::chrono::nanoseconds timeout)
+    {
+        HPX_ASSERT(num_thread < parking_data_.size());
+        parking_data& data = parking_data_[num_thread].data_;
+
+        std::atomic<std::uint64_t>& word = parked_[num_thread / 64].data_;
+        std::uint64_t const bit = std::uint64_t(1) << (num_thread % 64);
+        word.fetch_or(bit, std::memory_order_relaxed);
+
+        // Make the announcement visible before looking for work. This pairs
+        // with the fence in unpark_one: either the producer sees this thread
+        // as parked or this thread sees the newly added work.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        bool const may_steal =
+            has_scheduler_mode(policies::scheduler_mode::enable_stealing);
+
+        // Don't sleep past the expiry of the next timer. This is evaluated
+        // after the fence above to pair with the one in wake_for_timers.
+        auto const next = next_timer_expiry();
+        if (next != std::chrono::steady_clock::time_point::max())
+        {
+            timeout = (std::min)(timeout,
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    next - std::chrono::steady_clock::now()));
+        }
+
+        bool woken_up = true;
+        if (states_[num_thread].data_.load(std::memory_order_relaxed) ==
+                hpx::state::running &&
+            timeout.count() > 0 &&
+            get_queue_length(may_steal ? std::size_t(-1) : num_thread) == 0)
+        {
+            woken_up = data.parker_.park(timeout);
+        }
+
+        word.fetch_and(~bit, std::memory_order_relaxed);
+
+        return woken_up;
+    }
+
+    void scheduler_base::unpark(std::size_t num_thread) noexcept
+    {
+        HPX_ASSERT(num_thread < parking_data_.size());
+
+        std::atomic<std::uint64_t>& word = parked_[num_thread / 64].data_;
+        std::uint64_t const bit = std::uint64_t(1) << (num_thread % 64);
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if ((word.load(std::memory_order_relaxed) & bit) &&
+            (word.fetch_and(~bit, std::memory_order_acq_rel) & bit))
+        {
+            parking_data_[num_thread].data_.parker_.unpark();
+        }
+    }
+
+    void scheduler_base::unpark_one(std::size_t num_thread) noexcept
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // prefer the given OS thread or the calling one, followed by their
+        // neighbors
+        std::size_t const num_threads = parking_data_.size();
+        if (num_thread >= num_threads)
+        {
+            num_thread = threads::detail::get_local_thread_num_tss();
+            if (num_thread >= num_threads)
+            {
+                num_thread = 0;
+            }
+        }
+
+        // Claim the parked OS thread closest to the given one by clearing its
+        // bit, this touches a single word for up to 64 OS threads.
+        std::size_t const num_words = parked_.size();
+        std::size_t const first_word = num_thread / 64;
+        for (std::size_t i = 0; i != num_words; ++i)
+        {
+            std::size_t const w = (first_word + i) % num_words;
+            std::atomic<std::uint64_t>& word = parked_[w].data_;
+            std::size_t const shift = i == 0 ? num_thread % 64 : 0;
+
+            std::uint64_t bits = word.load(std::memory_order_relaxed);
+            while (bits != 0)
+            {
+                std::size_t const idx =
+                    (lowest_bit(rotate_right(bits, shift)) + shift) % 64;
+                std::uint64_t const bit = std::uint64_t(1) << idx;
+
+                bits = word.fetch_and(~bit, std::memory_order_acq_rel);
+                if (bits & bit)
+                {
+                    parking_data_[w * 64 + idx].data_.parker_.unpark();
+                    return;
+                }
+            }
+        }
+    }
+
+    void scheduler_base::unpark_all() noexcept
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        for (auto& data : parking_data_)
+        {
+            data.data_.parker_.unpark();
+        }
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    timer_id_type scheduler_base::add_timer(
+        std::chrono::steady_clock::time_point abs_time,
+        thread_id_ref_type thrd, thread_schedule_state newstate,
+        thread_restart_state newstate_ex, thread_priority priority,
+        thread_schedule_hint schedulehint, bool retry_on_active)
+    {
+        // Prefer the wheel of the calling OS thread, this avoids contention
+        // and doesn't require waking up any other OS thread.
+        std::size_t const num_threads = timers_.size();
+        std::size_t num_thread = std::size_t(-1);
+        if (parent_pool_ != nullptr &&
+            threads::detail::get_thread_pool_num_tss() ==
+                parent_pool_->get_pool_index())
+        {
+            num_thread = threads::detail::get_local_thread_num_tss();
+        }
+
+        bool const is_local = num_thread < num_threads;
+        if (!is_local)
+        {
+            num_thread = 0;
+            if (schedulehint.mode == thread_schedule_hint_mode::thread &&
+                schedulehint.hint >= 0 &&
+                std::size_t(schedulehint.hint) < num_threads)
+            {
+                num_thread = std::size_t(schedulehint.hint);
+            }
+        }
+
+        timer_id_type timer(new threads::detail::timer_entry(HPX_MOVE(thrd),
+            newstate, newstate_ex, priority, retry_on_active));
+
+        if (timers_[num_thread].data_.wheel_.add(timer.get(), abs_time) &&
+            !is_local)
+        {
+            // the owning OS thread might be sleeping past the new expiry
+            wake_for_timers(num_thread);
+        }
+        return timer;
+    }
+
+    void scheduler_base::wake_for_timers(
+        [[maybe_unused]] std::size_t num_thread) noexcept
+    {
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        scheduler_mode const mode = mode_.data_.load(std::memory_order_relaxed);
+        if (mode & policies::scheduler_mode::enable_idle_parking)
+        {
+            unpark(num_thread);
+        }
+        else if (mode & policies::scheduler_mode::enable_idle_backoff)
+        {
+            cond_.notify_all();
+        }
+#endif
+    }
+
+    bool scheduler_base::process_timers_slow(std::size_t num_thread, bool steal)
+    {
+        timer_data& data = timers_[num_thread].data_;
+
+        // the clock is read only once the first non-empty wheel was found,
+        // idle OS threads poll this while no timers are pending at all
+        std::chrono::steady_clock::time_point now;
+        bool have_now = false;
+
+        // an idle OS thread takes care of the expired timers of all others,
+        // as those might be busy running long lasting HPX threads
+        std::size_t const num_threads = timers_.size();
+        std::size_t const count = steal ? num_threads : 1;
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            auto& wheel = timers_[(num_thread + i) % num_threads].data_.wheel_;
+            if (wheel.empty())
+            {
+                continue;
+            }
+
+            if (!have_now)
+            {
+                now = std::chrono::steady_clock::now();
+                have_now = true;
+            }
+
+            if (wheel.next_expiry() <= now)
+            {
+                wheel.expire(now, data.expired_);
+            }
+        }
+
+        if (data.expired_.empty())
+        {
+            return false;
+        }
+
+        thread_schedule_hint const hint(static_cast<std::int16_t>(num_thread));
+        for (timer_id_type const& timer : data.expired_)
+        {
+            if (timer->fire())
+            {
+                error_code ec(throwmode::lightweight);    // ignore errors
+                threads::detail::set_thread_state(timer->thrd_.noref(),
+                    timer->newstate_, timer->newstate_ex_, timer->priority_,
+                    hint, timer->retry_on_active_, ec);
+            }
+        }
+
+        // this releases the references to the threads held by the timers
+        data.expired_.clear();
+        return true;
+    }
+
+    std::chrono::steady_clock::time_point scheduler_base::next_timer_expiry()
+        const noexcept
+    {
+        auto result = std::chrono::steady_clock::time_point::max();
+        for (auto const& data : timers_)
+        {
+            if (!data.data_.wheel_.empty())
+            {
+                result = (std::min)(result, data.data_.wheel_.next_expiry());
+            }
+        }
+        return result;
+    }
+
+    void scheduler_base::cancel_all_timers()
+    {
+        std::vector<timer_id_type> removed;
+        for (auto& data : timers_)
+        {
+            data.data_.wheel_.clear(removed);
+        }
+    }
+
+    void scheduler_base::create_thread_bulk(
+        thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            HPX_ASSERT(data[i].initial_state == thread_schedule_state::pending);
+
+            create_thread(data[i], nullptr, ec);
+            if (ec)
+            {
+                return;
+            }
+        }
+    }
+
     void scheduler_base::suspend(std::size_t num_thread)
     {
         HPX_ASSERT(num_thread < suspend_conds_.size());
@@ -267,6 +623,11 @@ namespace hpx::threads::policies {
         {
             state.data_.store(s);
         }
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        // make sure parked threads notice the state change
+        unpark_all();
+#endif
     }
 
     void scheduler_base::set_all_states_at_least(hpx::state s)
@@ -278,6 +639,11 @@ namespace hpx::threads::policies {
                 state.data_.store(s, std::memory_order_release);
             }
         }
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        // make sure parked threads notice the state change
+        unpark_all();
+#endif
     }
 
     // return whether all states are at least at the given one
@@ -323,6 +689,11 @@ namespace hpx::threads::policies {
         // distribute the same value across all cores
         mode_.data_.store(mode, std::memory_order_release);
         do_some_work(std::size_t(-1));
+
+#if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
+        // parked threads have to pick up the new mode as well
+        unpark_all();
+#endif
     }
 
     void scheduler_base::add_scheduler_mode(scheduler_mode mode) noexcept
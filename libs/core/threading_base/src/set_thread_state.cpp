@@ -270,9 +270,11 @@ namespace hpx::threads::detail {
             scheduler->schedule_thread(
                 thrd, schedulehint, false, thrd_data->get_priority());
 
-            // NOTE: Don't care if the hint is a NUMA hint, just want to wake up
-            // a thread.
-            scheduler->do_some_work(schedulehint.hint);
+            // NUMA hints don't name a thread to wake up
+            scheduler->do_some_work(
+                schedulehint.mode == thread_schedule_hint_mode::thread ?
+                    static_cast<std::size_t>(schedulehint.hint) :
+                    static_cast<std::size_t>(-1));
         }
 
         if (&ec != &throws)
@@ -0,0 +1,303 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/stack_usage.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx::threads {
+
+    namespace {
+
+        // number of distinct thread descriptions for which the stack usage
+        // is recorded, threads with other descriptions contribute to the
+        // overall statistics only
+        inline constexpr std::size_t max_descriptions = 1024;
+
+        // minimal number of measurements before a stack size is reduced
+        inline constexpr std::uint64_t min_samples = 16;
+
+        // a stack size is considered sufficient if it is at least this many
+        // times larger than the maximal recorded stack usage
+        inline constexpr std::size_t headroom_factor = 2;
+
+        struct stack_usage_entry
+        {
+            std::atomic<std::size_t> key = 0;
+            std::atomic<std::uint64_t> count = 0;
+            std::atomic<std::uint64_t> total = 0;
+            std::atomic<std::size_t> max_usage = 0;
+        };
+
+        void update_max(
+            std::atomic<std::size_t>& max_usage, std::size_t usage) noexcept
+        {
+            std::size_t current = max_usage.load(std::memory_order_relaxed);
+            while (current < usage &&
+                !max_usage.compare_exchange_weak(
+                    current, usage, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        std::size_t get_key(thread_description const& desc) noexcept
+        {
+            if (desc.kind() == thread_description::data_type_description)
+            {
+                return reinterpret_cast<std::size_t>(desc.get_description());
+            }
+            return desc.get_address();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        class stack_usage_registry
+        {
+        public:
+            // Find the entry for the given key (inserting it if needed),
+            // returns nullptr if the table is full
+            stack_usage_entry* find(std::size_t key, bool insert) noexcept
+            {
+                if (key == 0)
+                {
+                    return nullptr;
+                }
+
+                std::size_t index =
+                    (key * 0x9E3779B97F4A7C15ull) % max_descriptions;
+                for (std::size_t i = 0; i != max_descriptions; ++i)
+                {
+                    stack_usage_entry& e = entries_[index];
+
+                    std::size_t current = e.key.load(std::memory_order_acquire);
+                    if (current == key)
+                    {
+                        return &e;
+                    }
+
+                    if (current == 0)
+                    {
+                        if (!insert)
+                        {
+                            return nullptr;
+                        }
+
+                        if (e.key.compare_exchange_strong(
+                                current, key, std::memory_order_acq_rel) ||
+                            current == key)
+                        {
+                            return &e;
+                        }
+                    }
+
+                    index = (index + 1) % max_descriptions;
+                }
+                return nullptr;
+            }
+
+            void record(std::size_t key, std::size_t usage) noexcept
+            {
+                count_.fetch_add(1, std::memory_order_relaxed);
+                total_.fetch_add(usage, std::memory_order_relaxed);
+                update_max(max_usage_, usage);
+
+                if (stack_usage_entry* e = find(key, true); e != nullptr)
+                {
+                    e->total.fetch_add(usage, std::memory_order_relaxed);
+                    update_max(e->max_usage, usage);
+
+                    // update the count last, it decides whether the entry is
+                    // used for adapting the stack size
+                    e->count.fetch_add(1, std::memory_order_release);
+                }
+            }
+
+            std::atomic<std::uint64_t> count_ = 0;
+            std::atomic<std::uint64_t> total_ = 0;
+            std::atomic<std::size_t> max_usage_ = 0;
+            std::atomic<std::int64_t> adaptations_ = 0;
+
+        private:
+            std::array<stack_usage_entry, max_descriptions> entries_;
+        };
+
+        stack_usage_registry& get_stack_usage_registry() noexcept
+        {
+            static stack_usage_registry registry;
+            return registry;
+        }
+
+        bool stack_size_adaptation_enabled = false;
+        bool stack_size_shrinking_enabled = false;
+
+        thread_stacksize next_stacksize(thread_stacksize stacksize) noexcept
+        {
+            return static_cast<thread_stacksize>(
+                static_cast<std::int8_t>(stacksize) + 1);
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    stack_usage_statistics get_stack_usage_statistics(
+        thread_description const& desc) noexcept
+    {
+        stack_usage_statistics result;
+
+        stack_usage_entry const* e =
+            get_stack_usage_registry().find(get_key(desc), false);
+        if (e != nullptr)
+        {
+            result.count = e->count.load(std::memory_order_acquire);
+            result.max_usage = e->max_usage.load(std::memory_order_relaxed);
+            if (result.count != 0)
+            {
+                result.average_usage = static_cast<std::size_t>(
+                    e->total.load(std::memory_order_relaxed) / result.count);
+            }
+        }
+        return result;
+    }
+
+    std::int64_t get_stack_usage_max(bool reset) noexcept
+    {
+        stack_usage_registry& registry = get_stack_usage_registry();
+        return static_cast<std::int64_t>(
+            util::get_and_reset_value(registry.max_usage_, reset));
+    }
+
+    std::int64_t get_stack_usage_average(bool reset) noexcept
+    {
+        stack_usage_registry& registry = get_stack_usage_registry();
+
+        std::uint64_t const count =
+            util::get_and_reset_value(registry.count_, reset);
+        std::uint64_t const total =
+            util::get_and_reset_value(registry.total_, reset);
+
+        return count == 0 ? 0 : static_cast<std::int64_t>(total / count);
+    }
+
+    std::int64_t get_stack_size_adaptation_count(bool reset) noexcept
+    {
+        return util::get_and_reset_value(
+            get_stack_usage_registry().adaptations_, reset);
+    }
+
+    namespace detail {
+
+        void set_stack_size_adaptation_enabled(bool enabled) noexcept
+        {
+            stack_size_adaptation_enabled = enabled;
+        }
+
+        bool get_stack_size_adaptation_enabled() noexcept
+        {
+            return stack_size_adaptation_enabled;
+        }
+
+        void set_stack_size_shrinking_enabled(bool enabled) noexcept
+        {
+            stack_size_shrinking_enabled = enabled;
+        }
+
+        bool get_stack_size_shrinking_enabled() noexcept
+        {
+            return stack_size_shrinking_enabled;
+        }
+
+        void record_stack_usage(
+            thread_description const& desc, std::size_t usage) noexcept
+        {
+            get_stack_usage_registry().record(get_key(desc), usage);
+        }
+
+        // A stack is grown as soon as the recorded usage leaves less than
+        // the required headroom. It is shrunk only if this was explicitly
+        // enabled and once enough measurements are available, as the recorded
+        // maximum is only a lower bound of the stack space a thread may need.
+        thread_stacksize adapt_stack_size(
+            policies::scheduler_base const& scheduler,
+            thread_description const& desc,
+            thread_stacksize stacksize) noexcept
+        {
+            if (stacksize < thread_stacksize::minimal ||
+                stacksize > thread_stacksize::maximal)
+            {
+                return stacksize;
+            }
+
+            stack_usage_registry& registry = get_stack_usage_registry();
+            stack_usage_entry const* e = registry.find(get_key(desc), false);
+            if (e == nullptr)
+            {
+                return stacksize;
+            }
+
+            std::uint64_t const count =
+                e->count.load(std::memory_order_acquire);
+            std::size_t const required = headroom_factor *
+                e->max_usage.load(std::memory_order_relaxed);
+
+            if (static_cast<std::size_t>(scheduler.get_stack_size(stacksize)) <
+                required)
+            {
+                // use the smallest larger stack size which is sufficient, or
+                // the largest one
+                auto candidate = stacksize;
+                do
+                {
+                    candidate = next_stacksize(candidate);
+                } while (candidate != thread_stacksize::maximal &&
+                    static_cast<std::size_t>(
+                        scheduler.get_stack_size(candidate)) < required);
+
+                registry.adaptations_.fetch_add(1, std::memory_order_relaxed);
+                return candidate;
+            }
+
+            if (!stack_size_shrinking_enabled || count < min_samples)
+            {
+                return stacksize;
+            }
+
+            // use the smallest stack size which is sufficient. The default
+            // stack size is the smallest one, threads requesting it are
+            // never shrunk.
+            for (auto candidate = thread_stacksize::minimal;
+                 candidate < stacksize; candidate = next_stacksize(candidate))
+            {
+                if (static_cast<std::size_t>(
+                        scheduler.get_stack_size(candidate)) >= required)
+                {
+                    registry.adaptations_.fetch_add(
+                        1, std::memory_order_relaxed);
+                    return candidate;
+                }
+            }
+            return stacksize;
+        }
+
+        void adapt_stack_size([[maybe_unused]] thread_init_data& data) noexcept
+        {
+#ifdef HPX_HAVE_THREAD_DESCRIPTION
+            // use a different stack size if threads of the same kind are
+            // known to require more (or less) stack space than requested
+            if (stack_size_adaptation_enabled && data.scheduler_base != nullptr)
+            {
+                data.stacksize = adapt_stack_size(
+                    *data.scheduler_base, data.description, data.stacksize);
+            }
+#endif
+        }
+    }    // namespace detail
+}    // namespace hpx::threads
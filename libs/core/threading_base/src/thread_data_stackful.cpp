@@ -7,8 +7,11 @@
 #include <hpx/config.hpp>
 #include <hpx/allocator_support/internal_allocator.hpp>
 #include <hpx/modules/logging.hpp>
+#include <hpx/threading_base/stack_usage.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 
+#include <cstddef>
+
 ////////////////////////////////////////////////////////////////////////////////
 namespace hpx::threads {
 
@@ -20,5 +23,16 @@ namespace hpx::threads {
         LTM_(debug).format(
             "~thread_data_stackful({}), description({}), phase({})", this,
             this->get_description(), this->get_thread_phase());
+
+        record_stack_usage();
+    }
+
+    void thread_data_stackful::record_stack_usage() const noexcept
+    {
+        // the stack usage is measured only if hpx.stacks.track_usage is set
+        if (std::size_t const usage = coroutine_.get_stack_usage(); usage != 0)
+        {
+            detail::record_stack_usage(this->get_description(), usage);
+        }
     }
 }    // namespace hpx::threads
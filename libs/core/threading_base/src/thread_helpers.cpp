@@ -11,6 +11,7 @@
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
 #include <hpx/threading_base/set_thread_state.hpp>
@@ -53,7 +54,7 @@ namespace hpx::threads {
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    thread_id_ref_type set_thread_state(thread_id_type const& id,
+    timer_id_type set_thread_state(thread_id_type const& id,
         hpx::chrono::steady_time_point const& abs_time,
         std::atomic<bool>* timer_started, thread_schedule_state state,
         thread_restart_state stateex, thread_priority priority,
@@ -65,6 +66,11 @@ namespace hpx::threads {
             retry_on_active, ec);
     }
 
+    bool cancel_timer(timer_id_type const& timer) noexcept
+    {
+        return timer && detail::timer_wheel::cancel(timer.get());
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     thread_state get_thread_state(
         thread_id_type const& id, error_code& /* ec */) noexcept
@@ -537,9 +543,8 @@ namespace hpx::this_thread {
 #ifdef HPX_HAVE_THREAD_BACKTRACE_ON_SUSPENSION
             threads::detail::reset_backtrace bt(id, ec);
 #endif
-            std::atomic<bool> timer_started(false);
-            threads::thread_id_ref_type timer_id =
-                threads::set_thread_state(id.noref(), abs_time, &timer_started,
+            threads::timer_id_type const timer_id =
+                threads::set_thread_state(id.noref(), abs_time,
                     threads::thread_schedule_state::pending,
                     threads::thread_restart_state::timeout,
                     threads::thread_priority::boost, true, ec);
@@ -573,14 +578,7 @@ namespace hpx::this_thread {
                 HPX_ASSERT(statex == threads::thread_restart_state::abort ||
                     statex == threads::thread_restart_state::signaled);
 
-                error_code ec1(throwmode::lightweight);    // do not throw
-                hpx::util::yield_while<true>(
-                    [&timer_started]() { return !timer_started.load(); },
-                    "set_thread_state_timed");
-                threads::set_thread_state(timer_id.noref(),
-                    threads::thread_schedule_state::pending,
-                    threads::thread_restart_state::abort,
-                    threads::thread_priority::boost, true, ec1);
+                threads::cancel_timer(timer_id);
             }
         }
 
@@ -12,6 +12,7 @@
 #include <hpx/threading_base/callback_notifier.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
+#include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
 #include <hpx/timing/high_resolution_clock.hpp>
 #include <hpx/topology/topology.hpp>
@@ -111,6 +112,19 @@ namespace hpx::threads {
         return active_os_thread_count;
     }
 
+    void thread_pool_base::create_work_bulk(
+        thread_init_data* data, std::size_t count, error_code& ec)
+    {
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            create_work(data[i], ec);
+            if (ec)
+            {
+                return;
+            }
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     void thread_pool_base::init_pool_time_scale()
     {
@@ -0,0 +1,410 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/memory/intrusive_ptr.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
+
+#if defined(HPX_MSVC)
+#include <intrin.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+namespace hpx::threads::detail {
+
+    void intrusive_ptr_add_ref(timer_entry* p) noexcept
+    {
+        p->count_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void intrusive_ptr_release(timer_entry* p) noexcept
+    {
+        if (p->count_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            delete p;
+        }
+    }
+
+    namespace {
+
+        inline constexpr std::uint64_t no_event =
+            (std::numeric_limits<std::uint64_t>::max)();
+
+        inline constexpr std::size_t no_slot = std::size_t(-1);
+
+        // index of the lowest bit set in the given (non-zero) value
+        inline std::size_t lowest_bit(std::uint64_t bits) noexcept
+        {
+            HPX_ASSERT(bits != 0);
+#if defined(HPX_GCC_VERSION) || defined(HPX_CLANG_VERSION)
+            return static_cast<std::size_t>(__builtin_ctzll(bits));
+#elif defined(HPX_MSVC) && defined(_M_X64)
+            unsigned long index = 0;
+            _BitScanForward64(&index, bits);
+            return static_cast<std::size_t>(index);
+#else
+            std::size_t index = 0;
+            while ((bits & 1) == 0)
+            {
+                bits >>= 1;
+                ++index;
+            }
+            return index;
+#endif
+        }
+
+        // rotate the given bits to the right, i.e. bit n becomes bit 0
+        constexpr std::uint64_t rotate_right(
+            std::uint64_t bits, std::size_t n) noexcept
+        {
+            return n == 0 ? bits : (bits >> n) | (bits << (64 - n));
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    timer_wheel::timer_wheel(std::chrono::nanoseconds resolution)
+      : epoch_(clock_type::now())
+      , resolution_(
+            (std::max)(std::chrono::duration_cast<clock_type::duration>(
+                           resolution),
+                clock_type::duration(1)))
+      , next_expiry_(clock_type::time_point::max().time_since_epoch().count())
+    {
+        static_assert(num_slots == 64,
+            "the occupancy of the slots of a level is tracked in a 64 bit mask");
+    }
+
+    timer_wheel::~timer_wheel()
+    {
+        std::vector<hpx::intrusive_ptr<timer_entry>> removed;
+        clear(removed);
+    }
+
+    std::uint64_t timer_wheel::to_ticks(clock_type::time_point t) const noexcept
+    {
+        if (t <= epoch_)
+        {
+            return 0;
+        }
+
+        // round up, timers must not expire early
+        auto const d = t - epoch_;
+        if (d > clock_type::time_point::max() - epoch_ - resolution_)
+        {
+            return no_event - 1;
+        }
+        return static_cast<std::uint64_t>(
+            (d + resolution_ - clock_type::duration(1)) / resolution_);
+    }
+
+    timer_wheel::clock_type::time_point timer_wheel::from_ticks(
+        std::uint64_t ticks) const noexcept
+    {
+        auto const max_ticks = static_cast<std::uint64_t>(
+            (clock_type::time_point::max() - epoch_) / resolution_);
+        if (ticks >= max_ticks)
+        {
+            return clock_type::time_point::max();
+        }
+        return epoch_ + static_cast<clock_type::rep>(ticks) * resolution_;
+    }
+
+    // Link the entry into the slot covering its expiry. The level is the
+    // lowest one whose slots reach far enough into the future, entries
+    // expiring beyond the reach of the highest level are kept in its last
+    // slot and re-evaluated whenever that slot is cascaded.
+    void timer_wheel::link(timer_entry* entry) noexcept
+    {
+        std::uint64_t const expiry = (std::max)(entry->expiry_, current_);
+
+        std::size_t level = 0;
+        std::size_t slot = 0;
+        for (/**/; level != num_levels; ++level)
+        {
+            std::size_t const shift = level * slot_bits;
+            if ((expiry >> shift) - (current_ >> shift) < num_slots)
+            {
+                slot = static_cast<std::size_t>(expiry >> shift) &
+                    (num_slots - 1);
+                break;
+            }
+        }
+
+        if (level == num_levels)
+        {
+            level = num_levels - 1;
+            std::size_t const shift = level * slot_bits;
+            slot = static_cast<std::size_t>(
+                       (current_ >> shift) + num_slots - 1) &
+                (num_slots - 1);
+        }
+
+        timer_entry*& head = slots_[level][slot];
+        entry->prev_ = nullptr;
+        entry->next_ = head;
+        if (head != nullptr)
+        {
+            head->prev_ = entry;
+        }
+        head = entry;
+
+        entry->slot_ = level * num_slots + slot;
+        occupied_[level] |= std::uint64_t(1) << slot;
+    }
+
+    void timer_wheel::unlink(timer_entry* entry) noexcept
+    {
+        HPX_ASSERT(entry->slot_ != no_slot);
+
+        std::size_t const level = entry->slot_ / num_slots;
+        std::size_t const slot = entry->slot_ % num_slots;
+
+        if (entry->prev_ != nullptr)
+        {
+            entry->prev_->next_ = entry->next_;
+        }
+        else
+        {
+            slots_[level][slot] = entry->next_;
+        }
+
+        if (entry->next_ != nullptr)
+        {
+            entry->next_->prev_ = entry->prev_;
+        }
+
+        if (slots_[level][slot] == nullptr)
+        {
+            occupied_[level] &= ~(std::uint64_t(1) << slot);
+        }
+
+        entry->prev_ = nullptr;
+        entry->next_ = nullptr;
+        entry->slot_ = no_slot;
+    }
+
+    // The next tick at which a slot has to be processed: either the expiry of
+    // a slot of the first level or the tick at which a slot of a higher level
+    // is cascaded.
+    std::uint64_t timer_wheel::next_event() const noexcept
+    {
+        std::uint64_t result = no_event;
+        for (std::size_t level = 0; level != num_levels; ++level)
+        {
+            std::uint64_t const bits = occupied_[level];
+            if (bits == 0)
+            {
+                continue;
+            }
+
+            std::size_t const shift = level * slot_bits;
+            std::uint64_t const current = current_ >> shift;
+
+            std::size_t const distance = lowest_bit(rotate_right(bits,
+                static_cast<std::size_t>(current) & (num_slots - 1)));
+
+            std::uint64_t const tick =
+                (std::max)((current + distance) << shift, current_);
+            result = (std::min)(result, tick);
+        }
+        return result;
+    }
+
+    void timer_wheel::update_next_expiry() noexcept
+    {
+        std::uint64_t const event = next_event();
+        clock_type::time_point const next = event == no_event ?
+            clock_type::time_point::max() :
+            from_ticks(event);
+
+        next_expiry_.store(
+            next.time_since_epoch().count(), std::memory_order_release);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool timer_wheel::add(timer_entry* entry, clock_type::time_point expiry)
+    {
+        HPX_ASSERT(entry->slot_ == no_slot && entry->wheel_ == nullptr);
+
+        // the wheel holds a reference to all of its entries
+        intrusive_ptr_add_ref(entry);
+
+        std::lock_guard<mutex_type> l(mtx_);
+
+        entry->wheel_ = this;
+        entry->expiry_ = to_ticks(expiry);
+        link(entry);
+
+        size_.fetch_add(1, std::memory_order_relaxed);
+
+        auto const previous = next_expiry_.load(std::memory_order_relaxed);
+        update_next_expiry();
+        return next_expiry_.load(std::memory_order_relaxed) < previous;
+    }
+
+    bool timer_wheel::cancel(timer_entry* entry) noexcept
+    {
+        timer_entry::timer_state expected = timer_entry::timer_state::pending;
+        if (!entry->state_.compare_exchange_strong(expected,
+                timer_entry::timer_state::canceled, std::memory_order_acq_rel))
+        {
+            return false;
+        }
+
+        // The entry might have been removed from the wheel already, in which
+        // case whoever has removed it will drop the reference.
+        timer_wheel* wheel = entry->wheel_;
+        HPX_ASSERT(wheel != nullptr);
+
+        bool linked = false;
+        {
+            std::lock_guard<mutex_type> l(wheel->mtx_);
+            if (entry->slot_ != no_slot)
+            {
+                wheel->unlink(entry);
+                wheel->size_.fetch_sub(1, std::memory_order_relaxed);
+                wheel->update_next_expiry();
+                linked = true;
+            }
+        }
+
+        if (linked)
+        {
+            intrusive_ptr_release(entry);
+        }
+        return true;
+    }
+
+    std::size_t timer_wheel::expire(clock_type::time_point now,
+        std::vector<hpx::intrusive_ptr<timer_entry>>& expired)
+    {
+        std::unique_lock<mutex_type> l(mtx_, std::try_to_lock);
+        if (!l.owns_lock())
+        {
+            // somebody else is processing or modifying this wheel
+            return 0;
+        }
+
+        // all ticks which have started at the given point in time are due
+        std::uint64_t const now_tick =
+            now <= epoch_ ? 0 : std::uint64_t((now - epoch_) / resolution_);
+
+        std::size_t count = 0;
+        while (true)
+        {
+            std::uint64_t const tick = next_event();
+            if (tick == no_event || tick > now_tick)
+            {
+                break;
+            }
+
+            current_ = tick;
+
+            // cascade the slots of the higher levels reached at this tick,
+            // the highest level first
+            for (std::size_t level = num_levels - 1; level != 0; --level)
+            {
+                std::size_t const shift = level * slot_bits;
+                if ((tick & ((std::uint64_t(1) << shift) - 1)) != 0)
+                {
+                    continue;
+                }
+
+                std::size_t const slot =
+                    static_cast<std::size_t>(tick >> shift) & (num_slots - 1);
+
+                timer_entry* entry = slots_[level][slot];
+                slots_[level][slot] = nullptr;
+                occupied_[level] &= ~(std::uint64_t(1) << slot);
+
+                while (entry != nullptr)
+                {
+                    timer_entry* next = entry->next_;
+                    link(entry);
+                    entry = next;
+                }
+            }
+
+            // all entries of the current slot of the first level expire now
+            std::size_t const slot =
+                static_cast<std::size_t>(tick) & (num_slots - 1);
+
+            timer_entry* entry = slots_[0][slot];
+            slots_[0][slot] = nullptr;
+            occupied_[0] &= ~(std::uint64_t(1) << slot);
+
+            while (entry != nullptr)
+            {
+                timer_entry* next = entry->next_;
+                entry->prev_ = nullptr;
+                entry->next_ = nullptr;
+                entry->slot_ = no_slot;
+
+                // take over the reference held by the wheel
+                expired.emplace_back(entry, false);
+                ++count;
+
+                entry = next;
+            }
+
+            current_ = tick + 1;
+        }
+
+        current_ = (std::max)(current_, now_tick + 1);
+
+        if (count != 0)
+        {
+            size_.fetch_sub(count, std::memory_order_relaxed);
+        }
+        update_next_expiry();
+
+        return count;
+    }
+
+    void timer_wheel::clear(
+        std::vector<hpx::intrusive_ptr<timer_entry>>& removed)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+
+        for (std::size_t level = 0; level != num_levels; ++level)
+        {
+            for (timer_entry*& head : slots_[level])
+            {
+                timer_entry* entry = head;
+                head = nullptr;
+
+                while (entry != nullptr)
+                {
+                    timer_entry* next = entry->next_;
+                    entry->prev_ = nullptr;
+                    entry->next_ = nullptr;
+                    entry->slot_ = no_slot;
+
+                    timer_entry::timer_state expected =
+                        timer_entry::timer_state::pending;
+                    entry->state_.compare_exchange_strong(expected,
+                        timer_entry::timer_state::canceled,
+                        std::memory_order_acq_rel);
+
+                    removed.emplace_back(entry, false);
+                    entry = next;
+                }
+            }
+            occupied_[level] = 0;
+        }
+
+        size_.store(0, std::memory_order_relaxed);
+        update_next_expiry();
+    }
+}    // namespace hpx::threads::detail
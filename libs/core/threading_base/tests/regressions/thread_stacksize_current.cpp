@@ -76,7 +76,9 @@ int main(int argc, char** argv)
         "abp-priority-fifo",
         "abp-priority-lifo",
 #endif
-        "shared-priority"
+        "shared-priority",
+        "local-workstealing",
+        "local-deadline"
     };
     // clang-format on
     for (auto const& scheduler : schedulers)
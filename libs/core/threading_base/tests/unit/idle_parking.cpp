@@ -0,0 +1,93 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Worker threads which have run out of work are parked. This test makes sure
+// that work bound to a parked worker thread wakes it up. As the maximal idle
+// back-off time is very long, a lost wake-up makes this test hang.
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/runtime.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using hpx::threads::policies::scheduler_mode;
+
+int hpx_main()
+{
+    auto const* scheduler =
+        hpx::threads::get_self_id_data()->get_scheduler_base();
+    HPX_TEST(
+        scheduler->has_scheduler_mode(scheduler_mode::enable_idle_parking));
+
+    std::size_t const num_threads = hpx::get_num_worker_threads();
+    for (int i = 0; i != 10; ++i)
+    {
+        // give the other worker threads time to run out of work and park
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+        std::vector<hpx::future<void>> futures;
+        futures.reserve(num_threads);
+        for (std::size_t t = 0; t != num_threads; ++t)
+        {
+            auto exec = hpx::execution::parallel_executor(
+                hpx::threads::thread_priority::bound,
+                hpx::threads::thread_stacksize::default_,
+                hpx::threads::thread_schedule_hint(std::int16_t(t)));
+            futures.push_back(hpx::async(exec, []() {}));
+        }
+
+        hpx::wait_all(futures);
+    }
+
+    return hpx::local::finalize();
+}
+
+void test_scheduler(
+    int argc, char* argv[], hpx::resource::scheduling_policy scheduler)
+{
+    hpx::local::init_params init_args;
+
+    // park as soon as possible, never wake up because of a timeout
+    init_args.cfg = {"hpx.max_idle_loop_count=0",
+        "hpx.max_idle_backoff_time=1000000"};
+    init_args.rp_callback = [scheduler](auto& rp,
+                                hpx::program_options::variables_map const&) {
+        rp.create_thread_pool("default", scheduler, scheduler_mode::default_);
+    };
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<hpx::resource::scheduling_policy> const schedulers = {
+        hpx::resource::scheduling_policy::local,
+        hpx::resource::scheduling_policy::local_priority_fifo,
+        hpx::resource::scheduling_policy::static_,
+        hpx::resource::scheduling_policy::static_priority,
+        hpx::resource::scheduling_policy::shared_priority,
+        hpx::resource::scheduling_policy::local_workstealing,
+        hpx::resource::scheduling_policy::local_deadline,
+    };
+
+    for (auto const scheduler : schedulers)
+    {
+        test_scheduler(argc, argv, scheduler);
+    }
+
+    return hpx::util::report_errors();
+}
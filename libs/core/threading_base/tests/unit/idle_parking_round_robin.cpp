@@ -0,0 +1,94 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Schedulers which don't steal work place work without a hint round robin.
+// Only the OS thread owning the chosen queue will ever run it, thus this OS
+// thread has to be woken up if it is parked. As the maximal idle back-off
+// time is very long, waking up any other OS thread makes this test hang.
+
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/runtime.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using hpx::threads::policies::scheduler_mode;
+
+int hpx_main()
+{
+    auto const* scheduler =
+        hpx::threads::get_self_id_data()->get_scheduler_base();
+    HPX_TEST(
+        scheduler->has_scheduler_mode(scheduler_mode::enable_idle_parking));
+    HPX_TEST(!scheduler->has_scheduler_mode(scheduler_mode::enable_stealing));
+
+    std::size_t const num_threads = hpx::get_num_worker_threads();
+    for (int i = 0; i != 10; ++i)
+    {
+        // give the other worker threads time to run out of work and park
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+        auto const start = std::chrono::steady_clock::now();
+
+        // no hint, the work ends up on all queues in turn
+        std::vector<hpx::future<void>> futures;
+        futures.reserve(2 * num_threads);
+        for (std::size_t t = 0; t != 2 * num_threads; ++t)
+        {
+            futures.push_back(hpx::async([]() {}));
+        }
+
+        hpx::wait_all(futures);
+
+        // the owners of the queues must have been woken up right away
+        auto const elapsed =
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start);
+        HPX_TEST_LT(elapsed.count(), 5000);
+    }
+
+    return hpx::local::finalize();
+}
+
+void test_scheduler(
+    int argc, char* argv[], hpx::resource::scheduling_policy scheduler)
+{
+    hpx::local::init_params init_args;
+
+    // park as soon as possible, never wake up because of a timeout
+    init_args.cfg = {"hpx.max_idle_loop_count=0",
+        "hpx.max_idle_backoff_time=1000000"};
+    init_args.rp_callback = [scheduler](auto& rp,
+                                hpx::program_options::variables_map const&) {
+        rp.create_thread_pool("default", scheduler, scheduler_mode::default_);
+    };
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<hpx::resource::scheduling_policy> const schedulers = {
+        hpx::resource::scheduling_policy::static_,
+        hpx::resource::scheduling_policy::static_priority,
+    };
+
+    for (auto const scheduler : schedulers)
+    {
+        test_scheduler(argc, argv, scheduler);
+    }
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,184 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Work created in bulk is handed to the scheduler in one go. This test makes
+// sure that all of the work is run exactly once, for all schedulers and for
+// work with mixed priorities and schedule hints. The local priority schedulers
+// have to push the work to their queues in batches, also if each work item is
+// hinted to a worker thread as done by the bulk executors.
+
+#include <hpx/local/init.hpp>
+#include <hpx/local/latch.hpp>
+#include <hpx/local/runtime.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using hpx::threads::policies::scheduler_mode;
+
+hpx::resource::scheduling_policy current_scheduler =
+    hpx::resource::scheduling_policy::local;
+
+void test_register_work_bulk(std::size_t num_tasks, bool mixed)
+{
+    std::vector<std::atomic<int>> counts(num_tasks);
+    for (auto& count : counts)
+    {
+        count.store(0);
+    }
+
+    hpx::latch l(static_cast<std::ptrdiff_t>(num_tasks + 1));
+
+    std::size_t const num_threads = hpx::get_num_worker_threads();
+
+    std::vector<hpx::threads::thread_init_data> data;
+    data.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        auto priority = hpx::threads::thread_priority::default_;
+        auto hint = hpx::threads::thread_schedule_hint();
+        if (mixed)
+        {
+            if (i % 7 == 0)
+            {
+                priority = hpx::threads::thread_priority::high;
+            }
+            else if (i % 11 == 0)
+            {
+                priority = hpx::threads::thread_priority::low;
+            }
+            else if (i % 5 == 0)
+            {
+                hint = hpx::threads::thread_schedule_hint(
+                    static_cast<std::int16_t>(i % num_threads));
+            }
+        }
+
+        data.emplace_back(hpx::threads::make_thread_function_nullary(
+                              [&counts, &l, i]() {
+                                  ++counts[i];
+                                  l.count_down(1);
+                              }),
+            "test_register_work_bulk", priority, hint);
+    }
+
+    hpx::threads::register_work_bulk(data.data(), data.size());
+
+    l.arrive_and_wait();
+
+    for (auto const& count : counts)
+    {
+        HPX_TEST_EQ(count.load(), 1);
+    }
+}
+
+// Work hinted to the worker threads in contiguous blocks (as done by the bulk
+// executors) is pushed in batches by the local priority schedulers.
+void test_batched_hints(std::size_t num_tasks)
+{
+    std::atomic<std::size_t> count(0);
+    hpx::latch l(static_cast<std::ptrdiff_t>(num_tasks + 1));
+
+    std::size_t const num_threads = hpx::get_num_worker_threads();
+
+    std::vector<hpx::threads::thread_init_data> data;
+    data.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        data.emplace_back(hpx::threads::make_thread_function_nullary(
+                              [&count, &l]() {
+                                  ++count;
+                                  l.count_down(1);
+                              }),
+            "test_batched_hints", hpx::threads::thread_priority::default_,
+            hpx::threads::thread_schedule_hint(
+                static_cast<std::int16_t>(i * num_threads / num_tasks)));
+    }
+
+    hpx::threads::policies::scheduler_base* scheduler =
+        hpx::threads::get_self_id_data()->get_scheduler_base();
+    scheduler->get_num_bulk_created_threads(true);
+
+    hpx::threads::register_work_bulk(data.data(), data.size());
+
+    l.arrive_and_wait();
+    HPX_TEST_EQ(count.load(), num_tasks);
+
+    std::int64_t const num_batched =
+        scheduler->get_num_bulk_created_threads(true);
+    if (current_scheduler ==
+            hpx::resource::scheduling_policy::local_priority_fifo ||
+        current_scheduler == hpx::resource::scheduling_policy::static_priority)
+    {
+        HPX_TEST_EQ(num_batched, static_cast<std::int64_t>(num_tasks));
+    }
+}
+
+void test_invalid_state()
+{
+    std::vector<hpx::threads::thread_init_data> data;
+    data.emplace_back(hpx::threads::make_thread_function_nullary([]() {}),
+        "test_invalid_state", hpx::threads::thread_priority::default_,
+        hpx::threads::thread_schedule_hint(),
+        hpx::threads::thread_stacksize::default_,
+        hpx::threads::thread_schedule_state::suspended);
+
+    hpx::error_code ec(hpx::throwmode::lightweight);
+    hpx::threads::register_work_bulk(data.data(), data.size(), ec);
+    HPX_TEST(ec);
+}
+
+int hpx_main()
+{
+    test_register_work_bulk(0, false);
+    test_register_work_bulk(1, false);
+    test_register_work_bulk(10000, false);
+    test_register_work_bulk(10000, true);
+    test_batched_hints(1000);
+    test_invalid_state();
+
+    return hpx::local::finalize();
+}
+
+void test_scheduler(
+    int argc, char* argv[], hpx::resource::scheduling_policy scheduler)
+{
+    hpx::local::init_params init_args;
+
+    init_args.cfg = {"hpx.os_threads=4"};
+    init_args.rp_callback = [scheduler](auto& rp,
+                                hpx::program_options::variables_map const&) {
+        rp.create_thread_pool("default", scheduler, scheduler_mode::default_);
+    };
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<hpx::resource::scheduling_policy> const schedulers = {
+        hpx::resource::scheduling_policy::local,
+        hpx::resource::scheduling_policy::local_priority_fifo,
+        hpx::resource::scheduling_policy::static_,
+        hpx::resource::scheduling_policy::static_priority,
+        hpx::resource::scheduling_policy::shared_priority,
+        hpx::resource::scheduling_policy::local_workstealing,
+        hpx::resource::scheduling_policy::local_deadline,
+    };
+
+    for (auto const scheduler : schedulers)
+    {
+        current_scheduler = scheduler;
+        test_scheduler(argc, argv, scheduler);
+    }
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,147 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The timing wheel is driven with synthetic points in time to verify that
+// timers expire in order, never early, can be canceled, and are cascaded
+// correctly from the coarser levels.
+
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+using hpx::threads::timer_id_type;
+using hpx::threads::detail::timer_entry;
+using hpx::threads::detail::timer_wheel;
+
+using clock_type = timer_wheel::clock_type;
+
+constexpr std::chrono::microseconds resolution(100);
+
+timer_id_type make_timer()
+{
+    return timer_id_type(new timer_entry(hpx::threads::thread_id_ref_type(),
+        hpx::threads::thread_schedule_state::pending,
+        hpx::threads::thread_restart_state::timeout,
+        hpx::threads::thread_priority::normal, true));
+}
+
+void test_expire_in_order()
+{
+    timer_wheel wheel(resolution);
+    auto const start = clock_type::now();
+
+    std::vector<timer_id_type> timers;
+    for (int i = 0; i != 10; ++i)
+    {
+        timers.push_back(make_timer());
+        wheel.add(timers.back().get(), start + (10 - i) * resolution * 10);
+    }
+    HPX_TEST_EQ(wheel.size(), std::size_t(10));
+    HPX_TEST(wheel.next_expiry() <= start + resolution * 11);
+
+    std::vector<timer_id_type> expired;
+    for (int i = 1; i <= 10; ++i)
+    {
+        // nothing expires early
+        HPX_TEST_EQ(
+            wheel.expire(start + i * resolution * 10 - resolution, expired),
+            std::size_t(0));
+
+        HPX_TEST_EQ(wheel.expire(start + i * resolution * 10 + resolution,
+                        expired),
+            std::size_t(1));
+        HPX_TEST(expired.back() == timers[10 - i]);
+        HPX_TEST(expired.back()->fire());
+    }
+
+    HPX_TEST(wheel.empty());
+    HPX_TEST(wheel.next_expiry() == clock_type::time_point::max());
+}
+
+void test_cancel()
+{
+    timer_wheel wheel(resolution);
+    auto const start = clock_type::now();
+
+    timer_id_type t1 = make_timer();
+    timer_id_type t2 = make_timer();
+    wheel.add(t1.get(), start + resolution * 5);
+    wheel.add(t2.get(), start + resolution * 5);
+
+    HPX_TEST(timer_wheel::cancel(t1.get()));
+    HPX_TEST(!timer_wheel::cancel(t1.get()));
+    HPX_TEST(!t1->is_pending());
+    HPX_TEST_EQ(wheel.size(), std::size_t(1));
+
+    std::vector<timer_id_type> expired;
+    HPX_TEST_EQ(wheel.expire(start + resolution * 10, expired), std::size_t(1));
+    HPX_TEST(expired.back() == t2);
+
+    // a fired timer can't be canceled anymore
+    HPX_TEST(t2->fire());
+    HPX_TEST(!timer_wheel::cancel(t2.get()));
+}
+
+void test_cascade()
+{
+    timer_wheel wheel(resolution);
+    auto const start = clock_type::now();
+
+    // these end up on the second, third, and highest levels of the wheel
+    std::vector<clock_type::duration> const delays = {
+        resolution * 100, resolution * 5000, resolution * 300000,
+        std::chrono::hours(24 * 365)};
+
+    std::vector<timer_id_type> timers;
+    for (auto delay : delays)
+    {
+        timers.push_back(make_timer());
+        wheel.add(timers.back().get(), start + delay);
+    }
+
+    std::vector<timer_id_type> expired;
+    for (std::size_t i = 0; i != delays.size(); ++i)
+    {
+        HPX_TEST(wheel.next_expiry() <= start + delays[i] + resolution);
+
+        HPX_TEST_EQ(
+            wheel.expire(start + delays[i] - resolution, expired),
+            std::size_t(0));
+        HPX_TEST_EQ(wheel.expire(start + delays[i] + resolution, expired),
+            std::size_t(1));
+        HPX_TEST(expired.back() == timers[i]);
+    }
+    HPX_TEST(wheel.empty());
+}
+
+void test_clear()
+{
+    timer_id_type t = make_timer();
+    {
+        timer_wheel wheel(resolution);
+        wheel.add(t.get(), clock_type::now() + std::chrono::seconds(10));
+
+        std::vector<timer_id_type> removed;
+        wheel.clear(removed);
+        HPX_TEST_EQ(removed.size(), std::size_t(1));
+        HPX_TEST(wheel.empty());
+    }
+    HPX_TEST(!t->is_pending());
+}
+
+int main()
+{
+    test_expire_in_order();
+    test_cancel();
+    test_cascade();
+    test_clear();
+
+    return hpx::util::report_errors();
+}
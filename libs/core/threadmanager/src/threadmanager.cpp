@@ -130,6 +130,26 @@ namespace hpx { namespace threads {
                 HPX_THREAD_QUEUE_INIT_THREADS_COUNT);
         double const max_idle_backoff_time = hpx::util::get_entry_as<double>(
             rtcfg_, "hpx.max_idle_backoff_time", HPX_IDLE_BACKOFF_TIME_MAX);
+        std::int64_t const steal_threshold_l2 =
+            hpx::util::get_entry_as<std::int64_t>(rtcfg_,
+                "hpx.thread_queue.steal_threshold_l2",
+                HPX_THREAD_QUEUE_STEAL_THRESHOLD_L2);
+        std::int64_t const steal_threshold_l3 =
+            hpx::util::get_entry_as<std::int64_t>(rtcfg_,
+                "hpx.thread_queue.steal_threshold_l3",
+                HPX_THREAD_QUEUE_STEAL_THRESHOLD_L3);
+        std::int64_t const steal_threshold_numa =
+            hpx::util::get_entry_as<std::int64_t>(rtcfg_,
+                "hpx.thread_queue.steal_threshold_numa",
+                HPX_THREAD_QUEUE_STEAL_THRESHOLD_NUMA);
+        std::int64_t const steal_threshold_socket =
+            hpx::util::get_entry_as<std::int64_t>(rtcfg_,
+                "hpx.thread_queue.steal_threshold_socket",
+                HPX_THREAD_QUEUE_STEAL_THRESHOLD_SOCKET);
+        std::int64_t const steal_threshold_machine =
+            hpx::util::get_entry_as<std::int64_t>(rtcfg_,
+                "hpx.thread_queue.steal_threshold_machine",
+                HPX_THREAD_QUEUE_STEAL_THRESHOLD_MACHINE);
 
         std::ptrdiff_t small_stacksize =
             rtcfg_.get_stack_size(thread_stacksize::small_);
@@ -145,7 +165,9 @@ namespace hpx { namespace threads {
             min_add_new_count, max_add_new_count, min_delete_count,
             max_delete_count, max_terminated_threads, init_threads_count,
             max_idle_backoff_time, small_stacksize, medium_stacksize,
-            large_stacksize, huge_stacksize);
+            large_stacksize, huge_stacksize, steal_threshold_l2,
+            steal_threshold_l3, steal_threshold_numa, steal_threshold_socket,
+            steal_threshold_machine);
     }
 
     void threadmanager::create_scheduler_user_defined(
@@ -497,6 +519,66 @@ namespace hpx { namespace threads {
         pools_.push_back(HPX_MOVE(pool));
     }
 
+    void threadmanager::create_scheduler_local_workstealing(
+        thread_pool_init_parameters const& thread_pool_init,
+        policies::thread_queue_init_parameters const& thread_queue_init,
+        std::size_t numa_sensitive)
+    {
+        // instantiate the scheduler
+        using local_sched_type =
+            hpx::threads::policies::local_workstealing_scheduler<>;
+
+        local_sched_type::init_parameter_type init(
+            thread_pool_init.num_threads_, thread_pool_init.affinity_data_,
+            thread_queue_init, "core-local_workstealing_scheduler");
+
+        std::unique_ptr<local_sched_type> sched =
+            std::make_unique<local_sched_type>(init);
+
+        // set the default scheduler flags
+        sched->set_scheduler_mode(thread_pool_init.mode_);
+
+        // conditionally set/unset this flag
+        sched->update_scheduler_mode(
+            policies::scheduler_mode::enable_stealing_numa, !numa_sensitive);
+
+        // instantiate the pool
+        std::unique_ptr<thread_pool_base> pool = std::make_unique<
+            hpx::threads::detail::scheduled_thread_pool<local_sched_type>>(
+            HPX_MOVE(sched), thread_pool_init);
+        pools_.push_back(HPX_MOVE(pool));
+    }
+
+    void threadmanager::create_scheduler_local_deadline(
+        thread_pool_init_parameters const& thread_pool_init,
+        policies::thread_queue_init_parameters const& thread_queue_init,
+        std::size_t numa_sensitive)
+    {
+        // instantiate the scheduler
+        using local_sched_type =
+            hpx::threads::policies::local_deadline_scheduler<>;
+
+        local_sched_type::init_parameter_type init(
+            thread_pool_init.num_threads_, thread_pool_init.affinity_data_,
+            thread_queue_init, "core-local_deadline_scheduler");
+
+        std::unique_ptr<local_sched_type> sched =
+            std::make_unique<local_sched_type>(init);
+
+        // set the default scheduler flags
+        sched->set_scheduler_mode(thread_pool_init.mode_);
+
+        // conditionally set/unset this flag
+        sched->update_scheduler_mode(
+            policies::scheduler_mode::enable_stealing_numa, !numa_sensitive);
+
+        // instantiate the pool
+        std::unique_ptr<thread_pool_base> pool = std::make_unique<
+            hpx::threads::detail::scheduled_thread_pool<local_sched_type>>(
+            HPX_MOVE(sched), thread_pool_init);
+        pools_.push_back(HPX_MOVE(pool));
+    }
+
     void threadmanager::create_pools()
     {
         auto& rp = hpx::resource::get_partitioner();
@@ -650,6 +732,16 @@ namespace hpx { namespace threads {
                     thread_pool_init, thread_queue_init, numa_sensitive);
                 break;
 
+            case resource::scheduling_policy::local_workstealing:
+                create_scheduler_local_workstealing(
+                    thread_pool_init, thread_queue_init, numa_sensitive);
+                break;
+
+            case resource::scheduling_policy::local_deadline:
+                create_scheduler_local_deadline(
+                    thread_pool_init, thread_queue_init, numa_sensitive);
+                break;
+
             default:
                 [[fallthrough]];
             case resource::scheduling_policy::unspecified:
@@ -271,6 +271,14 @@ namespace hpx { namespace threads {
         /// Return the size of the cache associated with the given mask.
         std::size_t get_cache_size(mask_type mask, int level) const;
 
+        /// \brief Return a bit mask where each set bit corresponds to a
+        ///        processing unit sharing the cache of the given level
+        ///        with the processing unit the given thread is running on.
+        ///        The returned mask is empty if the topology does not
+        ///        provide information about the requested cache level.
+        mask_type get_cache_affinity_mask(
+            std::size_t num_thread, int level) const;
+
         mask_type get_cpubind_mask(error_code& ec = throws) const;
         mask_type get_cpubind_mask(
             std::thread& handle, error_code& ec = throws) const;
@@ -1562,6 +1562,77 @@ namespace hpx::threads {
         return cache_size;
     }
 
+    mask_type topology::get_cache_affinity_mask(
+        std::size_t num_thread, int level) const
+    {
+        mask_type cache_affinity_mask = mask_type();
+        resize(cache_affinity_mask, get_number_of_pus());
+
+        if (level < 1 || level > 5)
+        {
+            return cache_affinity_mask;
+        }
+
+        std::size_t const num_pu = (num_thread + pu_offset) % num_of_pus_;
+        hwloc_obj_t cache_obj = nullptr;
+
+        {
+            std::unique_lock<mutex_type> lk(topo_mtx);
+
+            hwloc_obj_t pu_obj = hwloc_get_obj_by_type(
+                topo, HWLOC_OBJ_PU, static_cast<unsigned>(num_pu));
+            if (pu_obj == nullptr)
+            {
+                return cache_affinity_mask;
+            }
+
+#if HWLOC_API_VERSION >= 0x00020000
+            hwloc_obj_type_t type = HWLOC_OBJ_L1CACHE;
+            switch (level)
+            {
+            case 2:
+                type = HWLOC_OBJ_L2CACHE;
+                break;
+
+            case 3:
+                type = HWLOC_OBJ_L3CACHE;
+                break;
+
+            case 4:
+                type = HWLOC_OBJ_L4CACHE;
+                break;
+
+            case 5:
+                type = HWLOC_OBJ_L5CACHE;
+                break;
+
+            default:
+                break;
+            }
+
+            cache_obj = hwloc_get_ancestor_obj_by_type(topo, type, pu_obj);
+#else
+            // traverse up until found the requested cache level
+            for (hwloc_obj_t obj = pu_obj->parent; obj != nullptr;
+                 obj = obj->parent)
+            {
+                if (obj->type == HWLOC_OBJ_CACHE &&
+                    obj->attr->cache.depth == static_cast<unsigned>(level))
+                {
+                    cache_obj = obj;
+                    break;
+                }
+            }
+#endif
+        }
+
+        if (cache_obj != nullptr)
+        {
+            extract_node_mask(cache_obj, cache_affinity_mask);
+        }
+        return cache_affinity_mask;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     hwloc_bitmap_t topology::mask_to_bitmap(
         mask_cref_type mask, hwloc_obj_type_t htype) const
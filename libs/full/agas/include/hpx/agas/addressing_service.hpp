@@ -11,8 +11,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/agas/agas_fwd.hpp>
-#include <hpx/cache/lru_cache.hpp>
-#include <hpx/cache/statistics/local_full_statistics.hpp>
+#include <hpx/agas/detail/gva_cache.hpp>
 #include <hpx/components_base/pinned_ptr.hpp>
 #include <hpx/datastructures/detail/dynamic_bitset.hpp>
 #include <hpx/functional/function.hpp>
@@ -61,15 +60,26 @@ namespace hpx { namespace agas {
         using mutex_type = hpx::spinlock;
 
         // gva cache
-        struct gva_cache_key;
-
-        using gva_cache_type = hpx::util::cache::lru_cache<gva_cache_key, gva,
-            hpx::util::cache::statistics::local_full_statistics>;
+        using gva_cache_key = detail::gva_cache_key;
+        using gva_cache_type = detail::gva_cache;
 
         using migrated_objects_table_type = std::set<naming::gid_type>;
         using refcnt_requests_type = std::map<naming::gid_type, std::int64_t>;
 
-        mutable mutex_type gva_cache_mtx_;
+        // Credits granted by AGAS in advance which are not attached to any
+        // id_type yet. Increments of the reference count are served from
+        // these without talking to AGAS. As the pooled credits keep the
+        // object alive, they are returned once not drawn from during a flush
+        // interval, or once they have been pooled for the configured lifetime.
+        struct credit_pool_entry
+        {
+            std::int64_t credits_ = 0;
+            bool used_ = false;    // drawn from since the last flush
+            std::uint64_t expires_ = 0;    // time to return the credits [ns]
+        };
+        using credit_pool_type = std::map<naming::gid_type, credit_pool_entry>;
+
+        // the cache synchronizes concurrent accesses itself
         std::shared_ptr<gva_cache_type> gva_cache_;
 
         mutable mutex_type migrated_objects_mtx_;
@@ -86,6 +96,19 @@ namespace hpx { namespace agas {
 
         std::shared_ptr<refcnt_requests_type> refcnt_requests_;
 
+        // additional credits requested whenever an increment has to be sent
+        // to AGAS, kept in the credit pool (protected by refcnt_requests_mtx_)
+        std::int64_t const refcnt_credit_batch_;
+        credit_pool_type credit_pool_;
+
+        // maximal time credits are kept in the credit pool [ns]
+        std::uint64_t const refcnt_credit_lifetime_;
+
+        // minimal time between two periodic flushes of the buffered
+        // reference count requests [ns]
+        std::uint64_t const refcnt_flush_interval_;
+        std::atomic<std::uint64_t> next_refcnt_flush_;
+
         service_mode const service_type;
         runtime_mode const runtime_type;
 
@@ -176,10 +199,21 @@ namespace hpx { namespace agas {
         // FIXME: document (add comments)
         void garbage_collect(error_code& ec = throws);
 
+        /// Send the buffered reference count requests if the configured flush
+        /// interval (hpx.agas.refcnt_flush_interval) has elapsed since the
+        /// last periodic flush. Invoked from the background work of the
+        /// runtime.
+        void garbage_collect_periodic(error_code& ec = throws);
+
         std::int64_t synchronize_with_async_incref(
             hpx::future<std::int64_t> fut, hpx::id_type const& id,
             std::int64_t compensated_credit);
 
+        std::int64_t synchronize_with_pooled_incref(
+            hpx::future<std::int64_t> fut, naming::gid_type const& raw,
+            hpx::id_type const& id, std::int64_t credit,
+            std::int64_t pooled_credit);
+
         server::primary_namespace& get_local_primary_namespace_service()
         {
             return primary_ns_.get_service();
@@ -232,6 +266,13 @@ namespace hpx { namespace agas {
         void send_refcnt_requests(
             std::unique_lock<mutex_type>& l, error_code& ec = throws);
 
+        /// Turn the pooled credits into pending decrements. Entries drawn
+        /// from since the last call are kept unless \a all is set or their
+        /// lifetime has expired. Assumes that \a refcnt_requests_mtx_ is
+        /// locked.
+        void release_credit_pool_locked(
+            std::unique_lock<mutex_type>& l, bool all);
+
         /// Assumes that \a refcnt_requests_mtx_ is locked.
         void send_refcnt_requests_non_blocking(
             std::unique_lock<mutex_type>& l, error_code& ec);
@@ -1137,6 +1178,27 @@ namespace hpx { namespace agas {
         future<hpx::id_type> on_symbol_namespace_event(
             std::string const& name, bool call_for_past_events = false) const;
 
+        /// \brief Wait for a set of names with a common prefix to be bound.
+        ///
+        /// This function installs a single listener with each symbol
+        /// namespace instance responsible for some of the names instead of
+        /// one listener per name.
+        ///
+        /// \param prefix     [in] The common prefix of the global names to
+        ///                   wait for.
+        /// \param sequence_numbers [in] The names to wait for are made up
+        ///                   from the prefix followed by one of these numbers
+        ///                   (like the names generated for basenames).
+        ///
+        /// \returns  A future instance encapsulating the requested names and
+        ///           their global ids, taken at the point all of them were
+        ///           bound. Names unbound in the meantime are missing from
+        ///           the result.
+        ///
+        future<iterate_names_return_type> on_symbol_namespace_prefix_event(
+            std::string const& prefix,
+            std::vector<std::size_t> const& sequence_numbers) const;
+
         /// \warning This function is for internal use only. It is dangerous and
         ///          may break your code if you use it.
         void update_cache_entry(naming::gid_type const& gid, gva const& gva,
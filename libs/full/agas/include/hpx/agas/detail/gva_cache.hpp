@@ -0,0 +1,644 @@
+//  Copyright (c) 2011 Bryce Adelstein-Lelbach
+//  Copyright (c) 2011-2023 Hartmut Kaiser
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/agas_base/gva.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+#include <hpx/synchronization/detail/rw_spinlock.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <utility>
+
+namespace hpx::agas::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The key of an entry in the AGAS address resolution cache, a range of
+    // (stripped) global ids [first, last]. Overlapping keys compare equivalent,
+    // which allows to find the range containing a single id.
+    struct gva_cache_key
+    {    // {{{ gva_cache_key implementation
+    private:
+        using key_type = std::pair<naming::gid_type, naming::gid_type>;
+
+        key_type key_;
+
+    public:
+        gva_cache_key()
+          : key_()
+        {
+        }
+
+        explicit gva_cache_key(
+            naming::gid_type const& id, std::uint64_t count = 1)
+          : key_(naming::detail::get_stripped_gid(id),
+                naming::detail::get_stripped_gid(id) + (count - 1))
+        {
+            HPX_ASSERT(count);
+        }
+
+        naming::gid_type get_gid() const
+        {
+            return key_.first;
+        }
+
+        naming::gid_type get_last_gid() const
+        {
+            return key_.second;
+        }
+
+        std::uint64_t get_count() const
+        {
+            naming::gid_type const size = key_.second - key_.first;
+            HPX_ASSERT(size.get_msb() == 0);
+            return size.get_lsb();
+        }
+
+        friend bool operator<(
+            gva_cache_key const& lhs, gva_cache_key const& rhs)
+        {
+            return lhs.key_.second < rhs.key_.first;
+        }
+
+        friend bool operator==(
+            gva_cache_key const& lhs, gva_cache_key const& rhs)
+        {
+            // Direct hit
+            if (lhs.key_ == rhs.key_)
+            {
+                return true;
+            }
+
+            // Is lhs in rhs?
+            if (1 == lhs.get_count() && 1 != rhs.get_count())
+            {
+                return rhs.key_.first <= lhs.key_.first &&
+                    lhs.key_.second <= rhs.key_.second;
+            }
+
+            // Is rhs in lhs?
+            else if (1 != lhs.get_count() && 1 == rhs.get_count())
+            {
+                return lhs.key_.first <= rhs.key_.first &&
+                    rhs.key_.second <= lhs.key_.second;
+            }
+
+            return false;
+        }
+    };    // }}}
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The AGAS address resolution cache. The cached ranges of global ids are
+    // distributed over a number of independently locked shards, a single id
+    // is always looked up in the shard owning the block of ids it belongs to.
+    // A range spanning several blocks is stored in all shards owning one of
+    // its blocks (or in all shards if it spans more blocks than there are
+    // shards). Lookups take the shard lock in shared mode only, entries are
+    // evicted using the CLOCK (second chance) approximation of LRU.
+    class gva_cache
+    {
+    public:
+        HPX_NON_COPYABLE(gva_cache);
+
+    public:
+        using key_type = gva_cache_key;
+        using entry_type = gva;
+        using size_type = std::size_t;
+
+        // blocks of 2^block_bits consecutive ids are owned by the same shard
+        static constexpr std::uint64_t block_bits = 4;
+
+    private:
+        using mutex_type = hpx::detail::rw_spinlock;
+
+        struct cache_entry
+        {
+            explicit cache_entry(entry_type const& value)
+              : value_(value)
+              , referenced_(true)
+            {
+            }
+
+            entry_type value_;
+
+            // set by readers, cleared by the CLOCK hand while evicting
+            mutable std::atomic<bool> referenced_;
+        };
+
+        using map_type = std::map<key_type, cache_entry>;
+
+        enum class method : std::uint8_t
+        {
+            get_entry = 0,
+            insert_entry = 1,
+            update_entry = 2,
+            erase_entry = 3
+        };
+
+        struct api_counter_data
+        {
+            std::atomic<std::int64_t> count_{0};
+            std::atomic<std::int64_t> time_{0};
+        };
+
+        struct shard
+        {
+            bool lookup(key_type const& key, key_type& realkey,
+                entry_type& entry) const
+            {
+                std::shared_lock<mutex_type> l(mtx_);
+
+                auto it = entries_.find(key);
+                if (it == entries_.end())
+                    return false;
+
+                // avoid writing to the entry if it is marked already
+                if (!it->second.referenced_.load(std::memory_order_relaxed))
+                {
+                    it->second.referenced_.store(
+                        true, std::memory_order_relaxed);
+                }
+
+                realkey = it->first;
+                entry = it->second.value_;
+                return true;
+            }
+
+            // the functions below have to be called with the lock held in
+            // exclusive mode
+            void insert_nonexist(key_type const& key, entry_type const& entry)
+            {
+                entries_.emplace(key, entry);
+                insertions_.fetch_add(1, std::memory_order_relaxed);
+
+                // Do we need to evict a cache entry?
+                while (entries_.size() > max_size_)
+                {
+                    evict();
+                }
+            }
+
+            void evict()
+            {
+                HPX_ASSERT(!entries_.empty());
+                for (;;)
+                {
+                    if (hand_ == entries_.end())
+                        hand_ = entries_.begin();
+
+                    // give recently used entries a second chance
+                    if (hand_->second.referenced_.exchange(
+                            false, std::memory_order_relaxed))
+                    {
+                        ++hand_;
+                        continue;
+                    }
+
+                    hand_ = entries_.erase(hand_);
+                    evictions_.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+            }
+
+            typename map_type::iterator erase(
+                typename map_type::iterator it)
+            {
+                // keep the CLOCK hand valid
+                if (hand_ == it)
+                {
+                    hand_ = entries_.erase(it);
+                    return hand_;
+                }
+                return entries_.erase(it);
+            }
+
+            mutable mutex_type mtx_;
+            map_type entries_;
+            typename map_type::iterator hand_ = entries_.end();
+            size_type max_size_ = 0;
+
+            // statistics
+            mutable std::atomic<std::int64_t> hits_{0};
+            mutable std::atomic<std::int64_t> misses_{0};
+            std::atomic<std::int64_t> insertions_{0};
+            std::atomic<std::int64_t> evictions_{0};
+            mutable api_counter_data api_counters_[4];
+        };
+
+        using shard_type = util::cache_aligned_data_derived<shard>;
+
+        // Helper class to update timings and counts on function exit
+        struct update_on_exit
+        {
+            static std::int64_t now() noexcept
+            {
+                std::chrono::nanoseconds const ns =
+                    std::chrono::steady_clock::now().time_since_epoch();
+                return static_cast<std::int64_t>(ns.count());
+            }
+
+            update_on_exit(shard const& s, method m) noexcept
+              : started_at_(now())
+              , data_(s.api_counters_[static_cast<std::size_t>(m)])
+            {
+            }
+
+            ~update_on_exit()
+            {
+                data_.time_.fetch_add(
+                    now() - started_at_, std::memory_order_relaxed);
+                data_.count_.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            std::int64_t started_at_;
+            api_counter_data& data_;
+        };
+
+        static size_type default_num_shards() noexcept
+        {
+            size_type const concurrency = (std::max)(
+                static_cast<size_type>(std::thread::hardware_concurrency()),
+                size_type(1));
+
+            size_type num_shards = 1;
+            while (num_shards < concurrency && num_shards < 64)
+                num_shards *= 2;
+            return num_shards;
+        }
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Construct an (empty) instance of a gva_cache.
+        ///
+        /// \param num_shards [in] The number of shards to use, will be
+        ///                   rounded up to the next power of two. The default
+        ///                   (zero) selects the number of shards based on the
+        ///                   number of cores of the system.
+        explicit gva_cache(size_type num_shards = 0)
+        {
+            if (num_shards == 0)
+                num_shards = default_num_shards();
+
+            num_shards_ = 1;
+            while (num_shards_ < num_shards)
+                num_shards_ *= 2;
+
+            shards_.reset(new shard_type[num_shards_]);
+        }
+
+        ~gva_cache() = default;
+
+        [[nodiscard]] size_type num_shards() const noexcept
+        {
+            return num_shards_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Return the number of entries held by all shards. Ranges
+        ///        stored in more than one shard are counted once per shard.
+        [[nodiscard]] size_type size() const
+        {
+            size_type size = 0;
+            for (shard const& s : shards())
+            {
+                std::shared_lock<mutex_type> l(s.mtx_);
+                size += s.entries_.size();
+            }
+            return size;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Change the maximum number of entries this cache can grow
+        ///        to. The capacity is divided evenly between the shards.
+        void reserve(size_type max_size)
+        {
+            size_type const shard_size =
+                (max_size + num_shards_ - 1) / num_shards_;
+
+            for (shard& s : shards())
+            {
+                std::lock_guard<mutex_type> l(s.mtx_);
+                s.max_size_ = shard_size;
+                while (s.entries_.size() > s.max_size_)
+                {
+                    s.evict();
+                }
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get the entry holding the given key.
+        ///
+        /// \param key     [in] The key for the entry which should be retrieved
+        ///               from the cache.
+        /// \param realkey[out] Return the full real key found in the cache
+        /// \param entry  [out] If the entry indexed by the key is found in the
+        ///               cache this value on successful return will be a copy
+        ///               of the corresponding entry.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool get_entry(
+            key_type const& key, key_type& realkey, entry_type& entry) const
+        {
+            shard const& s = home_shard(key);
+            update_on_exit update(s, method::get_entry);
+
+            if (!s.lookup(key, realkey, entry))
+            {
+                s.misses_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+
+            s.hits_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Insert a new entry into this cache, returns \a false if an
+        ///        entry overlapping with the given key is held already.
+        bool insert(key_type const& key, entry_type const& entry)
+        {
+            update_on_exit update(home_shard(key), method::insert_entry);
+
+            bool inserted = true;
+            for_each_shard(key, [&](shard& s) {
+                std::lock_guard<mutex_type> l(s.mtx_);
+                if (s.entries_.find(key) != s.entries_.end())
+                {
+                    inserted = false;
+                    return;
+                }
+                s.insert_nonexist(key, entry);
+            });
+            return inserted;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache, or insert it if
+        ///        it is not held by the cache.
+        ///
+        /// \param f      [in] A callable taking two arguments, \a key and the
+        ///               key found in the cache (in that order). If \a f
+        ///               returns true, the update will not succeed.
+        ///
+        /// \returns      This function returns \a true if the entry has been
+        ///               successfully updated (or inserted) in all shards
+        ///               holding it, otherwise it returns \a false.
+        template <typename F>
+        bool update_if(key_type const& key, entry_type const& entry, F&& f)
+        {
+            shard& home = home_shard(key);
+            update_on_exit update(home, method::update_entry);
+
+            bool hit = false;
+            bool updated = true;
+            for_each_shard(key, [&](shard& s) {
+                std::lock_guard<mutex_type> l(s.mtx_);
+
+                auto it = s.entries_.find(key);
+                if (it == s.entries_.end())
+                {
+                    s.insert_nonexist(key, entry);
+                    return;
+                }
+
+                if (f(key, it->first))
+                {
+                    updated = false;
+                    return;
+                }
+
+                hit = true;
+                it->second.value_ = entry;
+                it->second.referenced_.store(true, std::memory_order_relaxed);
+            });
+
+            if (hit)
+                home.hits_.fetch_add(1, std::memory_order_relaxed);
+            else
+                home.misses_.fetch_add(1, std::memory_order_relaxed);
+
+            return updated;
+        }
+
+        void update(key_type const& key, entry_type const& entry)
+        {
+            update_if(key, entry,
+                [](key_type const&, key_type const&) { return false; });
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Remove all entries from the cache for which the supplied
+        ///        predicate returns true. The predicate is invoked with a
+        ///        std::pair<key_type, entry_type>.
+        ///
+        /// \returns      The number of removed shard entries.
+        template <typename Func>
+        size_type erase(Func const& ep)
+        {
+            update_on_exit update(shards_[0], method::erase_entry);
+
+            size_type erased = 0;
+            for (shard& s : shards())
+            {
+                std::lock_guard<mutex_type> l(s.mtx_);
+                for (auto it = s.entries_.begin(); it != s.entries_.end();)
+                {
+                    if (ep(std::pair<key_type, entry_type>(
+                            it->first, it->second.value_)))
+                    {
+                        it = s.erase(it);
+                        s.evictions_.fetch_add(1, std::memory_order_relaxed);
+                        ++erased;
+                    }
+                    else
+                    {
+                        ++it;
+                    }
+                }
+            }
+            return erased;
+        }
+
+        /// \brief Unconditionally removes all stored entries from the cache
+        size_type clear()
+        {
+            size_type erased = 0;
+            for (shard& s : shards())
+            {
+                std::lock_guard<mutex_type> l(s.mtx_);
+                erased += s.entries_.size();
+                s.entries_.clear();
+                s.hand_ = s.entries_.end();
+            }
+            return erased;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // statistics, accumulated over all shards
+        [[nodiscard]] std::int64_t hits(bool reset) noexcept
+        {
+            return accumulate(&shard::hits_, reset);
+        }
+        [[nodiscard]] std::int64_t misses(bool reset) noexcept
+        {
+            return accumulate(&shard::misses_, reset);
+        }
+        [[nodiscard]] std::int64_t insertions(bool reset) noexcept
+        {
+            return accumulate(&shard::insertions_, reset);
+        }
+        [[nodiscard]] std::int64_t evictions(bool reset) noexcept
+        {
+            return accumulate(&shard::evictions_, reset);
+        }
+
+        [[nodiscard]] std::int64_t get_get_entry_count(bool reset) noexcept
+        {
+            return accumulate(method::get_entry, &api_counter_data::count_,
+                reset);
+        }
+        [[nodiscard]] std::int64_t get_insert_entry_count(bool reset) noexcept
+        {
+            return accumulate(method::insert_entry,
+                &api_counter_data::count_, reset);
+        }
+        [[nodiscard]] std::int64_t get_update_entry_count(bool reset) noexcept
+        {
+            return accumulate(method::update_entry,
+                &api_counter_data::count_, reset);
+        }
+        [[nodiscard]] std::int64_t get_erase_entry_count(bool reset) noexcept
+        {
+            return accumulate(method::erase_entry, &api_counter_data::count_,
+                reset);
+        }
+
+        [[nodiscard]] std::int64_t get_get_entry_time(bool reset) noexcept
+        {
+            return accumulate(method::get_entry, &api_counter_data::time_,
+                reset);
+        }
+        [[nodiscard]] std::int64_t get_insert_entry_time(bool reset) noexcept
+        {
+            return accumulate(method::insert_entry, &api_counter_data::time_,
+                reset);
+        }
+        [[nodiscard]] std::int64_t get_update_entry_time(bool reset) noexcept
+        {
+            return accumulate(method::update_entry, &api_counter_data::time_,
+                reset);
+        }
+        [[nodiscard]] std::int64_t get_erase_entry_time(bool reset) noexcept
+        {
+            return accumulate(method::erase_entry, &api_counter_data::time_,
+                reset);
+        }
+
+    private:
+        struct shard_range
+        {
+            shard_type* begin_;
+            shard_type* end_;
+
+            shard_type* begin() const noexcept
+            {
+                return begin_;
+            }
+            shard_type* end() const noexcept
+            {
+                return end_;
+            }
+        };
+
+        shard_range shards() const noexcept
+        {
+            return {shards_.get(), shards_.get() + num_shards_};
+        }
+
+        size_type get_shard_index(
+            std::uint64_t msb, std::uint64_t block) const noexcept
+        {
+            // the locality id is stored in the upper half of the msb
+            return static_cast<size_type>((msb ^ (msb >> 32)) + block) &
+                (num_shards_ - 1);
+        }
+
+        shard& home_shard(key_type const& key) const noexcept
+        {
+            naming::gid_type const& id = key.get_gid();
+            return shards_[get_shard_index(
+                id.get_msb(), id.get_lsb() >> block_bits)];
+        }
+
+        template <typename F>
+        void for_each_shard(key_type const& key, F&& f)
+        {
+            naming::gid_type const first = key.get_gid();
+            naming::gid_type const last = key.get_last_gid();
+
+            std::uint64_t const first_block = first.get_lsb() >> block_bits;
+            std::uint64_t const last_block = last.get_lsb() >> block_bits;
+
+            if (first.get_msb() != last.get_msb() ||
+                last_block - first_block >= num_shards_)
+            {
+                for (shard& s : shards())
+                    f(s);
+                return;
+            }
+
+            for (std::uint64_t block = first_block; block <= last_block;
+                 ++block)
+            {
+                f(shards_[get_shard_index(first.get_msb(), block)]);
+            }
+        }
+
+        std::int64_t accumulate(
+            std::atomic<std::int64_t> shard::*value, bool reset) noexcept
+        {
+            std::int64_t result = 0;
+            for (shard& s : shards())
+                result += util::get_and_reset_value(s.*value, reset);
+            return result;
+        }
+
+        std::int64_t accumulate(method m,
+            std::atomic<std::int64_t> api_counter_data::*value,
+            bool reset) noexcept
+        {
+            std::int64_t result = 0;
+            for (shard& s : shards())
+            {
+                result += util::get_and_reset_value(
+                    s.api_counters_[static_cast<std::size_t>(m)].*value,
+                    reset);
+            }
+            return result;
+        }
+
+    private:
+        size_type num_shards_;
+        std::unique_ptr<shard_type[]> shards_;
+    };
+}    // namespace hpx::agas::detail
@@ -33,10 +33,13 @@
 #include <hpx/serialization/vector.hpp>
 #include <hpx/thread_support/assert_owns_lock.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
 #include <hpx/type_support/unused.hpp>
 #include <hpx/util/get_entry_as.hpp>
 #include <hpx/util/insert_checked.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -51,72 +54,6 @@
 
 namespace hpx { namespace agas {
 
-    struct addressing_service::gva_cache_key
-    {    // {{{ gva_cache_key implementation
-    private:
-        using key_type = std::pair<naming::gid_type, naming::gid_type>;
-
-        key_type key_;
-
-    public:
-        gva_cache_key()
-          : key_()
-        {
-        }
-
-        explicit gva_cache_key(
-            naming::gid_type const& id, std::uint64_t count = 1)
-          : key_(naming::detail::get_stripped_gid(id),
-                naming::detail::get_stripped_gid(id) + (count - 1))
-        {
-            HPX_ASSERT(count);
-        }
-
-        naming::gid_type get_gid() const
-        {
-            return key_.first;
-        }
-
-        std::uint64_t get_count() const
-        {
-            naming::gid_type const size = key_.second - key_.first;
-            HPX_ASSERT(size.get_msb() == 0);
-            return size.get_lsb();
-        }
-
-        friend bool operator<(
-            gva_cache_key const& lhs, gva_cache_key const& rhs)
-        {
-            return lhs.key_.second < rhs.key_.first;
-        }
-
-        friend bool operator==(
-            gva_cache_key const& lhs, gva_cache_key const& rhs)
-        {
-            // Direct hit
-            if (lhs.key_ == rhs.key_)
-            {
-                return true;
-            }
-
-            // Is lhs in rhs?
-            if (1 == lhs.get_count() && 1 != rhs.get_count())
-            {
-                return rhs.key_.first <= lhs.key_.first &&
-                    lhs.key_.second <= rhs.key_.second;
-            }
-
-            // Is rhs in lhs?
-            else if (1 != lhs.get_count() && 1 == rhs.get_count())
-            {
-                return lhs.key_.first <= rhs.key_.first &&
-                    rhs.key_.second <= lhs.key_.second;
-            }
-
-            return false;
-        }
-    };
-
     addressing_service::addressing_service(
         util::runtime_configuration const& ini_)
       : gva_cache_(new gva_cache_type)
@@ -125,6 +62,17 @@ namespace hpx { namespace agas {
       , refcnt_requests_count_(0)
       , enable_refcnt_caching_(true)
       , refcnt_requests_(new refcnt_requests_type)
+      , refcnt_credit_batch_(static_cast<std::int64_t>(
+                                 HPX_GLOBALCREDIT_INITIAL) *
+            hpx::util::get_entry_as<std::int64_t>(
+                ini_, "hpx.agas.refcnt_credit_batch", 8))
+      , refcnt_credit_lifetime_(1000 *
+            hpx::util::get_entry_as<std::uint64_t>(
+                ini_, "hpx.agas.refcnt_credit_lifetime", 10000))
+      , refcnt_flush_interval_(1000 *
+            hpx::util::get_entry_as<std::uint64_t>(
+                ini_, "hpx.agas.refcnt_flush_interval", 1000))
+      , next_refcnt_flush_(0)
       , service_type(ini_.get_agas_service_mode())
       , runtime_type(ini_.mode_)
       , caching_(ini_.get_agas_caching_mode())
@@ -1258,6 +1206,37 @@ namespace hpx { namespace agas {
         return fut.get() + compensated_credit;
     }
 
+    // The parameter 'pooled_credit' holds the amount of credits requested in
+    // addition to the incref, which are added to the credit pool once AGAS has
+    // acknowledged them. The parameter 'credit' holds the amount of credits
+    // the caller asked for.
+    std::int64_t addressing_service::synchronize_with_pooled_incref(
+        hpx::future<std::int64_t> fut, naming::gid_type const& raw,
+        hpx::id_type const&, std::int64_t credit, std::int64_t pooled_credit)
+    {
+        fut.get();    // rethrows errors
+
+        std::unique_lock<mutex_type> l(refcnt_requests_mtx_);
+        if (enable_refcnt_caching_)
+        {
+            credit_pool_entry& entry = credit_pool_[raw];
+            if (entry.credits_ == 0)
+            {
+                entry.expires_ = hpx::chrono::high_resolution_clock::now() +
+                    refcnt_credit_lifetime_;
+            }
+            entry.credits_ += pooled_credit;
+        }
+        else
+        {
+            // we're shutting down, return the additional credits right away
+            (*refcnt_requests_)[raw] -= pooled_credit;
+            send_refcnt_requests(l);
+        }
+
+        return credit;
+    }
+
     hpx::future<std::int64_t> addressing_service::incref_async(
         naming::gid_type const& id, std::int64_t credit,
         hpx::id_type const& keep_alive)
@@ -1299,6 +1278,8 @@ namespace hpx { namespace agas {
         std::pair<naming::gid_type, std::int64_t> pending_incref;
         bool has_pending_incref = false;
         std::int64_t pending_decrefs = 0;
+        std::int64_t pooled_credit = 0;
+        bool served_from_pool = false;
 
         {
             std::lock_guard<mutex_type> l(refcnt_requests_mtx_);
@@ -1342,6 +1323,38 @@ namespace hpx { namespace agas {
                 pending_incref = mapping(raw, credit);
                 has_pending_incref = true;
             }
+
+            // Serve the remaining incref from the credits AGAS has granted
+            // in advance, if any.
+            if (has_pending_incref)
+            {
+                credit_pool_type::iterator pooled = credit_pool_.find(raw);
+                if (pooled != credit_pool_.end())
+                {
+                    std::int64_t const taken = (std::min)(
+                        pooled->second.credits_, pending_incref.second);
+
+                    pooled->second.credits_ -= taken;
+                    pooled->second.used_ = true;
+                    if (pooled->second.credits_ == 0)
+                        credit_pool_.erase(pooled);
+
+                    pending_incref.second -= taken;
+                    has_pending_incref = pending_incref.second != 0;
+                    served_from_pool = !has_pending_incref;
+                }
+            }
+
+            // Ask AGAS for an additional batch of credits to serve future
+            // increments locally.
+            if (has_pending_incref && enable_refcnt_caching_)
+                pooled_credit = refcnt_credit_batch_;
+        }
+
+        if (served_from_pool)
+        {
+            // the pooled credits cover the incref, acknowledge it immediately
+            return hpx::make_ready_future(credit);
         }
 
         if (!has_pending_incref)
@@ -1353,10 +1366,18 @@ namespace hpx { namespace agas {
         naming::gid_type const e_lower = pending_incref.first;
 
         hpx::future<std::int64_t> f = primary_ns_.increment_credit(
-            pending_incref.second, e_lower, e_lower);
+            pending_incref.second + pooled_credit, e_lower, e_lower);
 
         // pass the amount of compensated decrefs to the callback
         using placeholders::_1;
+        if (pooled_credit != 0)
+        {
+            return f.then(hpx::launch::sync,
+                util::one_shot(hpx::bind(
+                    &addressing_service::synchronize_with_pooled_incref, this,
+                    _1, raw, keep_alive, credit, pooled_credit)));
+        }
+
         return f.then(hpx::launch::sync,
             util::one_shot(
                 hpx::bind(&addressing_service::synchronize_with_async_incref,
@@ -1574,6 +1595,14 @@ namespace hpx { namespace agas {
                 &detail::on_register_event, HPX_MOVE(result_f))));
     }
 
+    hpx::future<addressing_service::iterate_names_return_type>
+    addressing_service::on_symbol_namespace_prefix_event(
+        std::string const& prefix,
+        std::vector<std::size_t> const& sequence_numbers) const
+    {
+        return symbol_ns_.on_prefix_event(prefix, sequence_numbers);
+    }
+
     // Return all matching entries in the symbol namespace
     hpx::future<addressing_service::iterate_names_return_type>
     addressing_service::iterate_ids(std::string const& pattern) const
@@ -1652,27 +1681,17 @@ namespace hpx { namespace agas {
 
             const gva_cache_key key(gid, count);
 
+            if (!gva_cache_->update_if(key, g, check_for_collisions))
             {
-                std::unique_lock<mutex_type> lock(gva_cache_mtx_);
-                if (!gva_cache_->update_if(key, g, check_for_collisions))
+                if (LAGAS_ENABLED(warning))
                 {
-                    if (LAGAS_ENABLED(warning))
-                    {
-                        // Figure out who we collided with.
-                        addressing_service::gva_cache_key idbase;
-                        addressing_service::gva_cache_type::entry_type e;
-
-                        if (!gva_cache_->get_entry(key, idbase, e))
-                        {
-                            // This is impossible under sane conditions.
-                            lock.unlock();
-                            HPX_THROWS_IF(ec, hpx::error::invalid_data,
-                                "addressing_service::update_cache_entry",
-                                "data corruption or lock error occurred in "
-                                "cache");
-                            return;
-                        }
+                    // Figure out who we collided with.
+                    addressing_service::gva_cache_key idbase;
+                    addressing_service::gva_cache_type::entry_type e;
 
+                    // The colliding entry may have been evicted concurrently.
+                    if (gva_cache_->get_entry(key, idbase, e))
+                    {
                         LAGAS_(warning).format(
                             "addressing_service::update_cache_entry, aborting "
                             "update due to key collision in cache, "
@@ -1703,7 +1722,6 @@ namespace hpx { namespace agas {
         gva_cache_key k(gid);
         gva_cache_key idbase_key;
 
-        std::unique_lock<mutex_type> lock(gva_cache_mtx_);
         if (gva_cache_->get_entry(k, idbase_key, gva))
         {
             const std::uint64_t id_msb =
@@ -1711,7 +1729,6 @@ namespace hpx { namespace agas {
 
             if (HPX_UNLIKELY(id_msb != idbase_key.get_gid().get_msb()))
             {
-                lock.unlock();
                 HPX_THROWS_IF(ec, hpx::error::internal_server_error,
                     "addressing_service::get_cache_entry",
                     "bad entry in cache, MSBs of GID base and GID do not "
@@ -1740,8 +1757,6 @@ namespace hpx { namespace agas {
             LAGAS_(warning).format(
                 "addressing_service::clear_cache, clearing cache");
 
-            std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-
             gva_cache_->clear();
 
             if (&ec != &throws)
@@ -1787,8 +1802,6 @@ namespace hpx { namespace agas {
         {
             LAGAS_(warning).format("addressing_service::remove_cache_entry");
 
-            std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-
             gva_cache_->erase([&gid](std::pair<gva_cache_key, gva> const& p) {
                 return gid == p.first.get_gid();
             });
@@ -1811,6 +1824,7 @@ namespace hpx { namespace agas {
 
         std::unique_lock<mutex_type> l(refcnt_requests_mtx_);
         enable_refcnt_caching_ = false;
+        release_credit_pool_locked(l, true);
         send_refcnt_requests_sync(l, ec);
     }
 
@@ -1818,88 +1832,75 @@ namespace hpx { namespace agas {
     // Helper functions to access the current cache statistics
     std::uint64_t addressing_service::get_cache_entries(bool /* reset */) const
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
         return gva_cache_->size();
     }
 
     std::uint64_t addressing_service::get_cache_hits(bool reset) const
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().hits(reset);
+        return gva_cache_->hits(reset);
     }
 
     std::uint64_t addressing_service::get_cache_misses(bool reset) const
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().misses(reset);
+        return gva_cache_->misses(reset);
     }
 
     std::uint64_t addressing_service::get_cache_evictions(bool reset) const
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().evictions(reset);
+        return gva_cache_->evictions(reset);
     }
 
     std::uint64_t addressing_service::get_cache_insertions(bool reset) const
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().insertions(reset);
+        return gva_cache_->insertions(reset);
     }
 
     ///////////////////////////////////////////////////////////////////////////
     std::uint64_t addressing_service::get_cache_get_entry_count(
         bool reset) const
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_get_entry_count(reset);
+        return gva_cache_->get_get_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_insertion_entry_count(
         bool reset) const
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_insert_entry_count(reset);
+        return gva_cache_->get_insert_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_update_entry_count(
         bool reset) const
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_update_entry_count(reset);
+        return gva_cache_->get_update_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_erase_entry_count(
         bool reset) const
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_erase_entry_count(reset);
+        return gva_cache_->get_erase_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_get_entry_time(bool reset) const
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_get_entry_time(reset);
+        return gva_cache_->get_get_entry_time(reset);
     }
 
     std::uint64_t addressing_service::get_cache_insertion_entry_time(
         bool reset) const
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_insert_entry_time(reset);
+        return gva_cache_->get_insert_entry_time(reset);
     }
 
     std::uint64_t addressing_service::get_cache_update_entry_time(
         bool reset) const
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_update_entry_time(reset);
+        return gva_cache_->get_update_entry_time(reset);
     }
 
     std::uint64_t addressing_service::get_cache_erase_entry_time(
         bool reset) const
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_erase_entry_time(reset);
+        return gva_cache_->get_erase_entry_time(reset);
     }
 
     void addressing_service::register_server_instances()
@@ -1919,6 +1920,7 @@ namespace hpx { namespace agas {
         if (!l.owns_lock())
             return;    // no need to compete for garbage collection
 
+        release_credit_pool_locked(l, true);
         send_refcnt_requests_non_blocking(l, ec);
     }
 
@@ -1928,9 +1930,56 @@ namespace hpx { namespace agas {
         if (!l.owns_lock())
             return;    // no need to compete for garbage collection
 
+        release_credit_pool_locked(l, true);
         send_refcnt_requests_sync(l, ec);
     }
 
+    void addressing_service::garbage_collect_periodic(error_code& ec)
+    {
+        std::uint64_t const now = hpx::chrono::high_resolution_clock::now();
+        if (now < next_refcnt_flush_.load(std::memory_order_relaxed))
+            return;    // the next flush is not due yet
+
+        std::unique_lock<mutex_type> l(refcnt_requests_mtx_, std::try_to_lock);
+        if (!l.owns_lock())
+            return;    // no need to compete for garbage collection
+
+        next_refcnt_flush_.store(
+            now + refcnt_flush_interval_, std::memory_order_relaxed);
+
+        release_credit_pool_locked(l, false);
+        send_refcnt_requests_non_blocking(l, ec);
+    }
+
+    void addressing_service::release_credit_pool_locked(
+        std::unique_lock<addressing_service::mutex_type>& l, bool all)
+    {
+        HPX_ASSERT_OWNS_LOCK(l);
+
+        if (credit_pool_.empty())
+            return;
+
+        std::uint64_t const now = hpx::chrono::high_resolution_clock::now();
+        for (credit_pool_type::iterator it = credit_pool_.begin();
+             it != credit_pool_.end();
+            /**/)
+        {
+            // keep the credits for objects which are still being referenced,
+            // but not for longer than their lifetime to not delay the
+            // destruction of the objects indefinitely
+            if (!all && it->second.used_ && now < it->second.expires_)
+            {
+                it->second.used_ = false;
+                ++it;
+                continue;
+            }
+
+            HPX_ASSERT(it->second.credits_ > 0);
+            (*refcnt_requests_)[it->first] -= it->second.credits_;
+            it = credit_pool_.erase(it);
+        }
+    }
+
     void addressing_service::send_refcnt_requests(
         std::unique_lock<addressing_service::mutex_type>& l, error_code& ec)
     {
@@ -1944,7 +1993,10 @@ namespace hpx { namespace agas {
 
         if (!enable_refcnt_caching_ ||
             max_refcnt_requests_ == ++refcnt_requests_count_)
+        {
+            release_credit_pool_locked(l, !enable_refcnt_caching_);
             send_refcnt_requests_non_blocking(l, ec);
+        }
 
         else if (&ec != &throws)
             ec = make_success_code();
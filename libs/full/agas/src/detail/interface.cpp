@@ -436,6 +436,14 @@ namespace hpx::agas::detail::impl {
             name, call_for_past_events);
     }
 
+    hpx::future<symbol_namespace::iterate_names_return_type>
+    on_symbol_namespace_prefix_event(std::string const& prefix,
+        std::vector<std::size_t> const& sequence_numbers)
+    {
+        return naming::get_agas_client().on_symbol_namespace_prefix_event(
+            prefix, sequence_numbers);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     hpx::future<std::pair<hpx::id_type, naming::address>> begin_migration(
         hpx::id_type const& id)
@@ -611,6 +619,8 @@ namespace hpx::agas {
 
             detail::on_symbol_namespace_event =
                 &detail::impl::on_symbol_namespace_event;
+            detail::on_symbol_namespace_prefix_event =
+                &detail::impl::on_symbol_namespace_prefix_event;
 
             detail::begin_migration = &detail::impl::begin_migration;
             detail::end_migration = &detail::impl::end_migration;
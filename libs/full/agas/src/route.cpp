@@ -54,7 +54,7 @@ namespace hpx::agas::server {
         // resolve destination addresses, we should be able to resolve all of
         // them, otherwise it's an error
         {
-            std::unique_lock<mutex_type> l(mutex_);
+            std::unique_lock<mutex_type> l(get_shard(gid).mutex_);
 
             error_code& ec = throws;
 
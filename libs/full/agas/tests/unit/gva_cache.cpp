@@ -0,0 +1,301 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <hpx/agas/detail/gva_cache.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using hpx::agas::gva;
+using hpx::agas::detail::gva_cache;
+using hpx::naming::gid_type;
+
+using key_type = gva_cache::key_type;
+
+// the ids of a locality, blocks of 16 consecutive ids are owned by the same
+// shard
+std::uint64_t const msb = std::uint64_t(2) << 32;
+std::uint64_t const block_size = std::uint64_t(1) << gva_cache::block_bits;
+
+///////////////////////////////////////////////////////////////////////////////
+gva make_gva(std::uint64_t lva, std::uint64_t count = 1)
+{
+    return gva(gid_type(msb, std::uint64_t(0)),
+        hpx::components::component_base_lco_with_value, count, lva);
+}
+
+bool lookup(gva_cache const& cache, std::uint64_t lsb, key_type& realkey,
+    gva& entry)
+{
+    return cache.get_entry(key_type(gid_type(msb, lsb)), realkey, entry);
+}
+
+bool lookup(gva_cache const& cache, std::uint64_t lsb)
+{
+    key_type realkey;
+    gva entry;
+    return lookup(cache, lsb, realkey, entry);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_num_shards()
+{
+    HPX_TEST_EQ(gva_cache(1).num_shards(), std::size_t(1));
+    HPX_TEST_EQ(gva_cache(4).num_shards(), std::size_t(4));
+    HPX_TEST_EQ(gva_cache(5).num_shards(), std::size_t(8));
+    HPX_TEST_LTE(std::size_t(1), gva_cache().num_shards());
+}
+
+// single ids of consecutive blocks are spread over all shards
+void test_insert_lookup()
+{
+    gva_cache cache(4);
+    cache.reserve(1024);
+
+    std::uint64_t const count = 16 * block_size;
+    for (std::uint64_t i = 0; i != count; ++i)
+    {
+        HPX_TEST(cache.insert(key_type(gid_type(msb, i)), make_gva(i + 1)));
+    }
+    HPX_TEST_EQ(cache.size(), count);
+    HPX_TEST_EQ(cache.insertions(true), std::int64_t(count));
+
+    // an id can't be inserted twice
+    HPX_TEST(!cache.insert(
+        key_type(gid_type(msb, std::uint64_t(0))), make_gva(42)));
+    HPX_TEST_EQ(cache.size(), count);
+
+    for (std::uint64_t i = 0; i != count; ++i)
+    {
+        key_type realkey;
+        gva entry;
+        HPX_TEST(lookup(cache, i, realkey, entry));
+        HPX_TEST_EQ(realkey.get_gid(), gid_type(msb, i));
+        HPX_TEST_EQ(entry, make_gva(i + 1));
+    }
+    HPX_TEST_EQ(cache.hits(true), std::int64_t(count));
+
+    HPX_TEST(!lookup(cache, count));
+    HPX_TEST_EQ(cache.misses(true), std::int64_t(1));
+    HPX_TEST_EQ(cache.get_get_entry_count(true), std::int64_t(count + 1));
+
+    HPX_TEST_EQ(cache.clear(), count);
+    HPX_TEST_EQ(cache.size(), std::size_t(0));
+    HPX_TEST(!lookup(cache, 0));
+}
+
+// a range is stored in each shard owning one of its blocks, any of its ids is
+// resolved from a single shard
+void test_ranges()
+{
+    gva_cache cache(4);
+    cache.reserve(1024);
+
+    // three blocks
+    std::uint64_t const first = 10 * block_size + 8;
+    std::uint64_t const count = 2 * block_size;
+    HPX_TEST(cache.insert(
+        key_type(gid_type(msb, first), count), make_gva(0x1000, count)));
+    HPX_TEST_EQ(cache.size(), std::size_t(3));
+
+    for (std::uint64_t i = first; i != first + count; ++i)
+    {
+        key_type realkey;
+        gva entry;
+        HPX_TEST(lookup(cache, i, realkey, entry));
+        HPX_TEST_EQ(realkey.get_gid(), gid_type(msb, first));
+        HPX_TEST_EQ(realkey.get_last_gid(), gid_type(msb, first + count - 1));
+        HPX_TEST_EQ(entry, make_gva(0x1000, count));
+    }
+    HPX_TEST(!lookup(cache, first - 1));
+    HPX_TEST(!lookup(cache, first + count));
+
+    // ids overlapping with the range can't be inserted
+    HPX_TEST(!cache.insert(key_type(gid_type(msb, first + 1)), make_gva(1)));
+
+    // a range spanning more blocks than there are shards is stored in all
+    // shards
+    std::uint64_t const large_first = 100 * block_size;
+    std::uint64_t const large_count = 10 * block_size;
+    HPX_TEST(cache.insert(key_type(gid_type(msb, large_first), large_count),
+        make_gva(0x2000, large_count)));
+    HPX_TEST_EQ(cache.size(), std::size_t(3 + 4));
+
+    for (std::uint64_t i = large_first; i != large_first + large_count; ++i)
+    {
+        HPX_TEST(lookup(cache, i));
+    }
+
+    // erasing a range removes it from all shards
+    std::size_t const erased =
+        cache.erase([&](std::pair<key_type, gva> const& p) {
+            return p.first.get_gid() == gid_type(msb, first);
+        });
+    HPX_TEST_EQ(erased, std::size_t(3));
+    HPX_TEST_EQ(cache.size(), std::size_t(4));
+
+    for (std::uint64_t i = first; i != first + count; ++i)
+    {
+        HPX_TEST(!lookup(cache, i));
+    }
+    HPX_TEST(lookup(cache, large_first));
+}
+
+void test_update_erase()
+{
+    gva_cache cache(4);
+    cache.reserve(1024);
+
+    std::uint64_t const count = 8 * block_size;
+    for (std::uint64_t i = 0; i != count; ++i)
+    {
+        cache.update(key_type(gid_type(msb, i)), make_gva(i + 1));
+    }
+    HPX_TEST_EQ(cache.size(), count);
+
+    // update existing entries
+    for (std::uint64_t i = 0; i != count; ++i)
+    {
+        cache.update(key_type(gid_type(msb, i)), make_gva(i + 100));
+    }
+    HPX_TEST_EQ(cache.size(), count);
+
+    // a rejected update leaves the entry unchanged
+    HPX_TEST(!cache.update_if(key_type(gid_type(msb, std::uint64_t(0))),
+        make_gva(42), [](key_type const&, key_type const&) { return true; }));
+
+    for (std::uint64_t i = 0; i != count; ++i)
+    {
+        key_type realkey;
+        gva entry;
+        HPX_TEST(lookup(cache, i, realkey, entry));
+        HPX_TEST_EQ(entry, make_gva(i + 100));
+    }
+
+    // erase every other entry, across all shards
+    std::size_t const erased =
+        cache.erase([](std::pair<key_type, gva> const& p) {
+            return p.first.get_gid().get_lsb() % 2 == 0;
+        });
+    HPX_TEST_EQ(erased, count / 2);
+    HPX_TEST_EQ(cache.size(), count / 2);
+
+    for (std::uint64_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(lookup(cache, i), i % 2 != 0);
+    }
+}
+
+// Each shard holds its share of the capacity, a shard evicts the entry not
+// used for the longest time (CLOCK) only once it is full.
+void test_eviction()
+{
+    gva_cache cache(4);
+    cache.reserve(8);
+
+    // the ids of a single block, all owned by the same shard
+    std::uint64_t const base = 4 * block_size;
+    HPX_TEST(cache.insert(key_type(gid_type(msb, base)), make_gva(1)));
+    HPX_TEST(cache.insert(key_type(gid_type(msb, base + 1)), make_gva(2)));
+
+    // other shards are not affected by this shard being full
+    for (std::uint64_t i = 1; i != 4; ++i)
+    {
+        HPX_TEST(cache.insert(
+            key_type(gid_type(msb, base + i * block_size)), make_gva(10 + i)));
+    }
+    HPX_TEST_EQ(cache.evictions(false), std::int64_t(0));
+
+    HPX_TEST(cache.insert(key_type(gid_type(msb, base + 2)), make_gva(3)));
+    HPX_TEST_EQ(cache.evictions(false), std::int64_t(1));
+    HPX_TEST_EQ(cache.size(), std::size_t(5));
+
+    HPX_TEST(!lookup(cache, base));
+    HPX_TEST(lookup(cache, base + 1));
+
+    // the recently used entry gets a second chance
+    HPX_TEST(cache.insert(key_type(gid_type(msb, base + 3)), make_gva(4)));
+    HPX_TEST_EQ(cache.evictions(false), std::int64_t(2));
+
+    HPX_TEST(lookup(cache, base + 1));
+    HPX_TEST(!lookup(cache, base + 2));
+    HPX_TEST(lookup(cache, base + 3));
+
+    for (std::uint64_t i = 1; i != 4; ++i)
+    {
+        HPX_TEST(lookup(cache, base + i * block_size));
+    }
+
+    // shrinking the cache evicts entries right away
+    cache.reserve(4);
+    HPX_TEST_EQ(cache.size(), std::size_t(4));
+    HPX_TEST_EQ(cache.evictions(true), std::int64_t(3));
+}
+
+// Insert, look up, and erase ids from many threads, each thread working on
+// its own ids spread over all shards.
+void test_concurrent(std::size_t num_tasks)
+{
+    gva_cache cache(8);
+
+    std::uint64_t const count = 32 * block_size;
+    cache.reserve(num_tasks * count);
+
+    std::vector<hpx::future<void>> tasks;
+    for (std::size_t t = 0; t != num_tasks; ++t)
+    {
+        tasks.push_back(hpx::async([&cache, t, count]() {
+            std::uint64_t const first = t * count;
+            for (std::uint64_t i = first; i != first + count; ++i)
+            {
+                HPX_TEST(
+                    cache.insert(key_type(gid_type(msb, i)), make_gva(i + 1)));
+            }
+
+            for (std::uint64_t i = first; i != first + count; ++i)
+            {
+                key_type realkey;
+                gva entry;
+                HPX_TEST(lookup(cache, i, realkey, entry));
+                HPX_TEST_EQ(entry, make_gva(i + 1));
+            }
+
+            cache.erase([first, count](std::pair<key_type, gva> const& p) {
+                std::uint64_t const lsb = p.first.get_gid().get_lsb();
+                return lsb >= first && lsb < first + count && lsb % 2 == 0;
+            });
+
+            for (std::uint64_t i = first; i != first + count; ++i)
+            {
+                HPX_TEST_EQ(lookup(cache, i), i % 2 != 0);
+            }
+        }));
+    }
+
+    hpx::wait_all(tasks);
+    HPX_TEST_EQ(cache.size(), num_tasks * count / 2);
+    HPX_TEST_EQ(cache.insertions(false), std::int64_t(num_tasks * count));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_num_shards();
+    test_insert_lookup();
+    test_ranges();
+    test_update_erase();
+    test_eviction();
+    test_concurrent(8);
+
+    return hpx::util::report_errors();
+}
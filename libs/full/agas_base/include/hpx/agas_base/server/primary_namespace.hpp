@@ -19,11 +19,14 @@
 #include <hpx/async_distributed/base_lco_with_value.hpp>
 #include <hpx/async_distributed/transfer_continuation_action.hpp>
 #include <hpx/components_base/server/fixed_component_base.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/naming_base/id_type.hpp>
 #include <hpx/parcelset_base/traits/action_get_embedded_parcel.hpp>
 #include <hpx/synchronization/condition_variable.hpp>
+#include <hpx/synchronization/detail/rw_spinlock.hpp>
 
+#include <array>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -127,21 +130,39 @@ namespace hpx::agas::server {
             hpx::tuple<naming::gid_type, gva, naming::gid_type>;
 
     private:
-        // REVIEW: Separate mutexes might reduce contention here. This has to be
-        // investigated carefully.
-        mutex_type mutex_;
-
-        gva_table_type gvas_;
-        refcnt_table_type refcnts_;
-
         using migration_table_type = std::map<naming::gid_type,
             hpx::tuple<bool, std::size_t,
                 lcos::local::detail::condition_variable>>;
 
+        // The bindings of single ids, their reference counts, and their
+        // migration state are partitioned by id into shards, each protected
+        // by its own lock.
+        struct shard
+        {
+            mutex_type mutex_;
+
+            gva_table_type gvas_;
+            refcnt_table_type refcnts_;
+            migration_table_type migrating_objects_;
+        };
+
+        static constexpr std::size_t num_shards = 64;
+
+        using shard_type = util::cache_aligned_data_derived<shard>;
+        std::array<shard_type, num_shards> shards_;
+
+        // The bindings of ranges of ids (e.g. of the objects of a component
+        // heap) are held in a separate ordered table, which allows to find the
+        // range containing a given id. Lookups take this lock in shared mode,
+        // a shard lock is always acquired before this one.
+        using ranges_mutex_type = hpx::detail::rw_spinlock;
+
+        ranges_mutex_type ranges_mutex_;
+        gva_table_type ranges_;
+
         std::string instance_name_;
         naming::gid_type next_id_;     // next available gid
         naming::gid_type locality_;    // our locality id
-        migration_table_type migrating_objects_;
 
         struct update_time_on_exit;
 
@@ -226,22 +247,23 @@ namespace hpx::agas::server {
 
     private:
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-        /// Dump the credit counts of all matching ranges. Expects that \p l
-        /// is locked.
-        void dump_refcnt_matches(refcnt_table_type::iterator lower_it,
-            refcnt_table_type::iterator upper_it, naming::gid_type const& lower,
-            naming::gid_type const& upper, std::unique_lock<mutex_type>& l,
-            char const* func_name);
+        /// Dump the credit counts of all ids in [lower, upper). Expects that
+        /// no shard is locked.
+        void dump_refcnt_matches(naming::gid_type const& lower,
+            naming::gid_type const& upper, char const* func_name);
 #endif
 
-        // helper function
+        // return the shard responsible for the given id
+        static std::size_t get_shard_index(naming::gid_type const& id) noexcept;
+        shard& get_shard(naming::gid_type const& id) noexcept;
+
+        // helper function, expects the shard of the given id to be locked
         void wait_for_migration_locked(std::unique_lock<mutex_type>& l,
             naming::gid_type const& id, error_code& ec);
 
     public:
         primary_namespace()
           : base_type(agas::primary_ns_msb, agas::primary_ns_lsb)
-          , mutex_()
           , instance_name_()
           , next_id_(naming::invalid_gid)
           , locality_(naming::invalid_gid)
@@ -291,6 +313,7 @@ namespace hpx::agas::server {
             std::uint64_t count);
 
     private:
+        // the resolve functions expect the shard of the given id to be locked
         resolved_type resolve_gid_locked(std::unique_lock<mutex_type>& l,
             naming::gid_type const& gid, error_code& ec);
 
@@ -322,19 +345,13 @@ namespace hpx::agas::server {
         using free_entry_list_type =
             std::list<free_entry, free_entry_allocator_type>;
 
-        void resolve_free_list(std::unique_lock<mutex_type>& l,
-            std::list<refcnt_table_type::iterator> const& free_list,
-            free_entry_list_type& free_entry_list,
-            naming::gid_type const& lower, naming::gid_type const& upper,
-            error_code& ec);
-
-        void decrement_sweep(free_entry_list_type& free_list,
-            naming::gid_type const& lower, naming::gid_type const& upper,
+        // expects the shard of the given id to be locked
+        void decrement_sweep_locked(std::unique_lock<mutex_type>& l,
+            free_entry_list_type& free_list, naming::gid_type const& raw,
             std::int64_t credits, error_code& ec);
 
-        void free_components_sync(free_entry_list_type& free_list,
-            naming::gid_type const& lower, naming::gid_type const& upper,
-            error_code& ec);
+        void free_components_sync(
+            free_entry_list_type& free_list, error_code& ec);
 
     public:
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, allocate)
@@ -15,16 +15,21 @@
 #include <hpx/async_distributed/base_lco_with_value.hpp>
 #include <hpx/async_distributed/transfer_continuation_action.hpp>
 #include <hpx/components_base/server/fixed_component_base.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/promise.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/naming_base/id_type.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <hpx/config/warnings_prefix.hpp>
 
@@ -53,11 +58,46 @@ namespace hpx::agas::server {
 
         using on_event_data_map_type = std::multimap<std::string, hpx::id_type>;
 
+        // A listener waiting for a set of names sharing a common prefix (as
+        // generated for basenames) to be bound.
+        struct prefix_event_data
+        {
+            std::string prefix_;
+            std::vector<std::size_t> sequence_numbers_;    // names to wait for
+            std::size_t pending_;    // number of names not bound so far
+            hpx::promise<iterate_names_return_type> promise_;
+        };
+
+        // the listeners, indexed by the names they are still waiting for
+        using on_prefix_event_data_map_type =
+            std::multimap<std::string, std::shared_ptr<prefix_event_data>>;
+
     private:
         mutex_type mutex_;
         gid_table_type gids_;
         std::string instance_name_;
         on_event_data_map_type on_event_data_;
+        on_prefix_event_data_map_type on_prefix_event_data_;
+
+        // return the range of entries in the GID table starting with prefix
+        std::pair<gid_table_type::iterator, gid_table_type::iterator>
+        prefix_range(std::string const& prefix);
+
+        // split the credits of all entries starting with prefix, expects the
+        // mutex to be locked
+        iterate_names_return_type collect_prefix_locked(
+            std::unique_lock<mutex_type>& l, std::string const& prefix);
+
+        // split the credits of the bound names the listener is waiting for,
+        // expects the mutex to be locked
+        iterate_names_return_type collect_names_locked(
+            std::unique_lock<mutex_type>& l, prefix_event_data const& data);
+
+        using entries_type = std::vector<
+            std::pair<std::string, std::shared_ptr<naming::gid_type>>>;
+
+        iterate_names_return_type split_credits_locked(
+            std::unique_lock<mutex_type>& l, entries_type&& entries);
 
     public:
         // data structure holding all counters for the component_namespace component
@@ -144,11 +184,20 @@ namespace hpx::agas::server {
         bool on_event(std::string const& name, bool call_for_past_events,
             hpx::id_type const& lco);
 
+        // The returned future becomes ready as soon as all names made up
+        // from the given prefix and one of the sequence numbers have been
+        // bound (names unbound in the meantime are still counted). It holds
+        // those of the names which are bound at that point.
+        hpx::future<iterate_names_return_type> on_prefix_event(
+            std::string const& prefix,
+            std::vector<std::size_t> const& sequence_numbers);
+
         HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, bind)
         HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, resolve)
         HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, unbind)
         HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, iterate)
         HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, on_event)
+        HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, on_prefix_event)
     };
 }    // namespace hpx::agas::server
 
@@ -185,4 +234,11 @@ HPX_REGISTER_ACTION_DECLARATION(
     hpx::agas::server::symbol_namespace::on_event_action,
     symbol_namespace_on_event_action)
 
+HPX_ACTION_USES_MEDIUM_STACK(
+    hpx::agas::server::symbol_namespace::on_prefix_event_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::symbol_namespace::on_prefix_event_action,
+    symbol_namespace_on_prefix_event_action)
+
 #include <hpx/config/warnings_suffix.hpp>
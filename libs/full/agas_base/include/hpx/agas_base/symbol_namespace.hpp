@@ -17,10 +17,12 @@
 #include <hpx/naming_base/address.hpp>
 #include <hpx/naming_base/id_type.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <hpx/config/warnings_prefix.hpp>
 
@@ -71,6 +73,10 @@ namespace hpx::agas {
         hpx::future<bool> on_event(std::string const& name,
             bool call_for_past_events, hpx::id_type lco) const;
 
+        hpx::future<iterate_names_return_type> on_prefix_event(
+            std::string const& prefix,
+            std::vector<std::size_t> const& sequence_numbers) const;
+
         hpx::future<iterate_names_return_type> iterate_async(
             std::string const& pattern) const;
         iterate_names_return_type iterate(std::string const& pattern) const;
@@ -22,12 +22,14 @@
 #include <hpx/util/get_and_reset_value.hpp>
 #include <hpx/util/insert_checked.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <list>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -84,6 +86,23 @@ namespace hpx::agas::server {
         }
     }
 
+    std::size_t primary_namespace::get_shard_index(
+        naming::gid_type const& id) noexcept
+    {
+        naming::gid_type const stripped = naming::detail::get_stripped_gid(id);
+
+        // consecutive ids of a locality are assigned to different shards
+        return static_cast<std::size_t>(
+                   stripped.get_lsb() ^ (stripped.get_msb() >> 32)) %
+            num_shards;
+    }
+
+    primary_namespace::shard& primary_namespace::get_shard(
+        naming::gid_type const& id) noexcept
+    {
+        return shards_[get_shard_index(id)];
+    }
+
     // start migration of the given object
     std::pair<hpx::id_type, naming::address> primary_namespace::begin_migration(
         naming::gid_type id)
@@ -94,7 +113,8 @@ namespace hpx::agas::server {
         counter_data_.increment_begin_migration_count();
         using hpx::get;
 
-        std::unique_lock<mutex_type> l(mutex_);
+        shard& s = get_shard(id);
+        std::unique_lock<mutex_type> l(s.mutex_);
 
         wait_for_migration_locked(l, id, hpx::throws);
         resolved_type r = resolve_gid_locked_non_local(l, id, hpx::throws);
@@ -109,11 +129,11 @@ namespace hpx::agas::server {
             return std::make_pair(hpx::invalid_id, naming::address());
         }
 
-        migration_table_type::iterator it = migrating_objects_.find(id);
-        if (it == migrating_objects_.end())
+        migration_table_type::iterator it = s.migrating_objects_.find(id);
+        if (it == s.migrating_objects_.end())
         {
             std::pair<migration_table_type::iterator, bool> p =
-                migrating_objects_.emplace(std::piecewise_construct,
+                s.migrating_objects_.emplace(std::piecewise_construct,
                     std::forward_as_tuple(id), std::forward_as_tuple());
             HPX_ASSERT(p.second);
             it = p.first;
@@ -141,12 +161,13 @@ namespace hpx::agas::server {
             counter_data_.end_migration_.enabled_);
         counter_data_.increment_end_migration_count();
 
-        std::unique_lock<mutex_type> l(mutex_);
+        shard& s = get_shard(id);
+        std::unique_lock<mutex_type> l(s.mutex_);
 
         using hpx::get;
 
-        migration_table_type::iterator it = migrating_objects_.find(id);
-        if (it != migrating_objects_.end())
+        migration_table_type::iterator it = s.migrating_objects_.find(id);
+        if (it != s.migrating_objects_.end())
         {
             // flag this id as not being migrated anymore
             get<0>(it->second) = false;
@@ -156,7 +177,7 @@ namespace hpx::agas::server {
             }
             else
             {
-                migrating_objects_.erase(it);
+                s.migrating_objects_.erase(it);
             }
         }
 
@@ -172,8 +193,11 @@ namespace hpx::agas::server {
 
         using hpx::get;
 
-        migration_table_type::iterator it = migrating_objects_.find(id);
-        if (it != migrating_objects_.end())
+        shard& s = get_shard(id);
+        HPX_ASSERT(l.mutex() == &s.mutex_);
+
+        migration_table_type::iterator it = s.migrating_objects_.find(id);
+        if (it != s.migrating_objects_.end())
         {
             if (get<0>(it->second))
             {
@@ -182,13 +206,13 @@ namespace hpx::agas::server {
                 get<2>(it->second).wait(l, ec);
 
                 if (--get<1>(it->second) == 0)
-                    migrating_objects_.erase(it);
+                    s.migrating_objects_.erase(it);
             }
             else
             {
                 if (get<1>(it->second) == 0)
                 {
-                    migrating_objects_.erase(it);
+                    s.migrating_objects_.erase(it);
                 }
             }
         }
@@ -205,124 +229,141 @@ namespace hpx::agas::server {
         naming::gid_type gid = id;
         naming::detail::strip_internal_bits_from_gid(id);
 
-        std::unique_lock<mutex_type> l(mutex_);
+        shard& s = get_shard(id);
+        std::unique_lock<mutex_type> l(s.mutex_);
 
-        gva_table_type::iterator it = gvas_.lower_bound(id),
-                                 begin = gvas_.begin(), end = gvas_.end();
+        // Bindings of ranges are modified only while holding the ranges lock
+        // exclusively, binding a single id just has to look at them.
+        bool const is_range = g.count > 1;
 
-        if (it != end)
-        {
-            // If we got an exact match, this is a request to update an existing
-            // binding (e.g. move semantics).
-            if (it->first == id)
-            {
-                // non-migratable gids can't be rebound
-                if (naming::refers_to_local_lva(gid) &&
-                    !naming::refers_to_virtual_memory(gid))
-                {
-                    l.unlock();
-
-                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
-                        "primary_namespace::bind_gid",
-                        "cannot rebind gids for non-migratable objects");
-
-                    return false;
-                }
+        std::unique_lock<ranges_mutex_type> rl(ranges_mutex_, std::defer_lock);
+        std::shared_lock<ranges_mutex_type> srl(
+            ranges_mutex_, std::defer_lock);
+        if (is_range)
+            rl.lock();
+        else
+            srl.lock();
 
-                gva& gaddr = it->second.first;
-                naming::gid_type& loc = it->second.second;
+        auto unlock = [&]() {
+            if (rl.owns_lock())
+                rl.unlock();
+            if (srl.owns_lock())
+                srl.unlock();
+            l.unlock();
+        };
 
-                // Check for count mismatch (we can't change block sizes of
-                // existing bindings).
-                if (HPX_UNLIKELY(gaddr.count != g.count))
+        gva_table_type::iterator it = s.gvas_.find(id);
+        bool found = it != s.gvas_.end();
+        if (!found)
+        {
+            it = ranges_.find(id);
+            found = it != ranges_.end();
+            if (!found)
+            {
+                // We're about to decrement the iterator it - first, we
+                // check that it's safe to do this.
+                gva_table_type::iterator prev = ranges_.lower_bound(id);
+                if (prev != ranges_.begin())
                 {
-                    // REVIEW: Is this the right error code to use?
-                    l.unlock();
+                    --prev;
 
-                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
-                        "primary_namespace::bind_gid",
-                        "cannot change block size of existing binding");
-                }
-
-                if (HPX_UNLIKELY(components::component_invalid == g.type))
-                {
-                    l.unlock();
+                    // Check that a previous range doesn't cover the new id.
+                    if (HPX_UNLIKELY(
+                            (prev->first + prev->second.first.count) > id))
+                    {
+                        // REVIEW: Is this the right error code to use?
+                        unlock();
 
-                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
-                        "primary_namespace::bind_gid",
-                        "attempt to update a GVA with an invalid type, "
-                        "gid({1}), gva({2}), locality({3})",
-                        id, g, locality);
+                        HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                            "primary_namespace::bind_gid",
+                            "the new GID is contained in an existing range");
+                    }
                 }
+            }
+        }
 
-                if (HPX_UNLIKELY(!locality))
-                {
-                    l.unlock();
+        // If we got an exact match, this is a request to update an existing
+        // binding (e.g. move semantics).
+        if (found)
+        {
+            // non-migratable gids can't be rebound
+            if (naming::refers_to_local_lva(gid) &&
+                !naming::refers_to_virtual_memory(gid))
+            {
+                unlock();
 
-                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
-                        "primary_namespace::bind_gid",
-                        "attempt to update a GVA with an invalid "
-                        "locality id, "
-                        "gid({1}), gva({2}), locality({3})",
-                        id, g, locality);
-                }
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "primary_namespace::bind_gid",
+                    "cannot rebind gids for non-migratable objects");
 
-                // Store the new endpoint and offset
-                gaddr.prefix = g.prefix;
-                gaddr.type = g.type;
-                gaddr.lva(g.lva());
-                gaddr.offset = g.offset;
-                loc = locality;
+                return false;
+            }
 
-                l.unlock();
+            gva& gaddr = it->second.first;
+            naming::gid_type& loc = it->second.second;
 
-                LAGAS_(info).format(
-                    "primary_namespace::bind_gid, gid({1}), gva({2}), "
-                    "locality({3}), response(repeated_request)",
-                    id, g, locality);
+            // Check for count mismatch (we can't change block sizes of
+            // existing bindings).
+            if (HPX_UNLIKELY(gaddr.count != g.count))
+            {
+                // REVIEW: Is this the right error code to use?
+                unlock();
 
-                return false;
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "primary_namespace::bind_gid",
+                    "cannot change block size of existing binding");
             }
 
-            // We're about to decrement the iterator it - first, we
-            // check that it's safe to do this.
-            else if (it != begin)
+            if (HPX_UNLIKELY(components::component_invalid == g.type))
             {
-                --it;
-
-                // Check that a previous range doesn't cover the new id.
-                if (HPX_UNLIKELY((it->first + it->second.first.count) > id))
-                {
-                    // REVIEW: Is this the right error code to use?
-                    l.unlock();
+                unlock();
 
-                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
-                        "primary_namespace::bind_gid",
-                        "the new GID is contained in an existing range");
-                }
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "primary_namespace::bind_gid",
+                    "attempt to update a GVA with an invalid type, "
+                    "gid({1}), gva({2}), locality({3})",
+                    id, g, locality);
             }
-        }
-
-        else if (HPX_LIKELY(!gvas_.empty()))
-        {
-            --it;
 
-            // Check that a previous range doesn't cover the new id.
-            if ((it->first + it->second.first.count) > id)
+            if (HPX_UNLIKELY(!locality))
             {
-                // REVIEW: Is this the right error code to use?
-                l.unlock();
+                unlock();
 
                 HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
                     "primary_namespace::bind_gid",
-                    "the new GID is contained in an existing range");
+                    "attempt to update a GVA with an invalid "
+                    "locality id, "
+                    "gid({1}), gva({2}), locality({3})",
+                    id, g, locality);
             }
+
+            // the block sizes match, thus a range is updated only while
+            // holding the ranges lock exclusively
+            HPX_ASSERT(!is_range || rl.owns_lock());
+
+            // Store the new endpoint and offset
+            gaddr.prefix = g.prefix;
+            gaddr.type = g.type;
+            gaddr.lva(g.lva());
+            gaddr.offset = g.offset;
+            loc = locality;
+
+            unlock();
+
+            LAGAS_(info).format(
+                "primary_namespace::bind_gid, gid({1}), gva({2}), "
+                "locality({3}), response(repeated_request)",
+                id, g, locality);
+
+            return false;
         }
 
         // non-migratable gids don't need to be bound
         if (naming::refers_to_local_lva(gid) &&
             !naming::refers_to_virtual_memory(gid))
         {
+            unlock();
+
             LAGAS_(info).format(
                 "primary_namespace::bind_gid, gid({1}), gva({2}), "
                 "locality({3})",
@@ -335,7 +376,7 @@ namespace hpx::agas::server {
 
         if (HPX_UNLIKELY(id.get_msb() != upper_bound.get_msb()))
         {
-            l.unlock();
+            unlock();
 
             HPX_THROW_EXCEPTION(hpx::error::internal_server_error,
                 "primary_namespace::bind_gid",
@@ -344,7 +385,7 @@ namespace hpx::agas::server {
 
         if (HPX_UNLIKELY(components::component_invalid == g.type))
         {
-            l.unlock();
+            unlock();
 
             HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
                 "primary_namespace::bind_gid",
@@ -354,10 +395,11 @@ namespace hpx::agas::server {
         }
 
         // Insert a GID -> GVA entry into the GVA table.
+        gva_table_type& gvas = is_range ? ranges_ : s.gvas_;
         if (HPX_UNLIKELY(!util::insert_checked(
-                gvas_.insert(std::make_pair(id, std::make_pair(g, locality))))))
+                gvas.insert(std::make_pair(id, std::make_pair(g, locality))))))
         {
-            l.unlock();
+            unlock();
 
             HPX_THROW_EXCEPTION(hpx::error::lock_error,
                 "primary_namespace::bind_gid",
@@ -366,7 +408,7 @@ namespace hpx::agas::server {
                 id, g, locality);
         }
 
-        l.unlock();
+        unlock();
 
         LAGAS_(info).format(
             "primary_namespace::bind_gid, gid({1}), gva({2}), locality({3})",
@@ -404,7 +446,7 @@ namespace hpx::agas::server {
         }
         else
         {
-            std::unique_lock<mutex_type> l(mutex_);
+            std::unique_lock<mutex_type> l(get_shard(id).mutex_);
 
             // wait for any migration to be completed
             if (naming::detail::is_migratable(id))
@@ -450,14 +492,36 @@ namespace hpx::agas::server {
 
         naming::detail::strip_internal_bits_from_gid(id);
 
-        std::unique_lock<mutex_type> l(mutex_);
+        shard& s = get_shard(id);
+        std::unique_lock<mutex_type> l(s.mutex_);
 
-        gva_table_type::iterator it = gvas_.find(id), end = gvas_.end();
+        // Unbinding a single id has to look at the ranges only to detect a
+        // mismatch of the block sizes.
+        std::unique_lock<ranges_mutex_type> rl(ranges_mutex_, std::defer_lock);
+        std::shared_lock<ranges_mutex_type> srl(
+            ranges_mutex_, std::defer_lock);
 
-        if (it != end)
+        gva_table_type* gvas = &s.gvas_;
+        gva_table_type::iterator it = s.gvas_.find(id);
+        if (it == s.gvas_.end())
+        {
+            if (count > 1)
+                rl.lock();
+            else
+                srl.lock();
+
+            gvas = &ranges_;
+            it = ranges_.find(id);
+        }
+
+        if (it != gvas->end())
         {
             if (HPX_UNLIKELY(it->second.first.count != count))
             {
+                if (rl.owns_lock())
+                    rl.unlock();
+                if (srl.owns_lock())
+                    srl.unlock();
                 l.unlock();
 
                 HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
@@ -466,8 +530,11 @@ namespace hpx::agas::server {
 
             gva_table_data_type data = it->second;
 
-            gvas_.erase(it);
+            HPX_ASSERT(gvas == &s.gvas_ || rl.owns_lock());
+            gvas->erase(it);
 
+            if (rl.owns_lock())
+                rl.unlock();
             l.unlock();
             LAGAS_(info).format(
                 "primary_namespace::unbind_gid, gid({1}), count({2}), "
@@ -495,6 +562,10 @@ namespace hpx::agas::server {
             return naming::address(g.prefix, g.type, g.lva());
         }
 
+        if (rl.owns_lock())
+            rl.unlock();
+        if (srl.owns_lock())
+            srl.unlock();
         l.unlock();
 
         LAGAS_(info).format(
@@ -551,24 +622,7 @@ namespace hpx::agas::server {
         for (auto& req : requests)
         {
             std::int64_t credits = hpx::get<0>(req);
-            naming::gid_type lower = hpx::get<1>(req);
-            naming::gid_type upper = hpx::get<1>(req);
-
-            naming::detail::strip_internal_bits_from_gid(lower);
-            naming::detail::strip_internal_bits_from_gid(upper);
-
-            if (lower == upper)
-                ++upper;
-
-            // Decrement.
-            if (credits < 0)
-            {
-                free_entry_list_type free_list;
-                decrement_sweep(free_list, lower, upper, -credits, hpx::throws);
-
-                free_components_sync(free_list, lower, upper, hpx::throws);
-            }
-            else
+            if (credits >= 0)
             {
                 HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
                     "primary_namespace::decrement_credit",
@@ -577,6 +631,47 @@ namespace hpx::agas::server {
             res_credits.push_back(credits);
         }
 
+        // Apply the decrements grouped by shard, acquiring the lock of each
+        // involved shard only once.
+        std::vector<std::pair<std::size_t, std::size_t>> order;
+        order.reserve(requests.size());
+        for (std::size_t i = 0; i != requests.size(); ++i)
+        {
+            order.emplace_back(get_shard_index(hpx::get<1>(requests[i])), i);
+        }
+        std::sort(order.begin(), order.end());
+
+        free_entry_list_type free_list;
+        try
+        {
+            for (auto it = order.begin(); it != order.end(); /**/)
+            {
+                std::size_t const index = it->first;
+                std::unique_lock<mutex_type> l(shards_[index].mutex_);
+
+                for (/**/; it != order.end() && it->first == index; ++it)
+                {
+                    auto const& req = requests[it->second];
+
+                    naming::gid_type raw = hpx::get<1>(req);
+                    naming::detail::strip_internal_bits_from_gid(raw);
+
+                    decrement_sweep_locked(
+                        l, free_list, raw, -hpx::get<0>(req), hpx::throws);
+                }
+            }
+        }
+        catch (...)
+        {
+            // the components swept before the failing request are not
+            // referenced anymore, free them before reporting the error
+            error_code ec(throwmode::lightweight);
+            free_components_sync(free_list, ec);
+            throw;
+        }
+
+        free_components_sync(free_list, hpx::throws);
+
         return res_credits;
     }
 
@@ -643,31 +738,29 @@ namespace hpx::agas::server {
     }    // }}}
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-    void primary_namespace::dump_refcnt_matches(
-        refcnt_table_type::iterator lower_it,
-        refcnt_table_type::iterator upper_it, naming::gid_type const& lower,
-        naming::gid_type const& upper, std::unique_lock<mutex_type>& l,
-        char const* func_name)
+    void primary_namespace::dump_refcnt_matches(naming::gid_type const& lower,
+        naming::gid_type const& upper, char const* func_name)
     {
         // dump_refcnt_matches implementation
-        HPX_ASSERT(l.owns_lock());
-
-        if (lower_it == refcnts_.end() && upper_it == refcnts_.end())
-            // We got nothing, bail - our caller is probably about to throw.
-            return;
-
         std::stringstream ss;
         hpx::util::format_to(ss,
             "{1}, dumping server-side refcnt table matches, lower({2}), "
             "upper({3}):",
             func_name, lower, upper);
 
-        for (/**/; lower_it != upper_it; ++lower_it)
+        for (naming::gid_type raw = lower; raw != upper; ++raw)
         {
+            shard& s = get_shard(raw);
+            std::unique_lock<mutex_type> l(s.mutex_);
+
+            refcnt_table_type::iterator it = s.refcnts_.find(raw);
+            if (it == s.refcnts_.end())
+                continue;
+
             // The [server] tag is in there to make it easier to filter
             // through the logs.
             hpx::util::format_to(ss, "\n  [server] lower({1}), credits({2})",
-                lower_it->first, lower_it->second);
+                it->first, it->second);
         }
 
         LAGAS_(debug) << ss.str();
@@ -678,28 +771,10 @@ namespace hpx::agas::server {
     void primary_namespace::increment(naming::gid_type const& lower,
         naming::gid_type const& upper, std::int64_t& credits, error_code& ec)
     {    // {{{ increment implementation
-        std::unique_lock<mutex_type> l(mutex_);
-
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
         if (LAGAS_ENABLED(debug))
         {
-            typedef refcnt_table_type::iterator iterator;
-
-            // Find the mappings that we're about to touch.
-            refcnt_table_type::iterator lower_it = refcnts_.find(lower);
-            refcnt_table_type::iterator upper_it;
-            if (lower != upper)
-            {
-                upper_it = refcnts_.find(upper);
-            }
-            else
-            {
-                upper_it = lower_it;
-                ++upper_it;
-            }
-
-            dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
-                "primary_namespace::increment");
+            dump_refcnt_matches(lower, upper, "primary_namespace::increment");
         }
 #endif
 
@@ -715,14 +790,18 @@ namespace hpx::agas::server {
 
         for (naming::gid_type raw = lower; raw != upper; ++raw)
         {
-            refcnt_table_type::iterator it = refcnts_.find(raw);
-            if (it == refcnts_.end())
+            shard& s = get_shard(raw);
+            std::unique_lock<mutex_type> l(s.mutex_);
+
+            refcnt_table_type::iterator it = s.refcnts_.find(raw);
+            if (it == s.refcnts_.end())
             {
                 std::int64_t count =
                     std::int64_t(HPX_GLOBALCREDIT_INITIAL) + credits;
 
                 std::pair<refcnt_table_type::iterator, bool> p =
-                    refcnts_.insert(refcnt_table_type::value_type(raw, count));
+                    s.refcnts_.insert(
+                        refcnt_table_type::value_type(raw, count));
                 if (!p.second)
                 {
                     l.unlock();
@@ -752,215 +831,161 @@ namespace hpx::agas::server {
     }    // }}}
 
     ///////////////////////////////////////////////////////////////////////////////
-    void primary_namespace::resolve_free_list(std::unique_lock<mutex_type>& l,
-        std::list<refcnt_table_type::iterator> const& free_list,
-        free_entry_list_type& free_entry_list,
-        naming::gid_type const& /* lower */,
-        naming::gid_type const& /* upper */, error_code& ec)
-    {
+    void primary_namespace::decrement_sweep_locked(
+        std::unique_lock<mutex_type>& l, free_entry_list_type& free_entry_list,
+        naming::gid_type const& raw, std::int64_t credits, error_code& ec)
+    {    // {{{ decrement_sweep_locked implementation
         HPX_ASSERT_OWNS_LOCK(l);
 
         using hpx::get;
 
-        typedef refcnt_table_type::iterator iterator;
-
-        for (iterator const& it : free_list)
+        LAGAS_(info).format(
+            "primary_namespace::decrement_sweep, raw({1}), credits({2})", raw,
+            credits);
+
+        shard& s = get_shard(raw);
+
+        // The third parameter we pass here is the default data to use in case
+        // the key is not mapped. We don't insert GIDs into the refcnt table
+        // when we allocate/bind them, so if a GID is not in the refcnt table,
+        // we know that it's global reference count is the initial global
+        // reference count.
+        refcnt_table_type::iterator it = s.refcnts_.find(raw);
+        if (it == s.refcnts_.end())
         {
-            typedef refcnt_table_type::key_type key_type;
-
-            // The mapping's key space.
-            key_type gid = it->first;
-
-            if (naming::detail::is_migratable(gid))
-            {
-                // wait for any migration to be completed
-                wait_for_migration_locked(l, gid, ec);
-            }
-
-            // Resolve the query GID.
-            resolved_type r = resolve_gid_locked(l, gid, ec);
-            if (ec)
-                return;
-
-            naming::gid_type& raw = get<0>(r);
-            if (raw == naming::invalid_gid)
+            if (credits > std::int64_t(HPX_GLOBALCREDIT_INITIAL))
             {
                 l.unlock();
 
-                HPX_THROWS_IF(ec, hpx::error::internal_server_error,
-                    "primary_namespace::resolve_free_list",
-                    "primary_namespace::resolve_free_list, failed to resolve "
-                    "gid, gid({1})",
-                    gid);
-                return;    // couldn't resolve this one
+                HPX_THROWS_IF(ec, hpx::error::invalid_data,
+                    "primary_namespace::decrement_sweep",
+                    "negative entry in reference count table, "
+                    "raw({1}), refcount({2})",
+                    raw, std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits);
+                return;
             }
 
-            // Make sure the GVA is valid.
-            gva& g = get<1>(r);
+            std::int64_t count =
+                std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits;
 
-            // REVIEW: Should we do more to make sure the GVA is valid?
-            if (HPX_UNLIKELY(components::component_invalid == g.type))
-            {
-                l.unlock();
-
-                HPX_THROWS_IF(ec, hpx::error::internal_server_error,
-                    "primary_namespace::resolve_free_list",
-                    "encountered a GVA with an invalid type while performing a "
-                    "decrement, gid({1}), gva({2})",
-                    gid, g);
-                return;
-            }
-            else if (HPX_UNLIKELY(0 == g.count))
+            std::pair<refcnt_table_type::iterator, bool> p =
+                s.refcnts_.insert(refcnt_table_type::value_type(raw, count));
+            if (!p.second)
             {
                 l.unlock();
 
-                HPX_THROWS_IF(ec, hpx::error::internal_server_error,
-                    "primary_namespace::resolve_free_list",
-                    "encountered a GVA with a count of zero while performing a "
-                    "decrement, gid({1}), gva({2})",
-                    gid, g);
+                HPX_THROWS_IF(ec, hpx::error::invalid_data,
+                    "primary_namespace::decrement_sweep",
+                    "couldn't create entry in reference count table, "
+                    "raw({1}), ref-count({2})",
+                    raw, count);
                 return;
             }
 
-            LAGAS_(info).format(
-                "primary_namespace::resolve_free_list, resolved match, "
-                "gid({1}), gva({2})",
-                gid, g);
-
-            // Fully resolve the range.
-            gva const resolved = g.resolve(gid, raw);
-
-            // Add the information needed to destroy these components to the
-            // free list.
-            free_entry_list.push_back(free_entry(resolved, gid, get<2>(r)));
-
-            // remove this entry from the refcnt table
-            refcnts_.erase(it);
+            it = p.first;
         }
-    }
-
-    ///////////////////////////////////////////////////////////////////////////////
-    void primary_namespace::decrement_sweep(
-        free_entry_list_type& free_entry_list, naming::gid_type const& lower,
-        naming::gid_type const& upper, std::int64_t credits, error_code& ec)
-    {    // {{{ decrement_sweep implementation
-        LAGAS_(info).format(
-            "primary_namespace::decrement_sweep, lower({1}), upper({2}), "
-            "credits({3})",
-            lower, upper, credits);
-
-        free_entry_list.clear();
-
+        else
         {
-            std::unique_lock<mutex_type> l(mutex_);
+            it->second -= credits;
+        }
 
-#if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-            if (LAGAS_ENABLED(debug))
-            {
-                typedef refcnt_table_type::iterator iterator;
+        // Sanity check.
+        if (it->second < 0)
+        {
+            l.unlock();
 
-                // Find the mappings that we just added or modified.
-                refcnt_table_type::iterator lower_it = refcnts_.find(lower);
-                refcnt_table_type::iterator upper_it;
-                if (lower != upper)
-                {
-                    upper_it = refcnts_.find(upper);
-                }
-                else
-                {
-                    upper_it = lower_it;
-                    ++upper_it;
-                }
+            HPX_THROWS_IF(ec, hpx::error::invalid_data,
+                "primary_namespace::decrement_sweep",
+                "negative entry in reference count table, raw({1}), "
+                "refcount({2})",
+                raw, it->second);
+            return;
+        }
 
-                dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
-                    "primary_namespace::decrement_sweep");
-            }
-#endif
+        // this object is still referenced
+        if (it->second != 0)
+            return;
 
-            ///////////////////////////////////////////////////////////////////////
-            // Apply the decrement across the entire key space (e.g. [lower, upper]).
+        if (naming::detail::is_migratable(raw))
+        {
+            // wait for any migration to be completed, this may temporarily
+            // release the lock
+            wait_for_migration_locked(l, raw, ec);
+            if (ec)
+                return;
 
-            // The third parameter we pass here is the default data to use in case
-            // the key is not mapped. We don't insert GIDs into the refcnt table
-            // when we allocate/bind them, so if a GID is not in the refcnt table,
-            // we know that it's global reference count is the initial global
-            // reference count.
+            it = s.refcnts_.find(raw);
+            if (it == s.refcnts_.end() || it->second != 0)
+                return;
+        }
 
-            std::list<refcnt_table_type::iterator> free_list;
-            for (naming::gid_type raw = lower; raw != upper; ++raw)
-            {
-                refcnt_table_type::iterator it = refcnts_.find(raw);
-                if (it == refcnts_.end())
-                {
-                    if (credits > std::int64_t(HPX_GLOBALCREDIT_INITIAL))
-                    {
-                        l.unlock();
+        // Resolve the query GID.
+        resolved_type r = resolve_gid_locked(l, raw, ec);
+        if (ec)
+            return;
 
-                        HPX_THROWS_IF(ec, hpx::error::invalid_data,
-                            "primary_namespace::decrement_sweep",
-                            "negative entry in reference count table, "
-                            "raw({1}), refcount({2})",
-                            raw,
-                            std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits);
-                        return;
-                    }
+        naming::gid_type& base = get<0>(r);
+        if (base == naming::invalid_gid)
+        {
+            l.unlock();
 
-                    std::int64_t count =
-                        std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits;
+            HPX_THROWS_IF(ec, hpx::error::internal_server_error,
+                "primary_namespace::decrement_sweep",
+                "primary_namespace::decrement_sweep, failed to resolve "
+                "gid, gid({1})",
+                raw);
+            return;    // couldn't resolve this one
+        }
 
-                    std::pair<refcnt_table_type::iterator, bool> p =
-                        refcnts_.insert(
-                            refcnt_table_type::value_type(raw, count));
-                    if (!p.second)
-                    {
-                        l.unlock();
+        // Make sure the GVA is valid.
+        gva& g = get<1>(r);
 
-                        HPX_THROWS_IF(ec, hpx::error::invalid_data,
-                            "primary_namespace::decrement_sweep",
-                            "couldn't create entry in reference count table, "
-                            "raw({1}), ref-count({2})",
-                            raw, count);
-                        return;
-                    }
+        // REVIEW: Should we do more to make sure the GVA is valid?
+        if (HPX_UNLIKELY(components::component_invalid == g.type))
+        {
+            l.unlock();
 
-                    it = p.first;
-                }
-                else
-                {
-                    it->second -= credits;
-                }
+            HPX_THROWS_IF(ec, hpx::error::internal_server_error,
+                "primary_namespace::decrement_sweep",
+                "encountered a GVA with an invalid type while performing a "
+                "decrement, gid({1}), gva({2})",
+                raw, g);
+            return;
+        }
+        else if (HPX_UNLIKELY(0 == g.count))
+        {
+            l.unlock();
 
-                // Sanity check.
-                if (it->second < 0)
-                {
-                    l.unlock();
+            HPX_THROWS_IF(ec, hpx::error::internal_server_error,
+                "primary_namespace::decrement_sweep",
+                "encountered a GVA with a count of zero while performing a "
+                "decrement, gid({1}), gva({2})",
+                raw, g);
+            return;
+        }
 
-                    HPX_THROWS_IF(ec, hpx::error::invalid_data,
-                        "primary_namespace::decrement_sweep",
-                        "negative entry in reference count table, raw({1}), "
-                        "refcount({2})",
-                        raw, it->second);
-                    return;
-                }
+        LAGAS_(info).format(
+            "primary_namespace::decrement_sweep, resolved match, "
+            "gid({1}), gva({2})",
+            raw, g);
 
-                // this objects needs to be deleted
-                if (it->second == 0)
-                    free_list.push_back(it);
-            }
+        // Fully resolve the range.
+        gva const resolved = g.resolve(raw, base);
 
-            // Resolve the objects which have to be deleted.
-            resolve_free_list(l, free_list, free_entry_list, lower, upper, ec);
+        // Add the information needed to destroy this component to the free
+        // list.
+        free_entry_list.push_back(free_entry(resolved, raw, get<2>(r)));
 
-        }    // Unlock the mutex.
+        // remove this entry from the refcnt table
+        s.refcnts_.erase(it);
 
         if (&ec != &throws)
             ec = make_success_code();
-    }
+    }    // }}}
 
     ///////////////////////////////////////////////////////////////////////////////
     void primary_namespace::free_components_sync(
-        free_entry_list_type& free_list, naming::gid_type const& lower,
-        naming::gid_type const& upper, error_code& ec)
+        free_entry_list_type& free_list, error_code& ec)
     {
         using hpx::get;
 
@@ -974,16 +999,16 @@ namespace hpx::agas::server {
             {
                 LAGAS_(info).format(
                     "primary_namespace::free_components_sync, cancelling free "
-                    "operation because the threadmanager is down, lower({1}), "
-                    "upper({2}), base({3}), gva({4}), locality({5})",
-                    lower, upper, e.gid_, e.gva_, e.locality_);
+                    "operation because the threadmanager is down, base({1}), "
+                    "gva({2}), locality({3})",
+                    e.gid_, e.gva_, e.locality_);
                 continue;
             }
 
             LAGAS_(info).format(
                 "primary_namespace::free_components_sync, freeing component, "
-                "lower({1}), upper({2}), base({3}), gva({4}), locality({5})",
-                lower, upper, e.gid_, e.gva_, e.locality_);
+                "base({1}), gva({2}), locality({3})",
+                e.gid_, e.gva_, e.locality_);
 
             // Destroy the component.
             HPX_ASSERT(e.locality_ == e.gva_.prefix);
@@ -1045,8 +1070,25 @@ namespace hpx::agas::server {
         naming::gid_type id = gid;
         naming::detail::strip_internal_bits_from_gid(id);
 
-        gva_table_type::const_iterator it = gvas_.lower_bound(id),
-                                       begin = gvas_.begin(), end = gvas_.end();
+        // Check for an exact match of a single id
+        shard& s = get_shard(id);
+        HPX_ASSERT(l.mutex() == &s.mutex_);
+
+        gva_table_type::const_iterator single = s.gvas_.find(id);
+        if (single != s.gvas_.end())
+        {
+            if (&ec != &throws)
+                ec = make_success_code();
+
+            gva_table_data_type const& data = single->second;
+            return resolved_type(single->first, data.first, data.second);
+        }
+
+        std::shared_lock<ranges_mutex_type> rl(ranges_mutex_);
+
+        gva_table_type::const_iterator it = ranges_.lower_bound(id),
+                                       begin = ranges_.begin(),
+                                       end = ranges_.end();
 
         if (it != end)
         {
@@ -1072,6 +1114,7 @@ namespace hpx::agas::server {
                 {
                     if (HPX_UNLIKELY(id.get_msb() != it->first.get_msb()))
                     {
+                        rl.unlock();
                         l.unlock();
 
                         HPX_THROWS_IF(ec, hpx::error::internal_server_error,
@@ -1090,7 +1133,7 @@ namespace hpx::agas::server {
             }
         }
 
-        else if (HPX_LIKELY(!gvas_.empty()))
+        else if (HPX_LIKELY(!ranges_.empty()))
         {
             --it;
 
@@ -1100,6 +1143,7 @@ namespace hpx::agas::server {
             {
                 if (HPX_UNLIKELY(id.get_msb() != it->first.get_msb()))
                 {
+                    rl.unlock();
                     l.unlock();
 
                     HPX_THROWS_IF(ec, hpx::error::internal_server_error,
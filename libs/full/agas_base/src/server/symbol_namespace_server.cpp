@@ -13,13 +13,16 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/naming/credit_handling.hpp>
 #include <hpx/naming/split_gid.hpp>
+#include <hpx/thread_support/assert_owns_lock.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/timing/scoped_timer.hpp>
 #include <hpx/util/get_and_reset_value.hpp>
 #include <hpx/util/insert_checked.hpp>
 #include <hpx/util/regex_from_pattern.hpp>
 
+#include <algorithm>
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <memory>
@@ -200,8 +203,42 @@ namespace hpx::agas::server {
             }
         }
 
+        // handle registered prefix events, each listener is registered with
+        // the names it still waits for
+        std::vector<std::shared_ptr<prefix_event_data>> completed;
+        if (auto const [first, last] = on_prefix_event_data_.equal_range(key);
+            first != last)
+        {
+            for (auto it = first; it != last; ++it)
+            {
+                HPX_ASSERT(it->second->pending_ != 0);
+                if (--it->second->pending_ == 0)
+                {
+                    completed.push_back(it->second);
+                }
+            }
+            on_prefix_event_data_.erase(first, last);
+        }
+
+        std::vector<iterate_names_return_type> found;
+        found.reserve(completed.size());
+        for (auto const& data : completed)
+        {
+            found.push_back(collect_names_locked(l, *data));
+        }
+
         l.unlock();
 
+        // notify all listeners which are not waiting for any names anymore
+        for (std::size_t i = 0; i != completed.size(); ++i)
+        {
+            LAGAS_(info).format("symbol_namespace::bind, notify: prefix({1}), "
+                                "count({2})",
+                completed[i]->prefix_, found[i].size());
+
+            completed[i]->promise_.set_value(HPX_MOVE(found[i]));
+        }
+
         LAGAS_(info).format(
             "symbol_namespace::bind, key({1}), gid({2})", key, gid);
 
@@ -286,7 +323,15 @@ namespace hpx::agas::server {
 
         std::map<std::string, naming::gid_type> found;
 
-        if (pattern.find_first_of("*?[]") != std::string::npos)
+        std::string::size_type const wildcard = pattern.find_first_of("*?[]");
+        if (wildcard != std::string::npos && wildcard + 1 == pattern.size() &&
+            pattern[wildcard] == '*')
+        {
+            // the pattern is a plain prefix, look at matching entries only
+            std::unique_lock<mutex_type> l(mutex_);
+            found = collect_prefix_locked(l, pattern.substr(0, wildcard));
+        }
+        else if (wildcard != std::string::npos)
         {
             std::string const str_rx(util::regex_from_pattern(pattern, throws));
             std::regex const rx(str_rx);
@@ -384,6 +429,149 @@ namespace hpx::agas::server {
         return true;
     }
 
+    hpx::future<symbol_namespace::iterate_names_return_type>
+    symbol_namespace::on_prefix_event(std::string const& prefix,
+        std::vector<std::size_t> const& sequence_numbers)
+    {
+        util::scoped_timer<std::atomic<std::int64_t>> update(
+            counter_data_.on_event_.time_, counter_data_.on_event_.enabled_);
+        counter_data_.increment_on_event_count();
+
+        auto data = std::make_shared<prefix_event_data>();
+        data->prefix_ = prefix;
+        data->sequence_numbers_ = sequence_numbers;
+        data->pending_ = 0;
+
+        std::sort(
+            data->sequence_numbers_.begin(), data->sequence_numbers_.end());
+        data->sequence_numbers_.erase(
+            std::unique(data->sequence_numbers_.begin(),
+                data->sequence_numbers_.end()),
+            data->sequence_numbers_.end());
+
+        std::unique_lock<mutex_type> l(mutex_);
+
+        // wait for the names which are not bound yet only
+        std::vector<std::string> pending;
+        for (std::size_t const i : data->sequence_numbers_)
+        {
+            std::string name = prefix + std::to_string(i);
+            if (gids_.find(name) == gids_.end())
+            {
+                pending.push_back(HPX_MOVE(name));
+            }
+        }
+
+        if (pending.empty())
+        {
+            // trigger right away as the names are already bound
+            iterate_names_return_type found = collect_names_locked(l, *data);
+
+            l.unlock();
+
+            LAGAS_(info).format("symbol_namespace::on_prefix_event, notify: "
+                                "prefix({1}), count({2})",
+                prefix, found.size());
+
+            return hpx::make_ready_future(HPX_MOVE(found));
+        }
+
+        hpx::future<iterate_names_return_type> f =
+            data->promise_.get_future();
+
+        data->pending_ = pending.size();
+        for (std::string& name : pending)
+        {
+            on_prefix_event_data_.emplace(HPX_MOVE(name), data);
+        }
+
+        l.unlock();
+
+        LAGAS_(info).format(
+            "symbol_namespace::on_prefix_event: prefix({1}), count({2})",
+            prefix, data->sequence_numbers_.size());
+
+        return f;
+    }
+
+    std::pair<symbol_namespace::gid_table_type::iterator,
+        symbol_namespace::gid_table_type::iterator>
+    symbol_namespace::prefix_range(std::string const& prefix)
+    {
+        // the entries starting with prefix are stored next to each other
+        auto const first = gids_.lower_bound(prefix);
+
+        auto last = first;
+        while (last != gids_.end() &&
+            last->first.compare(0, prefix.size(), prefix) == 0)
+        {
+            ++last;
+        }
+
+        return {first, last};
+    }
+
+    symbol_namespace::iterate_names_return_type
+    symbol_namespace::collect_prefix_locked(
+        std::unique_lock<mutex_type>& l, std::string const& prefix)
+    {
+        HPX_ASSERT_OWNS_LOCK(l);
+
+        entries_type entries;
+
+        auto [first, last] = prefix_range(prefix);
+        for (/**/; first != last; ++first)
+        {
+            entries.emplace_back(first->first, first->second);
+        }
+
+        return split_credits_locked(l, HPX_MOVE(entries));
+    }
+
+    symbol_namespace::iterate_names_return_type
+    symbol_namespace::collect_names_locked(
+        std::unique_lock<mutex_type>& l, prefix_event_data const& data)
+    {
+        HPX_ASSERT_OWNS_LOCK(l);
+
+        // names unbound in the meantime are not reported
+        entries_type entries;
+        entries.reserve(data.sequence_numbers_.size());
+
+        for (std::size_t const i : data.sequence_numbers_)
+        {
+            std::string name = data.prefix_ + std::to_string(i);
+            if (auto const it = gids_.find(name); it != gids_.end())
+            {
+                entries.emplace_back(HPX_MOVE(name), it->second);
+            }
+        }
+
+        return split_credits_locked(l, HPX_MOVE(entries));
+    }
+
+    symbol_namespace::iterate_names_return_type
+    symbol_namespace::split_credits_locked(
+        std::unique_lock<mutex_type>& l, entries_type&& entries)
+    {
+        HPX_ASSERT_OWNS_LOCK(l);
+
+        // the entries hold on to the gids while the map is unlocked
+        iterate_names_return_type found;
+        {
+            unlock_guard<std::unique_lock<mutex_type>> ul(l);
+
+            // split the credits as the receiving end will expect to keep the
+            // objects alive
+            for (auto& [key, current_gid] : entries)
+            {
+                found.emplace(HPX_MOVE(key),
+                    naming::detail::split_gid_if_needed(*current_gid).get());
+            }
+        }
+        return found;
+    }
+
     // access current counter values
     std::int64_t symbol_namespace::counter_data::get_bind_count(bool reset)
     {
@@ -13,13 +13,16 @@
 #include <hpx/agas_base/server/symbol_namespace.hpp>
 #include <hpx/agas_base/symbol_namespace.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/async_combinators/when_all.hpp>
 #include <hpx/async_distributed/base_lco_with_value.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/hashing/jenkins_hash.hpp>
 #include <hpx/modules/async_distributed.hpp>
+#include <hpx/serialization/vector.hpp>
 #include <hpx/util/from_string.hpp>
 
 #include <cctype>
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <string>
@@ -53,6 +56,10 @@ HPX_REGISTER_ACTION_ID(symbol_namespace::on_event_action,
     symbol_namespace_on_event_action,
     hpx::actions::symbol_namespace_on_event_action_id)
 
+HPX_REGISTER_ACTION_ID(symbol_namespace::on_prefix_event_action,
+    symbol_namespace_on_prefix_event_action,
+    hpx::actions::symbol_namespace_on_prefix_event_action_id)
+
 namespace hpx::agas {
 
     naming::gid_type symbol_namespace::get_service_instance(
@@ -266,6 +273,64 @@ namespace hpx::agas {
 #endif
     }
 
+    hpx::future<symbol_namespace::iterate_names_return_type>
+    symbol_namespace::on_prefix_event(std::string const& prefix,
+        std::vector<std::size_t> const& sequence_numbers) const
+    {
+        using return_type = server::symbol_namespace::iterate_names_return_type;
+
+        // the names are spread over the symbol namespace instances, install
+        // one listener with each instance responsible for some of them
+        std::map<std::uint32_t, std::vector<std::size_t>> requests;
+        for (std::size_t const i : sequence_numbers)
+        {
+            hpx::id_type const dest =
+                symbol_namespace_locality(prefix + std::to_string(i));
+            requests[naming::get_locality_id_from_id(dest)].push_back(i);
+        }
+
+        std::vector<hpx::future<return_type>> results;
+        results.reserve(requests.size());
+
+        std::uint32_t const here = agas::get_locality_id();
+        for (auto& [locality_id, numbers] : requests)
+        {
+            if (locality_id == here)
+            {
+                results.push_back(server_->on_prefix_event(prefix, numbers));
+                continue;
+            }
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+            constexpr server::symbol_namespace::on_prefix_event_action action;
+            results.push_back(hpx::async(action,
+                hpx::id_type(get_service_instance(locality_id),
+                    hpx::id_type::management_type::unmanaged),
+                prefix, HPX_MOVE(numbers)));
+#else
+            HPX_ASSERT(false);
+#endif
+        }
+
+        return hpx::when_all(HPX_MOVE(results))
+            .then(hpx::launch::sync,
+                [](hpx::future<std::vector<hpx::future<return_type>>>&& f) {
+                    iterate_names_return_type result;
+                    for (auto& r : f.get())
+                    {
+                        for (auto& [k, v] : r.get())
+                        {
+                            auto const type = naming::detail::has_credits(v) ?
+                                hpx::id_type::management_type::managed :
+                                hpx::id_type::management_type::unmanaged;
+                            result.emplace(
+                                HPX_MOVE(k), hpx::id_type(HPX_MOVE(v), type));
+                        }
+                    }
+                    return result;
+                });
+    }
+
     hpx::future<symbol_namespace::iterate_names_return_type>
     symbol_namespace::iterate_async(
         [[maybe_unused]] std::string const& pattern) const
@@ -15,6 +15,8 @@
 #include <hpx/naming_base/id_type.hpp>
 
 #include <cstddef>
+#include <map>
+#include <numeric>
 #include <string>
 #include <utility>
 #include <vector>
@@ -67,6 +69,51 @@ namespace hpx {
 
             return name;
         }
+
+        namespace {
+
+            std::string prefix_from_basename(std::string const& basename)
+            {
+                std::string name = name_from_basename(basename, 0);
+                name.pop_back();
+                return name;
+            }
+
+            // Wait for the names generated from the given basename and
+            // sequence numbers using a single listener per symbol namespace
+            // instance involved. Names which are not part of the result of
+            // the listener (as they were unbound before it triggered) are
+            // waited for separately.
+            std::vector<hpx::future<hpx::id_type>> find_from_prefix(
+                std::string const& basename,
+                std::vector<std::size_t> const& ids)
+            {
+                using names_type = std::map<std::string, hpx::id_type>;
+
+                hpx::shared_future<names_type> found =
+                    agas::on_symbol_namespace_prefix_event(
+                        prefix_from_basename(basename), ids);
+
+                std::vector<hpx::future<hpx::id_type>> results;
+                results.reserve(ids.size());
+                for (std::size_t const i : ids)
+                {
+                    results.push_back(found.then(hpx::launch::sync,
+                        [name = name_from_basename(basename, i)](
+                            hpx::shared_future<names_type> const& f)
+                            -> hpx::future<hpx::id_type> {
+                            names_type const& names = f.get();
+                            if (auto const it = names.find(name);
+                                it != names.end())
+                            {
+                                return hpx::make_ready_future(it->second);
+                            }
+                            return agas::on_symbol_namespace_event(name, true);
+                        }));
+                }
+                return results;
+            }
+        }    // namespace
     }    // namespace detail
 
     ///////////////////////////////////////////////////////////////////////////
@@ -79,6 +126,13 @@ namespace hpx {
                 "hpx::find_all_from_basename", "no basename specified");
         }
 
+        if (num_ids > 1)
+        {
+            std::vector<std::size_t> ids(num_ids);
+            std::iota(ids.begin(), ids.end(), std::size_t(0));
+            return detail::find_from_prefix(basename, ids);
+        }
+
         std::vector<hpx::future<hpx::id_type>> results;
         for (std::size_t i = 0; i != num_ids; ++i)
         {
@@ -98,6 +152,11 @@ namespace hpx {
                 "hpx::find_from_basename", "no basename specified");
         }
 
+        if (ids.size() > 1)
+        {
+            return detail::find_from_prefix(basename, ids);
+        }
+
         std::vector<hpx::future<hpx::id_type>> results;
         for (std::size_t const i : ids)
         {
@@ -198,6 +198,10 @@ namespace hpx::agas::detail {
     extern HPX_EXPORT hpx::future<hpx::id_type> (*on_symbol_namespace_event)(
         std::string const& name, bool call_for_past_events);
 
+    extern HPX_EXPORT hpx::future<std::map<std::string, hpx::id_type>> (
+        *on_symbol_namespace_prefix_event)(std::string const& prefix,
+        std::vector<std::size_t> const& sequence_numbers);
+
     ///////////////////////////////////////////////////////////////////////////
     extern HPX_EXPORT hpx::future<std::pair<hpx::id_type, naming::address>> (
         *begin_migration)(hpx::id_type const& id);
@@ -330,6 +330,14 @@ namespace hpx { namespace agas {
         return detail::on_symbol_namespace_event(name, call_for_past_events);
     }
 
+    hpx::future<std::map<std::string, hpx::id_type>>
+    on_symbol_namespace_prefix_event(std::string const& prefix,
+        std::vector<std::size_t> const& sequence_numbers)
+    {
+        return detail::on_symbol_namespace_prefix_event(
+            prefix, sequence_numbers);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     hpx::future<std::pair<hpx::id_type, naming::address>> begin_migration(
         hpx::id_type const& id)
@@ -191,6 +191,10 @@ namespace hpx::agas::detail {
     hpx::future<hpx::id_type> (*on_symbol_namespace_event)(
         std::string const& name, bool call_for_past_events) = nullptr;
 
+    hpx::future<std::map<std::string, hpx::id_type>> (
+        *on_symbol_namespace_prefix_event)(std::string const& prefix,
+        std::vector<std::size_t> const& sequence_numbers) = nullptr;
+
     ///////////////////////////////////////////////////////////////////////////
     hpx::future<std::pair<hpx::id_type, naming::address>> (*begin_migration)(
         hpx::id_type const& id) = nullptr;
@@ -49,7 +49,7 @@
 #include <hpx/string_util/classification.hpp>
 #include <hpx/string_util/split.hpp>
 #include <hpx/threading/thread.hpp>
-#include <hpx/threading_base/detail/get_default_timer_service.hpp>
+#include <hpx/threading_base/stack_usage.hpp>
 #include <hpx/type_support/pack.hpp>
 #include <hpx/type_support/unused.hpp>
 #include <hpx/util/from_string.hpp>
@@ -343,6 +343,16 @@ namespace hpx {
     defined(__FreeBSD__)
             threads::coroutines::detail::posix::use_guard_pages =
                 cmdline.rtcfg_.use_stack_guard_pages();
+            threads::coroutines::detail::posix::use_stack_pool =
+                cmdline.rtcfg_.use_stack_pool();
+            threads::coroutines::detail::posix::track_stack_usage =
+                cmdline.rtcfg_.track_stack_usage();
+            threads::detail::set_stack_size_adaptation_enabled(
+                cmdline.rtcfg_.adapt_stack_size());
+            // shrink stacks only if guard pages catch an overflow
+            threads::detail::set_stack_size_shrinking_enabled(
+                cmdline.rtcfg_.shrink_stack_size() &&
+                cmdline.rtcfg_.use_stack_guard_pages());
 #endif
 #ifdef HPX_HAVE_VERIFY_LOCKS
             if (cmdline.rtcfg_.enable_lock_detection())
@@ -705,8 +715,6 @@ namespace hpx {
 #endif
             hpx::threads::detail::set_get_default_pool(
                 &detail::get_default_pool);
-            hpx::threads::detail::set_get_default_timer_service(
-                &hpx::detail::get_default_timer_service);
             hpx::threads::detail::set_get_locality_id(&get_locality_id);
             hpx::parallel::execution::detail::set_get_pu_mask(
                 &hpx::detail::get_pu_mask);
@@ -61,6 +61,8 @@ namespace hpx::parcelset::policies::mpi {
             data.time_ = timer_.elapsed_nanoseconds();
             data.bytes_ = static_cast<std::size_t>(header_.numbytes());
 #endif
+            pp_.get_buffer_pool().reserve(
+                buffer_.data_, static_cast<std::size_t>(header_.size()));
             buffer_.data_.resize(static_cast<std::size_t>(header_.size()));
             buffer_.num_chunks_ = header_.num_chunks();
         }
@@ -0,0 +1,129 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/io_service.hpp>
+#include <hpx/modules/synchronization.hpp>
+
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/segment.hpp>
+#include <hpx/parcelport_shmem/sender.hpp>
+#include <hpx/parcelset/parcelport_impl.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset {
+
+    namespace policies::shmem {
+
+        class receiver;
+        class HPX_EXPORT connection_handler;
+    }    // namespace policies::shmem
+
+    template <>
+    struct connection_handler_traits<policies::shmem::connection_handler>
+    {
+        using connection_type = policies::shmem::sender;
+        using send_early_parcel = std::false_type;
+        using do_background_work = std::false_type;
+        using send_immediate_parcels = std::false_type;
+        using send_batched_messages = std::false_type;
+
+        static constexpr const char* type() noexcept
+        {
+            return "shmem";
+        }
+
+        static constexpr const char* pool_name() noexcept
+        {
+            return "parcel-pool-shmem";
+        }
+
+        static constexpr const char* pool_name_postfix() noexcept
+        {
+            return "-shmem";
+        }
+    };
+
+    namespace policies::shmem {
+
+        class HPX_EXPORT connection_handler
+          : public parcelport_impl<connection_handler>
+        {
+            using base_type = parcelport_impl<connection_handler>;
+
+        public:
+            static std::vector<std::string> runtime_configuration()
+            {
+                std::vector<std::string> lines;
+                return lines;
+            }
+
+            connection_handler(util::runtime_configuration const& ini,
+                threads::policies::callback_notifier const& notifier);
+
+            ~connection_handler();
+
+            // Start receiving messages.
+            bool do_run();
+
+            // Stop receiving messages.
+            void do_stop();
+
+            // Return the name of this locality
+            std::string get_locality_name() const;
+
+            // Only localities on the same node can be reached through shared
+            // memory.
+            bool can_connect(parcelset::locality const& dest,
+                bool use_alternative_parcelport) override;
+
+            std::shared_ptr<sender> create_connection(
+                parcelset::locality const& l, error_code& ec);
+
+            parcelset::locality agas_locality(
+                util::runtime_configuration const& ini) const;
+
+            parcelset::locality create_locality() const;
+
+        private:
+            // Return the (cached) mapping of the segment of the given
+            // locality
+            std::shared_ptr<segment> get_segment(
+                locality const& l, std::error_code& ec);
+
+            std::size_t num_channels_;
+            std::size_t channel_size_;
+            std::size_t out_of_band_threshold_;
+
+            // the receiving end of the segment owned by this locality, the
+            // receiver runs on a thread of its own
+            util::io_service_pool receive_pool_;
+            std::unique_ptr<receiver> receiver_;
+
+            // mappings of the segments of the localities we send to
+            mutable hpx::spinlock segments_mtx_;
+            std::map<std::string, std::weak_ptr<segment>> segments_;
+        };
+    }    // namespace policies::shmem
+}    // namespace hpx::parcelset
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -0,0 +1,94 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/serialization.hpp>
+
+#include <cstdint>
+#include <string>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // A shared memory locality is identified by the node it runs on, by the
+    // id of its process, and by a random token. The latter two determine the
+    // name of the shared memory segment the locality receives messages
+    // through, the token keeps processes which share the shared memory
+    // namespace but not the process id namespace (e.g. containers) apart.
+    class locality
+    {
+    public:
+        locality() noexcept
+          : pid_(0)
+          , token_(0)
+        {
+        }
+
+        locality(std::string const& node, std::uint32_t pid,
+            std::uint64_t token)
+          : node_(node)
+          , pid_(pid)
+          , token_(token)
+        {
+        }
+
+        std::string const& node() const noexcept
+        {
+            return node_;
+        }
+
+        std::uint32_t pid() const noexcept
+        {
+            return pid_;
+        }
+
+        std::uint64_t token() const noexcept
+        {
+            return token_;
+        }
+
+        static constexpr const char* type() noexcept
+        {
+            return "shmem";
+        }
+
+        explicit constexpr operator bool() const noexcept
+        {
+            return pid_ != 0;
+        }
+
+        HPX_EXPORT void save(serialization::output_archive& ar) const;
+        HPX_EXPORT void load(serialization::input_archive& ar);
+
+    private:
+        friend bool operator==(
+            locality const& lhs, locality const& rhs) noexcept
+        {
+            return lhs.pid_ == rhs.pid_ && lhs.token_ == rhs.token_ &&
+                lhs.node_ == rhs.node_;
+        }
+
+        friend bool operator<(locality const& lhs, locality const& rhs) noexcept
+        {
+            return lhs.node_ < rhs.node_ ||
+                (lhs.node_ == rhs.node_ &&
+                    (lhs.pid_ < rhs.pid_ ||
+                        (lhs.pid_ == rhs.pid_ && lhs.token_ < rhs.token_)));
+        }
+
+        friend HPX_EXPORT std::ostream& operator<<(
+            std::ostream& os, locality const& loc) noexcept;
+
+        std::string node_;
+        std::uint32_t pid_;
+        std::uint64_t token_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,104 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/timing.hpp>
+
+#include <hpx/parcelport_shmem/segment.hpp>
+#include <hpx/parcelset/parcel_buffer.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    class connection_handler;
+
+    // A received zero-copy chunk, either copied out of the ring buffer or
+    // still residing in the out of band shared memory object it was sent
+    // through. The latter is deserialized in place.
+    class receive_chunk
+    {
+    public:
+        receive_chunk() = default;
+
+        explicit receive_chunk(std::vector<char>&& data) noexcept
+          : data_(HPX_MOVE(data))
+        {
+        }
+
+        explicit receive_chunk(shared_memory_region&& region) noexcept
+          : region_(HPX_MOVE(region))
+        {
+        }
+
+        char* data() noexcept
+        {
+            return region_ ? static_cast<char*>(region_.data()) :
+                             data_.data();
+        }
+
+        std::size_t size() const noexcept
+        {
+            return region_ ? region_.size() : data_.size();
+        }
+
+    private:
+        std::vector<char> data_;
+        shared_memory_region region_;
+    };
+
+    // The receiving end of all channels of the segment owned by this
+    // locality. The receiver drains the channels and decodes the messages,
+    // it blocks on the doorbell of the segment if all channels are empty.
+    class receiver
+    {
+    public:
+        using parcel_buffer_type =
+            parcel_buffer<std::vector<char>, receive_chunk>;
+
+        receiver(connection_handler& parcelport, std::string const& name,
+            std::size_t num_channels, std::size_t channel_size,
+            std::uint64_t max_inbound_size);
+
+        // Removes the out of band objects of messages which were not received
+        ~receiver();
+
+        // Receive messages until stop() is called
+        void run();
+
+        void stop() noexcept;
+
+    private:
+        // Receive all available messages, returns whether anything was
+        // received
+        bool poll();
+
+        // Returns whether any of the channels holds a message
+        bool pending() const noexcept;
+
+        std::uint64_t receive_message(std::size_t channel, std::uint64_t tail);
+
+        connection_handler& parcelport_;
+        segment segment_;
+        std::uint64_t max_inbound_size_;
+        std::atomic<bool> stopped_;
+
+        // Counters and timers for parcels received.
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        hpx::chrono::high_resolution_timer timer_;
+#endif
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,249 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/concurrency/cache_line_data.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <system_error>
+
+namespace hpx::parcelset::policies::shmem {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A mapping of a POSIX shared memory object. The creator of the object
+    // removes its name when the mapping is released. Creating an object fails
+    // if its name exists already.
+    class shared_memory_region
+    {
+    public:
+        shared_memory_region() = default;
+
+        shared_memory_region(shared_memory_region&& rhs) noexcept;
+        shared_memory_region& operator=(shared_memory_region&& rhs) noexcept;
+
+        ~shared_memory_region();
+
+        // Create a new shared memory object of the given size and map it
+        // into the address space of this process.
+        static shared_memory_region create(
+            std::string const& name, std::size_t size, std::error_code& ec);
+
+        // Map an existing shared memory object. If unlink is set, the name
+        // of the object is removed right away, the memory is released as
+        // soon as all mappings are gone.
+        static shared_memory_region open(
+            std::string const& name, bool unlink, std::error_code& ec);
+
+        void* data() const noexcept
+        {
+            return data_;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        std::string const& name() const noexcept
+        {
+            return name_;
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return data_ != nullptr;
+        }
+
+        // Hand the responsibility for removing the name of the object to
+        // whoever maps it next.
+        void detach() noexcept
+        {
+            owner_ = false;
+        }
+
+    private:
+        void release() noexcept;
+
+        std::string name_;
+        void* data_ = nullptr;
+        std::size_t size_ = 0;
+        bool owner_ = false;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The layout of a segment is a segment_header, followed by a
+    // channel_header for each channel, followed by the ring buffers of all
+    // channels. All positions stored in the channel headers increase
+    // monotonically, they are mapped onto the ring buffer by masking.
+    struct segment_header
+    {
+        // written last by the owner of the segment once it has been
+        // initialized, reset when the owner shuts down
+        std::atomic<std::uint64_t> magic_;
+        std::uint64_t num_channels_;
+        std::uint64_t channel_size_;
+
+        // incremented for each published message, the receiver waits on
+        // this word if it has nothing to do
+        alignas(threads::get_cache_line_size())
+            std::atomic<std::uint32_t> doorbell_;
+        std::atomic<std::uint32_t> sleeping_;
+    };
+
+    struct channel_header
+    {
+        // the process currently owning the sending end of this channel
+        alignas(threads::get_cache_line_size()) std::atomic<std::uint32_t>
+            owner_;
+
+        // written by the sender only
+        alignas(threads::get_cache_line_size()) std::atomic<std::uint64_t>
+            head_;
+
+        // written by the receiver only
+        alignas(threads::get_cache_line_size()) std::atomic<std::uint64_t>
+            tail_;
+    };
+
+    // Every message starts with this header, followed by the transmission
+    // chunks, followed by a piece_descriptor for the main buffer and for each
+    // of the zero-copy chunks, followed by the data of the pieces which are
+    // sent inline. All parts start at 8 byte boundaries.
+    struct message_header
+    {
+        std::uint64_t frame_size_;
+        std::uint64_t size_;
+        std::uint64_t data_size_;
+        std::uint32_t num_zero_copy_chunks_;
+        std::uint32_t num_non_zero_copy_chunks_;
+    };
+
+    struct piece_descriptor
+    {
+        static constexpr std::size_t max_name_length = 80;
+
+        std::uint64_t size_;
+        // non-zero if the data was placed into a shared memory object of its
+        // own, name_ holds the name of that object
+        std::uint64_t out_of_band_;
+        char name_[max_name_length];
+    };
+
+    constexpr std::uint64_t align_message(std::uint64_t size) noexcept
+    {
+        return (size + 7) & ~std::uint64_t(7);
+    }
+
+    // Return a random token distinguishing this process from all other
+    // processes using the same shared memory namespace
+    std::uint64_t generate_token();
+
+    // Return the name of the segment owned by the given process
+    std::string segment_name(std::uint32_t pid, std::uint64_t token);
+
+    // Return a new unique name for an out of band shared memory object sent
+    // by the process with the given token to the given segment. The name
+    // starts with the name of the segment, which allows to remove the objects
+    // together with the segment.
+    std::string out_of_band_name(
+        std::string const& segment_name, std::uint64_t token);
+
+    // Remove the names of all out of band shared memory objects sent to the
+    // given segment
+    void remove_out_of_band_objects(std::string const& segment_name) noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    class segment
+    {
+    public:
+        static constexpr std::uint64_t segment_magic = 0x6870782d73686d31;
+
+        // Create the segment owned by this process
+        segment(std::string const& name, std::size_t num_channels,
+            std::size_t channel_size);
+
+        // Map the segment owned by another process
+        static std::shared_ptr<segment> open(
+            std::string const& name, std::error_code& ec);
+
+        std::string const& name() const noexcept
+        {
+            return region_.name();
+        }
+
+        segment_header& header() const noexcept
+        {
+            return *static_cast<segment_header*>(region_.data());
+        }
+
+        channel_header& channel(std::size_t i) const noexcept
+        {
+            return channels_[i];
+        }
+
+        std::size_t num_channels() const noexcept
+        {
+            return num_channels_;
+        }
+
+        std::uint64_t channel_size() const noexcept
+        {
+            return channel_size_;
+        }
+
+        bool is_alive() const noexcept
+        {
+            return header().magic_.load(std::memory_order_acquire) ==
+                segment_magic;
+        }
+
+        // Mark the segment as shut down, senders don't wait for space
+        // anymore
+        void shutdown() noexcept;
+
+        // Claim the sending end of an unused channel, returns
+        // num_channels() if all channels are in use.
+        std::size_t claim_channel(std::uint32_t owner) noexcept;
+        void release_channel(std::size_t i) noexcept;
+
+        // Copy data into/out of the ring buffer of the given channel, pos
+        // is the (unmasked) position to start at.
+        void write(std::size_t i, std::uint64_t pos, void const* data,
+            std::size_t size) const noexcept;
+        void read(std::size_t i, std::uint64_t pos, void* data,
+            std::size_t size) const noexcept;
+
+        // Wake up the receiver of this segment, if needed.
+        void notify() const noexcept;
+
+        // Block until the doorbell has changed from the expected value or
+        // until the timeout has expired.
+        void wait(std::uint32_t expected,
+            std::chrono::nanoseconds timeout) const noexcept;
+
+    private:
+        explicit segment(shared_memory_region&& region) noexcept;
+
+        void init_layout() noexcept;
+
+        shared_memory_region region_;
+        channel_header* channels_ = nullptr;
+        char* rings_ = nullptr;
+        std::size_t num_channels_ = 0;
+        std::uint64_t channel_size_ = 0;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,195 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/asio.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/segment.hpp>
+#include <hpx/parcelset/parcelport_connection.hpp>
+#include <hpx/parcelset_base/detail/data_point.hpp>
+#include <hpx/parcelset_base/detail/gatherer.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+#include <hpx/parcelset_base/parcelport.hpp>
+
+#include <asio/io_context.hpp>
+#include <asio/post.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // The sending end of a channel in the segment of the destination
+    // locality. Messages are copied into the ring buffer of the channel,
+    // the send operation is complete as soon as the copy has been published.
+    class sender
+      : public parcelset::parcelport_connection<sender, std::vector<char>>
+    {
+        using postprocess_handler_type =
+            hpx::move_only_function<void(std::error_code const&)>;
+
+    public:
+        sender(asio::io_context& io_service,
+            parcelset::locality const& locality_id,
+            std::shared_ptr<segment> there_segment, std::size_t channel,
+            std::size_t out_of_band_threshold, std::uint64_t token,
+            parcelset::parcelport* pp)
+          : io_service_(io_service)
+          , there_(locality_id)
+          , segment_(HPX_MOVE(there_segment))
+          , channel_(channel)
+          , out_of_band_threshold_(out_of_band_threshold)
+          , token_(token)
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+          , pp_(pp)
+#endif
+        {
+#if !defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            HPX_UNUSED(pp);
+#endif
+        }
+
+        ~sender()
+        {
+            // give the channel back, it can be claimed by other connections
+            segment_->release_channel(channel_);
+        }
+
+        parcelset::locality const& destination() const noexcept
+        {
+            return there_;
+        }
+
+        void verify_(parcelset::locality const& parcel_locality_id) const
+        {
+            HPX_ASSERT(parcel_locality_id == there_);
+            HPX_UNUSED(parcel_locality_id);
+        }
+
+        template <typename Handler, typename ParcelPostprocess>
+        void async_write(
+            Handler&& handler, ParcelPostprocess&& parcel_postprocess)
+        {
+            HPX_ASSERT(!buffer_.data_.empty());
+            HPX_ASSERT(!handler_);
+            HPX_ASSERT(!postprocess_handler_);
+
+            handler_ = HPX_FORWARD(Handler, handler);
+            postprocess_handler_ =
+                HPX_FORWARD(ParcelPostprocess, parcel_postprocess);
+            HPX_ASSERT(handler_);
+            HPX_ASSERT(postprocess_handler_);
+
+            /// Increment sends and begin timer.
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.time_ = timer_.elapsed_nanoseconds();
+#endif
+            std::error_code ec;
+            write_message(ec);
+
+            // The message has been copied into the ring buffer (or it has
+            // failed). Invoke the handlers asynchronously as the
+            // post-processing handler might send further parcels through
+            // this connection.
+            asio::post(io_service_,
+                hpx::bind_front(&sender::handle_write, shared_from_this(), ec));
+        }
+
+    private:
+        // Copy the message held in buffer_ into the channel
+        void write_message(std::error_code& ec);
+
+        static void reset_handler(postprocess_handler_type handler)
+        {
+            handler.reset();
+        }
+
+        /// handle completed write operation
+        void handle_write(std::error_code const& e)
+        {
+            // just call initial handler
+            handler_(e);
+
+            postprocess_handler_type handler;
+            std::swap(handler, handler_);
+
+            if (threads::threadmanager_is(hpx::state::running))
+            {
+                // the handler needs to be reset on an HPX thread (it destroys
+                // the parcel, which in turn might invoke HPX functions)
+                threads::thread_init_data data(
+                    threads::make_thread_function_nullary(util::deferred_call(
+                        &sender::reset_handler, HPX_MOVE(handler))),
+                    "sender::reset_handler");
+                threads::register_thread(data);
+            }
+            else
+            {
+                reset_handler(HPX_MOVE(handler));
+            }
+
+            if (!e)
+            {
+                // complete data point and push back onto gatherer
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+                buffer_.data_point_.time_ =
+                    timer_.elapsed_nanoseconds() - buffer_.data_point_.time_;
+                pp_->add_sent_data(buffer_.data_point_);
+#endif
+                buffer_.clear();
+            }
+
+            // Call post-processing handler, which will send remaining pending
+            // parcels. Pass along the connection so it can be reused if more
+            // parcels have to be sent.
+            hpx::move_only_function<void(std::error_code const&,
+                parcelset::locality const&, std::shared_ptr<sender>)>
+                postprocess_handler;
+            std::swap(postprocess_handler, postprocess_handler_);
+            postprocess_handler(e, there_, shared_from_this());
+        }
+
+        asio::io_context& io_service_;
+
+        // the other (receiving) end of this connection
+        parcelset::locality there_;
+        std::shared_ptr<segment> segment_;
+        std::size_t channel_;
+
+        // zero-copy chunks of at least this size are sent out of band
+        std::size_t out_of_band_threshold_;
+
+        // the token of the sending locality, part of the out of band names
+        std::uint64_t token_;
+
+        // Counters and their data containers.
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        hpx::chrono::high_resolution_timer timer_;
+        parcelset::parcelport* pp_;
+#endif
+
+        postprocess_handler_type handler_;
+        hpx::move_only_function<void(std::error_code const&,
+            parcelset::locality const&, std::shared_ptr<sender>)>
+            postprocess_handler_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,238 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/runtime_configuration.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/modules/util.hpp>
+
+#include <hpx/parcelport_shmem/connection_handler.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/receiver.hpp>
+#include <hpx/parcelport_shmem/segment.hpp>
+#include <hpx/parcelport_shmem/sender.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+
+#include <asio/io_context.hpp>
+#include <asio/ip/host_name.hpp>
+#include <asio/post.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+
+#include <unistd.h>
+
+namespace hpx::parcelset::policies::shmem {
+
+    namespace {
+
+        std::size_t round_up_to_power_of_two(std::size_t size) noexcept
+        {
+            std::size_t result = 1;
+            while (result < size)
+            {
+                result <<= 1;
+            }
+            return result;
+        }
+    }    // namespace
+
+    connection_handler::connection_handler(
+        util::runtime_configuration const& ini,
+        threads::policies::callback_notifier const& notifier)
+      : base_type(ini,
+            parcelset::locality(locality(asio::ip::host_name(),
+                static_cast<std::uint32_t>(::getpid()), generate_token())),
+            notifier)
+      , num_channels_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel.shmem.channels", 32))
+      , channel_size_(
+            round_up_to_power_of_two(hpx::util::get_entry_as<std::size_t>(
+                ini, "hpx.parcel.shmem.channel_size", 1048576)))
+      , out_of_band_threshold_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel.shmem.out_of_band_threshold", 262144))
+      , receive_pool_(
+            1, notifier, "parcel-pool-shmem-receive", "-shmem-receive")
+    {
+        if (here_.type() != std::string("shmem"))
+        {
+            HPX_THROW_EXCEPTION(hpx::error::network_error,
+                "shmem::parcelport::parcelport",
+                "this parcelport was instantiated to represent an unexpected "
+                "locality type: {}",
+                here_.type());
+        }
+
+        if (num_channels_ == 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "shmem::parcelport::parcelport",
+                "hpx.parcel.shmem.channels must be greater than zero");
+        }
+    }
+
+    connection_handler::~connection_handler()
+    {
+        HPX_ASSERT(!receiver_);
+    }
+
+    bool connection_handler::do_run()
+    {
+        locality const& here = here_.get<locality>();
+        receiver_.reset(new receiver(*this,
+            segment_name(here.pid(), here.token()),
+            num_channels_, channel_size_,
+            static_cast<std::uint64_t>(get_max_inbound_message_size())));
+
+        // the receiver blocks the only thread of its pool until it is
+        // stopped
+        receive_pool_.run(false);
+        asio::post(
+            receive_pool_.get_io_service(), [this]() { receiver_->run(); });
+
+        return true;
+    }
+
+    void connection_handler::do_stop()
+    {
+        if (receiver_)
+        {
+            receiver_->stop();
+
+            receive_pool_.stop();
+            receive_pool_.join();
+            receive_pool_.clear();
+
+            // this removes the segment owned by this locality
+            receiver_.reset();
+        }
+    }
+
+    std::string connection_handler::get_locality_name() const
+    {
+        return asio::ip::host_name();
+    }
+
+    bool connection_handler::can_connect(
+        parcelset::locality const& dest, bool use_alternative_parcelport)
+    {
+        return use_alternative_parcelport &&
+            dest.get<locality>().node() == here_.get<locality>().node();
+    }
+
+    std::shared_ptr<segment> connection_handler::get_segment(
+        locality const& l, std::error_code& ec)
+    {
+        std::lock_guard<hpx::spinlock> lk(segments_mtx_);
+
+        std::string const name = segment_name(l.pid(), l.token());
+
+        std::weak_ptr<segment>& entry = segments_[name];
+        std::shared_ptr<segment> s = entry.lock();
+        if (!s)
+        {
+            s = segment::open(name, ec);
+            if (!ec)
+            {
+                entry = s;
+            }
+        }
+        return s;
+    }
+
+    std::shared_ptr<sender> connection_handler::create_connection(
+        parcelset::locality const& l, error_code& ec)
+    {
+        locality const& there = l.get<locality>();
+
+        // Map the segment of the target locality, retry if needed
+        std::shared_ptr<segment> there_segment;
+        std::error_code error;
+        for (std::size_t i = 0; i < HPX_MAX_NETWORK_RETRIES; ++i)
+        {
+            // The receiver is only nullptr when the parcelport has been
+            // stopped. An exit here, avoids hangs when late parcels are in
+            // flight (those are mainly decref requests).
+            if (!receiver_)
+                return std::shared_ptr<sender>();
+
+            error.clear();
+            there_segment = get_segment(there, error);
+            if (!error)
+                break;
+
+            // wait for a really short amount of time
+            if (hpx::threads::get_self_ptr())
+            {
+                this_thread::suspend(
+                    hpx::threads::thread_schedule_state::pending,
+                    "connection_handler(shmem)::create_connection");
+            }
+            else
+            {
+                std::this_thread::sleep_for(
+                    std::chrono::milliseconds(HPX_NETWORK_RETRIES_SLEEP));
+            }
+        }
+
+        if (error)
+        {
+            if (tolerate_node_faults())
+                return std::shared_ptr<sender>();
+
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shmem::connection_handler::get_connection",
+                "{} (while trying to connect to: {})", error.message(), l);
+            return std::shared_ptr<sender>();
+        }
+
+        std::size_t const channel = there_segment->claim_channel(
+            static_cast<std::uint32_t>(here_.get<locality>().pid()));
+        if (channel == there_segment->num_channels())
+        {
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shmem::connection_handler::get_connection",
+                "all {} channels to {} are in use, consider increasing "
+                "hpx.parcel.shmem.channels",
+                there_segment->num_channels(), l);
+            return std::shared_ptr<sender>();
+        }
+
+        std::shared_ptr<sender> sender_connection(
+            new sender(io_service_pool_.get_io_service(), l,
+                HPX_MOVE(there_segment), channel, out_of_band_threshold_,
+                here_.get<locality>().token(), this));
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return sender_connection;
+    }
+
+    parcelset::locality connection_handler::agas_locality(
+        util::runtime_configuration const&) const
+    {
+        // this parcelport can't be used for bootstrapping
+        return parcelset::locality(locality());
+    }
+
+    parcelset::locality connection_handler::create_locality() const
+    {
+        return parcelset::locality(locality());
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
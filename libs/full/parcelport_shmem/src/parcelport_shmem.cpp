@@ -0,0 +1,61 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/parcelport_shmem/connection_handler.hpp>
+#include <hpx/plugin/traits/plugin_config_data.hpp>
+#include <hpx/plugin_factories/parcelport_factory.hpp>
+
+namespace hpx::traits {
+
+    // Inject additional configuration data into the factory registry for this
+    // type. This information ends up in the system wide configuration database
+    // under the plugin specific section:
+    //
+    //      [hpx.parcel.shmem]
+    //      ...
+    //      priority = 200
+    //
+    // The priority is higher than the one of all other parcelports, thus
+    // localities on the same node communicate through shared memory whenever
+    // this parcelport is enabled.
+    template <>
+    struct plugin_config_data<
+        hpx::parcelset::policies::shmem::connection_handler>
+    {
+        static constexpr char const* priority() noexcept
+        {
+            return "200";
+        }
+
+        static constexpr void init(int* /* argc */, char*** /* argv */,
+            util::command_line_handling& /* cfg */) noexcept
+        {
+        }
+
+        // by default no additional initialization using the resource
+        // partitioner is required
+        static constexpr void init(hpx::resource::partitioner&) noexcept {}
+
+        static constexpr void destroy() noexcept {}
+
+        static constexpr char const* call() noexcept
+        {
+            return "channels = ${HPX_PARCEL_SHMEM_CHANNELS:32}\n"
+                   "channel_size = ${HPX_PARCEL_SHMEM_CHANNEL_SIZE:1048576}\n"
+                   "out_of_band_threshold = "
+                   "${HPX_PARCEL_SHMEM_OUT_OF_BAND_THRESHOLD:262144}";
+        }
+    };
+}    // namespace hpx::traits
+
+HPX_REGISTER_PARCELPORT(
+    hpx::parcelset::policies::shmem::connection_handler, shmem)
+
+#endif
@@ -0,0 +1,261 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/logging.hpp>
+
+#include <hpx/parcelport_shmem/connection_handler.hpp>
+#include <hpx/parcelport_shmem/receiver.hpp>
+#include <hpx/parcelport_shmem/segment.hpp>
+#include <hpx/parcelset/decode_parcels.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // the number of empty polls before the receiver goes to sleep
+    constexpr std::size_t receiver_spin_count = 1024;
+
+    receiver::receiver(connection_handler& parcelport, std::string const& name,
+        std::size_t num_channels, std::size_t channel_size,
+        std::uint64_t max_inbound_size)
+      : parcelport_(parcelport)
+      , segment_(name, num_channels, channel_size)
+      , max_inbound_size_(max_inbound_size)
+      , stopped_(false)
+    {
+    }
+
+    receiver::~receiver()
+    {
+        remove_out_of_band_objects(segment_.name());
+    }
+
+    void receiver::run()
+    {
+        std::size_t idle = 0;
+        while (!stopped_.load(std::memory_order_acquire))
+        {
+            if (poll())
+            {
+                idle = 0;
+                continue;
+            }
+
+            if (++idle < receiver_spin_count)
+            {
+                HPX_SMT_PAUSE;
+                continue;
+            }
+
+            // Announce that we're about to sleep and check the channels once
+            // more. A sender publishing a message after the doorbell has
+            // been read changes the doorbell, which makes the wait return
+            // right away.
+            segment_header& hdr = segment_.header();
+            std::uint32_t const doorbell =
+                hdr.doorbell_.load(std::memory_order_seq_cst);
+            hdr.sleeping_.store(1, std::memory_order_seq_cst);
+
+            if (!pending() && !stopped_.load(std::memory_order_acquire))
+            {
+                segment_.wait(doorbell, std::chrono::milliseconds(100));
+            }
+
+            hdr.sleeping_.store(0, std::memory_order_relaxed);
+            idle = 0;
+        }
+    }
+
+    void receiver::stop() noexcept
+    {
+        stopped_.store(true, std::memory_order_release);
+        segment_.shutdown();
+
+        segment_header& hdr = segment_.header();
+        hdr.sleeping_.store(1, std::memory_order_seq_cst);
+        segment_.notify();
+    }
+
+    bool receiver::pending() const noexcept
+    {
+        for (std::size_t i = 0; i != segment_.num_channels(); ++i)
+        {
+            channel_header const& ch = segment_.channel(i);
+            if (ch.head_.load(std::memory_order_acquire) !=
+                ch.tail_.load(std::memory_order_relaxed))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool receiver::poll()
+    {
+        bool received = false;
+        for (std::size_t i = 0; i != segment_.num_channels(); ++i)
+        {
+            channel_header& ch = segment_.channel(i);
+
+            std::uint64_t tail = ch.tail_.load(std::memory_order_relaxed);
+            std::uint64_t const head = ch.head_.load(std::memory_order_acquire);
+            while (tail != head)
+            {
+                tail += receive_message(i, tail);
+                received = true;
+            }
+        }
+        return received;
+    }
+
+    std::uint64_t receiver::receive_message(
+        std::size_t channel, std::uint64_t tail)
+    {
+        using transmission_chunk_type =
+            parcel_buffer_type::transmission_chunk_type;
+
+        parcel_buffer_type buffer;
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        parcelset::data_point& data = buffer.data_point_;
+        data.time_ = timer_.elapsed_nanoseconds();
+        data.serialization_time_ = 0;
+        data.bytes_ = 0;
+        data.num_parcels_ = 0;
+#endif
+
+        message_header hdr;
+        std::uint64_t pos = tail;
+        segment_.read(channel, pos, &hdr, sizeof(hdr));
+        pos += sizeof(hdr);
+
+        buffer.size_ = hdr.size_;
+        buffer.data_size_ = hdr.data_size_;
+        buffer.num_chunks_.first = hdr.num_zero_copy_chunks_;
+        buffer.num_chunks_.second = hdr.num_non_zero_copy_chunks_;
+
+        std::size_t const num_zero_copy_chunks = hdr.num_zero_copy_chunks_;
+        if (num_zero_copy_chunks != 0)
+        {
+            buffer.transmission_chunks_.resize(
+                num_zero_copy_chunks + hdr.num_non_zero_copy_chunks_);
+
+            std::size_t const size = buffer.transmission_chunks_.size() *
+                sizeof(transmission_chunk_type);
+            segment_.read(
+                channel, pos, buffer.transmission_chunks_.data(), size);
+            pos += size;
+        }
+
+        std::vector<piece_descriptor> descriptors(num_zero_copy_chunks + 1);
+        segment_.read(channel, pos, descriptors.data(),
+            descriptors.size() * sizeof(piece_descriptor));
+        pos += descriptors.size() * sizeof(piece_descriptor);
+
+        // Copy the inline pieces out of the ring buffer and map the out of
+        // band pieces. The zero-copy chunks sent out of band are handed to
+        // the deserialization as they are.
+        std::error_code ec;
+        buffer.chunks_.reserve(num_zero_copy_chunks);
+
+        // the main buffer is drawn from the pool of the parcelport, it is
+        // handed back once the parcels have been decoded
+        parcelport_.get_buffer_pool().reserve(
+            buffer.data_, static_cast<std::size_t>(descriptors[0].size_));
+
+        for (std::size_t i = 0; i != descriptors.size(); ++i)
+        {
+            piece_descriptor const& desc = descriptors[i];
+            std::size_t const size = static_cast<std::size_t>(desc.size_);
+
+            if (desc.out_of_band_ == 0)
+            {
+                if (i == 0)
+                {
+                    buffer.data_.resize(size);
+                    segment_.read(channel, pos, buffer.data_.data(), size);
+                }
+                else
+                {
+                    std::vector<char> piece(size);
+                    segment_.read(channel, pos, piece.data(), size);
+                    buffer.chunks_.emplace_back(HPX_MOVE(piece));
+                }
+                pos += align_message(size);
+                continue;
+            }
+
+            std::string const name(desc.name_,
+                ::strnlen(desc.name_, piece_descriptor::max_name_length));
+            std::error_code piece_ec;
+            shared_memory_region region =
+                shared_memory_region::open(name, true, piece_ec);
+            if (piece_ec)
+            {
+                // keep going, the remaining pieces have to be consumed
+                ec = piece_ec;
+                continue;
+            }
+
+            if (i == 0)
+            {
+                auto const* p = static_cast<char const*>(region.data());
+                buffer.data_.assign(p, p + size);
+            }
+            else
+            {
+                buffer.chunks_.emplace_back(HPX_MOVE(region));
+            }
+        }
+
+        // release the space in the ring buffer, everything has been copied
+        HPX_ASSERT(pos - tail == hdr.frame_size_);
+        segment_.channel(channel).tail_.store(
+            tail + hdr.frame_size_, std::memory_order_release);
+
+        if (ec)
+        {
+            LPT_(error).format("shmem::receiver::receive_message: mapping an "
+                               "out of band chunk failed: {}",
+                ec.message());
+            return hdr.frame_size_;
+        }
+
+        if (buffer.size_ > max_inbound_size_)
+        {
+            LPT_(error).format("shmem::receiver::receive_message: message "
+                               "size ({}) exceeds the maximal inbound message "
+                               "size ({})",
+                buffer.size_, max_inbound_size_);
+            return hdr.frame_size_;
+        }
+
+        // complete data point and pass it along
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+        data.bytes_ = static_cast<std::size_t>(buffer.size_);
+        data.time_ = timer_.elapsed_nanoseconds() - data.time_;
+#endif
+
+        // decode the received parcels.
+        decode_parcels(parcelport_, HPX_MOVE(buffer), std::size_t(-1));
+
+        return hdr.frame_size_;
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,403 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <hpx/parcelport_shmem/segment.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace hpx::parcelset::policies::shmem {
+
+    static_assert(std::atomic<std::uint32_t>::is_always_lock_free &&
+            std::atomic<std::uint64_t>::is_always_lock_free,
+        "the shared memory parcelport relies on address-free atomics");
+
+    ///////////////////////////////////////////////////////////////////////////
+    shared_memory_region::shared_memory_region(
+        shared_memory_region&& rhs) noexcept
+      : name_(HPX_MOVE(rhs.name_))
+      , data_(std::exchange(rhs.data_, nullptr))
+      , size_(std::exchange(rhs.size_, 0))
+      , owner_(std::exchange(rhs.owner_, false))
+    {
+    }
+
+    shared_memory_region& shared_memory_region::operator=(
+        shared_memory_region&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            release();
+            name_ = HPX_MOVE(rhs.name_);
+            data_ = std::exchange(rhs.data_, nullptr);
+            size_ = std::exchange(rhs.size_, 0);
+            owner_ = std::exchange(rhs.owner_, false);
+        }
+        return *this;
+    }
+
+    shared_memory_region::~shared_memory_region()
+    {
+        release();
+    }
+
+    void shared_memory_region::release() noexcept
+    {
+        if (data_ != nullptr)
+        {
+            ::munmap(data_, size_);
+            data_ = nullptr;
+            size_ = 0;
+        }
+        if (owner_)
+        {
+            ::shm_unlink(name_.c_str());
+            owner_ = false;
+        }
+    }
+
+    shared_memory_region shared_memory_region::create(
+        std::string const& name, std::size_t size, std::error_code& ec)
+    {
+        shared_memory_region region;
+
+        // never remove an existing object, it might be in use by another
+        // process
+        int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd == -1)
+        {
+            ec = std::error_code(errno, std::system_category());
+            return region;
+        }
+
+        region.name_ = name;
+        region.owner_ = true;
+
+        if (::ftruncate(fd, static_cast<off_t>(size)) == -1)
+        {
+            ec = std::error_code(errno, std::system_category());
+            ::close(fd);
+            return region;
+        }
+
+        void* data =
+            ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (data == MAP_FAILED)
+        {
+            ec = std::error_code(errno, std::system_category());
+            ::close(fd);
+            return region;
+        }
+
+        ::close(fd);
+
+        region.data_ = data;
+        region.size_ = size;
+        return region;
+    }
+
+    shared_memory_region shared_memory_region::open(
+        std::string const& name, bool unlink, std::error_code& ec)
+    {
+        shared_memory_region region;
+
+        int fd = ::shm_open(name.c_str(), O_RDWR, 0600);
+        if (fd == -1)
+        {
+            ec = std::error_code(errno, std::system_category());
+            return region;
+        }
+
+        if (unlink)
+        {
+            ::shm_unlink(name.c_str());
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) == -1)
+        {
+            ec = std::error_code(errno, std::system_category());
+            ::close(fd);
+            return region;
+        }
+
+        std::size_t const size = static_cast<std::size_t>(st.st_size);
+        void* data =
+            ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (data == MAP_FAILED)
+        {
+            ec = std::error_code(errno, std::system_category());
+            ::close(fd);
+            return region;
+        }
+
+        ::close(fd);
+
+        region.name_ = name;
+        region.data_ = data;
+        region.size_ = size;
+        return region;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+
+        std::string to_hex(std::uint64_t value)
+        {
+            char buffer[17];
+            std::snprintf(buffer, sizeof(buffer), "%016llx",
+                static_cast<unsigned long long>(value));
+            return buffer;
+        }
+    }    // namespace
+
+    std::uint64_t generate_token()
+    {
+        // the time is mixed in as std::random_device might be deterministic
+        std::random_device rd;
+        std::uint64_t const token =
+            (static_cast<std::uint64_t>(rd()) << 32) ^ rd() ^
+            static_cast<std::uint64_t>(
+                std::chrono::steady_clock::now().time_since_epoch().count());
+        return token != 0 ? token : 1;
+    }
+
+    std::string segment_name(std::uint32_t pid, std::uint64_t token)
+    {
+        return "/hpx.shmem." + std::to_string(pid) + "." + to_hex(token);
+    }
+
+    std::string out_of_band_name(
+        std::string const& segment_name, std::uint64_t token)
+    {
+        static std::atomic<std::uint64_t> sequence(0);
+        return segment_name + "." + to_hex(token) + "." +
+            std::to_string(++sequence);
+    }
+
+    // POSIX doesn't provide a way to enumerate shared memory objects, on
+    // Linux they are files in /dev/shm.
+    void remove_out_of_band_objects(std::string const& segment_name) noexcept
+    {
+        HPX_ASSERT(!segment_name.empty() && segment_name[0] == '/');
+        std::string const prefix = segment_name.substr(1) + ".";
+
+        DIR* dir = ::opendir("/dev/shm");
+        if (dir == nullptr)
+        {
+            return;
+        }
+
+        while (dirent const* entry = ::readdir(dir))
+        {
+            if (std::strncmp(entry->d_name, prefix.c_str(), prefix.size()) ==
+                0)
+            {
+                ::shm_unlink((std::string("/") + entry->d_name).c_str());
+            }
+        }
+        ::closedir(dir);
+    }
+
+    namespace {
+
+        constexpr std::size_t rings_offset(std::size_t num_channels) noexcept
+        {
+            return sizeof(segment_header) +
+                num_channels * sizeof(channel_header);
+        }
+    }    // namespace
+
+    segment::segment(std::string const& name, std::size_t num_channels,
+        std::size_t channel_size)
+    {
+        HPX_ASSERT(num_channels != 0);
+        HPX_ASSERT((channel_size & (channel_size - 1)) == 0);
+
+        std::error_code ec;
+        region_ = shared_memory_region::create(name,
+            rings_offset(num_channels) + num_channels * channel_size, ec);
+        if (ec)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::network_error,
+                "shmem::segment::segment",
+                "creating the shared memory segment {} failed: {}", name,
+                ec == std::errc::file_exists ?
+                    std::string("the name is in use by another process") :
+                    ec.message());
+        }
+
+        // the memory of a new shared memory object is zero-initialized
+        segment_header& hdr = header();
+        hdr.num_channels_ = num_channels;
+        hdr.channel_size_ = channel_size;
+
+        init_layout();
+
+        hdr.magic_.store(segment_magic, std::memory_order_release);
+    }
+
+    segment::segment(shared_memory_region&& region) noexcept
+      : region_(HPX_MOVE(region))
+    {
+        init_layout();
+    }
+
+    std::shared_ptr<segment> segment::open(
+        std::string const& name, std::error_code& ec)
+    {
+        shared_memory_region region =
+            shared_memory_region::open(name, false, ec);
+        if (ec)
+        {
+            return std::shared_ptr<segment>();
+        }
+
+        // the segment may not have been initialized yet
+        auto const* hdr = static_cast<segment_header const*>(region.data());
+        if (region.size() < sizeof(segment_header) ||
+            hdr->magic_.load(std::memory_order_acquire) != segment_magic ||
+            region.size() < rings_offset(hdr->num_channels_) +
+                    hdr->num_channels_ * hdr->channel_size_)
+        {
+            ec = std::make_error_code(
+                std::errc::resource_unavailable_try_again);
+            return std::shared_ptr<segment>();
+        }
+
+        return std::shared_ptr<segment>(new segment(HPX_MOVE(region)));
+    }
+
+    void segment::init_layout() noexcept
+    {
+        segment_header const& hdr = header();
+        num_channels_ = static_cast<std::size_t>(hdr.num_channels_);
+        channel_size_ = hdr.channel_size_;
+
+        char* base = static_cast<char*>(region_.data());
+        channels_ =
+            reinterpret_cast<channel_header*>(base + sizeof(segment_header));
+        rings_ = base + rings_offset(num_channels_);
+    }
+
+    void segment::shutdown() noexcept
+    {
+        header().magic_.store(0, std::memory_order_release);
+    }
+
+    std::size_t segment::claim_channel(std::uint32_t owner) noexcept
+    {
+        for (std::size_t i = 0; i != num_channels_; ++i)
+        {
+            std::uint32_t expected = 0;
+            if (channels_[i].owner_.load(std::memory_order_relaxed) == 0 &&
+                channels_[i].owner_.compare_exchange_strong(
+                    expected, owner, std::memory_order_acquire))
+            {
+                return i;
+            }
+        }
+        return num_channels_;
+    }
+
+    void segment::release_channel(std::size_t i) noexcept
+    {
+        HPX_ASSERT(i < num_channels_);
+        channels_[i].owner_.store(0, std::memory_order_release);
+    }
+
+    void segment::write(std::size_t i, std::uint64_t pos, void const* data,
+        std::size_t size) const noexcept
+    {
+        char* ring = rings_ + i * channel_size_;
+        std::size_t const offset =
+            static_cast<std::size_t>(pos & (channel_size_ - 1));
+        std::size_t const first = (std::min)(
+            size, static_cast<std::size_t>(channel_size_) - offset);
+
+        std::memcpy(ring + offset, data, first);
+        if (first != size)
+        {
+            std::memcpy(
+                ring, static_cast<char const*>(data) + first, size - first);
+        }
+    }
+
+    void segment::read(std::size_t i, std::uint64_t pos, void* data,
+        std::size_t size) const noexcept
+    {
+        char const* ring = rings_ + i * channel_size_;
+        std::size_t const offset =
+            static_cast<std::size_t>(pos & (channel_size_ - 1));
+        std::size_t const first = (std::min)(
+            size, static_cast<std::size_t>(channel_size_) - offset);
+
+        std::memcpy(data, ring + offset, first);
+        if (first != size)
+        {
+            std::memcpy(static_cast<char*>(data) + first, ring, size - first);
+        }
+    }
+
+    // The futex word lives in memory shared between processes, thus the
+    // non-private futex operations have to be used.
+    void segment::notify() const noexcept
+    {
+        segment_header& hdr = header();
+        hdr.doorbell_.fetch_add(1, std::memory_order_seq_cst);
+        if (hdr.sleeping_.load(std::memory_order_seq_cst) != 0)
+        {
+            ::syscall(SYS_futex,
+                reinterpret_cast<std::uint32_t*>(&hdr.doorbell_), FUTEX_WAKE,
+                1, nullptr, nullptr, 0);
+        }
+    }
+
+    void segment::wait(std::uint32_t expected,
+        std::chrono::nanoseconds timeout) const noexcept
+    {
+        auto const secs =
+            std::chrono::duration_cast<std::chrono::seconds>(timeout);
+
+        timespec ts{};
+        ts.tv_sec = static_cast<time_t>(secs.count());
+        ts.tv_nsec = static_cast<long>((timeout - secs).count());
+
+        // the result is deliberately ignored, the caller re-checks the
+        // channels in any case
+        ::syscall(SYS_futex,
+            reinterpret_cast<std::uint32_t*>(&header().doorbell_), FUTEX_WAIT,
+            expected, &ts, nullptr, 0);
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,170 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/execution_base.hpp>
+#include <hpx/modules/serialization.hpp>
+
+#include <hpx/parcelport_shmem/segment.hpp>
+#include <hpx/parcelport_shmem/sender.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    void sender::write_message(std::error_code& ec)
+    {
+        using transmission_chunk_type =
+            parcel_buffer_type::transmission_chunk_type;
+
+        // the pieces to transfer are the main buffer holding the data which
+        // was serialized normally, followed by the zero-copy chunks
+        std::vector<std::pair<void const*, std::size_t>> pieces;
+        pieces.reserve(buffer_.num_chunks_.first + 1);
+        pieces.emplace_back(buffer_.data_.data(), buffer_.data_.size());
+        for (serialization::serialization_chunk const& c : buffer_.chunks_)
+        {
+            if (c.type_ == serialization::chunk_type::chunk_type_pointer)
+            {
+                pieces.emplace_back(c.data_.cpos_, c.size_);
+            }
+        }
+
+        std::vector<transmission_chunk_type> const& chunks =
+            buffer_.transmission_chunks_;
+
+        std::uint64_t const capacity = segment_->channel_size();
+        std::uint64_t const prefix_size = sizeof(message_header) +
+            chunks.size() * sizeof(transmission_chunk_type) +
+            pieces.size() * sizeof(piece_descriptor);
+
+        // Decide which pieces go out of band. Those are copied into a shared
+        // memory object of their own which is mapped by the receiver, this
+        // keeps large chunks from blocking the ring buffer. Everything has
+        // to go out of band if the message would not fit otherwise.
+        std::vector<piece_descriptor> descriptors(pieces.size());
+        std::vector<shared_memory_region> out_of_band;
+        std::uint64_t frame_size = prefix_size;
+        for (std::size_t i = 0; i != pieces.size(); ++i)
+        {
+            piece_descriptor& desc = descriptors[i];
+            std::size_t const size = pieces[i].second;
+
+            desc.size_ = size;
+            desc.out_of_band_ = 0;
+
+            std::uint64_t const aligned_size = align_message(size);
+            if ((size == 0 || size < out_of_band_threshold_) &&
+                frame_size + aligned_size <= capacity)
+            {
+                frame_size += aligned_size;
+                continue;
+            }
+
+            std::string const name =
+                out_of_band_name(segment_->name(), token_);
+            HPX_ASSERT(name.size() < piece_descriptor::max_name_length);
+
+            shared_memory_region region =
+                shared_memory_region::create(name, size, ec);
+            if (ec)
+            {
+                return;
+            }
+
+            std::memcpy(region.data(), pieces[i].first, size);
+
+            desc.out_of_band_ = 1;
+            std::memset(desc.name_, 0, sizeof(desc.name_));
+            std::memcpy(desc.name_, name.data(), name.size());
+            out_of_band.push_back(HPX_MOVE(region));
+        }
+
+        if (frame_size > capacity)
+        {
+            ec = std::make_error_code(std::errc::message_size);
+            return;
+        }
+
+        // wait for the receiver to make enough room in the ring buffer
+        channel_header& ch = segment_->channel(channel_);
+        std::uint64_t const head = ch.head_.load(std::memory_order_relaxed);
+
+        hpx::util::yield_while(
+            [&]() {
+                return capacity -
+                    (head - ch.tail_.load(std::memory_order_acquire)) <
+                    frame_size &&
+                    segment_->is_alive();
+            },
+            "shmem::sender::write_message");
+
+        if (!segment_->is_alive())
+        {
+            ec = std::make_error_code(std::errc::not_connected);
+            return;
+        }
+
+        // copy the message into the ring buffer
+        message_header hdr;
+        hdr.frame_size_ = frame_size;
+        hdr.size_ = buffer_.size_;
+        hdr.data_size_ = buffer_.data_size_;
+        hdr.num_zero_copy_chunks_ = buffer_.num_chunks_.first;
+        hdr.num_non_zero_copy_chunks_ = buffer_.num_chunks_.second;
+
+        std::uint64_t pos = head;
+        segment_->write(channel_, pos, &hdr, sizeof(hdr));
+        pos += sizeof(hdr);
+
+        if (!chunks.empty())
+        {
+            std::size_t const size =
+                chunks.size() * sizeof(transmission_chunk_type);
+            segment_->write(channel_, pos, chunks.data(), size);
+            pos += size;
+        }
+
+        segment_->write(channel_, pos, descriptors.data(),
+            descriptors.size() * sizeof(piece_descriptor));
+        pos += descriptors.size() * sizeof(piece_descriptor);
+
+        for (std::size_t i = 0; i != pieces.size(); ++i)
+        {
+            if (descriptors[i].out_of_band_ == 0)
+            {
+                segment_->write(
+                    channel_, pos, pieces[i].first, pieces[i].second);
+                pos += align_message(pieces[i].second);
+            }
+        }
+        HPX_ASSERT(pos - head == frame_size);
+
+        // the receiver removes the names of the out of band objects once it
+        // has mapped them (or when it shuts down), their memory is released
+        // when the receiver unmaps them
+        for (shared_memory_region& region : out_of_band)
+        {
+            region.detach();
+        }
+
+        // publish the message and wake up the receiver
+        ch.head_.store(head + frame_size, std::memory_order_release);
+        segment_->notify();
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,178 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Send parcels of various sizes through the shared memory parcelport. The
+// channels are configured to be small, which makes messages wrap around the
+// end of the ring buffers, and makes larger chunks go out of band.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t const numparcels_default = 10;
+
+// the sizes (in elements) of the sent vectors, ranging from messages which
+// fit into the ring buffer to vectors larger than a channel
+std::size_t const vsizes[] = {0, 1, 100, 1000, 10000, 100000};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Action, typename T>
+hpx::parcelset::parcel generate_parcel(
+    hpx::id_type const& dest_id, hpx::id_type const& cont, T&& data)
+{
+    hpx::naming::address addr;
+    hpx::naming::gid_type dest = dest_id.get_gid();
+    hpx::parcelset::parcel p(hpx::parcelset::detail::create_parcel::call(
+        std::move(dest), std::move(addr),
+        hpx::actions::typed_continuation<double>(cont), Action(),
+        hpx::threads::thread_priority::normal, std::forward<T>(data)));
+
+    p.set_source_id(hpx::find_here());
+    p.size() = 4096;
+    return p;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+double accumulate(std::vector<double> const& data)
+{
+    return std::accumulate(data.begin(), data.end(), 0.0);
+}
+HPX_PLAIN_ACTION(accumulate)
+
+std::vector<double> make_data(std::size_t size)
+{
+    std::vector<double> data(size);
+    std::generate(
+        data.begin(), data.end(), []() { return double(std::rand() % 100); });
+    return data;
+}
+
+void test_put_parcels(hpx::id_type const& id, std::size_t size)
+{
+    std::vector<double> expected;
+    expected.reserve(numparcels_default);
+
+    std::vector<hpx::future<double>> results;
+    results.reserve(numparcels_default);
+
+    // create parcels
+    std::vector<hpx::parcelset::parcel> parcels;
+    for (std::size_t i = 0; i != numparcels_default; ++i)
+    {
+        std::vector<double> data = make_data(size);
+        expected.push_back(accumulate(data));
+
+        hpx::distributed::promise<double> p;
+        results.push_back(p.get_future());
+        parcels.push_back(
+            generate_parcel<accumulate_action>(id, p.get_id(), data));
+    }
+
+    // send parcels
+    hpx::get_runtime_distributed().get_parcel_handler().put_parcels(
+        std::move(parcels));
+
+    // verify that all data has arrived intact
+    hpx::wait_all(results);
+
+    for (std::size_t i = 0; i != numparcels_default; ++i)
+    {
+        HPX_TEST_EQ(results[i].get(), expected[i]);
+    }
+}
+
+void test_async(hpx::id_type const& id, std::size_t size)
+{
+    std::vector<double> expected;
+    expected.reserve(numparcels_default);
+
+    std::vector<hpx::future<double>> results;
+    results.reserve(numparcels_default);
+
+    for (std::size_t i = 0; i != numparcels_default; ++i)
+    {
+        std::vector<double> data = make_data(size);
+        expected.push_back(accumulate(data));
+        results.push_back(hpx::async(accumulate_action(), id, data));
+    }
+
+    hpx::wait_all(results);
+
+    for (std::size_t i = 0; i != numparcels_default; ++i)
+    {
+        HPX_TEST_EQ(results[i].get(), expected[i]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        for (std::size_t const size : vsizes)
+        {
+            test_put_parcels(id, size);
+            test_async(id, size);
+        }
+    }
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+         "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    // explicitly disable message handlers (parcel coalescing), use small
+    // channels
+    std::vector<std::string> const cfg = {
+        "hpx.parcel.message_handlers=0",
+        "hpx.parcel.shmem.channel_size!=65536",
+        "hpx.parcel.shmem.out_of_band_threshold!=16384",
+    };
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,141 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// All localities concurrently send messages of random sizes to all other
+// localities through the shared memory parcelport. The number of channels
+// equals the number of connections per locality, the channels are small,
+// which keeps the senders waiting for the receivers to make room.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t checksum(std::vector<std::uint8_t> const& data)
+{
+    return std::accumulate(data.begin(), data.end(), std::uint64_t(0));
+}
+HPX_PLAIN_ACTION(checksum)
+
+///////////////////////////////////////////////////////////////////////////////
+void send_messages(
+    std::size_t num_messages, std::size_t max_size, unsigned int seed)
+{
+    std::vector<hpx::id_type> const localities =
+        hpx::find_remote_localities();
+
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<std::size_t> dist_size(0, max_size);
+
+    std::vector<std::uint64_t> expected;
+    expected.reserve(num_messages);
+
+    std::vector<hpx::future<std::uint64_t>> results;
+    results.reserve(num_messages);
+
+    for (std::size_t i = 0; i != num_messages; ++i)
+    {
+        std::vector<std::uint8_t> data(dist_size(gen));
+        for (std::uint8_t& c : data)
+        {
+            c = static_cast<std::uint8_t>(gen());
+        }
+
+        expected.push_back(checksum(data));
+        results.push_back(hpx::async(
+            checksum_action(), localities[i % localities.size()], data));
+    }
+
+    hpx::wait_all(results);
+
+    for (std::size_t i = 0; i != num_messages; ++i)
+    {
+        HPX_TEST_EQ(results[i].get(), expected[i]);
+    }
+}
+HPX_PLAIN_ACTION(send_messages)
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+
+    std::size_t const num_messages = vm["messages"].as<std::size_t>();
+    std::size_t const max_size = vm["max-size"].as<std::size_t>();
+    std::size_t const num_tasks = vm["tasks"].as<std::size_t>();
+
+    // run several senders on every locality at the same time
+    std::vector<hpx::future<void>> senders;
+    for (hpx::id_type const& id : hpx::find_all_localities())
+    {
+        for (std::size_t i = 0; i != num_tasks; ++i)
+        {
+            senders.push_back(hpx::async(send_messages_action(), id,
+                num_messages, max_size, seed++));
+        }
+    }
+
+    hpx::wait_all(senders);
+    for (hpx::future<void>& f : senders)
+    {
+        HPX_TEST(!f.has_exception());
+    }
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+         "the random number generator seed to use for this run")
+        ("messages", value<std::size_t>()->default_value(200),
+         "the number of messages sent by each task")
+        ("max-size", value<std::size_t>()->default_value(200000),
+         "the maximal size of the messages in bytes")
+        ("tasks", value<std::size_t>()->default_value(8),
+         "the number of sending tasks on each locality")
+        ;
+    // clang-format on
+
+    std::vector<std::string> const cfg = {
+        "hpx.parcel.shmem.channels!=4",
+        "hpx.parcel.shmem.max_connections_per_locality!=4",
+        "hpx.parcel.shmem.channel_size!=65536",
+        "hpx.parcel.shmem.out_of_band_threshold!=16384",
+    };
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -46,6 +46,7 @@ namespace hpx::parcelset {
         using send_early_parcel = std::true_type;
         using do_background_work = std::false_type;
         using send_immediate_parcels = std::false_type;
+        using send_batched_messages = std::true_type;
 
         static constexpr const char* type() noexcept
         {
@@ -114,6 +115,14 @@ namespace hpx::parcelset {
             /// Acceptor used to listen for incoming connections.
             asio::ip::tcp::acceptor* acceptor_;
 
+            /// Limits of the batch of messages sent by a single (gathered)
+            /// write operation
+            std::size_t max_batch_size_;
+            std::size_t max_batch_iov_;
+
+            /// Size of the buffer incoming data is read into
+            std::size_t receive_buffer_size_;
+
             /// The list of accepted connections
             mutable hpx::spinlock connections_mtx_;
 
@@ -38,8 +38,10 @@
 #undef VT1
 #undef VT2
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <mutex>
 #include <system_error>
@@ -50,15 +52,34 @@ namespace hpx::parcelset::policies::tcp {
 
     class connection_handler;
 
+    // The receiving end of a TCP connection. The sender transmits batches of
+    // framed messages, each batch is preceded by the number of messages it
+    // holds and is acknowledged as a whole. Incoming data is read into a
+    // receive buffer from which as many messages as available are parsed,
+    // large message parts are read directly into their destination.
     class receiver
       : public parcelport_connection<receiver, std::vector<char>,
             std::vector<char>>
     {
+        enum receive_state
+        {
+            state_batch_header,
+            state_header,
+            state_data,
+            state_chunks
+        };
+
     public:
         receiver(asio::io_context& io_service, std::uint64_t max_inbound_size,
-            connection_handler& parcelport)
+            std::size_t receive_buffer_size, connection_handler& parcelport)
           : socket_(io_service)
           , max_inbound_size_(max_inbound_size)
+          , receive_buffer_(receive_buffer_size)
+          , receive_begin_(0)
+          , receive_end_(0)
+          , pending_index_(0)
+          , state_(state_batch_header)
+          , batch_size_(0)
           , ack_(0)
           , parcelport_(parcelport)
           , mtx_()
@@ -77,55 +98,18 @@ namespace hpx::parcelset::policies::tcp {
             return socket_;
         }
 
-        // Asynchronously read a data structure from the socket.
+        // Asynchronously read the next batch of messages from the socket.
         template <typename Handler>
         void async_read(Handler handler)
         {
             HPX_ASSERT(buffer_.data_.empty());
 
-            // Store the time of the begin of the read operation
-#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
-            parcelset::data_point& data = buffer_.data_point_;
-            data.time_ = timer_.elapsed_nanoseconds();
-            data.serialization_time_ = 0;
-            data.bytes_ = 0;
-            data.num_parcels_ = 0;
-#endif
-            // Issue a read operation to read the message size.
-            using asio::buffer;
-            std::vector<asio::mutable_buffer> buffers;
-            buffers.push_back(buffer(&buffer_.size_, sizeof(buffer_.size_)));
-            buffers.push_back(
-                buffer(&buffer_.data_size_, sizeof(buffer_.data_size_)));
-
-            buffers.push_back(
-                buffer(&buffer_.num_chunks_, sizeof(buffer_.num_chunks_)));
-
-            {
-                std::unique_lock lk(mtx_);
-                if (!socket_.is_open())
-                {
-                    lk.unlock();
-                    // report this problem back to the handler
-                    handler(asio::error::make_error_code(
-                        asio::error::not_connected));
-                    return;
-                }
-#if defined(__linux) || defined(linux) || defined(__linux__)
-                asio::detail::socket_option::boolean<IPPROTO_TCP, TCP_QUICKACK>
-                    quickack(true);
-                socket_.set_option(quickack);
-#endif
-
-                void (receiver::*f)(std::error_code const&, std::size_t,
-                    Handler) = &receiver::handle_read_header<Handler>;
+            // Issue a read operation to read the number of messages in the
+            // batch.
+            state_ = state_batch_header;
+            set_pending(asio::buffer(&batch_size_, sizeof(batch_size_)));
 
-                asio::async_read(socket_, buffers,
-                    hpx::bind(f, shared_from_this(),
-                        placeholders::_1,    // error
-                        placeholders::_2,    // bytes_transferred
-                        util::protect(handler)));
-            }
+            continue_read(HPX_MOVE(handler));
         }
 
         void shutdown()
@@ -147,217 +131,354 @@ namespace hpx::parcelset::policies::tcp {
         }
 
     private:
-        // Handle a completed read of the message size from the
-        // message header.
-        template <typename Handler>
-        void handle_read_header(std::error_code const& e,
-            std::size_t /* bytes_transferred */, Handler handler)
+        void set_pending(asio::mutable_buffer const& b)
         {
-            HPX_ASSERT(operation_in_flight_ == 0);
-            if (e)
+            pending_.clear();
+            pending_.push_back(b);
+            pending_index_ = 0;
+        }
+
+        // Copy as much of the data held by the receive buffer as possible
+        // into the buffers of the current receive state, returns whether
+        // all of those have been filled.
+        bool consume_receive_buffer() noexcept
+        {
+            while (pending_index_ != pending_.size())
             {
-                handler(e);
+                asio::mutable_buffer& b = pending_[pending_index_];
+                std::size_t const n =
+                    (std::min)(b.size(), receive_end_ - receive_begin_);
+                if (n != 0)
+                {
+                    std::memcpy(
+                        b.data(), receive_buffer_.data() + receive_begin_, n);
+                    receive_begin_ += n;
+                    b += n;
+                }
 
-                // Issue a read operation to read the next parcel.
-                //                 async_read(handler);
+                if (b.size() != 0)
+                {
+                    return false;
+                }
+                ++pending_index_;
             }
-            else
-            {
-                ++operation_in_flight_;
+            return true;
+        }
 
-                // Determine the length of the serialized data.
-                std::uint64_t inbound_size = buffer_.size_;
+        std::size_t pending_bytes() const noexcept
+        {
+            std::size_t result = 0;
+            for (std::size_t i = pending_index_; i != pending_.size(); ++i)
+            {
+                result += pending_[i].size();
+            }
+            return result;
+        }
 
-                if (inbound_size > max_inbound_size_)
+        // Parse all messages available in the receive buffer and issue the
+        // next read operation.
+        template <typename Handler>
+        void continue_read(Handler handler)
+        {
+            while (consume_receive_buffer())
+            {
+                if (!next_state(handler))
                 {
-                    // report this problem back to the handler
-                    handler(asio::error::make_error_code(
-                        asio::error::operation_not_supported));
                     return;
                 }
+            }
 
-#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
-                buffer_.data_point_.bytes_ =
-                    static_cast<std::size_t>(inbound_size);
-#endif
-                // receive buffers
-                std::vector<asio::mutable_buffer> buffers;
+            HPX_ASSERT(receive_begin_ == receive_end_);
+            receive_begin_ = 0;
+            receive_end_ = 0;
 
-                // determine the size of the chunk buffer
-                std::size_t num_zero_copy_chunks = static_cast<std::size_t>(
-                    static_cast<std::uint32_t>(buffer_.num_chunks_.first));
-                std::size_t num_non_zero_copy_chunks = static_cast<std::size_t>(
-                    static_cast<std::uint32_t>(buffer_.num_chunks_.second));
+            std::unique_lock lk(mtx_);
+            if (!socket_.is_open())
+            {
+                lk.unlock();
 
-                void (receiver::*f)(std::error_code const&, Handler) = nullptr;
+                // report this problem back to the handler
+                report_error(handler,
+                    asio::error::make_error_code(asio::error::not_connected));
+                return;
+            }
 
-                if (num_zero_copy_chunks != 0)
-                {
-                    using transmission_chunk_type =
-                        parcel_buffer_type::transmission_chunk_type;
+#if defined(__linux) || defined(linux) || defined(__linux__)
+            asio::detail::socket_option::boolean<IPPROTO_TCP, TCP_QUICKACK>
+                quickack(true);
+            socket_.set_option(quickack);
+#endif
+            void (receiver::*f)(std::error_code const&, std::size_t,
+                Handler) = nullptr;
 
-                    std::vector<transmission_chunk_type>& chunks =
-                        buffer_.transmission_chunks_;
+            if (pending_bytes() >= receive_buffer_.size())
+            {
+                // Large message parts are read directly into their
+                // destination.
+                f = &receiver::handle_read_pending<Handler>;
+                asio::async_read(socket_,
+                    std::vector<asio::mutable_buffer>(
+                        pending_.begin() + pending_index_, pending_.end()),
+                    hpx::bind(f, shared_from_this(),
+                        placeholders::_1,    // error
+                        placeholders::_2,    // bytes_transferred
+                        util::protect(handler)));
+            }
+            else
+            {
+                // Read whatever is available, this possibly includes several
+                // messages.
+                f = &receiver::handle_read_some<Handler>;
+                socket_.async_read_some(asio::buffer(receive_buffer_),
+                    hpx::bind(f, shared_from_this(),
+                        placeholders::_1,    // error
+                        placeholders::_2,    // bytes_transferred
+                        util::protect(handler)));
+            }
+        }
 
-                    chunks.resize(static_cast<std::size_t>(
-                        num_zero_copy_chunks + num_non_zero_copy_chunks));
+        // Handle a completed read into the receive buffer.
+        template <typename Handler>
+        void handle_read_some(
+            std::error_code const& e, std::size_t bytes_transferred,
+            Handler handler)
+        {
+            if (e)
+            {
+                report_error(handler, e);
+                return;
+            }
 
-                    buffers.push_back(asio::buffer(chunks.data(),
-                        chunks.size() * sizeof(transmission_chunk_type)));
+            receive_end_ += bytes_transferred;
+            continue_read(HPX_MOVE(handler));
+        }
 
-                    // add main buffer holding data which was serialized normally
-                    buffer_.data_.resize(
-                        static_cast<std::size_t>(inbound_size));
-                    buffers.push_back(asio::buffer(buffer_.data_));
+        // Handle a completed read directly into the buffers of the current
+        // receive state.
+        template <typename Handler>
+        void handle_read_pending(std::error_code const& e,
+            std::size_t /* bytes_transferred */, Handler handler)
+        {
+            if (e)
+            {
+                report_error(handler, e);
+                return;
+            }
 
-                    // Start an asynchronous call to receive the data.
-                    f = &receiver::handle_read_chunk_data<Handler>;
-                }
-                else
-                {
-                    // add main buffer holding data which was serialized normally
-                    buffer_.data_.resize(
-                        static_cast<std::size_t>(inbound_size));
-                    buffers.push_back(asio::buffer(buffer_.data_));
+            pending_index_ = pending_.size();
+            continue_read(HPX_MOVE(handler));
+        }
 
-                    // Start an asynchronous call to receive the data.
-                    f = &receiver::handle_read_data<Handler>;
-                }
+        template <typename Handler>
+        void report_error(Handler& handler, std::error_code const& e)
+        {
+            handler(e);
 
-                {
-                    std::unique_lock lk(mtx_);
-                    if (!socket_.is_open())
-                    {
-                        lk.unlock();
+            // the operation is in flight as soon as the batch header has
+            // been received
+            if (state_ != state_batch_header)
+            {
+                --operation_in_flight_;
+            }
 
-                        // report this problem back to the handler
-                        handler(asio::error::make_error_code(
-                            asio::error::not_connected));
-                        return;
-                    }
+            // Issue a read operation to read the next parcel.
+            //                 async_read(handler);
+        }
 
-#if defined(__linux) || defined(linux) || defined(__linux__)
-                    asio::detail::socket_option::boolean<IPPROTO_TCP,
-                        TCP_QUICKACK>
-                        quickack(true);
-                    socket_.set_option(quickack);
+        void start_message()
+        {
+            // Store the time of the begin of the read operation
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            parcelset::data_point& data = buffer_.data_point_;
+            data.time_ = timer_.elapsed_nanoseconds();
+            data.serialization_time_ = 0;
+            data.bytes_ = 0;
+            data.num_parcels_ = 0;
 #endif
-                    asio::async_read(socket_, buffers,
-                        hpx::bind(f, shared_from_this(),
-                            placeholders::_1,    // error,
-                            util::protect(handler)));
-                }
-            }
+            // read the message size and the chunk description
+            pending_.clear();
+            pending_.push_back(
+                asio::buffer(&buffer_.size_, sizeof(buffer_.size_)));
+            pending_.push_back(
+                asio::buffer(&buffer_.data_size_, sizeof(buffer_.data_size_)));
+            pending_.push_back(
+                asio::buffer(&buffer_.num_chunks_, sizeof(buffer_.num_chunks_)));
+            pending_index_ = 0;
+
+            state_ = state_header;
         }
 
-        // Handle a completed read of message data.
+        // All buffers of the current state have been filled, set up the next
+        // state. Returns false if no further data should be parsed.
         template <typename Handler>
-        void handle_read_chunk_data(std::error_code const& e, Handler handler)
+        bool next_state(Handler& handler)
         {
-            if (e)
+            switch (state_)
             {
-                handler(e);
-                --operation_in_flight_;
-
-                // Issue a read operation to read the next parcel.
-                //                 async_read(handler);
-            }
-            else
+            case state_batch_header:
             {
-                // receive buffers
-                std::vector<asio::mutable_buffer> buffers;
-
-                // add appropriately sized chunk buffers for the zero-copy data
-                std::size_t num_zero_copy_chunks = static_cast<std::size_t>(
-                    static_cast<std::uint32_t>(buffer_.num_chunks_.first));
-
-                buffer_.chunks_.resize(num_zero_copy_chunks);
-                for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
+                if (batch_size_ == 0)
                 {
-                    std::size_t chunk_size = static_cast<std::size_t>(
-                        buffer_.transmission_chunks_[i].second);
-                    buffer_.chunks_[i].resize(chunk_size);
-                    buffers.push_back(
-                        asio::buffer(buffer_.chunks_[i].data(), chunk_size));
+                    // report this problem back to the handler
+                    report_error(handler,
+                        asio::error::make_error_code(
+                            asio::error::invalid_argument));
+                    return false;
                 }
 
-                // Start an asynchronous call to receive the data.
-                void (receiver::*f)(std::error_code const&, Handler) =
-                    &receiver::handle_read_data<Handler>;
+                ++operation_in_flight_;
+                start_message();
+                return true;
+            }
+
+            case state_header:
+                return handle_read_header(handler);
 
+            case state_data:
+            {
+                if (buffer_.num_chunks_.first != 0)
                 {
-                    std::unique_lock lk(mtx_);
-                    if (!socket_.is_open())
-                    {
-                        lk.unlock();
+                    handle_read_chunk_data();
+                    return true;
+                }
+                return handle_read_data(handler);
+            }
 
-                        // report this problem back to the handler
-                        handler(asio::error::make_error_code(
-                            asio::error::not_connected));
-                        return;
-                    }
+            case state_chunks:
+                return handle_read_data(handler);
 
-#if defined(__linux) || defined(linux) || defined(__linux__)
-                    asio::detail::socket_option::boolean<IPPROTO_TCP,
-                        TCP_QUICKACK>
-                        quickack(true);
-                    socket_.set_option(quickack);
-#endif
-                    asio::async_read(socket_, buffers,
-                        hpx::bind(f, shared_from_this(),
-                            placeholders::_1,    // error,
-                            util::protect(handler)));
-                }
+            default:
+                break;
             }
+
+            HPX_ASSERT(false);
+            return false;
         }
 
-        // Handle a completed read of message data.
+        // Handle a completed read of the message header.
         template <typename Handler>
-        void handle_read_data(std::error_code const& e, Handler handler)
+        bool handle_read_header(Handler& handler)
         {
-            if (e)
+            // Determine the length of the serialized data.
+            std::uint64_t inbound_size = buffer_.size_;
+
+            if (inbound_size > max_inbound_size_)
             {
-                handler(e);
-                --operation_in_flight_;
+                // report this problem back to the handler
+                report_error(handler,
+                    asio::error::make_error_code(
+                        asio::error::operation_not_supported));
+                return false;
+            }
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.bytes_ = static_cast<std::size_t>(inbound_size);
+#endif
+            // determine the size of the chunk buffer
+            std::size_t num_zero_copy_chunks = static_cast<std::size_t>(
+                static_cast<std::uint32_t>(buffer_.num_chunks_.first));
+            std::size_t num_non_zero_copy_chunks = static_cast<std::size_t>(
+                static_cast<std::uint32_t>(buffer_.num_chunks_.second));
+
+            // draw the main buffer from the pool of the parcelport, it is
+            // handed back once the parcels have been decoded
+            parcelport_.get_buffer_pool().reserve(
+                buffer_.data_, static_cast<std::size_t>(inbound_size));
+
+            pending_.clear();
+            pending_index_ = 0;
+
+            if (num_zero_copy_chunks != 0)
+            {
+                using transmission_chunk_type =
+                    parcel_buffer_type::transmission_chunk_type;
 
-                // Issue a read operation to read the next parcel.
-                //                 async_read(handler);
+                std::vector<transmission_chunk_type>& chunks =
+                    buffer_.transmission_chunks_;
+
+                chunks.resize(static_cast<std::size_t>(
+                    num_zero_copy_chunks + num_non_zero_copy_chunks));
+
+                pending_.push_back(asio::buffer(chunks.data(),
+                    chunks.size() * sizeof(transmission_chunk_type)));
             }
-            else
+
+            // add main buffer holding data which was serialized normally
+            buffer_.data_.resize(static_cast<std::size_t>(inbound_size));
+            pending_.push_back(asio::buffer(buffer_.data_));
+
+            state_ = state_data;
+            return true;
+        }
+
+        // Handle a completed read of the chunk description, set up the
+        // buffers for the zero-copy chunks.
+        void handle_read_chunk_data()
+        {
+            // add appropriately sized chunk buffers for the zero-copy data
+            std::size_t num_zero_copy_chunks = static_cast<std::size_t>(
+                static_cast<std::uint32_t>(buffer_.num_chunks_.first));
+
+            pending_.clear();
+            pending_index_ = 0;
+
+            buffer_.chunks_.resize(num_zero_copy_chunks);
+            for (std::size_t i = 0; i != num_zero_copy_chunks; ++i)
             {
-                // complete data point and pass it along
+                std::size_t chunk_size = static_cast<std::size_t>(
+                    buffer_.transmission_chunks_[i].second);
+                buffer_.chunks_[i].resize(chunk_size);
+                pending_.push_back(
+                    asio::buffer(buffer_.chunks_[i].data(), chunk_size));
+            }
+
+            state_ = state_chunks;
+        }
+
+        // Handle a completed read of message data.
+        template <typename Handler>
+        bool handle_read_data(Handler& handler)
+        {
+            // complete data point and pass it along
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
-                buffer_.data_point_.time_ =
-                    timer_.elapsed_nanoseconds() - buffer_.data_point_.time_;
+            buffer_.data_point_.time_ =
+                timer_.elapsed_nanoseconds() - buffer_.data_point_.time_;
 #endif
-                // now send acknowledgment byte
-                void (receiver::*f)(std::error_code const&, Handler) =
-                    &receiver::handle_write_ack<Handler>;
+            // decode the received parcels.
+            decode_parcels(parcelport_, HPX_MOVE(buffer_), std::size_t(-1));
+            buffer_ = parcel_buffer_type();
 
-                // decode the received parcels.
-                decode_parcels(parcelport_, HPX_MOVE(buffer_), std::size_t(-1));
-                buffer_ = parcel_buffer_type();
+            // continue with the next message of this batch, if any
+            if (--batch_size_ != 0)
+            {
+                start_message();
+                return true;
+            }
+
+            // now send acknowledgment byte for the whole batch
+            void (receiver::*f)(std::error_code const&, Handler) =
+                &receiver::handle_write_ack<Handler>;
 
-                ack_ = true;
+            ack_ = true;
+            {
+                std::unique_lock lk(mtx_);
+                if (!socket_.is_open())
                 {
-                    std::unique_lock lk(mtx_);
-                    if (!socket_.is_open())
-                    {
-                        lk.unlock();
+                    lk.unlock();
 
-                        // report this problem back to the handler
-                        handler(asio::error::make_error_code(
+                    // report this problem back to the handler
+                    report_error(handler,
+                        asio::error::make_error_code(
                             asio::error::not_connected));
-                        return;
-                    }
-
-                    asio::async_write(socket_,
-                        asio::buffer(&ack_, sizeof(ack_)),
-                        hpx::bind(f, shared_from_this(),
-                            placeholders::_1,    // error,
-                            util::protect(handler)));
+                    return false;
                 }
+
+                asio::async_write(socket_, asio::buffer(&ack_, sizeof(ack_)),
+                    hpx::bind(f, shared_from_this(),
+                        placeholders::_1,    // error,
+                        util::protect(handler)));
             }
+            return false;
         }
 
         template <typename Handler>
@@ -369,7 +490,7 @@ namespace hpx::parcelset::policies::tcp {
             handler(e);
             --operation_in_flight_;
 
-            // Issue a read operation to read the next parcel.
+            // Issue a read operation to read the next batch of parcels.
             if (!e)
             {
                 async_read(handler);
@@ -381,6 +502,20 @@ namespace hpx::parcelset::policies::tcp {
 
         std::uint64_t max_inbound_size_;
 
+        // data read from the socket which has not been parsed yet is held in
+        // [receive_begin_, receive_end_)
+        std::vector<char> receive_buffer_;
+        std::size_t receive_begin_;
+        std::size_t receive_end_;
+
+        // the buffers to fill for the current receive state
+        std::vector<asio::mutable_buffer> pending_;
+        std::size_t pending_index_;
+        receive_state state_;
+
+        // number of messages of the current batch still to be received
+        std::uint64_t batch_size_;
+
         bool ack_;
 
         // The handler used to process the incoming request.
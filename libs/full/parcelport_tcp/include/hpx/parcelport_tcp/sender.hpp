@@ -41,6 +41,7 @@
 #undef VT2
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <system_error>
 #include <utility>
@@ -57,17 +58,16 @@ namespace hpx::parcelset::policies::tcp {
     public:
         // Construct a sending parcelport_connection with the given io_context.
         sender(asio::io_context& io_service,
-            parcelset::locality const& locality_id, parcelset::parcelport* pp)
+            parcelset::locality const& locality_id, parcelset::parcelport* pp,
+            std::size_t max_batch_size = 0, std::size_t max_batch_iov = 0)
           : socket_(io_service)
           , ack_(0)
           , there_(locality_id)
-#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
           , pp_(pp)
-#endif
+          , batch_size_(0)
+          , max_batch_size_(max_batch_size)
+          , max_batch_iov_(max_batch_iov)
         {
-#if !defined(HPX_HAVE_PARCELPORT_COUNTERS)
-            HPX_UNUSED(pp);
-#endif
         }
 
         ~sender()
@@ -118,6 +118,40 @@ namespace hpx::parcelset::policies::tcp {
 #endif
         }
 
+        // Return whether a message holding the given number of bytes and
+        // zero-copy chunks can be added to the batch of messages sent by the
+        // next write operation. The batch is limited by the overall number of
+        // bytes and the number of buffers handed to the gathered write.
+        bool can_batch(
+            std::size_t size, std::size_t num_chunks) const noexcept
+        {
+            std::size_t bytes = message_size(buffer_) +
+                message_size(static_cast<std::uint64_t>(size), num_chunks);
+            std::size_t iov =
+                1 + message_iov(buffer_) + message_iov(num_chunks);
+            for (parcel_buffer_type const& b : batch_)
+            {
+                bytes += message_size(b);
+                iov += message_iov(b);
+            }
+            return bytes <= max_batch_size_ && iov <= max_batch_iov_;
+        }
+
+        // Add a new (empty) message to the batch sent by the next write
+        // operation
+        parcel_buffer_type& add_batch_buffer()
+        {
+            return batch_.emplace_back();
+        }
+
+        // Remove the last message added to the batch (used if encoding the
+        // message failed)
+        void remove_batch_buffer() noexcept
+        {
+            HPX_ASSERT(!batch_.empty());
+            batch_.pop_back();
+        }
+
         template <typename Handler, typename ParcelPostprocess>
         void async_write(
             Handler&& handler, ParcelPostprocess&& parcel_postprocess)
@@ -143,19 +177,87 @@ namespace hpx::parcelset::policies::tcp {
             buffer_.data_point_.time_ = timer_.elapsed_nanoseconds();
 #endif
             // Write the serialized data to the socket. We use "gather-write"
-            // to send both the header and the data in a single write operation.
+            // to send the batch header and the headers and the data of all
+            // batched messages in a single write operation.
+            batch_size_ = 1 + batch_.size();
+
             std::vector<asio::const_buffer> buffers;
+            buffers.reserve(max_batch_iov_ != 0 ? max_batch_iov_ : 8);
+            buffers.push_back(asio::buffer(&batch_size_, sizeof(batch_size_)));
+
+            add_message_buffers(buffers, buffer_);
+            for (parcel_buffer_type& b : batch_)
+            {
+                add_message_buffers(buffers, b);
+            }
+
+            // this additional wrapping of the handler into a bind object is
+            // needed to keep  this parcelport_connection object alive for the
+            // whole write operation
+            void (sender::*f)(std::error_code const&, std::size_t) =
+                &sender::handle_write;
+
+            asio::async_write(socket_, buffers,
+                hpx::bind(
+                    f, shared_from_this(), placeholders::_1, placeholders::_2));
+        }
+
+    private:
+        static void reset_handler(postprocess_handler_type handler)
+        {
+            handler.reset();
+        }
+
+        // number of bytes sent for a message of the given size holding the
+        // given number of transmission chunks
+        static std::size_t message_size(
+            std::uint64_t data_size, std::size_t num_chunks) noexcept
+        {
+            return sizeof(parcel_buffer_type::size_) +
+                sizeof(parcel_buffer_type::data_size_) +
+                sizeof(parcel_buffer_type::num_chunks_) +
+                num_chunks *
+                sizeof(parcel_buffer_type::transmission_chunk_type) +
+                static_cast<std::size_t>(data_size);
+        }
+
+        // number of bytes sent for the given message
+        static std::size_t message_size(parcel_buffer_type const& b) noexcept
+        {
+            return message_size(b.data_size_, b.transmission_chunks_.size());
+        }
+
+        // number of buffers handed to the gathered write for a message
+        // holding the given number of zero-copy chunks
+        static constexpr std::size_t message_iov(
+            std::size_t num_chunks) noexcept
+        {
+            return num_chunks == 0 ? 4 : 5 + num_chunks;
+        }
+
+        // number of buffers handed to the gathered write for the given message
+        static std::size_t message_iov(parcel_buffer_type const& b) noexcept
+        {
+            if (b.transmission_chunks_.empty())
+            {
+                return message_iov(0);
+            }
+            return message_iov(static_cast<std::size_t>(b.num_chunks_.first));
+        }
+
+        static void add_message_buffers(
+            std::vector<asio::const_buffer>& buffers, parcel_buffer_type& b)
+        {
+            buffers.push_back(asio::buffer(&b.size_, sizeof(b.size_)));
             buffers.push_back(
-                asio::buffer(&buffer_.size_, sizeof(buffer_.size_)));
-            buffers.push_back(
-                asio::buffer(&buffer_.data_size_, sizeof(buffer_.data_size_)));
+                asio::buffer(&b.data_size_, sizeof(b.data_size_)));
 
             // add chunk description
-            buffers.push_back(asio::buffer(
-                &buffer_.num_chunks_, sizeof(buffer_.num_chunks_)));
+            buffers.push_back(
+                asio::buffer(&b.num_chunks_, sizeof(b.num_chunks_)));
 
             std::vector<parcel_buffer_type::transmission_chunk_type>& chunks =
-                buffer_.transmission_chunks_;
+                b.transmission_chunks_;
             if (!chunks.empty())
             {
                 buffers.push_back(asio::buffer(chunks.data(),
@@ -163,10 +265,10 @@ namespace hpx::parcelset::policies::tcp {
                         sizeof(parcel_buffer_type::transmission_chunk_type)));
 
                 // add main buffer holding data which was serialized normally
-                buffers.push_back(asio::buffer(buffer_.data_));
+                buffers.push_back(asio::buffer(b.data_));
 
                 // now add chunks themselves, those hold zero-copy serialized chunks
-                for (serialization::serialization_chunk& c : buffer_.chunks_)
+                for (serialization::serialization_chunk& c : b.chunks_)
                 {
                     if (c.type_ ==
                         serialization::chunk_type::chunk_type_pointer)
@@ -176,24 +278,8 @@ namespace hpx::parcelset::policies::tcp {
             else
             {
                 // add main buffer holding data which was serialized normally
-                buffers.push_back(asio::buffer(buffer_.data_));
+                buffers.push_back(asio::buffer(b.data_));
             }
-
-            // this additional wrapping of the handler into a bind object is
-            // needed to keep  this parcelport_connection object alive for the
-            // whole write operation
-            void (sender::*f)(std::error_code const&, std::size_t) =
-                &sender::handle_write;
-
-            asio::async_write(socket_, buffers,
-                hpx::bind(
-                    f, shared_from_this(), placeholders::_1, placeholders::_2));
-        }
-
-    private:
-        static void reset_handler(postprocess_handler_type handler)
-        {
-            handler.reset();
         }
 
         /// handle completed write operation
@@ -234,11 +320,16 @@ namespace hpx::parcelset::policies::tcp {
                 return;
             }
 
-            // complete data point and push back onto gatherer
+            // complete data points and push back onto gatherer
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
             buffer_.data_point_.time_ =
                 timer_.elapsed_nanoseconds() - buffer_.data_point_.time_;
             pp_->add_sent_data(buffer_.data_point_);
+            for (parcel_buffer_type& b : batch_)
+            {
+                b.data_point_.time_ = buffer_.data_point_.time_;
+                pp_->add_sent_data(b.data_point_);
+            }
 #endif
 
             // now handle the acknowledgment byte which is sent by the receiver
@@ -262,6 +353,13 @@ namespace hpx::parcelset::policies::tcp {
 #endif
             buffer_.clear();
 
+            // hand the buffers of the batched messages back to the pool
+            for (parcel_buffer_type& b : batch_)
+            {
+                pp_->get_buffer_pool().release(HPX_MOVE(b.data_));
+            }
+            batch_.clear();
+
             // Call post-processing handler, which will send remaining pending
             // parcels. Pass along the connection so it can be reused if more
             // parcels have to be sent.
@@ -280,10 +378,17 @@ namespace hpx::parcelset::policies::tcp {
         // the other (receiving) end of this connection
         parcelset::locality there_;
 
+        parcelset::parcelport* pp_;
+
+        // messages sent along with buffer_ by the next write operation
+        std::vector<parcel_buffer_type> batch_;
+        std::uint64_t batch_size_;
+        std::size_t max_batch_size_;
+        std::size_t max_batch_iov_;
+
         // Counters and their data containers.
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
         hpx::chrono::high_resolution_timer timer_;
-        parcelset::parcelport* pp_;
 #endif
 
         postprocess_handler_type handler_;
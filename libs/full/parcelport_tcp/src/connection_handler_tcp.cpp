@@ -64,6 +64,12 @@ namespace hpx::parcelset::policies::tcp {
         threads::policies::callback_notifier const& notifier)
       : base_type(ini, parcelport_address(ini), notifier)
       , acceptor_(nullptr)
+      , max_batch_size_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel.tcp.max_batch_size", 4194304))
+      , max_batch_iov_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel.tcp.max_batch_iov", 64))
+      , receive_buffer_size_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel.tcp.receive_buffer_size", 65536))
     {
         if (here_.type() != std::string("tcp"))
         {
@@ -97,8 +103,8 @@ namespace hpx::parcelset::policies::tcp {
         {
             try
             {
-                std::shared_ptr<receiver> receiver_conn(new receiver(
-                    io_service, get_max_inbound_message_size(), *this));
+                std::shared_ptr<receiver> receiver_conn(new receiver(io_service,
+                    get_max_inbound_message_size(), receive_buffer_size_, *this));
 
                 tcp::endpoint ep = *it;
                 acceptor_->open(ep.protocol());
@@ -158,7 +164,7 @@ namespace hpx::parcelset::policies::tcp {
         // The parcel gets serialized inside the connection constructor, no
         // need to keep the original parcel alive after this call returned.
         std::shared_ptr<sender> sender_connection(
-            new sender(io_service, l, this));
+            new sender(io_service, l, this, max_batch_size_, max_batch_iov_));
 
         // Connect to the target locality, retry if needed
         std::error_code error = asio::error::try_again;
@@ -287,8 +293,8 @@ namespace hpx::parcelset::policies::tcp {
             std::shared_ptr<receiver> c(receiver_conn);
 
             asio::io_context& io_service = io_service_pool_.get_io_service();
-            receiver_conn.reset(new receiver(
-                io_service, get_max_inbound_message_size(), *this));
+            receiver_conn.reset(new receiver(io_service,
+                get_max_inbound_message_size(), receive_buffer_size_, *this));
             acceptor_->async_accept(receiver_conn->socket(),
                 hpx::bind(&connection_handler::handle_accept, this,
                     placeholders::_1, receiver_conn));
@@ -43,7 +43,10 @@ namespace hpx::traits {
 
         static constexpr char const* call() noexcept
         {
-            return "";
+            return "max_batch_size = ${HPX_PARCEL_TCP_MAX_BATCH_SIZE:4194304}\n"
+                   "max_batch_iov = ${HPX_PARCEL_TCP_MAX_BATCH_IOV:64}\n"
+                   "receive_buffer_size = "
+                   "${HPX_PARCEL_TCP_RECEIVE_BUFFER_SIZE:65536}";
         }
     };
 }    // namespace hpx::traits
@@ -0,0 +1,170 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The TCP parcelport sends the parcels which don't fit into a single message
+// as a batch of messages written at once, each write starts with the number
+// of messages it holds. The outbound messages and the receive buffer are
+// configured to be small, which makes batches hold several messages and
+// makes the receiver see batches split across several reads.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Action, typename T>
+hpx::parcelset::parcel generate_parcel(
+    hpx::id_type const& dest_id, hpx::id_type const& cont, T&& data)
+{
+    hpx::naming::address addr;
+    hpx::naming::gid_type dest = dest_id.get_gid();
+    hpx::parcelset::parcel p(hpx::parcelset::detail::create_parcel::call(
+        std::move(dest), std::move(addr),
+        hpx::actions::typed_continuation<double>(cont), Action(),
+        hpx::threads::thread_priority::normal, std::forward<T>(data)));
+
+    p.set_source_id(hpx::find_here());
+    p.size() = 4096;
+    return p;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+double accumulate(std::vector<double> const& data)
+{
+    return std::accumulate(data.begin(), data.end(), 0.0);
+}
+HPX_PLAIN_ACTION(accumulate)
+
+std::vector<double> make_data(std::size_t size)
+{
+    std::vector<double> data(size);
+    std::generate(
+        data.begin(), data.end(), []() { return double(std::rand() % 100); });
+    return data;
+}
+
+// Send all parcels at once, they are encoded into as many messages as
+// needed, which are sent as one or more batches.
+void test_batch(hpx::id_type const& id, std::size_t num_parcels,
+    std::size_t min_size, std::size_t max_size)
+{
+    std::vector<double> expected;
+    expected.reserve(num_parcels);
+
+    std::vector<hpx::future<double>> results;
+    results.reserve(num_parcels);
+
+    std::vector<hpx::parcelset::parcel> parcels;
+    for (std::size_t i = 0; i != num_parcels; ++i)
+    {
+        std::vector<double> data =
+            make_data(min_size + std::rand() % (max_size - min_size + 1));
+        expected.push_back(accumulate(data));
+
+        hpx::distributed::promise<double> p;
+        results.push_back(p.get_future());
+        parcels.push_back(
+            generate_parcel<accumulate_action>(id, p.get_id(), data));
+    }
+
+    hpx::get_runtime_distributed().get_parcel_handler().put_parcels(
+        std::move(parcels));
+
+    // verify that all messages of the batches have arrived intact
+    hpx::wait_all(results);
+
+    for (std::size_t i = 0; i != num_parcels; ++i)
+    {
+        HPX_TEST_EQ(results[i].get(), expected[i]);
+    }
+}
+
+// Send one parcel at a time, each write holds a single message.
+void test_batch_of_one(hpx::id_type const& id, std::size_t size)
+{
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        std::vector<double> data = make_data(size);
+        HPX_TEST_EQ(
+            hpx::async(accumulate_action(), id, data).get(), accumulate(data));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int) std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        // a batch of one, smaller and larger than the receive buffer
+        test_batch_of_one(id, 1);
+        test_batch_of_one(id, 1000);
+
+        // several small messages per batch, a read holds several messages
+        test_batch(id, 100, 0, 10);
+
+        // several messages per batch, messages are split across reads
+        test_batch(id, 100, 100, 1000);
+
+        // messages larger than the maximal outbound message size
+        test_batch(id, 10, 10000, 20000);
+    }
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+         "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    // explicitly disable message handlers (parcel coalescing), use small
+    // messages and a small receive buffer
+    std::vector<std::string> const cfg = {
+        "hpx.parcel.message_handlers=0",
+        "hpx.parcel.tcp.max_outbound_message_size!=16384",
+        "hpx.parcel.tcp.receive_buffer_size!=1024",
+    };
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -22,7 +22,9 @@
 #include <hpx/naming_base/id_type.hpp>
 #include <hpx/parcelset_base/detail/data_point.hpp>
 #include <hpx/parcelset_base/detail/parcel_route_handler.hpp>
+#include <hpx/parcelset_base/parcel_buffer_pool.hpp>
 #include <hpx/parcelset_base/parcel_interface.hpp>
+#include <hpx/parcelset_base/parcel_trace.hpp>
 
 #if ASIO_HAS_BOOST_THROW_EXCEPTION != 0
 #include <boost/exception/exception.hpp>
@@ -33,6 +35,7 @@
 #include <exception>
 #include <functional>
 #include <system_error>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -129,6 +132,13 @@ namespace hpx::parcelset {
         std::size_t inbound_data_size = static_cast<std::size_t>(
             static_cast<std::uint64_t>(buffer.data_size_));
 
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+        // the parcels contained in the message are known only once decoded
+        bool const tracing = is_parcel_tracing_enabled();
+        std::int64_t const receive_time =
+            tracing ? parcel_trace_timestamp() : 0;
+#endif
+
         // protect from unhandled exceptions bubbling up
         try
         {
@@ -164,6 +174,10 @@ namespace hpx::parcelset {
                         std::size_t archive_pos = archive.current_pos();
                         std::int64_t serialize_time =
                             timer.elapsed_nanoseconds();
+#endif
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+                        std::int64_t const decode_time =
+                            tracing ? parcel_trace_timestamp() : 0;
 #endif
                         // de-serialize parcel and add it to incoming parcel queue
                         parcelset::parcel p;
@@ -176,6 +190,22 @@ namespace hpx::parcelset {
                         bool migrated = p.load_schedule(
                             archive, num_thread, deferred_schedule);
 
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+                        if (tracing)
+                        {
+                            trace_parcel(p, parcel_trace_event::receive,
+                                receive_time);
+                            trace_parcel(p, parcel_trace_event::decode_begin,
+                                decode_time);
+                            trace_parcel(p, parcel_trace_event::decode_end);
+                            if (!migrated && !deferred_schedule)
+                            {
+                                trace_parcel(
+                                    p, parcel_trace_event::action_scheduled);
+                            }
+                        }
+#endif
+
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
                         std::int64_t add_parcel_time =
                             timer.elapsed_nanoseconds();
@@ -244,7 +274,12 @@ namespace hpx::parcelset {
                                         &parcelset::detail::
                                             parcel_route_handler,
                                         threads::thread_priority::normal);
+                                    return;
                                 }
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+                                trace_parcel(
+                                    p, parcel_trace_event::action_scheduled);
+#endif
                             };
 
                             // schedule all but the first parcel on a new thread.
@@ -270,6 +305,13 @@ namespace hpx::parcelset {
                                 &parcelset::detail::parcel_route_handler,
                                 threads::thread_priority::normal);
                         }
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+                        else
+                        {
+                            trace_parcel(deferred_parcels[0],
+                                parcel_trace_event::action_scheduled);
+                        }
+#endif
                     }
                 }
 
@@ -315,6 +357,13 @@ namespace hpx::parcelset {
             LPT_(error).format("decode_message: caught unknown exception.");
             hpx::report_error(std::current_exception());
         }
+
+        // hand the buffer back to the parcelport for reuse
+        if constexpr (std::is_same_v<decltype(buffer.data_),
+                          parcel_buffer_pool::buffer_type>)
+        {
+            pp.get_buffer_pool().release(HPX_MOVE(buffer.data_));
+        }
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -13,6 +13,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/modules/errors.hpp>
 
+#include <hpx/parcelset_base/parcel_trace.hpp>
 #include <hpx/parcelset_base/parcelport.hpp>
 
 #include <cstddef>
@@ -43,6 +44,10 @@ namespace hpx::parcelset::detail {
         void operator()(std::error_code const& e)
         {
             HPX_ASSERT(parcels_.size() == handlers_.size());
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+            trace_parcels(parcels_.data(), parcels_.size(),
+                parcel_trace_event::send_complete);
+#endif
             for (std::size_t i = 0; i < parcels_.size(); ++i)
             {
                 handlers_[i](e, parcels_[i]);
@@ -14,6 +14,7 @@
 
 #include <hpx/parcelset/parcelset_fwd.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
@@ -22,16 +23,21 @@ namespace hpx { namespace parcelset { namespace detail {
     using put_parcel_type = hpx::move_only_function<void(
         parcelset::parcel&&, write_handler_type&&)>;
 
+    // Wait for all futures referenced by the parcel to become ready and split
+    // the credits of the contained GIDs, if needed. This also measures the
+    // size of the serialized parcel and its number of chunks for the given
+    // archive flags and zero-copy threshold, which allows the parcelport to
+    // allocate the send buffer only once.
     void HPX_EXPORT parcel_await_apply(parcelset::parcel&& p,
         write_handler_type&& f, std::uint32_t archive_flags,
-        put_parcel_type pp);
+        put_parcel_type pp, std::size_t zero_copy_serialization_threshold = 0);
 
     using put_parcels_type = hpx::move_only_function<void(
         std::vector<parcelset::parcel>&&, std::vector<write_handler_type>&&)>;
 
     void HPX_EXPORT parcels_await_apply(std::vector<parcelset::parcel>&& p,
         std::vector<write_handler_type>&& f, std::uint32_t archive_flags,
-        put_parcels_type pp);
+        put_parcels_type pp, std::size_t zero_copy_serialization_threshold = 0);
 }}}    // namespace hpx::parcelset::detail
 
 #endif
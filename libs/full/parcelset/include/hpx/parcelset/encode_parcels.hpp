@@ -25,6 +25,7 @@
 #include <hpx/naming/split_gid.hpp>
 #include <hpx/parcelset/parcel.hpp>
 #include <hpx/parcelset/parcelset_fwd.hpp>
+#include <hpx/parcelset_base/parcel_trace.hpp>
 #include <hpx/parcelset_base/parcelport.hpp>
 
 #if ASIO_HAS_BOOST_THROW_EXCEPTION != 0
@@ -37,6 +38,7 @@
 #include <memory>
 #include <string>
 #include <system_error>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -145,6 +147,25 @@ namespace hpx::parcelset {
                 }
             }
         }
+
+        // Return the expected size and number of chunks of the message the
+        // given parcels are encoded into, based on the sizes measured while
+        // awaiting the parcels (see encode_parcels below).
+        inline std::pair<std::size_t, std::size_t> estimate_encoded_size(
+            parcelset::parcel const* ps, std::size_t num_parcels,
+            std::uint64_t max_outbound_size)
+        {
+            std::size_t size = sizeof(std::int64_t);
+            std::size_t num_chunks = 0;
+            for (std::size_t i = 0; i != num_parcels; ++i)
+            {
+                if (size >= max_outbound_size)
+                    break;
+                size += ps[i].size();
+                num_chunks += ps[i].num_chunks();
+            }
+            return {size, num_chunks};
+        }
     }    // namespace detail
 
     template <typename Buffer>
@@ -190,7 +211,24 @@ namespace hpx::parcelset {
                     num_chunks += ps[parcels_sent].num_chunks();
                 }
 
-                buffer.data_.reserve(arg_size);
+                // The sizes and chunk counts were measured while awaiting the
+                // parcels, which allows to allocate the buffer only once. A
+                // filter may generate more data than it was given, though.
+                std::size_t const buffer_size = filter.get() != nullptr ?
+                    filter->get_max_compressed_length(arg_size) :
+                    arg_size;
+
+                // draw the buffer from the pool of the parcelport, if
+                // possible
+                if constexpr (std::is_same_v<decltype(buffer.data_),
+                                  parcel_buffer_pool::buffer_type>)
+                {
+                    pp.get_buffer_pool().reserve(buffer.data_, buffer_size);
+                }
+                else
+                {
+                    buffer.data_.reserve(buffer_size);
+                }
                 buffer.chunks_.reserve(num_chunks);
 
                 // mark start of serialization
@@ -201,7 +239,7 @@ namespace hpx::parcelset {
                     // Serialize the data
                     if (filter.get() != nullptr)
                     {
-                        filter->set_max_length(buffer.data_.capacity());
+                        filter->set_max_length(arg_size);
                     }
 
                     serialization::output_archive archive(buffer.data_,
@@ -229,7 +267,14 @@ namespace hpx::parcelset {
                             split_gids.set_split_gids(HPX_MOVE(split_gids_map));
                         }
 
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+                        trace_parcel(
+                            ps[i], parcel_trace_event::serialize_begin);
+#endif
                         archive << ps[i];
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+                        trace_parcel(ps[i], parcel_trace_event::serialize_end);
+#endif
 
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
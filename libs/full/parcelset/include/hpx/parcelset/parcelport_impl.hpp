@@ -30,8 +30,10 @@
 #include <hpx/parcelset/detail/call_for_each.hpp>
 #include <hpx/parcelset/detail/parcel_await.hpp>
 #include <hpx/parcelset/encode_parcels.hpp>
+#include <hpx/parcelset_base/parcel_trace.hpp>
 #include <hpx/parcelset_base/parcelport.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstddef>
@@ -260,7 +262,8 @@ namespace hpx::parcelset {
                         enqueue_parcel(dest, HPX_MOVE(p), HPX_MOVE(f));
                         get_connection_and_send_parcels(dest);
                     }
-                });
+                },
+                this->get_zero_copy_serialization_threshold());
         }
 
         void put_parcels(locality const& dest, std::vector<parcel> parcels,
@@ -305,7 +308,8 @@ namespace hpx::parcelset {
 
                         get_connection_and_send_parcels(dest);
                     }
-                });
+                },
+                this->get_zero_copy_serialization_threshold());
         }
 
         void send_early_parcel(locality const& dest, parcel p) override
@@ -524,12 +528,22 @@ namespace hpx::parcelset {
                         HPX_ASSERT(parcels.size() == handlers.size());
                     }
 
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+                    trace_parcels(ps, num_parcels,
+                        parcel_trace_event::connection_acquired);
+#endif
+
                     // encode the parcels
                     auto encoded_buffer = sender->get_new_buffer();
                     encoded_parcels =
                         encode_parcels(*this, ps, num_parcels, encoded_buffer,
                             archive_flags_, get_max_outbound_message_size());
 
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+                    trace_parcels(
+                        ps, encoded_parcels, parcel_trace_event::send);
+#endif
+
                     using handler_type = detail::call_for_each;
 
                     if (sender->parcelport_->async_write(
@@ -611,7 +625,7 @@ namespace hpx::parcelset {
         void enqueue_parcel(
             locality const& locality_id, parcel&& p, write_handler_type&& f)
         {
-            using mapped_type = pending_parcels_map::mapped_type;
+            std::size_t const lane = this->get_parcel_lane(p);
 
             std::unique_lock l(mtx_);
 
@@ -621,7 +635,7 @@ namespace hpx::parcelset {
             util::ignore_while_checking il(&l);
             HPX_UNUSED(il);
 
-            mapped_type& e = pending_parcels_[locality_id];
+            map_second_type& e = pending_parcels_[locality_id][lane];
             hpx::get<0>(e).push_back(HPX_MOVE(p));
             hpx::get<1>(e).push_back(HPX_MOVE(f));
 
@@ -633,7 +647,16 @@ namespace hpx::parcelset {
             std::vector<parcel>&& parcels,
             std::vector<write_handler_type>&& handlers)
         {
-            using mapped_type = pending_parcels_map::mapped_type;
+            HPX_ASSERT(parcels.size() == handlers.size());
+            if (parcels.empty())
+                return;
+
+            // the parcels of a batch usually all belong to the same lane
+            std::size_t const lane = this->get_parcel_lane(parcels.front());
+            bool const same_lane = std::all_of(parcels.begin() + 1,
+                parcels.end(), [this, lane](parcel const& p) {
+                    return this->get_parcel_lane(p) == lane;
+                });
 
             std::unique_lock l(mtx_);
 
@@ -643,32 +666,92 @@ namespace hpx::parcelset {
             util::ignore_while_checking il(&l);
             HPX_UNUSED(il);
 
-            HPX_ASSERT(parcels.size() == handlers.size());
-
-            mapped_type& e = pending_parcels_[locality_id];
-            if (hpx::get<0>(e).empty())
+            pending_parcels_lanes& lanes = pending_parcels_[locality_id];
+            if (same_lane)
             {
-                HPX_ASSERT(hpx::get<1>(e).empty());
-                std::swap(hpx::get<0>(e), parcels);
-                std::swap(hpx::get<1>(e), handlers);
+                map_second_type& e = lanes[lane];
+                if (hpx::get<0>(e).empty())
+                {
+                    HPX_ASSERT(hpx::get<1>(e).empty());
+                    std::swap(hpx::get<0>(e), parcels);
+                    std::swap(hpx::get<1>(e), handlers);
+                }
+                else
+                {
+                    HPX_ASSERT(hpx::get<0>(e).size() == hpx::get<1>(e).size());
+                    std::size_t new_size =
+                        hpx::get<0>(e).size() + parcels.size();
+                    hpx::get<0>(e).reserve(new_size);
+
+                    std::move(parcels.begin(), parcels.end(),
+                        std::back_inserter(hpx::get<0>(e)));
+                    hpx::get<1>(e).reserve(new_size);
+                    std::move(handlers.begin(), handlers.end(),
+                        std::back_inserter(hpx::get<1>(e)));
+                }
             }
             else
             {
-                HPX_ASSERT(hpx::get<0>(e).size() == hpx::get<1>(e).size());
-                std::size_t new_size = hpx::get<0>(e).size() + parcels.size();
-                hpx::get<0>(e).reserve(new_size);
-
-                std::move(parcels.begin(), parcels.end(),
-                    std::back_inserter(hpx::get<0>(e)));
-                hpx::get<1>(e).reserve(new_size);
-                std::move(handlers.begin(), handlers.end(),
-                    std::back_inserter(hpx::get<1>(e)));
+                for (std::size_t i = 0; i != parcels.size(); ++i)
+                {
+                    map_second_type& e =
+                        lanes[this->get_parcel_lane(parcels[i])];
+                    hpx::get<0>(e).push_back(HPX_MOVE(parcels[i]));
+                    hpx::get<1>(e).push_back(HPX_MOVE(handlers[i]));
+                }
             }
 
             parcel_destinations_.insert(locality_id);
             ++num_parcel_destinations_;
         }
 
+        // Move the oldest bulk parcels to the given parcels, limiting their
+        // overall size to the configured bulk message size. This prevents
+        // large transfers from monopolizing the connections to a destination
+        // as urgent parcels queued in the meantime are picked up by the next
+        // send operation.
+        void dequeue_bulk_parcels(map_second_type& bulk,
+            std::vector<parcel>& parcels,
+            std::vector<write_handler_type>& handlers)
+        {
+            std::vector<parcel>& bulk_parcels = hpx::get<0>(bulk);
+            std::vector<write_handler_type>& bulk_handlers =
+                hpx::get<1>(bulk);
+            HPX_ASSERT(bulk_parcels.size() == bulk_handlers.size());
+
+            std::size_t count = bulk_parcels.size();
+            if (std::size_t const max_size = this->get_bulk_message_size();
+                max_size != 0)
+            {
+                // always send at least one parcel
+                std::size_t size = 0;
+                for (count = 0; count != bulk_parcels.size() && size < max_size;
+                     ++count)
+                {
+                    size += bulk_parcels[count].size();
+                }
+            }
+
+            if (count == bulk_parcels.size() && parcels.empty())
+            {
+                std::swap(parcels, bulk_parcels);
+                std::swap(handlers, bulk_handlers);
+                return;
+            }
+
+            parcels.reserve(parcels.size() + count);
+            std::move(bulk_parcels.begin(), bulk_parcels.begin() + count,
+                std::back_inserter(parcels));
+            bulk_parcels.erase(
+                bulk_parcels.begin(), bulk_parcels.begin() + count);
+
+            handlers.reserve(handlers.size() + count);
+            std::move(bulk_handlers.begin(), bulk_handlers.begin() + count,
+                std::back_inserter(handlers));
+            bulk_handlers.erase(
+                bulk_handlers.begin(), bulk_handlers.begin() + count);
+        }
+
         bool dequeue_parcels(locality const& locality_id,
             std::vector<parcel>& parcels,
             std::vector<write_handler_type>& handlers)
@@ -684,29 +767,35 @@ namespace hpx::parcelset {
 
                 // do nothing if parcels have already been picked up by
                 // another thread
-                if (it != pending_parcels_.end() &&
-                    !hpx::get<0>(it->second).empty())
-                {
-                    HPX_ASSERT(it->first == locality_id);
-                    HPX_ASSERT(handlers.size() == 0);
-                    HPX_ASSERT(handlers.size() == parcels.size());
-                    std::swap(parcels, hpx::get<0>(it->second));
-                    HPX_ASSERT(hpx::get<0>(it->second).size() == 0);
-                    std::swap(handlers, hpx::get<1>(it->second));
-                    HPX_ASSERT(handlers.size() == parcels.size());
-
-                    HPX_ASSERT(!handlers.empty());
-                }
-                else
-                {
-                    HPX_ASSERT(hpx::get<1>(it->second).empty());
+                if (it == pending_parcels_.end())
                     return false;
-                }
 
-                parcel_destinations_.erase(locality_id);
+                HPX_ASSERT(it->first == locality_id);
+                HPX_ASSERT(handlers.size() == 0);
+                HPX_ASSERT(handlers.size() == parcels.size());
+
+                // urgent parcels bypass all of the queued bulk parcels
+                map_second_type& urgent = it->second[urgent_lane];
+                std::swap(parcels, hpx::get<0>(urgent));
+                std::swap(handlers, hpx::get<1>(urgent));
+                HPX_ASSERT(hpx::get<0>(urgent).empty());
+
+                map_second_type& bulk = it->second[bulk_lane];
+                dequeue_bulk_parcels(bulk, parcels, handlers);
+                HPX_ASSERT(handlers.size() == parcels.size());
+
+                if (parcels.empty())
+                    return false;
+
+                // the destination stays registered as long as there are bulk
+                // parcels left
+                if (hpx::get<0>(bulk).empty())
+                {
+                    parcel_destinations_.erase(locality_id);
 
-                HPX_ASSERT(0 != num_parcel_destinations_.load());
-                --num_parcel_destinations_;
+                    HPX_ASSERT(0 != num_parcel_destinations_.load());
+                    --num_parcel_destinations_;
+                }
 
                 return true;
             }
@@ -722,17 +811,23 @@ namespace hpx::parcelset {
 
             for (auto& pending : pending_parcels_)
             {
-                auto& parcels = hpx::get<0>(pending.second);
-                if (!parcels.empty())
+                for (map_second_type& lane : pending.second)
                 {
-                    auto& handlers = hpx::get<1>(pending.second);
+                    auto& parcels = hpx::get<0>(lane);
+                    if (parcels.empty())
+                        continue;
+
+                    auto& handlers = hpx::get<1>(lane);
                     dest = pending.first;
                     p = HPX_MOVE(parcels.back());
                     parcels.pop_back();
                     handler = HPX_MOVE(handlers.back());
                     handlers.pop_back();
 
-                    if (parcels.empty())
+                    if (std::all_of(pending.second.begin(),
+                            pending.second.end(), [](map_second_type const& e) {
+                                return hpx::get<0>(e).empty();
+                            }))
                     {
                         pending_parcels_.erase(dest);
                     }
@@ -816,6 +911,11 @@ namespace hpx::parcelset {
                 return;
             }
 
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+            trace_parcels(parcels.data(), parcels.size(),
+                parcel_trace_event::connection_acquired);
+#endif
+
             // send parcels if they didn't get sent by another connection
             send_pending_parcels(locality_id, sender_connection,
                 HPX_MOVE(parcels), HPX_MOVE(handlers));
@@ -855,7 +955,10 @@ namespace hpx::parcelset {
                 pending_parcels_map::iterator it =
                     pending_parcels_.find(locality_id);
                 if (it == pending_parcels_.end() ||
-                    hpx::get<0>(it->second).empty())
+                    std::all_of(it->second.begin(), it->second.end(),
+                        [](map_second_type const& e) {
+                            return hpx::get<0>(e).empty();
+                        }))
                 {
                     return;
                 }
@@ -885,6 +988,39 @@ namespace hpx::parcelset {
                 parcels.size(), sender_connection->buffer_, archive_flags_,
                 this->get_max_outbound_message_size());
 
+            if constexpr (connection_handler_traits<
+                              ConnectionHandler>::send_batched_messages::value)
+            {
+                // encode the parcels which didn't fit into the first message
+                // into further messages sent by the same write operation, as
+                // long as the next message fits into the batch
+                while (num_parcels != 0 && num_parcels != parcels.size())
+                {
+                    auto const [size, num_chunks] =
+                        detail::estimate_encoded_size(&parcels[num_parcels],
+                            parcels.size() - num_parcels,
+                            this->get_max_outbound_message_size());
+                    if (!sender_connection->can_batch(size, num_chunks))
+                        break;
+
+                    std::size_t const encoded = encode_parcels(*this,
+                        &parcels[num_parcels], parcels.size() - num_parcels,
+                        sender_connection->add_batch_buffer(), archive_flags_,
+                        this->get_max_outbound_message_size());
+                    if (encoded == 0)
+                    {
+                        sender_connection->remove_batch_buffer();
+                        break;
+                    }
+                    num_parcels += encoded;
+                }
+            }
+
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+            trace_parcels(
+                parcels.data(), num_parcels, parcel_trace_event::send);
+#endif
+
             using hpx::parcelset::detail::call_for_each;
             if (num_parcels == parcels.size())
             {
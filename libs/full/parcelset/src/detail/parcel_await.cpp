@@ -33,12 +33,19 @@ namespace hpx::parcelset::detail {
         using put_parcel_type =
             hpx::move_only_function<void(Parcel&&, Handler&&)>;
 
+        // The archive is created with chunking enabled (and with the
+        // zero-copy threshold used by the parcelport) to measure the
+        // parcel in the same way as it will be serialized later, i.e.
+        // excluding the data sent as zero-copy chunks. The chunks
+        // themselves are only counted, chunks_ remains empty.
         parcel_await_base(Parcel&& parcel, Handler&& handler,
-            std::uint32_t archive_flags, put_parcel_type pp) noexcept
+            std::uint32_t archive_flags, put_parcel_type pp,
+            std::size_t zero_copy_serialization_threshold) noexcept
           : put_parcel_(HPX_MOVE(pp))
           , parcel_(HPX_MOVE(parcel))
           , handler_(HPX_MOVE(handler))
-          , archive_(data_, archive_flags)
+          , archive_(data_, archive_flags, &chunks_, nullptr,
+                zero_copy_serialization_threshold)
           , overhead_(archive_.bytes_written())
         {
         }
@@ -90,6 +97,7 @@ namespace hpx::parcelset::detail {
         Parcel parcel_;
         Handler handler_;
         hpx::serialization::detail::preprocess_container data_;
+        std::vector<hpx::serialization::serialization_chunk> chunks_;
         hpx::serialization::output_archive archive_;
         std::size_t overhead_;
     };
@@ -101,8 +109,10 @@ namespace hpx::parcelset::detail {
             write_handler_type, parcel_await>;
 
         parcel_await(parcelset::parcel&& p, write_handler_type&& f,
-            std::uint32_t archive_flags, put_parcel_type pp) noexcept
-          : base_type(HPX_MOVE(p), HPX_MOVE(f), archive_flags, HPX_MOVE(pp))
+            std::uint32_t archive_flags, put_parcel_type pp,
+            std::size_t zero_copy_serialization_threshold) noexcept
+          : base_type(HPX_MOVE(p), HPX_MOVE(f), archive_flags, HPX_MOVE(pp),
+                zero_copy_serialization_threshold)
         {
         }
 
@@ -124,8 +134,10 @@ namespace hpx::parcelset::detail {
 
         parcels_await(std::vector<parcelset::parcel>&& p,
             std::vector<write_handler_type>&& f, std::uint32_t archive_flags,
-            put_parcel_type pp) noexcept
-          : base_type(HPX_MOVE(p), HPX_MOVE(f), archive_flags, HPX_MOVE(pp))
+            put_parcel_type pp,
+            std::size_t zero_copy_serialization_threshold) noexcept
+          : base_type(HPX_MOVE(p), HPX_MOVE(f), archive_flags, HPX_MOVE(pp),
+                zero_copy_serialization_threshold)
           , idx_(0)
         {
         }
@@ -145,19 +157,20 @@ namespace hpx::parcelset::detail {
 
     ///////////////////////////////////////////////////////////////////////////
     void parcel_await_apply(parcelset::parcel&& p, write_handler_type&& f,
-        std::uint32_t archive_flags, put_parcel_type pp)
+        std::uint32_t archive_flags, put_parcel_type pp,
+        std::size_t zero_copy_serialization_threshold)
     {
-        auto ptr = std::make_shared<parcel_await>(
-            HPX_MOVE(p), HPX_MOVE(f), archive_flags, HPX_MOVE(pp));
+        auto ptr = std::make_shared<parcel_await>(HPX_MOVE(p), HPX_MOVE(f),
+            archive_flags, HPX_MOVE(pp), zero_copy_serialization_threshold);
         ptr->apply();
     }
 
     void parcels_await_apply(std::vector<parcelset::parcel>&& p,
         std::vector<write_handler_type>&& f, std::uint32_t archive_flags,
-        put_parcels_type pp)
+        put_parcels_type pp, std::size_t zero_copy_serialization_threshold)
     {
-        auto ptr = std::make_shared<parcels_await>(
-            HPX_MOVE(p), HPX_MOVE(f), archive_flags, HPX_MOVE(pp));
+        auto ptr = std::make_shared<parcels_await>(HPX_MOVE(p), HPX_MOVE(f),
+            archive_flags, HPX_MOVE(pp), zero_copy_serialization_threshold);
         ptr->apply();
     }
 }    // namespace hpx::parcelset::detail
@@ -36,6 +36,7 @@
 #include <hpx/parcelset/message_handler_fwd.hpp>
 #include <hpx/parcelset/parcelhandler.hpp>
 #include <hpx/parcelset/static_parcelports.hpp>
+#include <hpx/parcelset_base/parcel_trace.hpp>
 #include <hpx/parcelset_base/policies/message_handler.hpp>
 #include <hpx/plugin_factories/parcelport_factory_base.hpp>
 
@@ -117,6 +118,14 @@ namespace hpx::parcelset {
                 std::shared_ptr<parcelport> pp(factory->create(cfg, notifier));
                 attach_parcelport(pp);
             }
+
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+            // record the timeline of all parcels, if requested
+            detail::enable_parcel_tracing(
+                cfg.get_entry("hpx.parcel.trace", ""),
+                hpx::util::get_entry_as<std::size_t>(
+                    cfg, "hpx.parcel.trace_buffer_size", 1048576));
+#endif
         }
     }
 
@@ -424,6 +433,12 @@ namespace hpx::parcelset {
 
         // release all message handlers
         handlers_.clear();
+
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+        // write the recorded parcel timeline, if any
+        error_code ec(throwmode::lightweight);    // ignore all errors
+        detail::write_parcel_trace(agas::get_locality_id(ec));
+#endif
     }
 
     bool parcelhandler::get_raw_remote_localities(
@@ -1265,6 +1280,16 @@ namespace hpx::parcelset {
         return pp ? pp->get_connection_cache_statistics(stat_type, reset) : 0;
     }
 
+    // buffer pool statistics
+    std::int64_t parcelhandler::get_buffer_pool_statistics(
+        std::string const& pp_type,
+        parcelport::buffer_pool_statistics_type stat_type, bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_buffer_pool_statistics(stat_type, reset) : 0;
+    }
+
     std::vector<plugins::parcelport_factory_base*>&
     parcelhandler::get_parcelport_factories()
     {
@@ -1349,6 +1374,19 @@ namespace hpx::parcelset {
                 HPX_ZERO_COPY_SERIALIZATION_THRESHOLD) "}");
         ini_defs.emplace_back("max_background_threads = "
                               "${HPX_PARCEL_MAX_BACKGROUND_THREADS:-1}");
+        ini_defs.emplace_back(
+            "buffer_pool_size = ${HPX_PARCEL_BUFFER_POOL_SIZE:67108864}");
+        ini_defs.emplace_back(
+            "buffer_pool_huge_pages = ${HPX_PARCEL_BUFFER_POOL_HUGE_PAGES:0}");
+        ini_defs.emplace_back(
+            "priority_lanes = ${HPX_PARCEL_PRIORITY_LANES:1}");
+        ini_defs.emplace_back(
+            "bulk_message_size = ${HPX_PARCEL_BULK_MESSAGE_SIZE:4194304}");
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+        ini_defs.emplace_back("trace = ${HPX_PARCEL_TRACE:}");
+        ini_defs.emplace_back(
+            "trace_buffer_size = ${HPX_PARCEL_TRACE_BUFFER_SIZE:1048576}");
+#endif
 
         for (plugins::parcelport_factory_base* f :
             parcelhandler::get_parcelport_factories())
@@ -1378,6 +1416,8 @@ namespace hpx::parcelset {
             std::uint32_t locality_id = agas::get_locality_id(ec);
             p.parcel_id() = parcelset::parcel::generate_unique_id(locality_id);
         }
+
+        trace_parcel(p, parcel_trace_event::enqueue);
 #endif
     }
 }    // namespace hpx::parcelset
@@ -0,0 +1,205 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The pending parcels of a destination are queued in two lanes, parcels of
+// high priority actions are sent before any of the queued parcels of lower
+// priority. There is a single connection per locality and each send operation
+// takes a single bulk parcel only, which makes the order in which the write
+// handlers are called reflect the order in which the parcels were dequeued.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t identity(std::size_t i)
+{
+    return i;
+}
+HPX_PLAIN_ACTION(identity)
+
+using write_handler_type = hpx::parcelset::parcelhandler::write_handler_type;
+
+hpx::parcelset::parcel generate_parcel(hpx::id_type const& dest_id,
+    hpx::id_type const& cont, hpx::threads::thread_priority priority,
+    std::size_t i)
+{
+    hpx::naming::address addr;
+    hpx::naming::gid_type dest = dest_id.get_gid();
+    hpx::parcelset::parcel p(hpx::parcelset::detail::create_parcel::call(
+        std::move(dest), std::move(addr),
+        hpx::actions::typed_continuation<std::size_t>(cont), identity_action(),
+        priority, i));
+
+    p.set_source_id(hpx::find_here());
+    p.size() = 4096;
+    return p;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// records the order in which the parcels were written
+struct write_order
+{
+    write_handler_type handler(std::size_t i)
+    {
+        return [this, i](std::error_code const&,
+                   hpx::parcelset::parcel const&) {
+            std::lock_guard<std::mutex> l(mtx_);
+            order_.push_back(i);
+        };
+    }
+
+    std::vector<std::size_t> get() const
+    {
+        std::lock_guard<std::mutex> l(mtx_);
+        return order_;
+    }
+
+    mutable std::mutex mtx_;
+    std::vector<std::size_t> order_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Urgent parcels put behind a batch of normal parcels overtake them.
+void test_overtaking(hpx::id_type const& id, std::size_t num_normal,
+    std::size_t num_urgent)
+{
+    write_order order;
+
+    std::vector<hpx::future<std::size_t>> results;
+    std::vector<hpx::parcelset::parcel> parcels;
+    std::vector<write_handler_type> handlers;
+
+    std::size_t const num_parcels = num_normal + num_urgent;
+    for (std::size_t i = 0; i != num_parcels; ++i)
+    {
+        hpx::threads::thread_priority const priority = i < num_normal ?
+            hpx::threads::thread_priority::normal :
+            hpx::threads::thread_priority::high;
+
+        hpx::distributed::promise<std::size_t> p;
+        results.push_back(p.get_future());
+        parcels.push_back(generate_parcel(id, p.get_id(), priority, i));
+        handlers.push_back(order.handler(i));
+    }
+
+    hpx::get_runtime_distributed().get_parcel_handler().put_parcels(
+        std::move(parcels), std::move(handlers));
+
+    hpx::wait_all(results);
+    for (std::size_t i = 0; i != num_parcels; ++i)
+    {
+        HPX_TEST_EQ(results[i].get(), i);
+    }
+
+    // all urgent parcels were written first, the normal parcels follow in
+    // the order they were put
+    std::vector<std::size_t> expected;
+    for (std::size_t i = num_normal; i != num_parcels; ++i)
+    {
+        expected.push_back(i);
+    }
+    for (std::size_t i = 0; i != num_normal; ++i)
+    {
+        expected.push_back(i);
+    }
+
+    std::vector<std::size_t> const written = order.get();
+    HPX_TEST_EQ(written.size(), num_parcels);
+    HPX_TEST(written == expected);
+}
+
+// Low priority parcels make progress while urgent parcels keep arriving.
+void test_no_starvation(
+    hpx::id_type const& id, std::size_t num_low, std::size_t num_urgent)
+{
+    std::vector<hpx::future<std::size_t>> low_results;
+    std::vector<hpx::parcelset::parcel> parcels;
+    for (std::size_t i = 0; i != num_low; ++i)
+    {
+        hpx::distributed::promise<std::size_t> p;
+        low_results.push_back(p.get_future());
+        parcels.push_back(generate_parcel(
+            id, p.get_id(), hpx::threads::thread_priority::low, i));
+    }
+
+    hpx::parcelset::parcelhandler& ph =
+        hpx::get_runtime_distributed().get_parcel_handler();
+    ph.put_parcels(std::move(parcels));
+
+    auto all_ready = [&]() {
+        return std::all_of(low_results.begin(), low_results.end(),
+            [](hpx::future<std::size_t> const& f) { return f.is_ready(); });
+    };
+
+    // keep the urgent lane busy until all low priority parcels were sent
+    std::vector<hpx::future<std::size_t>> urgent_results;
+    while (!all_ready() && urgent_results.size() < 100 * num_low)
+    {
+        std::vector<hpx::parcelset::parcel> urgent;
+        for (std::size_t i = 0; i != num_urgent; ++i)
+        {
+            hpx::distributed::promise<std::size_t> p;
+            urgent_results.push_back(p.get_future());
+            urgent.push_back(generate_parcel(id, p.get_id(),
+                hpx::threads::thread_priority::high, urgent_results.size()));
+        }
+        ph.put_parcels(std::move(urgent));
+
+        hpx::this_thread::yield();
+    }
+
+    HPX_TEST(all_ready());
+    for (std::size_t i = 0; i != num_low; ++i)
+    {
+        HPX_TEST_EQ(low_results[i].get(), i);
+    }
+
+    hpx::wait_all(urgent_results);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_overtaking(id, 10, 1);
+        test_overtaking(id, 100, 10);
+        test_no_starvation(id, 100, 10);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // explicitly disable message handlers (parcel coalescing), use a single
+    // connection and send a single bulk parcel per send operation
+    std::vector<std::string> const cfg = {
+        "hpx.parcel.message_handlers=0",
+        "hpx.parcel.tcp.max_connections_per_locality!=1",
+        "hpx.parcel.tcp.bulk_message_size!=1",
+    };
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,222 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Send parcels with parcel tracing enabled (see hpx.parcel.trace). The trace
+// is written once the parcel handler has stopped, each locality verifies the
+// events recorded in its own trace file after the runtime has exited: the
+// console locality records sending the parcels, the other locality records
+// receiving them. If the parcel_trace tool was built, it is run on the trace
+// as well.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelset_base/parcel_trace.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t const num_parcels = 100;
+char const* const trace_filename = "trace_parcels_test.trace";
+
+std::uint32_t locality_id = hpx::naming::invalid_locality_id;
+
+std::size_t traced(std::size_t i)
+{
+    return i;
+}
+HPX_PLAIN_ACTION(traced)
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        std::vector<hpx::future<std::size_t>> results;
+        results.reserve(num_parcels);
+        for (std::size_t i = 0; i != num_parcels; ++i)
+        {
+            results.push_back(hpx::async(traced_action(), id, i));
+        }
+
+        hpx::wait_all(results);
+        for (std::size_t i = 0; i != num_parcels; ++i)
+        {
+            HPX_TEST_EQ(results[i].get(), i);
+        }
+    }
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+using hpx::parcelset::parcel_trace_event;
+
+constexpr std::size_t num_events =
+    static_cast<std::size_t>(parcel_trace_event::num_events);
+
+template <typename T>
+bool read_value(std::istream& in, T& value)
+{
+    return static_cast<bool>(
+        in.read(reinterpret_cast<char*>(&value), sizeof(value)));
+}
+
+// Return the recorded events of all parcels of the traced action.
+std::map<std::uint64_t, std::array<bool, num_events>> read_trace(
+    std::string const& filename)
+{
+    std::map<std::uint64_t, std::array<bool, num_events>> parcels;
+
+    std::ifstream in(filename, std::ios::in | std::ios::binary);
+    HPX_TEST(static_cast<bool>(in));
+
+    hpx::parcelset::parcel_trace_file_header header;
+    HPX_TEST(read_value(in, header));
+    HPX_TEST_EQ(std::memcmp(header.magic_, hpx::parcelset::parcel_trace_magic,
+                    sizeof(header.magic_)),
+        0);
+    HPX_TEST_EQ(header.version_, hpx::parcelset::parcel_trace_version);
+    HPX_TEST_EQ(header.locality_id_, locality_id);
+    HPX_TEST_EQ(header.num_dropped_, std::uint64_t(0));
+
+    std::vector<std::string> actions(header.num_actions_);
+    for (std::string& name : actions)
+    {
+        std::uint32_t size = 0;
+        HPX_TEST(read_value(in, size));
+        name.resize(size);
+        in.read(name.data(), size);
+    }
+
+    for (std::uint64_t i = 0; i != header.num_records_; ++i)
+    {
+        hpx::parcelset::parcel_trace_record r;
+        HPX_TEST(read_value(in, r));
+        if (!in)
+            break;
+
+        HPX_TEST_LT(static_cast<std::size_t>(r.action_), actions.size());
+        HPX_TEST_LT(static_cast<std::size_t>(r.event_), num_events);
+        if (static_cast<std::size_t>(r.action_) >= actions.size() ||
+            actions[r.action_] != "traced_action")
+        {
+            continue;
+        }
+
+        // the traced parcels were all sent by the console locality
+        HPX_TEST_EQ(r.origin_, std::uint32_t(0));
+        parcels[r.parcel_id_][static_cast<std::size_t>(r.event_)] = true;
+    }
+
+    return parcels;
+}
+
+void test_trace(std::string const& filename)
+{
+    std::map<std::uint64_t, std::array<bool, num_events>> const parcels =
+        read_trace(filename);
+    HPX_TEST_EQ(parcels.size(), num_parcels);
+
+    // the events recorded while sending and while receiving the parcels
+    std::vector<parcel_trace_event> expected;
+    if (locality_id == 0)
+    {
+        expected = {parcel_trace_event::enqueue,
+            parcel_trace_event::connection_acquired,
+            parcel_trace_event::serialize_begin,
+            parcel_trace_event::serialize_end, parcel_trace_event::send,
+            parcel_trace_event::send_complete};
+    }
+    else
+    {
+        expected = {parcel_trace_event::receive,
+            parcel_trace_event::decode_begin, parcel_trace_event::decode_end,
+            parcel_trace_event::action_scheduled};
+    }
+
+    for (auto const& p : parcels)
+    {
+        for (parcel_trace_event event : expected)
+        {
+            HPX_TEST_MSG(p.second[static_cast<std::size_t>(event)],
+                hpx::parcelset::get_parcel_trace_event_name(event));
+        }
+    }
+}
+
+#if defined(HPX_PARCEL_TRACE_TOOL)
+// Run the parcel_trace tool, each traced parcel is listed in its output.
+void test_tool(std::string const& filename)
+{
+    std::string const output = filename + ".csv";
+    std::string const command = std::string("\"") + HPX_PARCEL_TRACE_TOOL +
+        "\" --csv \"" + filename + "\" > \"" + output + "\"";
+    HPX_TEST_EQ(std::system(command.c_str()), 0);
+
+    std::ifstream in(output);
+    HPX_TEST(static_cast<bool>(in));
+
+    std::string line;
+    HPX_TEST(static_cast<bool>(std::getline(in, line)));
+    HPX_TEST_EQ(line.find("origin,parcel_id,action,size"), std::size_t(0));
+
+    std::size_t count = 0;
+    while (std::getline(in, line))
+    {
+        if (line.find(",traced_action,") != std::string::npos)
+            ++count;
+    }
+    HPX_TEST_EQ(count, num_parcels);
+
+    in.close();
+    std::remove(output.c_str());
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // explicitly disable message handlers (parcel coalescing), enable parcel
+    // tracing
+    std::vector<std::string> const cfg = {
+        "hpx.parcel.message_handlers=0",
+        std::string("hpx.parcel.trace!=") + trace_filename,
+    };
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+    init_args.startup = []() { locality_id = hpx::get_locality_id(); };
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    // the trace is written while the runtime shuts down
+    HPX_TEST_NEQ(locality_id, hpx::naming::invalid_locality_id);
+    std::string const filename =
+        std::string(trace_filename) + "." + std::to_string(locality_id);
+
+    test_trace(filename);
+#if defined(HPX_PARCEL_TRACE_TOOL)
+    test_tool(filename);
+#endif
+    std::remove(filename.c_str());
+
+    return hpx::util::report_errors();
+}
+#endif
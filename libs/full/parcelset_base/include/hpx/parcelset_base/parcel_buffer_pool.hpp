@@ -0,0 +1,94 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset {
+
+    /// A pool of the byte buffers used by a parcelport to (de-)serialize
+    /// messages. Buffers are kept in power-of-two size classes, a buffer
+    /// handed out has at least the requested capacity. Released buffers are
+    /// retained as long as the overall number of retained bytes stays below
+    /// the configured limit.
+    class HPX_EXPORT parcel_buffer_pool
+    {
+    public:
+        using buffer_type = std::vector<char>;
+
+        // the smallest (1 KiB) and largest (64 MiB) pooled size classes,
+        // buffers outside of this range are never retained
+        static constexpr std::size_t min_size_class = 10;
+        static constexpr std::size_t max_size_class = 26;
+
+        explicit parcel_buffer_pool(
+            std::size_t max_bytes_retained = 0, bool use_huge_pages = false);
+
+        parcel_buffer_pool(parcel_buffer_pool const&) = delete;
+        parcel_buffer_pool(parcel_buffer_pool&&) = delete;
+        parcel_buffer_pool& operator=(parcel_buffer_pool const&) = delete;
+        parcel_buffer_pool& operator=(parcel_buffer_pool&&) = delete;
+
+        ~parcel_buffer_pool();
+
+        /// Return an empty buffer with a capacity of at least \a size bytes
+        buffer_type get(std::size_t size);
+
+        /// Make sure the given (empty) buffer has a capacity of at least
+        /// \a size bytes. A buffer which is too small is handed back to the
+        /// pool and replaced.
+        void reserve(buffer_type& buffer, std::size_t size);
+
+        /// Hand a buffer back to the pool, its contents are discarded
+        void release(buffer_type&& buffer) noexcept;
+
+        /// Free all retained buffers
+        void clear() noexcept;
+
+        std::int64_t get_hits(bool reset) noexcept;
+        std::int64_t get_misses(bool reset) noexcept;
+        std::int64_t get_bytes_retained() const noexcept;
+
+    private:
+        struct size_class
+        {
+            hpx::spinlock mtx_;
+            std::vector<buffer_type> buffers_;
+        };
+
+        static constexpr std::size_t num_size_classes =
+            max_size_class - min_size_class + 1;
+
+        buffer_type allocate(std::size_t size) const;
+
+        std::size_t const max_bytes_retained_;
+        bool const use_huge_pages_;
+
+        std::atomic<std::int64_t> bytes_retained_;
+        std::atomic<std::int64_t> hits_;
+        std::atomic<std::int64_t> misses_;
+
+        std::array<util::cache_aligned_data<size_class>, num_size_classes>
+            size_classes_;
+    };
+}    // namespace hpx::parcelset
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
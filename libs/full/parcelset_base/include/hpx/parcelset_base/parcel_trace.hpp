@@ -0,0 +1,120 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+
+namespace hpx::parcelset {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Per-parcel timeline tracing. If enabled (see hpx.parcel.trace), each
+    // locality records the points in time each parcel passes through the
+    // parcel layer into a ring buffer, which is written to a binary file once
+    // the parcel handler is stopped. The parcel_trace tool merges the files
+    // written by all localities and reports per-action latency breakdowns.
+    enum class parcel_trace_event : std::uint8_t
+    {
+        enqueue = 0,                // parcel was handed to the parcel layer
+        connection_acquired = 1,    // a connection to the destination is ready
+        serialize_begin = 2,
+        serialize_end = 3,
+        send = 4,             // the message holding the parcel is being sent
+        send_complete = 5,    // the message holding the parcel was sent
+        receive = 6,          // the message holding the parcel was received
+        decode_begin = 7,
+        decode_end = 8,
+        action_scheduled = 9,
+
+        num_events = 10
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A trace file starts with a parcel_trace_file_header, followed by the
+    // names of the traced actions (each stored as its std::uint32_t length
+    // followed by its characters), followed by the trace records. All values
+    // are stored in the native byte order of the writing locality.
+    inline constexpr char parcel_trace_magic[8] = {
+        'H', 'P', 'X', 'P', 'T', 'R', 'C', '\0'};
+    inline constexpr std::uint32_t parcel_trace_version = 1;
+
+    struct parcel_trace_file_header
+    {
+        char magic_[8];
+        std::uint32_t version_;
+        std::uint32_t locality_id_;
+
+        // time stamps of the steady clock used for tracing and of the system
+        // clock (nanoseconds since the epoch) taken at the same time, used to
+        // align the traces written by different localities
+        std::int64_t steady_time_;
+        std::int64_t system_time_;
+
+        std::uint64_t num_records_;
+        // records overwritten in the ring buffer or still being written
+        std::uint64_t num_dropped_;
+        std::uint32_t num_actions_;
+        std::uint32_t reserved_;
+    };
+
+    struct parcel_trace_record
+    {
+        std::int64_t timestamp_;     // nanoseconds, steady clock
+        std::uint64_t parcel_id_;    // unique on the originating locality
+        std::uint32_t origin_;       // locality which created the parcel
+        std::uint32_t size_;         // size of the parcel in bytes, if known
+        std::uint16_t action_;       // index into the action names
+        parcel_trace_event event_;
+        std::uint8_t reserved_[5];
+    };
+
+    static_assert(sizeof(parcel_trace_record) == 32);
+
+    constexpr char const* get_parcel_trace_event_name(
+        parcel_trace_event event) noexcept
+    {
+        constexpr char const* const names[] = {"enqueue",
+            "connection_acquired", "serialize_begin", "serialize_end", "send",
+            "send_complete", "receive", "decode_begin", "decode_end",
+            "action_scheduled"};
+
+        auto const index = static_cast<std::size_t>(event);
+        return index < std::size(names) ? names[index] : "<unknown>";
+    }
+
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+    class parcel;
+
+    namespace detail {
+
+        // Start recording parcel trace events into a ring buffer holding
+        // the given number of records. The trace is written to the file
+        // '<filename>.<locality id>'.
+        HPX_EXPORT void enable_parcel_tracing(
+            std::string const& filename, std::size_t capacity);
+
+        // Stop recording and write the recorded events (if any).
+        HPX_EXPORT void write_parcel_trace(std::uint32_t locality_id);
+    }    // namespace detail
+
+    HPX_EXPORT bool is_parcel_tracing_enabled() noexcept;
+
+    // The current time stamp as recorded in the trace.
+    HPX_EXPORT std::int64_t parcel_trace_timestamp() noexcept;
+
+    // Record that the given parcel(s) reached the given point in time.
+    HPX_EXPORT void trace_parcel(parcel const& p, parcel_trace_event event);
+    HPX_EXPORT void trace_parcel(
+        parcel const& p, parcel_trace_event event, std::int64_t timestamp);
+    HPX_EXPORT void trace_parcels(
+        parcel const* ps, std::size_t num_parcels, parcel_trace_event event);
+#endif
+}    // namespace hpx::parcelset
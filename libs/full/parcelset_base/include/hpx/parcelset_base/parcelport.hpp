@@ -23,9 +23,11 @@
 #include <hpx/parcelset_base/detail/gatherer.hpp>
 #include <hpx/parcelset_base/detail/per_action_data_counter.hpp>
 #include <hpx/parcelset_base/locality.hpp>
+#include <hpx/parcelset_base/parcel_buffer_pool.hpp>
 #include <hpx/parcelset_base/parcel_interface.hpp>
 #include <hpx/parcelset_base/parcelset_base_fwd.hpp>
 
+#include <array>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -181,6 +183,18 @@ namespace hpx::parcelset {
         virtual std::int64_t get_connection_cache_statistics(
             connection_cache_statistics_type, bool reset) = 0;
 
+        /// Return the given buffer pool statistic
+        enum buffer_pool_statistics_type
+        {
+            buffer_pool_hits = 0,
+            buffer_pool_misses = 1,
+            buffer_pool_bytes_retained = 2
+        };
+
+        // retrieve performance counter value for given statistics type
+        std::int64_t get_buffer_pool_statistics(
+            buffer_pool_statistics_type, bool reset);
+
         /// Return the name of this locality
         virtual std::string get_locality_name() const = 0;
 
@@ -319,6 +333,18 @@ namespace hpx::parcelset {
 
         bool async_serialization() const noexcept;
 
+        /// Return the pool the buffers used for (de-)serialization are drawn
+        /// from
+        parcel_buffer_pool& get_buffer_pool() noexcept;
+
+        /// Return the lane of the pending parcels of a destination the given
+        /// parcel is queued in
+        std::size_t get_parcel_lane(parcel const& p) const;
+
+        /// Return the maximal number of bytes of bulk parcels sent by a
+        /// single send operation (zero if not limited)
+        std::size_t get_bulk_message_size() const noexcept;
+
         // callback while bootstrap the parcel layer
         void early_pending_parcel_handler(
             std::error_code const& ec, parcel const& p);
@@ -327,10 +353,18 @@ namespace hpx::parcelset {
         // mutex for all of the member data
         mutable hpx::spinlock mtx_;
 
-        // The cache for pending parcels
+        // The cache for pending parcels. The parcels for each destination
+        // are kept in separate lanes: urgent parcels (parcels of actions with
+        // a high priority) are always sent before any of the queued bulk
+        // parcels.
+        static constexpr std::size_t urgent_lane = 0;
+        static constexpr std::size_t bulk_lane = 1;
+        static constexpr std::size_t num_lanes = 2;
+
         using map_second_type =
             hpx::tuple<std::vector<parcel>, std::vector<write_handler_type>>;
-        using pending_parcels_map = std::map<locality, map_second_type>;
+        using pending_parcels_lanes = std::array<map_second_type, num_lanes>;
+        using pending_parcels_map = std::map<locality, pending_parcels_lanes>;
         pending_parcels_map pending_parcels_;
 
         using pending_parcels_destinations = std::set<locality>;
@@ -363,11 +397,20 @@ namespace hpx::parcelset {
         /// async serialization of parcels
         bool async_serialization_;
 
+        /// queue urgent parcels separately from bulk parcels
+        bool priority_lanes_;
+
+        /// maximal number of bytes of bulk parcels per send operation
+        std::size_t bulk_message_size_;
+
         /// priority of the parcelport
         int priority_;
         std::string type_;
 
         std::size_t zero_copy_serialization_threshold_;
+
+        /// pooled (de-)serialization buffers
+        parcel_buffer_pool buffer_pool_;
     };
 }    // namespace hpx::parcelset
 
@@ -0,0 +1,220 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/assert.hpp>
+#include <hpx/modules/util.hpp>
+
+#include <hpx/parcelset_base/parcel_buffer_pool.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace hpx::parcelset {
+
+    namespace {
+
+        // buffers at least this large are backed by transparent huge pages,
+        // if enabled
+        constexpr std::size_t huge_page_size = std::size_t(2) << 20;
+
+        // index of the smallest size class holding buffers of the given size
+        constexpr std::size_t size_class_for_request(std::size_t size) noexcept
+        {
+            std::size_t result = parcel_buffer_pool::min_size_class;
+            while ((std::size_t(1) << result) < size)
+            {
+                ++result;
+            }
+            return result;
+        }
+
+        // index of the largest size class a buffer with the given capacity
+        // can serve
+        constexpr std::size_t size_class_for_capacity(
+            std::size_t capacity) noexcept
+        {
+            std::size_t result = 0;
+            while ((capacity >>= 1) != 0)
+            {
+                ++result;
+            }
+            return result;
+        }
+    }    // namespace
+
+    parcel_buffer_pool::parcel_buffer_pool(
+        std::size_t max_bytes_retained, bool use_huge_pages)
+      : max_bytes_retained_(max_bytes_retained)
+      , use_huge_pages_(use_huge_pages)
+      , bytes_retained_(0)
+      , hits_(0)
+      , misses_(0)
+    {
+    }
+
+    parcel_buffer_pool::~parcel_buffer_pool()
+    {
+        clear();
+    }
+
+    parcel_buffer_pool::buffer_type parcel_buffer_pool::allocate(
+        std::size_t size) const
+    {
+        buffer_type buffer;
+        buffer.reserve(size);
+
+#if defined(MADV_HUGEPAGE)
+        // Ask the kernel to back the (2 MiB aligned part of the) buffer with
+        // transparent huge pages. This reduces the number of page faults and
+        // TLB misses while large messages are being (de-)serialized.
+        if (use_huge_pages_ && size >= huge_page_size)
+        {
+            auto const begin = reinterpret_cast<std::uintptr_t>(buffer.data());
+            auto const end = begin + size;
+            std::uintptr_t const aligned_begin =
+                (begin + huge_page_size - 1) & ~(huge_page_size - 1);
+            std::uintptr_t const aligned_end = end & ~(huge_page_size - 1);
+            if (aligned_begin < aligned_end)
+            {
+                // this is a hint only, errors are deliberately ignored
+                ::madvise(reinterpret_cast<void*>(aligned_begin),
+                    aligned_end - aligned_begin, MADV_HUGEPAGE);
+            }
+        }
+#endif
+        return buffer;
+    }
+
+    parcel_buffer_pool::buffer_type parcel_buffer_pool::get(std::size_t size)
+    {
+        std::size_t const index = size_class_for_request(size);
+        if (max_bytes_retained_ == 0 || index > max_size_class)
+        {
+            misses_.fetch_add(1, std::memory_order_relaxed);
+            return allocate(size);
+        }
+
+        size_class& sc = size_classes_[index - min_size_class].data_;
+        {
+            std::unique_lock<hpx::spinlock> l(sc.mtx_);
+            if (!sc.buffers_.empty())
+            {
+                buffer_type buffer = HPX_MOVE(sc.buffers_.back());
+                sc.buffers_.pop_back();
+                l.unlock();
+
+                HPX_ASSERT(buffer.empty() && buffer.capacity() >= size);
+                bytes_retained_.fetch_sub(
+                    static_cast<std::int64_t>(buffer.capacity()),
+                    std::memory_order_relaxed);
+                hits_.fetch_add(1, std::memory_order_relaxed);
+                return buffer;
+            }
+        }
+
+        // Allocate the full size of the class to be able to serve any later
+        // request for this class with this buffer.
+        misses_.fetch_add(1, std::memory_order_relaxed);
+        return allocate(std::size_t(1) << index);
+    }
+
+    void parcel_buffer_pool::reserve(buffer_type& buffer, std::size_t size)
+    {
+        HPX_ASSERT(buffer.empty());
+        if (buffer.capacity() >= size)
+        {
+            return;
+        }
+
+        buffer_type old_buffer = HPX_MOVE(buffer);
+        buffer = get(size);
+        release(HPX_MOVE(old_buffer));
+    }
+
+    void parcel_buffer_pool::release(buffer_type&& buffer) noexcept
+    {
+        buffer_type released(HPX_MOVE(buffer));
+
+        std::size_t const capacity = released.capacity();
+        std::size_t const index = size_class_for_capacity(capacity);
+        if (index < min_size_class || index > max_size_class)
+        {
+            return;
+        }
+
+        // account for the buffer before inserting it, give up if this would
+        // exceed the limit
+        std::int64_t const bytes = static_cast<std::int64_t>(capacity);
+        if (bytes_retained_.fetch_add(bytes, std::memory_order_relaxed) +
+                bytes >
+            static_cast<std::int64_t>(max_bytes_retained_))
+        {
+            bytes_retained_.fetch_sub(bytes, std::memory_order_relaxed);
+            return;
+        }
+
+        released.clear();
+
+        size_class& sc = size_classes_[index - min_size_class].data_;
+        try
+        {
+            std::lock_guard<hpx::spinlock> l(sc.mtx_);
+            sc.buffers_.push_back(HPX_MOVE(released));
+        }
+        catch (...)
+        {
+            // growing the free list failed, simply drop the buffer
+            bytes_retained_.fetch_sub(bytes, std::memory_order_relaxed);
+        }
+    }
+
+    void parcel_buffer_pool::clear() noexcept
+    {
+        for (auto& entry : size_classes_)
+        {
+            std::vector<buffer_type> buffers;
+            {
+                std::lock_guard<hpx::spinlock> l(entry.data_.mtx_);
+                buffers.swap(entry.data_.buffers_);
+            }
+
+            for (buffer_type const& buffer : buffers)
+            {
+                bytes_retained_.fetch_sub(
+                    static_cast<std::int64_t>(buffer.capacity()),
+                    std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::int64_t parcel_buffer_pool::get_hits(bool reset) noexcept
+    {
+        return util::get_and_reset_value(hits_, reset);
+    }
+
+    std::int64_t parcel_buffer_pool::get_misses(bool reset) noexcept
+    {
+        return util::get_and_reset_value(misses_, reset);
+    }
+
+    std::int64_t parcel_buffer_pool::get_bytes_retained() const noexcept
+    {
+        return bytes_retained_.load(std::memory_order_relaxed);
+    }
+}    // namespace hpx::parcelset
+
+#endif
@@ -0,0 +1,247 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCEL_PROFILING)
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <hpx/naming_base/gid_type.hpp>
+#include <hpx/parcelset_base/parcel_interface.hpp>
+#include <hpx/parcelset_base/parcel_trace.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace hpx::parcelset {
+
+    namespace {
+
+        // The fields of an entry are written and read concurrently, they are
+        // published using the sequence number of the entry: it is odd while
+        // the entry is being written and 2 * (pos + 1) once the record at the
+        // position pos of the trace is complete.
+        struct trace_entry
+        {
+            std::atomic<std::uint64_t> seq_{0};
+            std::atomic<std::int64_t> timestamp_{0};
+            std::atomic<std::uint64_t> parcel_id_{0};
+            std::atomic<char const*> action_{nullptr};
+            std::atomic<std::uint32_t> origin_{0};
+            std::atomic<std::uint32_t> size_{0};
+            std::atomic<parcel_trace_event> event_{};
+        };
+
+        // The ring buffer is allocated once while starting up. Concurrent
+        // writers claim their slots by incrementing the write position, the
+        // oldest entries are overwritten if the buffer is full. A record is
+        // dropped if its slot is still being written by another thread.
+        struct trace_buffer
+        {
+            std::atomic<bool> enabled_{false};
+            std::string filename_;
+            std::unique_ptr<trace_entry[]> entries_;
+            std::uint64_t capacity_ = 0;
+            std::atomic<std::uint64_t> next_{0};
+        };
+
+        trace_buffer& get_trace_buffer()
+        {
+            static trace_buffer buffer;
+            return buffer;
+        }
+    }    // namespace
+
+    namespace detail {
+
+        void enable_parcel_tracing(
+            std::string const& filename, std::size_t capacity)
+        {
+            trace_buffer& buffer = get_trace_buffer();
+            if (buffer.enabled_.load() || filename.empty() || capacity == 0)
+                return;
+
+            buffer.filename_ = filename;
+            buffer.entries_.reset(new trace_entry[capacity]);
+            buffer.capacity_ = capacity;
+            buffer.next_.store(0);
+            buffer.enabled_.store(true);
+        }
+
+        void write_parcel_trace(std::uint32_t locality_id)
+        {
+            trace_buffer& buffer = get_trace_buffer();
+            if (!buffer.enabled_.exchange(false))
+                return;
+
+            // writers which saw tracing enabled may still be active, records
+            // which are incomplete or overwritten while being read are
+            // dropped
+            std::uint64_t const next = buffer.next_.load();
+            std::uint64_t const capacity = buffer.capacity_;
+            std::uint64_t const count = (std::min)(next, capacity);
+
+            // assign indices to the names of all traced actions
+            std::map<std::string, std::uint16_t> action_indices;
+            std::vector<std::string const*> action_names;
+            std::vector<parcel_trace_record> records;
+            records.reserve(count);
+
+            for (std::uint64_t i = next - count; i != next; ++i)
+            {
+                trace_entry const& e = buffer.entries_[i % capacity];
+
+                std::uint64_t const seq =
+                    e.seq_.load(std::memory_order_acquire);
+                if (seq != 2 * (i + 1))
+                    continue;
+
+                parcel_trace_record r = {};
+                r.timestamp_ = e.timestamp_.load(std::memory_order_relaxed);
+                r.parcel_id_ = e.parcel_id_.load(std::memory_order_relaxed);
+                r.origin_ = e.origin_.load(std::memory_order_relaxed);
+                r.size_ = e.size_.load(std::memory_order_relaxed);
+                r.event_ = e.event_.load(std::memory_order_relaxed);
+                char const* action = e.action_.load(std::memory_order_relaxed);
+
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (e.seq_.load(std::memory_order_relaxed) != seq)
+                    continue;
+
+                auto it = action_indices
+                              .emplace(action ? action : "<unknown>",
+                                  static_cast<std::uint16_t>(
+                                      action_indices.size()))
+                              .first;
+                if (it->second == action_names.size())
+                    action_names.push_back(&it->first);
+
+                r.action_ = it->second;
+                records.push_back(r);
+            }
+
+            parcel_trace_file_header header = {};
+            std::memcpy(
+                header.magic_, parcel_trace_magic, sizeof(header.magic_));
+            header.version_ = parcel_trace_version;
+            header.locality_id_ = locality_id;
+            header.steady_time_ = parcel_trace_timestamp();
+            header.system_time_ =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::system_clock::now().time_since_epoch())
+                    .count();
+            header.num_records_ = records.size();
+            header.num_dropped_ = next - records.size();
+            header.num_actions_ =
+                static_cast<std::uint32_t>(action_names.size());
+
+            std::string const filename =
+                hpx::util::format("{}.{}", buffer.filename_, locality_id);
+
+            std::ofstream out(filename, std::ios::out | std::ios::binary);
+            if (!out)
+            {
+                LPT_(error).format(
+                    "write_parcel_trace: could not write trace file: {}",
+                    filename);
+                return;
+            }
+
+            out.write(reinterpret_cast<char const*>(&header), sizeof(header));
+            for (std::string const* name : action_names)
+            {
+                auto const size = static_cast<std::uint32_t>(name->size());
+                out.write(reinterpret_cast<char const*>(&size), sizeof(size));
+                out.write(name->data(), size);
+            }
+            out.write(reinterpret_cast<char const*>(records.data()),
+                static_cast<std::streamsize>(
+                    records.size() * sizeof(parcel_trace_record)));
+        }
+    }    // namespace detail
+
+    bool is_parcel_tracing_enabled() noexcept
+    {
+        return get_trace_buffer().enabled_.load(std::memory_order_relaxed);
+    }
+
+    std::int64_t parcel_trace_timestamp() noexcept
+    {
+        return static_cast<std::int64_t>(
+            hpx::chrono::high_resolution_clock::now());
+    }
+
+    void trace_parcel(
+        parcel const& p, parcel_trace_event event, std::int64_t timestamp)
+    {
+        trace_buffer& buffer = get_trace_buffer();
+        if (!buffer.enabled_.load(std::memory_order_relaxed))
+            return;
+
+        std::uint64_t const pos =
+            buffer.next_.fetch_add(1, std::memory_order_relaxed);
+        trace_entry& e = buffer.entries_[pos % buffer.capacity_];
+
+        // claim the entry, unless it is being written by another thread or
+        // was already claimed for a later record
+        std::uint64_t seq = e.seq_.load(std::memory_order_relaxed);
+        do
+        {
+            if ((seq & 1) != 0 || seq > 2 * pos)
+                return;
+        } while (!e.seq_.compare_exchange_weak(seq, 2 * pos + 1,
+            std::memory_order_acquire, std::memory_order_relaxed));
+        std::atomic_thread_fence(std::memory_order_release);
+
+        naming::gid_type const& id = p.parcel_id();
+        e.timestamp_.store(timestamp, std::memory_order_relaxed);
+        e.parcel_id_.store(id.get_lsb(), std::memory_order_relaxed);
+        e.action_.store(p.get_action_name(), std::memory_order_relaxed);
+        e.origin_.store(naming::get_locality_id_from_gid(id),
+            std::memory_order_relaxed);
+        e.size_.store(static_cast<std::uint32_t>((std::min)(p.size(),
+                          static_cast<std::size_t>(
+                              (std::numeric_limits<std::uint32_t>::max)()))),
+            std::memory_order_relaxed);
+        e.event_.store(event, std::memory_order_relaxed);
+
+        // publish the record
+        e.seq_.store(2 * (pos + 1), std::memory_order_release);
+    }
+
+    void trace_parcel(parcel const& p, parcel_trace_event event)
+    {
+        if (is_parcel_tracing_enabled())
+            trace_parcel(p, event, parcel_trace_timestamp());
+    }
+
+    void trace_parcels(
+        parcel const* ps, std::size_t num_parcels, parcel_trace_event event)
+    {
+        if (!is_parcel_tracing_enabled())
+            return;
+
+        std::int64_t const timestamp = parcel_trace_timestamp();
+        for (std::size_t i = 0; i != num_parcels; ++i)
+        {
+            trace_parcel(ps[i], event, timestamp);
+        }
+    }
+}    // namespace hpx::parcelset
+
+#endif
@@ -42,10 +42,17 @@ namespace hpx::parcelset {
       , allow_array_optimizations_(true)
       , allow_zero_copy_optimizations_(true)
       , async_serialization_(false)
+      , priority_lanes_(true)
+      , bulk_message_size_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel." + type + ".bulk_message_size", 0))
       , priority_(hpx::util::get_entry_as<int>(
             ini, "hpx.parcel." + type + ".priority", 0))
       , type_(type)
       , zero_copy_serialization_threshold_(zero_copy_serialization_threshold)
+      , buffer_pool_(hpx::util::get_entry_as<std::size_t>(ini,
+                         "hpx.parcel." + type + ".buffer_pool_size", 0),
+            hpx::util::get_entry_as<int>(
+                ini, "hpx.parcel." + type + ".buffer_pool_huge_pages", 0) != 0)
     {
         std::string key("hpx.parcel.");
         key += type;
@@ -70,6 +77,11 @@ namespace hpx::parcelset {
         {
             async_serialization_ = true;
         }
+
+        if (hpx::util::get_entry_as<int>(ini, key + ".priority_lanes", 1) == 0)
+        {
+            priority_lanes_ = false;
+        }
     }
 
     int parcelport::priority() const noexcept
@@ -331,9 +343,12 @@ namespace hpx::parcelset {
         std::int64_t count = 0;
         for (auto&& p : pending_parcels_)
         {
-            count += hpx::get<0>(p.second).size();
-            HPX_ASSERT(
-                hpx::get<0>(p.second).size() == hpx::get<1>(p.second).size());
+            for (auto&& lane : p.second)
+            {
+                count += hpx::get<0>(lane).size();
+                HPX_ASSERT(
+                    hpx::get<0>(lane).size() == hpx::get<1>(lane).size());
+            }
         }
         return count;
     }
@@ -369,6 +384,58 @@ namespace hpx::parcelset {
         return async_serialization_;
     }
 
+    parcel_buffer_pool& parcelport::get_buffer_pool() noexcept
+    {
+        return buffer_pool_;
+    }
+
+    std::size_t parcelport::get_parcel_lane(parcel const& p) const
+    {
+        if (priority_lanes_)
+        {
+            switch (p.get_thread_priority())
+            {
+            case threads::thread_priority::high_recursive:
+            case threads::thread_priority::boost:
+            case threads::thread_priority::high:
+                return urgent_lane;
+
+            default:
+                break;
+            }
+        }
+        return bulk_lane;
+    }
+
+    std::size_t parcelport::get_bulk_message_size() const noexcept
+    {
+        return bulk_message_size_;
+    }
+
+    std::int64_t parcelport::get_buffer_pool_statistics(
+        buffer_pool_statistics_type t, bool reset)
+    {
+        switch (t)
+        {
+        case buffer_pool_hits:
+            return buffer_pool_.get_hits(reset);
+
+        case buffer_pool_misses:
+            return buffer_pool_.get_misses(reset);
+
+        case buffer_pool_bytes_retained:
+            return buffer_pool_.get_bytes_retained();
+
+        default:
+            break;
+        }
+
+        HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+            "parcelport::get_buffer_pool_statistics",
+            "invalid buffer pool statistics type");
+        return 0;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // the code below is needed to bootstrap the parcel layer
     void parcelport::early_pending_parcel_handler(
@@ -0,0 +1,161 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/hpx_main.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelset_base/parcel_buffer_pool.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using hpx::parcelset::parcel_buffer_pool;
+using buffer_type = parcel_buffer_pool::buffer_type;
+
+///////////////////////////////////////////////////////////////////////////////
+buffer_type make_buffer(std::size_t capacity)
+{
+    buffer_type buffer;
+    buffer.reserve(capacity);
+    return buffer;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_disabled()
+{
+    parcel_buffer_pool pool;
+
+    buffer_type buffer = pool.get(1000);
+    HPX_TEST(buffer.empty());
+    HPX_TEST_LTE(std::size_t(1000), buffer.capacity());
+
+    // nothing is retained
+    pool.release(std::move(buffer));
+    HPX_TEST_EQ(pool.get_bytes_retained(), std::int64_t(0));
+
+    buffer = pool.get(1000);
+    HPX_TEST_EQ(pool.get_hits(false), std::int64_t(0));
+    HPX_TEST_EQ(pool.get_misses(false), std::int64_t(2));
+}
+
+void test_hit_and_miss()
+{
+    parcel_buffer_pool pool(1 << 20);
+
+    // the first request allocates the full size of its class
+    buffer_type buffer = pool.get(1000);
+    HPX_TEST_EQ(buffer.capacity(), std::size_t(1024));
+    HPX_TEST_EQ(pool.get_misses(false), std::int64_t(1));
+
+    void const* data = buffer.data();
+    buffer.resize(1000);
+    pool.release(std::move(buffer));
+    HPX_TEST_EQ(pool.get_bytes_retained(), std::int64_t(1024));
+
+    // the buffer is reused for any request of the same class, it is handed
+    // out empty
+    buffer = pool.get(600);
+    HPX_TEST(buffer.empty());
+    HPX_TEST_EQ(static_cast<void const*>(buffer.data()), data);
+    HPX_TEST_EQ(pool.get_hits(false), std::int64_t(1));
+    HPX_TEST_EQ(pool.get_bytes_retained(), std::int64_t(0));
+
+    // the pool is empty again
+    buffer_type other = pool.get(1024);
+    HPX_TEST_NEQ(static_cast<void const*>(other.data()), data);
+    HPX_TEST_EQ(pool.get_misses(false), std::int64_t(2));
+
+    // statistics can be reset
+    HPX_TEST_EQ(pool.get_hits(true), std::int64_t(1));
+    HPX_TEST_EQ(pool.get_misses(true), std::int64_t(2));
+    HPX_TEST_EQ(pool.get_hits(false), std::int64_t(0));
+    HPX_TEST_EQ(pool.get_misses(false), std::int64_t(0));
+}
+
+void test_size_classes()
+{
+    parcel_buffer_pool pool(1 << 20);
+
+    // a released buffer is filed under the largest class it can serve
+    buffer_type buffer = make_buffer(6000);
+    void const* data = buffer.data();
+    pool.release(std::move(buffer));
+    HPX_TEST_EQ(pool.get_bytes_retained(), std::int64_t(6000));
+
+    // requests of other classes don't reuse it
+    buffer = pool.get(8192);
+    HPX_TEST_NEQ(static_cast<void const*>(buffer.data()), data);
+    buffer_type smaller = pool.get(2048);
+    HPX_TEST_NEQ(static_cast<void const*>(smaller.data()), data);
+    HPX_TEST_EQ(pool.get_hits(false), std::int64_t(0));
+    HPX_TEST_EQ(pool.get_misses(false), std::int64_t(2));
+
+    // requests of its class do
+    buffer_type reused = pool.get(4000);
+    HPX_TEST_EQ(static_cast<void const*>(reused.data()), data);
+    HPX_TEST_LTE(std::size_t(4000), reused.capacity());
+    HPX_TEST_EQ(pool.get_hits(false), std::int64_t(1));
+
+    // buffers below the smallest class are not retained
+    pool.release(make_buffer(512));
+    HPX_TEST_EQ(pool.get_bytes_retained(), std::int64_t(0));
+}
+
+void test_reserve()
+{
+    parcel_buffer_pool pool(1 << 20);
+
+    buffer_type buffer = pool.get(1024);
+    void const* data = buffer.data();
+
+    // a sufficient buffer is kept
+    pool.reserve(buffer, 1000);
+    HPX_TEST_EQ(static_cast<void const*>(buffer.data()), data);
+    HPX_TEST_EQ(pool.get_bytes_retained(), std::int64_t(0));
+
+    // a buffer which is too small is handed back and replaced
+    pool.reserve(buffer, 5000);
+    HPX_TEST_LTE(std::size_t(5000), buffer.capacity());
+    HPX_TEST_EQ(pool.get_bytes_retained(), std::int64_t(1024));
+
+    buffer_type reused = pool.get(1000);
+    HPX_TEST_EQ(static_cast<void const*>(reused.data()), data);
+}
+
+void test_limit()
+{
+    parcel_buffer_pool pool(4096);
+
+    pool.release(make_buffer(4096));
+    HPX_TEST_EQ(pool.get_bytes_retained(), std::int64_t(4096));
+
+    // this would exceed the limit
+    pool.release(make_buffer(1024));
+    HPX_TEST_EQ(pool.get_bytes_retained(), std::int64_t(4096));
+
+    buffer_type buffer = pool.get(1024);
+    HPX_TEST_EQ(pool.get_hits(false), std::int64_t(0));
+
+    pool.clear();
+    HPX_TEST_EQ(pool.get_bytes_retained(), std::int64_t(0));
+
+    buffer = pool.get(4096);
+    HPX_TEST_EQ(pool.get_hits(false), std::int64_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_disabled();
+    test_hit_and_miss();
+    test_size_classes();
+    test_reserve();
+    test_limit();
+
+    return hpx::util::report_errors();
+}
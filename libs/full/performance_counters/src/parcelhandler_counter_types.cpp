@@ -590,6 +590,80 @@ namespace hpx::performance_counters {
             sizeof(connection_cache_types) / sizeof(connection_cache_types[0]));
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    void register_buffer_pool_counter_types(
+        parcelset::parcelhandler& ph, std::string const& pp_type)
+    {
+        if (!ph.is_networking_enabled())
+        {
+            return;
+        }
+
+        using hpx::placeholders::_1;
+        using hpx::placeholders::_2;
+
+        using parcelset::parcelhandler;
+        using parcelset::parcelport;
+
+        hpx::function<std::int64_t(bool)> pool_hits(
+            hpx::bind_front(&parcelhandler::get_buffer_pool_statistics, &ph,
+                pp_type, parcelport::buffer_pool_hits));
+        hpx::function<std::int64_t(bool)> pool_misses(
+            hpx::bind_front(&parcelhandler::get_buffer_pool_statistics, &ph,
+                pp_type, parcelport::buffer_pool_misses));
+        hpx::function<std::int64_t(bool)> pool_bytes_retained(
+            hpx::bind_front(&parcelhandler::get_buffer_pool_statistics, &ph,
+                pp_type, parcelport::buffer_pool_bytes_retained));
+
+        performance_counters::generic_counter_type_data const
+            buffer_pool_types[] = {
+                {hpx::util::format(
+                     "/parcelport/count/{}/buffer-pool-hits", pp_type),
+                    performance_counters::counter_type::raw,
+                    hpx::util::format(
+                        "returns the number of message buffers which were "
+                        "taken from the buffer pool of the {} parcelport on "
+                        "the referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(pool_hits), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/count/{}/buffer-pool-misses", pp_type),
+                    performance_counters::counter_type::raw,
+                    hpx::util::format(
+                        "returns the number of message buffers which had to "
+                        "be allocated because the buffer pool of the {} "
+                        "parcelport on the referenced locality had no "
+                        "suitable buffer",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(pool_misses), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/count/{}/buffer-pool-bytes-retained",
+                     pp_type),
+                    performance_counters::counter_type::raw,
+                    hpx::util::format(
+                        "returns the number of bytes currently held by the "
+                        "buffer pool of the {} parcelport on the referenced "
+                        "locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(pool_bytes_retained), _2),
+                    &performance_counters::locality_counter_discoverer,
+                    "bytes"}};
+
+        performance_counters::install_counter_types(buffer_pool_types,
+            sizeof(buffer_pool_types) / sizeof(buffer_pool_types[0]));
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     void register_parcelhandler_counter_types(parcelset::parcelhandler& ph)
     {
@@ -597,6 +671,7 @@ namespace hpx::performance_counters {
         ph.enum_parcelports([&](std::string const& type) -> bool {
             register_parcelhandler_counter_types(ph, type);
             register_connection_cache_counter_types(ph, type);
+            register_buffer_pool_counter_types(ph, type);
             return true;
         });
 
@@ -10,6 +10,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/coroutines/stack_pool.hpp>
 #include <hpx/functional/bind_back.hpp>
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/modules/errors.hpp>
@@ -20,6 +21,7 @@
 #include <hpx/performance_counters/threadmanager_counter_types.hpp>
 #include <hpx/runtime_local/thread_pool_helpers.hpp>
 #include <hpx/schedulers/maintain_queue_wait_times.hpp>
+#include <hpx/threading_base/stack_usage.hpp>
 
 #include <cstddef>
 #include <cstdint>
@@ -323,6 +325,36 @@ namespace hpx::performance_counters::detail {
                                     get_stack_unbind_count),
                 hpx::function<std::uint64_t(bool)>(), "", 0},
 #endif
+            // /threads{locality#%d/total}/count/stack-pool-hits
+            {"count/stack-pool-hits",
+                &threads::coroutines::get_stack_pool_hit_count,
+                hpx::function<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/count/stack-pool-misses
+            {"count/stack-pool-misses",
+                &threads::coroutines::get_stack_pool_miss_count,
+                hpx::function<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/count/stack-pool-slabs
+            {"count/stack-pool-slabs",
+                &threads::coroutines::get_stack_pool_slab_count,
+                hpx::function<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/count/stack-pool-idle
+            {"count/stack-pool-idle",
+                &threads::coroutines::get_stack_pool_idle_count,
+                hpx::function<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/count/stack-pool-resident-bytes
+            {"count/stack-pool-resident-bytes",
+                &threads::coroutines::get_stack_pool_resident_bytes,
+                hpx::function<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/count/stack-size-adaptations
+            {"count/stack-size-adaptations",
+                &threads::get_stack_size_adaptation_count,
+                hpx::function<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/stack-usage/max
+            {"stack-usage/max", &threads::get_stack_usage_max,
+                hpx::function<std::uint64_t(bool)>(), "", 0},
+            // /threads{locality#%d/total}/stack-usage/average
+            {"stack-usage/average", &threads::get_stack_usage_average,
+                hpx::function<std::uint64_t(bool)>(), "", 0},
         };
         std::size_t const data_size = sizeof(data) / sizeof(data[0]);
 
@@ -610,6 +642,52 @@ namespace hpx::performance_counters {
                 HPX_PERFORMANCE_COUNTER_V1, counts_creator,
                 &locality_counter_discoverer, ""},
 #endif
+            {"/threads/count/stack-pool-hits",
+                counter_type::monotonically_increasing,
+                "returns the total number of HPX-thread stack allocations "
+                "served from the stack pool for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, ""},
+            {"/threads/count/stack-pool-misses",
+                counter_type::monotonically_increasing,
+                "returns the total number of HPX-thread stack allocations "
+                "which required mapping a new slab of stacks for the "
+                "referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, ""},
+            {"/threads/count/stack-pool-slabs", counter_type::raw,
+                "returns the current number of stack slabs mapped by the "
+                "stack pool for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, ""},
+            {"/threads/count/stack-pool-idle", counter_type::raw,
+                "returns the current number of idle stacks held by the stack "
+                "pool for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, ""},
+            {"/threads/count/stack-pool-resident-bytes", counter_type::raw,
+                "returns an upper bound of the number of bytes of idle stacks "
+                "held by the stack pool which are backed by physical memory "
+                "for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, "bytes"},
+            {"/threads/count/stack-size-adaptations",
+                counter_type::monotonically_increasing,
+                "returns the total number of HPX-threads which were created "
+                "with a different stack size than requested based on their "
+                "recorded stack usage for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, ""},
+            {"/threads/stack-usage/max", counter_type::raw,
+                "returns the maximal stack usage of all terminated HPX-threads "
+                "for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, "bytes"},
+            {"/threads/stack-usage/average", counter_type::raw,
+                "returns the average stack usage of all terminated "
+                "HPX-threads for the referenced locality",
+                HPX_PERFORMANCE_COUNTER_V1, counts_creator,
+                &locality_counter_discoverer, "bytes"},
 #endif
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
             {"/threads/count/pending-misses",
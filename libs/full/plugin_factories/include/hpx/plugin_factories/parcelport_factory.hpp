@@ -123,6 +123,18 @@ namespace hpx::plugins {
                 name_uc +
                 "_ASYNC_SERIALIZATION:"
                 "$[hpx.parcel.async_serialization]}");
+            fillini.emplace_back("buffer_pool_size = ${HPX_PARCEL_" + name_uc +
+                "_BUFFER_POOL_SIZE:$[hpx.parcel.buffer_pool_size]}");
+            fillini.emplace_back("buffer_pool_huge_pages = ${HPX_PARCEL_" +
+                name_uc +
+                "_BUFFER_POOL_HUGE_PAGES:"
+                "$[hpx.parcel.buffer_pool_huge_pages]}");
+            fillini.emplace_back("priority_lanes = ${HPX_PARCEL_" + name_uc +
+                "_PRIORITY_LANES:$[hpx.parcel.priority_lanes]}");
+            fillini.emplace_back("bulk_message_size = ${HPX_PARCEL_" +
+                name_uc +
+                "_BULK_MESSAGE_SIZE:"
+                "$[hpx.parcel.bulk_message_size]}");
             fillini.emplace_back("priority = ${HPX_PARCEL_" + name_uc +
                 "_PRIORITY:" +
                 traits::plugin_config_data<Parcelport>::priority() + "}");
@@ -0,0 +1,118 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Exhausting the credits of an id_type makes AGAS hand out additional credits
+// which are kept locally to serve later increments. Make sure that these
+// pooled credits do not keep an object alive once its last reference went out
+// of scope, without explicitly invoking the garbage collection.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "components/managed_refcnt_checker.hpp"
+
+using hpx::program_options::options_description;
+using hpx::program_options::value;
+using hpx::program_options::variables_map;
+
+using hpx::id_type;
+using hpx::naming::detail::split_gid_if_needed;
+
+using std::chrono::milliseconds;
+
+///////////////////////////////////////////////////////////////////////////////
+inline id_type split_credits(id_type const& id)
+{
+    return id_type(split_gid_if_needed(const_cast<id_type&>(id).get_gid()).get(),
+        id_type::management_type::managed);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_credit_pool(std::size_t splits, std::uint64_t delay)
+{
+    hpx::distributed::promise<void> flag_promise;
+    hpx::future<void> flag = flag_promise.get_future();
+
+    {
+        id_type object =
+            hpx::new_<hpx::test::server::managed_refcnt_checker>(
+                hpx::find_here(), flag_promise.get_id())
+                .get();
+
+        // Exhaust the credits of the id several times. Every exhaustion
+        // increments the reference count, which is served from the pooled
+        // credits after the first one.
+        std::vector<id_type> ids;
+        ids.reserve(splits);
+        for (std::size_t i = 0; i != splits; ++i)
+        {
+            ids.push_back(split_credits(object));
+        }
+
+        // The references are still being held, let the pooled credits expire
+        // in the meantime.
+        hpx::this_thread::sleep_for(milliseconds(delay));
+        HPX_TEST(!flag.is_ready());
+
+        // let all references go out of scope
+    }
+
+    // The pooled credits have to be returned without explicit garbage
+    // collection for the object to be destroyed.
+    HPX_TEST(flag.wait_for(milliseconds(10 * delay)) ==
+        hpx::future_status::ready);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(variables_map& vm)
+{
+    std::uint64_t const delay = vm["delay"].as<std::uint64_t>();
+
+    // a few splits which do not exhaust the credits
+    test_credit_pool(8, delay);
+
+    // exhaust the credits repeatedly
+    test_credit_pool(vm["splits"].as<std::size_t>(), delay);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    cmdline.add_options()("delay", value<std::uint64_t>()->default_value(500),
+        "number of milliseconds to wait for object destruction")("splits",
+        value<std::size_t>()->default_value(1000),
+        "number of times the credits of the object are split");
+
+    // We need to explicitly enable the test component used by this test. Let
+    // the pooled credits expire quickly.
+    std::vector<std::string> const cfg = {
+        "hpx.components.managed_refcnt_checker.enabled! = 1",
+        "hpx.agas.refcnt_flush_interval! = 1000",
+        "hpx.agas.refcnt_credit_lifetime! = 10000"};
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,188 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// find_all_from_basename and find_from_basename wait for more than one name
+// using a single symbol namespace listener per instance. Make sure that
+// unrelated names below the same basename don't trigger the listener, that
+// names unbound before the listener triggers are waited for separately, and
+// that the credits handed out by the listener are balanced.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "components/managed_refcnt_checker.hpp"
+
+using hpx::program_options::options_description;
+using hpx::program_options::value;
+using hpx::program_options::variables_map;
+
+using hpx::test::managed_refcnt_monitor;
+
+using std::chrono::milliseconds;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_partial_match()
+{
+    char const* basename = "/find_from_basename_prefix_test/partial/";
+
+    managed_refcnt_monitor m0(hpx::find_here());
+    managed_refcnt_monitor m1(hpx::find_here());
+    managed_refcnt_monitor m5(hpx::find_here());
+
+    HPX_TEST(hpx::register_with_basename(basename, m0.get_id(), 0).get());
+
+    // names below the same basename which were not asked for
+    HPX_TEST(hpx::register_with_basename(basename, m5.get_id(), 5).get());
+    HPX_TEST(hpx::register_with_basename(basename, m5.get_id(), 7).get());
+
+    std::vector<hpx::future<hpx::id_type>> ids =
+        hpx::find_from_basename(basename, std::vector<std::size_t>{0, 1});
+    HPX_TEST_EQ(ids.size(), std::size_t(2));
+
+    // the unrelated names must not trigger the listener
+    hpx::this_thread::sleep_for(milliseconds(100));
+    HPX_TEST(!ids[0].is_ready());
+    HPX_TEST(!ids[1].is_ready());
+
+    HPX_TEST(hpx::register_with_basename(basename, m1.get_id(), 1).get());
+
+    HPX_TEST_EQ(ids[0].get(), m0.get_id());
+    HPX_TEST_EQ(ids[1].get(), m1.get_id());
+
+    for (std::size_t const i : std::vector<std::size_t>{0, 1, 5, 7})
+    {
+        HPX_TEST_NEQ(
+            hpx::unregister_with_basename(basename, i).get(), hpx::invalid_id);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_unbound_before_trigger()
+{
+    char const* basename = "/find_from_basename_prefix_test/fallback/";
+
+    managed_refcnt_monitor m0(hpx::find_here());
+    managed_refcnt_monitor m1(hpx::find_here());
+
+    std::vector<hpx::future<hpx::id_type>> ids =
+        hpx::find_all_from_basename(basename, 2);
+    HPX_TEST_EQ(ids.size(), std::size_t(2));
+
+    // the first name is counted by the listener, but it is gone once the
+    // listener triggers
+    HPX_TEST(hpx::register_with_basename(basename, m0.get_id(), 0).get());
+    HPX_TEST_EQ(
+        hpx::unregister_with_basename(basename, 0).get(), m0.get_id());
+
+    HPX_TEST(hpx::register_with_basename(basename, m1.get_id(), 1).get());
+    HPX_TEST_EQ(ids[1].get(), m1.get_id());
+
+    // the missing name is waited for separately
+    hpx::this_thread::sleep_for(milliseconds(100));
+    HPX_TEST(!ids[0].is_ready());
+
+    HPX_TEST(hpx::register_with_basename(basename, m1.get_id(), 0).get());
+    HPX_TEST_EQ(ids[0].get(), m1.get_id());
+
+    for (std::size_t const i : std::vector<std::size_t>{0, 1})
+    {
+        HPX_TEST_NEQ(
+            hpx::unregister_with_basename(basename, i).get(), hpx::invalid_id);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_credit_balance(std::uint64_t delay)
+{
+    char const* basename = "/find_from_basename_prefix_test/credits/";
+
+    managed_refcnt_monitor m0(hpx::find_here());
+    managed_refcnt_monitor m1(hpx::find_here());
+
+    HPX_TEST(hpx::register_with_basename(basename, m0.get_id(), 0).get());
+    HPX_TEST(hpx::register_with_basename(basename, m1.get_id(), 1).get());
+
+    {
+        // the listener triggers right away and splits the credits of both
+        // names
+        std::vector<hpx::future<hpx::id_type>> ids =
+            hpx::find_all_from_basename(basename, 2);
+
+        HPX_TEST_EQ(ids[0].get(), m0.get_id());
+        HPX_TEST_EQ(ids[1].get(), m1.get_id());
+
+        // let the ids go out of scope
+    }
+
+    {
+        // Detach the references held by the monitors.
+        hpx::id_type id0 = m0.detach().get();
+        hpx::id_type id1 = m1.detach().get();
+    }
+
+    // The components should still be alive, as the symbolic bindings hold a
+    // reference to them.
+    HPX_TEST(!m0.is_ready(milliseconds(delay)));
+    HPX_TEST(!m1.is_ready(milliseconds(delay)));
+
+    // Remove the symbolic names. This should return the final credits to
+    // AGAS.
+    for (std::size_t const i : std::vector<std::size_t>{0, 1})
+    {
+        HPX_TEST_NEQ(
+            hpx::unregister_with_basename(basename, i).get(), hpx::invalid_id);
+    }
+
+    // Flush pending reference counting operations.
+    hpx::agas::garbage_collect();
+    hpx::agas::garbage_collect();
+
+    // The components should be destroyed.
+    HPX_TEST(m0.is_ready(milliseconds(delay)));
+    HPX_TEST(m1.is_ready(milliseconds(delay)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(variables_map& vm)
+{
+    test_partial_match();
+    test_unbound_before_trigger();
+    test_credit_balance(vm["delay"].as<std::uint64_t>());
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    cmdline.add_options()("delay", value<std::uint64_t>()->default_value(500),
+        "number of milliseconds to wait for object destruction");
+
+    // We need to explicitly enable the test component used by this test.
+    std::vector<std::string> const cfg = {
+        "hpx.components.managed_refcnt_checker.enabled! = 1"};
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,195 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The primary namespace partitions the bindings of single ids into shards,
+// consecutive ids are assigned to different shards. Bind, resolve and unbind
+// blocks of consecutive ids (covering all shards), also mixed with bindings
+// of ranges of ids, and do so from many threads on all localities at the same
+// time. The ids are resolved bypassing the local AGAS cache.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <hpx/agas/addressing_service.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using hpx::program_options::options_description;
+using hpx::program_options::value;
+using hpx::program_options::variables_map;
+
+using hpx::naming::address;
+using hpx::naming::gid_type;
+
+///////////////////////////////////////////////////////////////////////////////
+// the bound addresses are never dereferenced
+address make_address(std::uint64_t lva)
+{
+    return address(hpx::agas::get_locality(),
+        hpx::components::component_base_lco_with_value,
+        reinterpret_cast<void*>(static_cast<std::uintptr_t>(lva)));
+}
+
+bool resolve(gid_type const& id, address& addr)
+{
+    addr = address();
+    return hpx::naming::get_agas_client().resolve_full_local(id, addr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_bind_resolve_unbind(std::size_t count)
+{
+    gid_type const base = hpx::agas::get_next_id(count);
+    std::uint32_t const locality_id = hpx::get_locality_id();
+
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST(hpx::agas::bind(hpx::launch::sync, base + i,
+            make_address(0x10000 + 16 * i), locality_id));
+    }
+
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        address addr;
+        HPX_TEST(resolve(base + i, addr));
+        HPX_TEST(addr == make_address(0x10000 + 16 * i));
+    }
+
+    // unbinding returns the bound address, the id can't be resolved anymore
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        address const addr = hpx::agas::unbind(hpx::launch::sync, base + i);
+        HPX_TEST(addr == make_address(0x10000 + 16 * i));
+    }
+
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        address addr;
+        HPX_TEST(!resolve(base + i, addr));
+    }
+}
+
+// The ids of a range are resolved through the range bindings, which are kept
+// separately from the shards. The single ids following the range are bound in
+// the shards.
+void test_ranges(std::size_t range_count, std::size_t count)
+{
+    gid_type const base = hpx::agas::get_next_id(range_count + count);
+    std::uint32_t const locality_id = hpx::get_locality_id();
+
+    HPX_TEST(hpx::agas::bind_range_local(
+        base, range_count, make_address(0x20000), 8));
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST(hpx::agas::bind(hpx::launch::sync, base + range_count + i,
+            make_address(0x30000 + 16 * i), locality_id));
+    }
+
+    for (std::size_t i = 0; i != range_count; ++i)
+    {
+        address addr;
+        HPX_TEST(resolve(base + i, addr));
+        HPX_TEST(addr == make_address(0x20000 + 8 * i));
+    }
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        address addr;
+        HPX_TEST(resolve(base + range_count + i, addr));
+        HPX_TEST(addr == make_address(0x30000 + 16 * i));
+    }
+
+    hpx::agas::unbind_range_local(base, range_count);
+    for (std::size_t i = 0; i != range_count; ++i)
+    {
+        address addr;
+        HPX_TEST(!resolve(base + i, addr));
+    }
+
+    // unbinding the range didn't affect the single ids
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        address addr;
+        HPX_TEST(resolve(base + range_count + i, addr));
+
+        addr = hpx::agas::unbind(hpx::launch::sync, base + range_count + i);
+        HPX_TEST(addr == make_address(0x30000 + 16 * i));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent(std::size_t num_tasks, std::size_t count)
+{
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(2 * num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async(&test_bind_resolve_unbind, count));
+        tasks.push_back(hpx::async(&test_ranges, count, count));
+    }
+
+    hpx::wait_all(tasks);
+    for (hpx::future<void>& f : tasks)
+    {
+        HPX_TEST(!f.has_exception());
+    }
+}
+HPX_PLAIN_ACTION(test_concurrent)
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(variables_map& vm)
+{
+    std::size_t const count = vm["count"].as<std::size_t>();
+    std::size_t const num_tasks = vm["tasks"].as<std::size_t>();
+
+    test_bind_resolve_unbind(count);
+    test_ranges(count, count);
+
+    // all localities at the same time
+    std::vector<hpx::future<void>> localities;
+    for (hpx::id_type const& id : hpx::find_all_localities())
+    {
+        localities.push_back(
+            hpx::async(test_concurrent_action(), id, num_tasks, count));
+    }
+
+    hpx::wait_all(localities);
+    for (hpx::future<void>& f : localities)
+    {
+        HPX_TEST(!f.has_exception());
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("count", value<std::size_t>()->default_value(256),
+         "the number of consecutive ids bound by each test")
+        ("tasks", value<std::size_t>()->default_value(8),
+         "the number of concurrent tasks on each locality")
+        ;
+    // clang-format on
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -258,7 +258,8 @@ namespace hpx { namespace agas {
             [this, dest](
                 parcelset::parcel&& p, parcelset::write_handler_type&&) {
                 pp->send_early_parcel(dest, HPX_MOVE(p));
-            });
+            },
+            pp->get_zero_copy_serialization_threshold());
     }    // }}}
 
     template <typename Action, typename... Args>
@@ -146,7 +146,7 @@ namespace hpx {
 #endif
 
             if (0 == num_thread)
-                hpx::agas::garbage_collect_non_blocking();
+                naming::get_agas_client().garbage_collect_periodic();
             return result;
         }
 #else
@@ -163,7 +163,7 @@ namespace hpx {
 #endif
 
             if (0 == num_thread)
-                hpx::agas::garbage_collect_non_blocking();
+                naming::get_agas_client().garbage_collect_periodic();
             return result;
         }
 #endif
@@ -14,8 +14,10 @@
 #include <hpx/hpx.hpp>
 #include <hpx/hpx_init.hpp>
 
+#include <hpx/agas/detail/gva_cache.hpp>
 #include <hpx/cache/entries/lfu_entry.hpp>
 #include <hpx/cache/local_cache.hpp>
+#include <hpx/cache/lru_cache.hpp>
 #include <hpx/cache/statistics/local_full_statistics.hpp>
 #include <hpx/modules/testing.hpp>
 #include <hpx/preprocessor/stringize.hpp>
@@ -30,6 +32,7 @@
 #include <iomanip>
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -230,6 +233,115 @@ void test_update(gva_cache_type& cache, hpx::naming::gid_type first_key)
     calculate_histogram("update", timings);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Compare concurrent lookups in a cache protected by a single lock (as used
+// by AGAS before) with the sharded cache used by AGAS now.
+typedef hpx::util::cache::lru_cache<gva_cache_key, hpx::agas::gva,
+    hpx::util::cache::statistics::local_full_statistics>
+    locked_gva_cache_type;
+
+template <typename Lookup>
+double measure_lookups(std::vector<hpx::naming::gid_type> const& ids,
+    std::size_t num_threads, std::size_t num_lookups, Lookup const& lookup)
+{
+    hpx::execution::parallel_executor exec(
+        hpx::threads::thread_priority::bound);
+
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(num_threads);
+
+    hpx::chrono::high_resolution_timer t;
+
+    for (std::size_t worker = 0; worker != num_threads; ++worker)
+    {
+        hpx::threads::thread_schedule_hint hint(
+            hpx::threads::thread_schedule_hint_mode::thread,
+            static_cast<std::int16_t>(worker));
+
+        futures.push_back(
+            hpx::async(hpx::execution::experimental::with_hint(exec, hint),
+                [&ids, &lookup, worker, num_lookups]() {
+                    // spread the lookups of all threads over all entries
+                    for (std::size_t i = 0; i != num_lookups; ++i)
+                    {
+                        lookup(ids[(worker * 7919 + i) % ids.size()]);
+                    }
+                }));
+    }
+
+    hpx::wait_all(futures);
+
+    // lookups per second
+    return double(num_threads * num_lookups) / t.elapsed();
+}
+
+void test_scaling(
+    std::size_t cache_size, std::size_t num_entries, std::size_t num_lookups)
+{
+    hpx::naming::gid_type locality = hpx::get_locality();
+    std::int32_t ct = hpx::components::component_invalid;
+
+    hpx::spinlock mtx;
+    locked_gva_cache_type locked_cache;
+    locked_cache.reserve(cache_size);
+
+    hpx::agas::detail::gva_cache sharded_cache;
+    sharded_cache.reserve(cache_size);
+
+    std::vector<hpx::naming::gid_type> ids;
+    ids.reserve(num_entries);
+
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        hpx::naming::gid_type id = hpx::detail::get_next_id();
+        hpx::agas::gva value(locality, ct, 1, std::uint64_t(0), 0);
+
+        locked_cache.insert(gva_cache_key(id, 1), value);
+        sharded_cache.insert(hpx::agas::detail::gva_cache_key(id, 1), value);
+
+        ids.push_back(id);
+    }
+
+    auto locked_lookup = [&](hpx::naming::gid_type const& id) {
+        gva_cache_key key(id, 1);
+        gva_cache_key idbase;
+        hpx::agas::gva e;
+
+        std::lock_guard<hpx::spinlock> l(mtx);
+        locked_cache.get_entry(key, idbase, e);
+    };
+
+    auto sharded_lookup = [&](hpx::naming::gid_type const& id) {
+        hpx::agas::detail::gva_cache_key key(id, 1);
+        hpx::agas::detail::gva_cache_key idbase;
+        hpx::agas::gva e;
+
+        sharded_cache.get_entry(key, idbase, e);
+    };
+
+    std::cout << "lookups/s (" << sharded_cache.num_shards()
+              << " shards):\n"
+              << "threads,  locked, sharded\n";
+
+    std::size_t const max_threads = hpx::get_num_worker_threads();
+    for (std::size_t num_threads = 1; num_threads <= max_threads;
+         num_threads *= 2)
+    {
+        double const locked =
+            measure_lookups(ids, num_threads, num_lookups, locked_lookup);
+        double const sharded =
+            measure_lookups(ids, num_threads, num_lookups, sharded_lookup);
+
+        std::cout << std::setw(7) << num_threads << ", " << std::scientific
+                  << std::setprecision(3) << locked << ", " << sharded
+                  << std::defaultfloat << std::endl;
+
+        // always include the maximal number of threads
+        if (num_threads < max_threads && 2 * num_threads > max_threads)
+            num_threads = max_threads / 2;
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -241,6 +353,10 @@ int hpx_main(hpx::program_options::variables_map& vm)
     if (vm.count("num_entries"))
         num_entries = vm["num_entries"].as<std::size_t>();
 
+    std::size_t num_lookups = 100000;
+    if (vm.count("num_lookups"))
+        num_lookups = vm["num_lookups"].as<std::size_t>();
+
     gva_cache_type cache;
     cache.reserve(cache_size);
 
@@ -255,6 +371,8 @@ int hpx_main(hpx::program_options::variables_map& vm)
     double elapsed = t1.elapsed();
     hpx::util::print_cdash_timing("AGASCache", elapsed);
 
+    test_scaling(cache_size, num_entries, num_lookups);
+
     return hpx::finalize();
 }
 
@@ -268,7 +386,9 @@ int main(int argc, char* argv[])
         "initial cache size (default: " HPX_PP_STRINGIZE(
             HPX_AGAS_LOCAL_CACHE_SIZE_PER_THREAD) ")")("num_entries,n",
         value<std::size_t>(),
-        "number of items to insert into cache (default: 1000)");
+        "number of items to insert into cache (default: 1000)")(
+        "num_lookups", value<std::size_t>(),
+        "number of concurrent lookups per thread (default: 100000)");
 
     // Initialize and run HPX
     hpx::init_params init_args;
@@ -312,6 +312,49 @@ void measure_function_futures_for_loop(std::uint64_t count, bool csv,
         executor_name ? executor_name : exec_name(exec), count, duration, csv);
 }
 
+// Time attaching continuations, each continuation is run synchronously by
+// the thread making its predecessor ready
+void measure_function_futures_then_chain(std::uint64_t count, bool csv)
+{
+    hpx::promise<double> p;
+
+    // start the clock
+    high_resolution_timer walltime;
+    future<double> f = p.get_future();
+    for (std::uint64_t i = 0; i < count; ++i)
+    {
+        f = f.then(hpx::launch::sync,
+            [](future<double>&& r) { return r.get() + null_function(); });
+    }
+    p.set_value(0.0);
+    global_scratch += f.get();
+
+    // stop the clock
+    const double duration = walltime.elapsed();
+    print_stats("then", "chain", "launch::sync", count, duration, csv);
+}
+
+// Time attaching continuations to ready futures, each continuation is run
+// as a new HPX thread
+void measure_function_futures_then_async(std::uint64_t count, bool csv)
+{
+    std::vector<future<double>> futures;
+    futures.reserve(count);
+
+    // start the clock
+    high_resolution_timer walltime;
+    for (std::uint64_t i = 0; i < count; ++i)
+    {
+        futures.push_back(hpx::make_ready_future(0.0).then(hpx::launch::async,
+            [](future<double>&& r) { return r.get() + null_function(); }));
+    }
+    hpx::wait_all(futures);
+
+    // stop the clock
+    const double duration = walltime.elapsed();
+    print_stats("then", "WaitAll", "launch::async", count, duration, csv);
+}
+
 void measure_function_futures_register_work(std::uint64_t count, bool csv)
 {
     hpx::latch l(count);
@@ -531,6 +574,8 @@ int hpx_main(variables_map& vm)
                 measure_function_futures_for_loop(count, csv, sched_exec_tps);
                 measure_function_futures_for_loop(
                     count, csv, par_nostack, "parallel_executor_nostack");
+                measure_function_futures_then_chain(count, csv);
+                measure_function_futures_then_async(count, csv);
                 measure_function_futures_register_work(count, csv);
                 measure_function_futures_create_thread(count, csv);
                 measure_function_futures_apply_hierarchical_placement(
@@ -0,0 +1,328 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Merges the parcel traces written by the localities of an application (see
+// hpx.parcel.trace) and reports, per action, how long the parcels spent in
+// each phase of their life: waiting for a connection, being serialized, on
+// the wire, and being decoded and scheduled on the receiving locality.
+//
+// Time stamps recorded on different localities are aligned using the system
+// clock, the durations of phases spanning two localities (wire) are only as
+// accurate as the clocks of the involved nodes are synchronized.
+
+#include <hpx/parcelset_base/parcel_trace.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+using hpx::parcelset::parcel_trace_event;
+
+static constexpr std::size_t num_events =
+    static_cast<std::size_t>(parcel_trace_event::num_events);
+
+struct parcel_timeline
+{
+    std::string const* action = nullptr;
+    std::uint32_t size = 0;
+
+    // wall clock time stamps (nanoseconds), zero if not recorded
+    std::array<std::int64_t, num_events> times = {};
+};
+
+// parcels are identified by their originating locality and their id
+using parcel_key = std::pair<std::uint32_t, std::uint64_t>;
+
+static std::set<std::string> s_action_names;
+static std::map<parcel_key, parcel_timeline> s_parcels;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+static bool read_value(std::istream& in, T& value)
+{
+    return static_cast<bool>(
+        in.read(reinterpret_cast<char*>(&value), sizeof(value)));
+}
+
+static bool read_trace(std::string const& filename)
+{
+    std::ifstream in(filename, std::ios::in | std::ios::binary);
+    if (!in)
+    {
+        std::cerr << "parcel_trace: could not open " << filename << "\n";
+        return false;
+    }
+
+    hpx::parcelset::parcel_trace_file_header header;
+    if (!read_value(in, header) ||
+        std::memcmp(header.magic_, hpx::parcelset::parcel_trace_magic,
+            sizeof(header.magic_)) != 0)
+    {
+        std::cerr << "parcel_trace: " << filename
+                  << " is not a parcel trace file\n";
+        return false;
+    }
+
+    if (header.version_ != hpx::parcelset::parcel_trace_version)
+    {
+        std::cerr << "parcel_trace: " << filename
+                  << " has an unsupported version (" << header.version_
+                  << ")\n";
+        return false;
+    }
+
+    std::vector<std::string const*> actions;
+    actions.reserve(header.num_actions_);
+    for (std::uint32_t i = 0; i != header.num_actions_; ++i)
+    {
+        std::uint32_t size = 0;
+        std::string name;
+        if (read_value(in, size))
+        {
+            name.resize(size);
+            in.read(name.data(), size);
+        }
+        if (!in)
+        {
+            std::cerr << "parcel_trace: " << filename << " is truncated\n";
+            return false;
+        }
+        actions.push_back(&*s_action_names.insert(std::move(name)).first);
+    }
+
+    // align the time stamps with the system clock
+    std::int64_t const offset = header.system_time_ - header.steady_time_;
+
+    for (std::uint64_t i = 0; i != header.num_records_; ++i)
+    {
+        hpx::parcelset::parcel_trace_record r;
+        if (!read_value(in, r))
+        {
+            std::cerr << "parcel_trace: " << filename << " is truncated\n";
+            return false;
+        }
+
+        auto const event = static_cast<std::size_t>(r.event_);
+        if (event >= num_events || r.action_ >= actions.size())
+            continue;
+
+        parcel_timeline& p = s_parcels[parcel_key(r.origin_, r.parcel_id_)];
+        p.action = actions[r.action_];
+        p.size = (std::max)(p.size, r.size_);
+
+        // a parcel may pass a point more than once (if it is routed), keep
+        // the earliest time
+        std::int64_t const time = r.timestamp_ + offset;
+        if (p.times[event] == 0 || time < p.times[event])
+            p.times[event] = time;
+    }
+
+    if (header.num_dropped_ != 0)
+    {
+        std::cerr << "parcel_trace: " << filename << ": "
+                  << header.num_dropped_
+                  << " records were dropped, consider increasing "
+                     "hpx.parcel.trace_buffer_size\n";
+    }
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+struct phase
+{
+    char const* name;
+    parcel_trace_event from;
+    parcel_trace_event to;
+};
+
+static constexpr phase s_phases[] = {
+    {"queue", parcel_trace_event::enqueue,
+        parcel_trace_event::connection_acquired},
+    {"serialize", parcel_trace_event::serialize_begin,
+        parcel_trace_event::serialize_end},
+    {"send", parcel_trace_event::send, parcel_trace_event::send_complete},
+    {"wire", parcel_trace_event::send, parcel_trace_event::receive},
+    {"wait", parcel_trace_event::receive, parcel_trace_event::decode_begin},
+    {"decode", parcel_trace_event::decode_begin,
+        parcel_trace_event::decode_end},
+    {"schedule", parcel_trace_event::decode_end,
+        parcel_trace_event::action_scheduled},
+    {"total", parcel_trace_event::enqueue,
+        parcel_trace_event::action_scheduled},
+};
+
+static constexpr std::size_t num_phases = std::size(s_phases);
+
+static bool get_duration(parcel_timeline const& p, phase const& ph, double& us)
+{
+    std::int64_t const from = p.times[static_cast<std::size_t>(ph.from)];
+    std::int64_t const to = p.times[static_cast<std::size_t>(ph.to)];
+    if (from == 0 || to == 0)
+        return false;
+
+    us = static_cast<double>(to - from) / 1000.0;
+    return true;
+}
+
+static double percentile(std::vector<double> const& sorted, double pct)
+{
+    // nearest rank
+    auto const rank = static_cast<std::size_t>(
+        std::ceil(pct / 100.0 * static_cast<double>(sorted.size())));
+    return sorted[rank == 0 ? 0 : rank - 1];
+}
+
+static void print_summary()
+{
+    // durations (microseconds) per action and phase
+    std::map<std::string, std::array<std::vector<double>, num_phases>> data;
+    std::map<std::string, std::size_t> counts;
+
+    for (auto const& [key, p] : s_parcels)
+    {
+        auto& durations = data[*p.action];
+        ++counts[*p.action];
+
+        for (std::size_t i = 0; i != num_phases; ++i)
+        {
+            double us = 0;
+            if (get_duration(p, s_phases[i], us))
+                durations[i].push_back(us);
+        }
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+    for (auto& [action, durations] : data)
+    {
+        std::cout << action << " (" << counts[action] << " parcels)\n";
+        std::cout << "  " << std::left << std::setw(10) << "phase"
+                  << std::right << std::setw(10) << "count" << std::setw(14)
+                  << "mean[us]" << std::setw(14) << "p50[us]"
+                  << std::setw(14) << "p90[us]" << std::setw(14)
+                  << "p99[us]" << std::setw(14) << "max[us]"
+                  << "\n";
+
+        for (std::size_t i = 0; i != num_phases; ++i)
+        {
+            std::vector<double>& d = durations[i];
+            if (d.empty())
+                continue;
+
+            std::sort(d.begin(), d.end());
+
+            double sum = 0;
+            for (double us : d)
+                sum += us;
+
+            std::cout << "  " << std::left << std::setw(10)
+                      << s_phases[i].name << std::right << std::setw(10)
+                      << d.size() << std::setw(14)
+                      << sum / static_cast<double>(d.size()) << std::setw(14)
+                      << percentile(d, 50) << std::setw(14)
+                      << percentile(d, 90) << std::setw(14)
+                      << percentile(d, 99) << std::setw(14) << d.back()
+                      << "\n";
+        }
+        std::cout << "\n";
+    }
+}
+
+static void print_csv()
+{
+    std::cout << "origin,parcel_id,action,size";
+    for (phase const& ph : s_phases)
+        std::cout << "," << ph.name << "[us]";
+    std::cout << "\n";
+
+    std::cout << std::fixed << std::setprecision(3);
+    for (auto const& [key, p] : s_parcels)
+    {
+        std::cout << key.first << "," << key.second << "," << *p.action
+                  << "," << p.size;
+        for (phase const& ph : s_phases)
+        {
+            std::cout << ",";
+            double us = 0;
+            if (get_duration(p, ph, us))
+                std::cout << us;
+        }
+        std::cout << "\n";
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+static void print_usage()
+{
+    std::cout
+        << "Usage: parcel_trace [--csv] <trace file>...\n\n"
+           "Merges the parcel traces written by all localities (see\n"
+           "hpx.parcel.trace) and reports the time parcels spent in each\n"
+           "phase per action:\n\n"
+           "  queue      until a connection to the destination was acquired\n"
+           "  serialize  serializing the parcel\n"
+           "  send       writing the message holding the parcel\n"
+           "  wire       until the message was received\n"
+           "  wait       until decoding the message started\n"
+           "  decode     decoding the parcel\n"
+           "  schedule   until its action was scheduled\n"
+           "  total      from being handed to the parcel layer until its\n"
+           "             action was scheduled\n\n"
+           "  --csv      print the phases of each parcel instead\n";
+}
+
+int main(int argc, char* argv[])
+{
+    bool csv = false;
+    std::vector<std::string> files;
+    for (int i = 1; i != argc; ++i)
+    {
+        std::string const arg = argv[i];
+        if (arg == "--csv")
+        {
+            csv = true;
+        }
+        else if (arg == "--help" || arg == "-h")
+        {
+            print_usage();
+            return EXIT_SUCCESS;
+        }
+        else
+        {
+            files.push_back(arg);
+        }
+    }
+
+    if (files.empty())
+    {
+        print_usage();
+        return EXIT_FAILURE;
+    }
+
+    for (std::string const& file : files)
+    {
+        if (!read_trace(file))
+            return EXIT_FAILURE;
+    }
+
+    if (csv)
+        print_csv();
+    else
+        print_summary();
+
+    return EXIT_SUCCESS;
+}